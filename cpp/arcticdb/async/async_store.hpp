@@ -9,6 +9,7 @@
 #pragma once
 
 #include <arcticdb/async/task_scheduler.hpp>
+#include <arcticdb/async/memory_budget.hpp>
 #include <arcticdb/util/clock.hpp>
 #include <arcticdb/storage/store.hpp>
 #include <arcticdb/storage/library.hpp>
@@ -37,6 +38,14 @@ auto read_and_continue(
     return async::submit_io_task(ReadCompressedTask{key, library, opts, std::forward<decltype(c)>(c)})
             .thenValueInline([](auto&& result) mutable {
                 auto&& [key_seg_fut, continuation] = std::forward<decltype(result)>(result);
+                // With the work stealing CPU pool the continuation, usually a decode, runs on its workers rather than
+                // inline on the IO thread that read the key, so that a pinned worker first-touches the decoded pages
+                if (auto* work_stealing_exec = TaskScheduler::instance()->work_stealing_exec()) {
+                    return std::move(key_seg_fut)
+                            .via(work_stealing_exec)
+                            .thenValue([continuation = std::move(continuation)](storage::KeySegmentPair&& key_seg
+                                       ) mutable { return continuation(std::move(key_seg)); });
+                }
                 return std::move(key_seg_fut)
                         .thenValueInline([continuation = std::move(continuation)](storage::KeySegmentPair&& key_seg
                                          ) mutable { return continuation(std::move(key_seg)); });
@@ -437,11 +446,35 @@ class AsyncStore : public Store {
         util::check(
                 !keys_and_continuations.empty(), "Unexpected empty keys/continuation vector in batch_read_compressed"
         );
+        util::check(
+                args.estimated_bytes_.empty() || args.estimated_bytes_.size() == keys_and_continuations.size(),
+                "Mismatched key count {} and size estimate count {} in batch_read_compressed",
+                keys_and_continuations.size(),
+                args.estimated_bytes_.size()
+        );
+        auto budget = args.estimated_bytes_.empty() ? std::shared_ptr<MemoryBudget>{} : MemoryBudget::instance();
+        storage::ReadKeyOpts opts;
+        opts.columns_ = args.columns_;
+        std::vector<std::tuple<entity::VariantKey, ReadContinuation, uint64_t>> reads;
+        reads.reserve(keys_and_continuations.size());
+        for (size_t idx = 0; idx < keys_and_continuations.size(); ++idx) {
+            reads.emplace_back(
+                    std::move(keys_and_continuations[idx].first),
+                    std::move(keys_and_continuations[idx].second),
+                    args.estimated_bytes_.empty() ? 0 : args.estimated_bytes_[idx]
+            );
+        }
         return folly::window(
-                std::move(keys_and_continuations),
-                [this](auto&& key_and_continuation) {
-                    auto [key, continuation] = std::forward<decltype(key_and_continuation)>(key_and_continuation);
-                    return read_and_continue(key, library_, storage::ReadKeyOpts{}, std::move(continuation));
+                std::move(reads),
+                [this, budget, opts](auto&& read) {
+                    auto [key, continuation, bytes] = std::forward<decltype(read)>(read);
+                    return with_memory_budget(
+                            budget,
+                            bytes,
+                            [this, opts, key = std::move(key), continuation = std::move(continuation)]() mutable {
+                                return read_and_continue(key, library_, opts, std::move(continuation));
+                            }
+                    );
                 },
                 args.batch_size_
         );
@@ -449,21 +482,58 @@ class AsyncStore : public Store {
 
     std::vector<folly::Future<pipelines::SegmentAndSlice>> batch_read_uncompressed(
             std::vector<pipelines::RangesAndKey>&& ranges_and_keys,
-            std::shared_ptr<std::unordered_set<std::string>> columns_to_decode
+            std::shared_ptr<std::unordered_set<std::string>> columns_to_decode,
+            std::shared_ptr<BlockFilter> block_filter
     ) override {
         ARCTICDB_RUNTIME_DEBUG(log::version(), "Reading {} keys", ranges_and_keys.size());
         // Window the reads for reasons detailed in the PR description https://github.com/man-group/ArcticDB/pull/3086
         // x2 IO threadpool size is a balance to keep the IO workers busy, without reading data in faster than we can
         // process it
+        // With a memory budget configured, each read additionally holds a reservation until its decoded segment has
+        // been handed to the processing pipeline
+        // With a decoded segment cache configured, hits skip both the read and the decode, and misses populate it
+        auto decoded_segment_cache = DecodedSegmentCache::instance();
+        if (!decoded_segment_cache->enabled())
+            decoded_segment_cache.reset();
+
         return folly::window(
                 std::move(ranges_and_keys),
-                [this, columns_to_decode](pipelines::RangesAndKey&& ranges_and_key) {
-                    const auto key = ranges_and_key.key_;
-                    return read_and_continue(
-                            key,
-                            library_,
-                            storage::ReadKeyOpts{},
-                            DecodeSliceTask{std::move(ranges_and_key), columns_to_decode}
+                [this, columns_to_decode, block_filter, budget = MemoryBudget::instance(), decoded_segment_cache](
+                        pipelines::RangesAndKey&& ranges_and_key
+                ) -> folly::Future<pipelines::SegmentAndSlice> {
+                    if (decoded_segment_cache) {
+                        if (auto segment = decoded_segment_cache->get(ranges_and_key.key_, columns_to_decode)) {
+                            return folly::makeFuture(
+                                    make_decoded_slice(std::move(ranges_and_key), std::move(*segment))
+                            );
+                        }
+                    }
+                    const auto bytes = estimate_slice_bytes(
+                            ranges_and_key.row_range().diff(), ranges_and_key.col_range().diff()
+                    );
+                    return with_memory_budget(
+                            budget,
+                            bytes,
+                            [this,
+                             columns_to_decode,
+                             decoded_segment_cache,
+                             block_filter,
+                             ranges_and_key = std::move(ranges_and_key)]() mutable {
+                                const auto key = ranges_and_key.key_;
+                                storage::ReadKeyOpts opts;
+                                opts.columns_ = columns_to_decode;
+                                return read_and_continue(
+                                        key,
+                                        library_,
+                                        opts,
+                                        DecodeSliceTask{
+                                                std::move(ranges_and_key),
+                                                columns_to_decode,
+                                                decoded_segment_cache,
+                                                block_filter
+                                        }
+                                );
+                            }
                     );
                 },
                 2 * async::TaskScheduler::instance()->io_thread_count()
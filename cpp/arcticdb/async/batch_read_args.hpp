@@ -10,6 +10,11 @@
 
 #include <arcticdb/util/configs_map.hpp>
 
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 namespace arcticdb {
 struct BatchReadArgs {
     BatchReadArgs() = default;
@@ -17,5 +22,11 @@ struct BatchReadArgs {
     explicit BatchReadArgs(size_t batch_size) : batch_size_(batch_size) {}
 
     size_t batch_size_ = ConfigsMap::instance()->get_int("BatchRead.BatchSize", 200);
+    // Optional, one per key in the same order as the keys. When provided, each read reserves this many bytes from
+    // the MemoryBudget until its continuation has completed.
+    std::vector<uint64_t> estimated_bytes_;
+    // Optional. When provided, only these columns and the index will be decoded from the TABLE_DATA segments read, so
+    // storages that support range reads may skip fetching the others.
+    std::shared_ptr<const std::unordered_set<std::string>> columns_;
 };
 } // namespace arcticdb
\ No newline at end of file
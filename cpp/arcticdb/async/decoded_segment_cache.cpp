@@ -0,0 +1,62 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/async/decoded_segment_cache.hpp>
+#include <arcticdb/column_store/string_pool.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/log/log.hpp>
+
+#include <fmt/ranges.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace arcticdb::async {
+
+DecodedSegmentCacheKey::DecodedSegmentCacheKey(
+        entity::AtomKey key, const std::shared_ptr<std::unordered_set<std::string>>& columns
+) :
+    key_(std::move(key)),
+    all_columns_(!columns) {
+    if (columns) {
+        std::vector<std::string_view> names(columns->begin(), columns->end());
+        std::sort(names.begin(), names.end());
+        columns_ = fmt::format("{}", fmt::join(names, ","));
+    }
+}
+
+std::shared_ptr<DecodedSegmentCache> DecodedSegmentCache::instance() {
+    static const auto instance_ = std::make_shared<DecodedSegmentCache>(static_cast<uint64_t>(
+            std::max(int64_t{0}, ConfigsMap::instance()->get_int("DecodedSegmentCache.MaxBytes", 0))
+    ));
+    return instance_;
+}
+
+uint64_t DecodedSegmentCache::segment_bytes(const SegmentInMemory& segment) {
+    return segment.num_bytes() + (segment.has_string_pool() ? segment.const_string_pool().size() : 0);
+}
+
+std::optional<SegmentInMemory> DecodedSegmentCache::get(
+        const entity::AtomKey& key, const std::shared_ptr<std::unordered_set<std::string>>& columns
+) const {
+    auto cached = cache_.get(DecodedSegmentCacheKey{key, columns});
+    if (!cached)
+        return std::nullopt;
+
+    ARCTICDB_DEBUG(log::inmem(), "Decoded segment cache hit for {}", key);
+    return cached->clone();
+}
+
+void DecodedSegmentCache::put(
+        const entity::AtomKey& key, const std::shared_ptr<std::unordered_set<std::string>>& columns,
+        const SegmentInMemory& segment
+) {
+    cache_.put(DecodedSegmentCacheKey{key, columns}, segment.clone());
+}
+
+} // namespace arcticdb::async
@@ -0,0 +1,112 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/column_store/memory_segment.hpp>
+#include <arcticdb/entity/atom_key.hpp>
+#include <arcticdb/util/constructors.hpp>
+#include <arcticdb/util/lru_cache.hpp>
+
+#include <folly/hash/Hash.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+
+namespace arcticdb::async {
+
+struct DecodedSegmentCacheKey {
+    entity::AtomKey key_;
+    bool all_columns_;
+    // Sorted, comma separated names of the decoded columns if not all_columns_
+    std::string columns_;
+
+    DecodedSegmentCacheKey(entity::AtomKey key, const std::shared_ptr<std::unordered_set<std::string>>& columns);
+
+    bool operator==(const DecodedSegmentCacheKey& other) const = default;
+};
+
+} // namespace arcticdb::async
+
+namespace std {
+template<>
+struct hash<arcticdb::async::DecodedSegmentCacheKey> {
+    size_t operator()(const arcticdb::async::DecodedSegmentCacheKey& k) const noexcept {
+        return folly::hash::hash_combine(std::hash<arcticdb::entity::AtomKey>{}(k.key_), k.all_columns_, k.columns_);
+    }
+};
+} // namespace std
+
+namespace fmt {
+template<>
+struct formatter<arcticdb::async::DecodedSegmentCacheKey> {
+    template<typename ParseContext>
+    constexpr auto parse(ParseContext& ctx) {
+        return ctx.begin();
+    }
+
+    template<typename FormatContext>
+    auto format(const arcticdb::async::DecodedSegmentCacheKey& k, FormatContext& ctx) const {
+        if (k.all_columns_)
+            return fmt::format_to(ctx.out(), "{} [all columns]", k.key_);
+
+        return fmt::format_to(ctx.out(), "{} [{}]", k.key_, k.columns_);
+    }
+};
+} // namespace fmt
+
+namespace arcticdb::async {
+
+/*
+ * Decoded segments from batch_read_uncompressed, keyed by the atom key and the set of columns decoded, so that
+ * repeated reads of the same version skip both the storage read and the decode.
+ *
+ * Clauses are free to modify the segments they are given in place, so the cache holds its own copy of each segment
+ * and hands out copies. This still saves the IO and decompression, which dominate the cost of a read.
+ *
+ * Configured with DecodedSegmentCache.MaxBytes, where 0 (the default) disables the cache. Entries are evicted least
+ * recently used first once their total decoded size reaches the limit.
+ */
+class DecodedSegmentCache {
+  public:
+    explicit DecodedSegmentCache(uint64_t max_bytes) : cache_(max_bytes) {}
+
+    ARCTICDB_NO_MOVE_OR_COPY(DecodedSegmentCache)
+
+    static std::shared_ptr<DecodedSegmentCache> instance();
+
+    [[nodiscard]] bool enabled() const { return cache_.capacity() != 0; }
+
+    [[nodiscard]] std::optional<SegmentInMemory> get(
+            const entity::AtomKey& key, const std::shared_ptr<std::unordered_set<std::string>>& columns
+    ) const;
+
+    void put(
+            const entity::AtomKey& key, const std::shared_ptr<std::unordered_set<std::string>>& columns,
+            const SegmentInMemory& segment
+    );
+
+    [[nodiscard]] size_t size() const { return cache_.size(); }
+
+    [[nodiscard]] uint64_t size_bytes() const { return cache_.weight(); }
+
+    // Approximate memory held by a decoded segment: its column buffers and string pool
+    static uint64_t segment_bytes(const SegmentInMemory& segment);
+
+  private:
+    struct SegmentWeigher {
+        size_t operator()(const SegmentInMemory& segment) const { return segment_bytes(segment); }
+    };
+
+    LRUCache<DecodedSegmentCacheKey, SegmentInMemory, SegmentWeigher> cache_;
+};
+
+} // namespace arcticdb::async
@@ -0,0 +1,103 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/async/fair_task_queue.hpp>
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/log/log.hpp>
+
+#include <atomic>
+
+namespace arcticdb::async {
+
+OperationId next_operation_id() {
+    static std::atomic<OperationId> counter{no_operation_id};
+    return ++counter;
+}
+
+void FairTaskQueue::push(folly::Func&& func, const OperationContext& context) {
+    const auto lane_index = static_cast<size_t>(context.priority_);
+    util::check(lane_index < num_task_priorities, "Invalid task priority {}", lane_index);
+    std::lock_guard lock{mutex_};
+    auto& lane = lanes_[lane_index];
+    auto& queue = lane.tasks_[context.operation_id_];
+    if (queue.empty())
+        lane.ready_.push_back(context.operation_id_);
+
+    queue.emplace_back(QueuedTask{std::move(func), context, Clock::now()});
+    ++lane.stats_.pending_;
+}
+
+std::optional<FairTaskQueue::QueuedTask> FairTaskQueue::pop_next() {
+    std::lock_guard lock{mutex_};
+    for (auto& lane : lanes_) {
+        if (lane.ready_.empty())
+            continue;
+
+        const auto operation_id = lane.ready_.front();
+        lane.ready_.pop_front();
+        auto it = lane.tasks_.find(operation_id);
+        util::check(it != lane.tasks_.end() && !it->second.empty(), "No tasks queued for ready operation {}", operation_id);
+        auto task = std::move(it->second.front());
+        it->second.pop_front();
+        if (it->second.empty())
+            lane.tasks_.erase(it);
+        else
+            lane.ready_.push_back(operation_id);
+
+        const auto wait_ns = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - task.enqueued_).count()
+        );
+        --lane.stats_.pending_;
+        ++lane.stats_.scheduled_;
+        lane.stats_.total_wait_ns_ += wait_ns;
+        lane.stats_.max_wait_ns_ = std::max(lane.stats_.max_wait_ns_, wait_ns);
+        return task;
+    }
+    return std::nullopt;
+}
+
+bool FairTaskQueue::run_next() {
+    auto task = pop_next();
+    if (!task) {
+        ARCTICDB_DEBUG(log::schedule(), "Fair task queue woken with nothing to run");
+        return false;
+    }
+
+    ScopedOperationContext context{task->context_};
+    task->func_();
+    return true;
+}
+
+LaneStatsArray FairTaskQueue::lane_stats() const {
+    LaneStatsArray output;
+    std::lock_guard lock{mutex_};
+    for (size_t i = 0; i < num_task_priorities; ++i)
+        output[i] = lanes_[i].stats_;
+
+    return output;
+}
+
+size_t FairTaskQueue::pending() const {
+    size_t total = 0;
+    std::lock_guard lock{mutex_};
+    for (const auto& lane : lanes_)
+        total += lane.stats_.pending_;
+
+    return total;
+}
+
+void FairTaskQueue::reset_stats() {
+    std::lock_guard lock{mutex_};
+    for (auto& lane : lanes_) {
+        const auto pending = lane.stats_.pending_;
+        lane.stats_ = LaneStats{};
+        lane.stats_.pending_ = pending;
+    }
+}
+
+} // namespace arcticdb::async
@@ -0,0 +1,86 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/async/operation_context.hpp>
+#include <arcticdb/util/constructors.hpp>
+
+#include <folly/Function.h>
+#include <ankerl/unordered_dense.h>
+
+#include <array>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace arcticdb::async {
+
+struct LaneStats {
+    uint64_t scheduled_ = 0;
+    uint64_t pending_ = 0;
+    uint64_t total_wait_ns_ = 0;
+    uint64_t max_wait_ns_ = 0;
+
+    [[nodiscard]] double mean_wait_ms() const {
+        return scheduled_ == 0 ? 0.0 : static_cast<double>(total_wait_ns_) / static_cast<double>(scheduled_) / 1e6;
+    }
+};
+
+using LaneStatsArray = std::array<LaneStats, num_task_priorities>;
+
+/*
+ * Sits in front of a folly executor and decides which task runs next. For every task pushed, the owner adds exactly
+ * one call to run_next() to the underlying executor, so the executor only ever sees anonymous "run something" work
+ * items and the choice of what that something is happens here, at the moment a worker becomes free.
+ *
+ * Selection is strict priority between lanes, and round-robin between operations within a lane, so one operation
+ * with 50k queued segment reads cannot hold back a concurrent operation that only needs a couple of tasks.
+ */
+class FairTaskQueue {
+  public:
+    FairTaskQueue() = default;
+
+    ARCTICDB_NO_MOVE_OR_COPY(FairTaskQueue)
+
+    void push(folly::Func&& func, const OperationContext& context);
+
+    // Runs the most deserving pending task on the calling thread, under that task's operation context. Returns false
+    // if there was nothing to run.
+    bool run_next();
+
+    [[nodiscard]] LaneStatsArray lane_stats() const;
+
+    [[nodiscard]] size_t pending() const;
+
+    void reset_stats();
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct QueuedTask {
+        folly::Func func_;
+        OperationContext context_;
+        Clock::time_point enqueued_;
+    };
+
+    struct Lane {
+        // Operations with at least one pending task, in the order they will next be served
+        std::deque<OperationId> ready_;
+        ankerl::unordered_dense::map<OperationId, std::deque<QueuedTask>> tasks_;
+        LaneStats stats_;
+    };
+
+    std::optional<QueuedTask> pop_next();
+
+    mutable std::mutex mutex_;
+    std::array<Lane, num_task_priorities> lanes_;
+};
+
+} // namespace arcticdb::async
@@ -0,0 +1,86 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/async/memory_budget.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/log/log.hpp>
+
+#include <vector>
+
+namespace arcticdb::async {
+
+std::shared_ptr<MemoryBudget> MemoryBudget::instance() {
+    static const auto instance_ = std::make_shared<MemoryBudget>(
+            static_cast<uint64_t>(std::max(int64_t{0}, ConfigsMap::instance()->get_int("ReadMemoryBudget.MaxBytes", 0)))
+    );
+    return instance_;
+}
+
+bool MemoryBudget::can_admit(uint64_t bytes) const {
+    return in_flight_bytes_ == 0 || in_flight_bytes_ + bytes <= limit_bytes_;
+}
+
+void MemoryBudget::admit(uint64_t bytes) {
+    in_flight_bytes_ += bytes;
+    peak_in_flight_bytes_ = std::max(peak_in_flight_bytes_, in_flight_bytes_);
+}
+
+folly::Future<folly::Unit> MemoryBudget::acquire(uint64_t bytes) {
+    std::lock_guard lock{mutex_};
+    if (waiters_.empty() && can_admit(bytes)) {
+        admit(bytes);
+        return folly::makeFuture();
+    }
+
+    ARCTICDB_DEBUG(
+            log::schedule(),
+            "Memory budget waiting to admit {} bytes, {} of {} in flight",
+            bytes,
+            in_flight_bytes_,
+            limit_bytes_
+    );
+    auto& waiter = waiters_.emplace_back(Waiter{bytes, folly::Promise<folly::Unit>{}});
+    return waiter.promise_.getFuture();
+}
+
+void MemoryBudget::release(uint64_t bytes) {
+    std::vector<folly::Promise<folly::Unit>> admitted;
+    {
+        std::lock_guard lock{mutex_};
+        util::check(
+                bytes <= in_flight_bytes_, "Releasing {} bytes from memory budget with {} in flight", bytes, in_flight_bytes_
+        );
+        in_flight_bytes_ -= bytes;
+        while (!waiters_.empty() && can_admit(waiters_.front().bytes_)) {
+            admit(waiters_.front().bytes_);
+            admitted.emplace_back(std::move(waiters_.front().promise_));
+            waiters_.pop_front();
+        }
+    }
+    // Fulfilled outside the lock as the continuations run inline and will typically schedule IO
+    for (auto& promise : admitted)
+        promise.setValue();
+}
+
+uint64_t MemoryBudget::in_flight_bytes() const {
+    std::lock_guard lock{mutex_};
+    return in_flight_bytes_;
+}
+
+uint64_t MemoryBudget::peak_in_flight_bytes() const {
+    std::lock_guard lock{mutex_};
+    return peak_in_flight_bytes_;
+}
+
+size_t MemoryBudget::waiting() const {
+    std::lock_guard lock{mutex_};
+    return waiters_.size();
+}
+
+} // namespace arcticdb::async
@@ -0,0 +1,100 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/util/constructors.hpp>
+
+#include <folly/futures/Future.h>
+#include <folly/futures/Promise.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+namespace arcticdb::async {
+
+/*
+ * Bounds the number of bytes that segment reads are allowed to hold between being admitted for IO and their decoded
+ * contents being handed on (written into the output frame, or returned to the processing pipeline).
+ *
+ * Admission is FIFO. A reservation larger than the whole budget is admitted once nothing else is in flight, so a
+ * single oversized segment can always make progress.
+ *
+ * Configured with ReadMemoryBudget.MaxBytes, where 0 (the default) disables the budget entirely.
+ */
+class MemoryBudget {
+  public:
+    explicit MemoryBudget(uint64_t limit_bytes) : limit_bytes_(limit_bytes) {}
+
+    ARCTICDB_NO_MOVE_OR_COPY(MemoryBudget)
+
+    static std::shared_ptr<MemoryBudget> instance();
+
+    [[nodiscard]] bool enabled() const { return limit_bytes_ != 0; }
+
+    [[nodiscard]] uint64_t limit_bytes() const { return limit_bytes_; }
+
+    // The returned future completes (inline, on the releasing thread if it had to wait) once the bytes are admitted
+    folly::Future<folly::Unit> acquire(uint64_t bytes);
+
+    void release(uint64_t bytes);
+
+    [[nodiscard]] uint64_t in_flight_bytes() const;
+
+    [[nodiscard]] uint64_t peak_in_flight_bytes() const;
+
+    [[nodiscard]] size_t waiting() const;
+
+  private:
+    struct Waiter {
+        uint64_t bytes_;
+        folly::Promise<folly::Unit> promise_;
+    };
+
+    [[nodiscard]] bool can_admit(uint64_t bytes) const;
+
+    void admit(uint64_t bytes);
+
+    const uint64_t limit_bytes_;
+    mutable std::mutex mutex_;
+    uint64_t in_flight_bytes_ = 0;
+    uint64_t peak_in_flight_bytes_ = 0;
+    std::deque<Waiter> waiters_;
+};
+
+// Rough upper bound on the decoded size of a slice, used to size reservations before the segment has been fetched.
+// Numeric columns are at most 8 bytes per value, and string columns are decoded as 8 byte offsets into the pool.
+inline uint64_t estimate_slice_bytes(size_t num_rows, size_t num_columns) {
+    static constexpr uint64_t min_reservation = 4096;
+    return std::max(min_reservation, static_cast<uint64_t>(num_rows) * num_columns * sizeof(uint64_t));
+}
+
+/*
+ * Runs factory(), which must return a folly::Future, once `bytes` have been admitted by the budget, and releases
+ * them when that future completes, whether with a value or an exception.
+ */
+template<typename FutureFactory>
+auto with_memory_budget(const std::shared_ptr<MemoryBudget>& budget, uint64_t bytes, FutureFactory&& factory) {
+    using FutureType = std::invoke_result_t<std::decay_t<FutureFactory>>;
+    using ValueType = typename FutureType::value_type;
+    if (!budget || !budget->enabled())
+        return factory();
+
+    return budget->acquire(bytes)
+            .thenValue([factory = std::forward<FutureFactory>(factory)](auto&&) mutable { return factory(); })
+            .thenTry([budget, bytes](folly::Try<ValueType>&& result) {
+                budget->release(bytes);
+                return std::move(result).value();
+            });
+}
+
+} // namespace arcticdb::async
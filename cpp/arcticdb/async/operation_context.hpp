@@ -0,0 +1,96 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/util/constructors.hpp>
+
+#include <cstdint>
+#include <cstddef>
+
+namespace arcticdb::async {
+
+/*
+ * Scheduling lane for a task. Lanes are served in strict order, so HIGH should only be used for operations that are
+ * cheap and latency sensitive (metadata reads, version listing), otherwise they will starve everything else.
+ */
+enum class TaskPriority : uint8_t { HIGH = 0, NORMAL = 1, LOW = 2, COUNT = 3 };
+
+constexpr size_t num_task_priorities = static_cast<size_t>(TaskPriority::COUNT);
+
+inline const char* task_priority_name(TaskPriority priority) {
+    switch (priority) {
+    case TaskPriority::HIGH:
+        return "HIGH";
+    case TaskPriority::NORMAL:
+        return "NORMAL";
+    case TaskPriority::LOW:
+        return "LOW";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+using OperationId = uint64_t;
+
+// Tasks submitted outside any ScopedOperation all share this id, and are therefore treated as a single operation
+// for the purposes of fairness
+constexpr OperationId no_operation_id = 0;
+
+struct OperationContext {
+    OperationId operation_id_ = no_operation_id;
+    TaskPriority priority_ = TaskPriority::NORMAL;
+};
+
+// The context of the operation the calling thread is currently working on. Captured when a task is submitted to the
+// TaskScheduler and re-installed on the worker thread while the task runs, so that any tasks it submits in turn
+// are attributed to the same top-level operation.
+inline OperationContext& current_operation_context() {
+    thread_local OperationContext context;
+    return context;
+}
+
+OperationId next_operation_id();
+
+/*
+ * Marks the lifetime of a top-level user operation (a read, a list_versions call etc.). Nested scopes are a no-op so
+ * that an operation implemented in terms of other operations keeps a single id and the outermost priority.
+ */
+class ScopedOperation {
+  public:
+    explicit ScopedOperation(TaskPriority priority) : previous_(current_operation_context()) {
+        if (previous_.operation_id_ == no_operation_id)
+            current_operation_context() = OperationContext{next_operation_id(), priority};
+    }
+
+    ~ScopedOperation() { current_operation_context() = previous_; }
+
+    ARCTICDB_NO_MOVE_OR_COPY(ScopedOperation)
+
+    [[nodiscard]] OperationId operation_id() const { return current_operation_context().operation_id_; }
+
+  private:
+    OperationContext previous_;
+};
+
+// Installs a previously captured context on the current (worker) thread for the duration of a task
+class ScopedOperationContext {
+  public:
+    explicit ScopedOperationContext(const OperationContext& context) : previous_(current_operation_context()) {
+        current_operation_context() = context;
+    }
+
+    ~ScopedOperationContext() { current_operation_context() = previous_; }
+
+    ARCTICDB_NO_MOVE_OR_COPY(ScopedOperationContext)
+
+  private:
+    OperationContext previous_;
+};
+
+} // namespace arcticdb::async
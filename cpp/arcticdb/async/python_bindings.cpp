@@ -28,6 +28,25 @@ void register_bindings(py::module& m) {
     async.def("reinit_task_scheduler", &arcticdb::async::TaskScheduler::reattach_instance);
     async.def("cpu_thread_count", []() { return arcticdb::async::TaskScheduler::instance()->cpu_thread_count(); });
     async.def("io_thread_count", []() { return arcticdb::async::TaskScheduler::instance()->io_thread_count(); });
+    async.def("scheduler_lane_stats", []() {
+        auto to_dict = [](const LaneStatsArray& lanes) {
+            py::dict output;
+            for (size_t i = 0; i < num_task_priorities; ++i) {
+                py::dict lane;
+                lane["scheduled"] = lanes[i].scheduled_;
+                lane["pending"] = lanes[i].pending_;
+                lane["mean_wait_ms"] = lanes[i].mean_wait_ms();
+                lane["max_wait_ms"] = static_cast<double>(lanes[i].max_wait_ns_) / 1e6;
+                output[task_priority_name(static_cast<TaskPriority>(i))] = lane;
+            }
+            return output;
+        };
+        py::dict output;
+        output["cpu"] = to_dict(TaskScheduler::instance()->cpu_lane_stats());
+        output["io"] = to_dict(TaskScheduler::instance()->io_lane_stats());
+        return output;
+    });
+    async.def("reset_scheduler_lane_stats", []() { TaskScheduler::instance()->reset_lane_stats(); });
 }
 
 } // namespace arcticdb::async
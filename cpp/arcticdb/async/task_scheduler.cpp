@@ -77,6 +77,37 @@ void print_scheduler_stats() {
             io_stats.totalTaskCount,
             io_stats.maxIdleTime.count()
     );
+
+    if (auto* work_stealing = TaskScheduler::instance()->work_stealing_exec(); work_stealing) {
+        const auto stats = work_stealing->stats();
+        log::schedule().info(
+                "CPU (work stealing): Threads: {}\tPending: {}\tExecuted: {}\tStolen: {}",
+                work_stealing->num_threads(),
+                stats.pending_,
+                stats.executed_,
+                stats.stolen_
+        );
+    }
+
+    if (!TaskScheduler::instance()->priority_scheduling())
+        return;
+
+    auto log_lanes = [](const char* pool, const LaneStatsArray& lanes) {
+        for (size_t i = 0; i < num_task_priorities; ++i) {
+            const auto& lane = lanes[i];
+            log::schedule().info(
+                    "{} lane {}: Scheduled: {}\tPending: {}\tMeanWaitMs: {:.3f}\tMaxWaitMs: {:.3f}",
+                    pool,
+                    task_priority_name(static_cast<TaskPriority>(i)),
+                    lane.scheduled_,
+                    lane.pending_,
+                    lane.mean_wait_ms(),
+                    static_cast<double>(lane.max_wait_ns_) / 1e6
+            );
+        }
+    };
+    log_lanes("CPU", TaskScheduler::instance()->cpu_lane_stats());
+    log_lanes("IO", TaskScheduler::instance()->io_lane_stats());
 }
 
 } // namespace arcticdb::async
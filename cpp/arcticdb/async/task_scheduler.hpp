@@ -11,10 +11,14 @@
 #include <arcticdb/util/configs_map.hpp>
 #include <arcticdb/util/string_utils.hpp>
 #include <arcticdb/async/base_task.hpp>
+#include <arcticdb/async/fair_task_queue.hpp>
+#include <arcticdb/async/operation_context.hpp>
+#include <arcticdb/async/work_stealing_executor.hpp>
 #include <arcticdb/entity/performance_tracing.hpp>
 #include <folly/executors/FutureExecutor.h>
 #include <folly/executors/CPUThreadPoolExecutor.h>
 #include <folly/executors/IOThreadPoolExecutor.h>
+#include <folly/futures/Future.h>
 #include <fmt/format.h>
 #include <thread>
 #include <algorithm>
@@ -174,14 +178,34 @@ inline long get_default_cpu_count() {
     );
 }
 
+inline bool get_priority_scheduling_enabled() {
+    return ConfigsMap::instance()->get_int("VersionStore.PriorityScheduling", 0) != 0;
+}
+
+inline bool get_work_stealing_cpu_pool_enabled() {
+    return ConfigsMap::instance()->get_int("VersionStore.WorkStealingCPUPool", 0) != 0;
+}
+
+inline ThreadPinning get_cpu_thread_pinning() {
+    const auto pinning = ConfigsMap::instance()->get_int("VersionStore.CPUThreadPinning", 0);
+    util::check(pinning >= 0 && pinning <= 2, "Invalid VersionStore.CPUThreadPinning value {}", pinning);
+    return static_cast<ThreadPinning>(pinning);
+}
+
 /*
+ * When priority scheduling is enabled, tasks submitted through submit_cpu_task/submit_io_task are not handed to the
+ * folly pools directly but queued in a FairTaskQueue per pool, tagged with the submitting thread's OperationContext.
+ * See fair_task_queue.hpp for the selection policy. Continuations attached with .via() bypass this and run in
+ * folly's FIFO order as before.
+ *
+ * When the work stealing CPU pool is enabled, CPU tasks run on a WorkStealingExecutor (optionally pinned to cores or
+ * NUMA nodes) rather than the folly CPU pool, as do the decode continuations of read_and_continue. The folly pool is
+ * still used for continuations attached with .via(&cpu_executor()), which are cheap.
+ *
  * Possible areas of inprovement in the future:
  * 1/ Task/op decoupling: push task and then use strategy to implement smart batching to
  * amortize costs wherever possible
- * 2/ Worker thread Affinity - would better locality improve throughput by keeping hot structure in
- * hot cachelines and not jumping from one thread to the next (assuming thread/core affinity in hw too) ?
- * 3/ Priority: How to assign priorities to task in order to treat the most pressing first.
- * 4/ Throttling: (similar to priority) how to absorb work spikes and apply memory backpressure
+ * 2/ Throttling: (similar to priority) how to absorb work spikes and apply memory backpressure
  */
 class TaskScheduler {
   public:
@@ -199,7 +223,11 @@ class TaskScheduler {
                         : ConfigsMap::instance()->get_int("VersionStore.NumIOThreads", (int)(cpu_thread_count_ * 1.5))
         ),
         cpu_exec_(cpu_thread_count_, std::make_shared<InstrumentedNamedFactory>("CPUPool")),
-        io_exec_(io_thread_count_, std::make_shared<InstrumentedNamedFactory>("IOPool")) {
+        io_exec_(io_thread_count_, std::make_shared<InstrumentedNamedFactory>("IOPool")),
+        priority_scheduling_(get_priority_scheduling_enabled()) {
+        if (get_work_stealing_cpu_pool_enabled())
+            work_stealing_exec_ = make_work_stealing_executor();
+
         util::check(
                 cpu_thread_count_ > 0 && io_thread_count_ > 0,
                 "Zero IO or CPU threads: {} {}",
@@ -207,7 +235,12 @@ class TaskScheduler {
                 cpu_thread_count_
         );
         ARCTICDB_RUNTIME_DEBUG(
-                log::schedule(), "Task scheduler created with {:d} {:d}", cpu_thread_count_, io_thread_count_
+                log::schedule(),
+                "Task scheduler created with {:d} {:d}, priority scheduling {}, work stealing {}",
+                cpu_thread_count_,
+                io_thread_count_,
+                priority_scheduling_,
+                static_cast<bool>(work_stealing_exec_)
         );
     }
 
@@ -223,6 +256,12 @@ class TaskScheduler {
                 cpu_exec_.getTaskQueueSize(),
                 cpu_exec_.kDefaultMaxQueueSize
         );
+        if (work_stealing_exec_)
+            return submit_via(*work_stealing_exec_, priority_scheduling_ ? &cpu_queue_ : nullptr, std::move(task));
+
+        if (priority_scheduling_)
+            return submit_via(cpu_exec_, &cpu_queue_, std::move(task));
+
         std::lock_guard lock{cpu_mutex_};
         return cpu_exec_.addFuture(std::move(task));
     }
@@ -238,6 +277,9 @@ class TaskScheduler {
                 typeid(task).name(),
                 io_exec_.getPendingTaskCount()
         );
+        if (priority_scheduling_)
+            return submit_via(io_exec_, &io_queue_, std::move(task));
+
         std::lock_guard lock{io_mutex_};
         return io_exec_.addFuture(std::move(task));
     }
@@ -259,12 +301,16 @@ class TaskScheduler {
         ARCTICDB_DEBUG(log::schedule(), "Joining task scheduler");
         io_exec_.join();
         cpu_exec_.join();
+        if (work_stealing_exec_)
+            work_stealing_exec_->join();
     }
 
     void stop() {
         ARCTICDB_DEBUG(log::schedule(), "Stopping task scheduler");
         io_exec_.stop();
         cpu_exec_.stop();
+        if (work_stealing_exec_)
+            work_stealing_exec_->stop();
     }
 
     void set_active_threads(size_t n) {
@@ -301,6 +347,11 @@ class TaskScheduler {
         cpu_exec_.set_thread_factory(std::make_shared<InstrumentedNamedFactory>("CPUPool"));
         io_exec_.setNumThreads(io_thread_count_);
         cpu_exec_.setNumThreads(cpu_thread_count_);
+        if (work_stealing_exec_) {
+            // The worker threads did not survive the fork, so the old executor cannot be joined and is leaked
+            [[maybe_unused]] auto* leaked = work_stealing_exec_.release();
+            work_stealing_exec_ = make_work_stealing_executor();
+        }
     }
 
     size_t cpu_thread_count() const { return cpu_thread_count_; }
@@ -312,13 +363,59 @@ class TaskScheduler {
         cpu_exec_.stop_orphaned_threads();
     }
 
+    [[nodiscard]] bool priority_scheduling() const { return priority_scheduling_; }
+
+    [[nodiscard]] WorkStealingExecutor* work_stealing_exec() const { return work_stealing_exec_.get(); }
+
+    [[nodiscard]] LaneStatsArray cpu_lane_stats() const { return cpu_queue_.lane_stats(); }
+
+    [[nodiscard]] LaneStatsArray io_lane_stats() const { return io_queue_.lane_stats(); }
+
+    void reset_lane_stats() {
+        cpu_queue_.reset_stats();
+        io_queue_.reset_stats();
+    }
+
   private:
+    std::unique_ptr<WorkStealingExecutor> make_work_stealing_executor() const {
+        return std::make_unique<WorkStealingExecutor>(
+                cpu_thread_count_,
+                get_cpu_thread_pinning(),
+                NumaTopology::detect(),
+                std::make_shared<InstrumentedNamedFactory>("CPUPool")
+        );
+    }
+
+    // Mirrors folly::FutureExecutor::addFuture so that callers see the same future type whichever path is taken. If
+    // a queue is provided the task is parked there and the executor is only given a token to run the next queued task.
+    template<class Task>
+    auto submit_via(folly::Executor& exec, FairTaskQueue* queue, Task&& task) {
+        using ResultType = std::invoke_result_t<std::decay_t<Task>>;
+        static_assert(!folly::isFutureOrSemiFuture<ResultType>::value, "Tasks returning futures are not supported");
+        folly::Promise<folly::lift_unit_t<ResultType>> promise;
+        auto future = promise.getFuture();
+        folly::Func func = [promise = std::move(promise), task = std::forward<Task>(task)]() mutable {
+            promise.setWith(std::move(task));
+        };
+        if (queue) {
+            queue->push(std::move(func), current_operation_context());
+            exec.add([queue] { queue->run_next(); });
+        } else {
+            exec.add(std::move(func));
+        }
+        return future;
+    }
+
     size_t cpu_thread_count_;
     size_t io_thread_count_;
     SchedulerWrapper<CPUSchedulerType> cpu_exec_;
     SchedulerWrapper<IOSchedulerType> io_exec_;
     std::mutex cpu_mutex_;
     std::mutex io_mutex_;
+    bool priority_scheduling_;
+    FairTaskQueue cpu_queue_;
+    FairTaskQueue io_queue_;
+    std::unique_ptr<WorkStealingExecutor> work_stealing_exec_;
 };
 
 inline auto& cpu_executor() { return TaskScheduler::instance()->cpu_exec(); }
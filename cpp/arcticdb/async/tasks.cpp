@@ -37,6 +37,15 @@ StreamDescriptor get_filtered_descriptor(
     });
 }
 
+pipelines::SegmentAndSlice make_decoded_slice(
+        pipelines::RangesAndKey&& ranges_and_key, SegmentInMemory&& segment_in_memory
+) {
+    const auto& descriptor = segment_in_memory.descriptor();
+    ranges_and_key.col_range_.second =
+            ranges_and_key.col_range_.first + (descriptor.field_count() - descriptor.index().field_count());
+    return pipelines::SegmentAndSlice(std::move(ranges_and_key), std::move(segment_in_memory));
+}
+
 pipelines::SegmentAndSlice DecodeSliceTask::decode_into_slice(storage::KeySegmentPair&& key_segment_pair) {
     auto key = key_segment_pair.atom_key();
     auto& seg = *key_segment_pair.segment_ptr();
@@ -44,12 +53,23 @@ pipelines::SegmentAndSlice DecodeSliceTask::decode_into_slice(storage::KeySegmen
     auto& hdr = seg.header();
     const auto& desc = seg.descriptor();
     auto descriptor = async::get_filtered_descriptor(desc, columns_to_decode_);
-    ranges_and_key_.col_range_.second =
-            ranges_and_key_.col_range_.first + (descriptor.field_count() - descriptor.index().field_count());
     ARCTICDB_TRACE(log::codec(), "Creating segment");
     SegmentInMemory segment_in_memory(std::move(descriptor));
-    decode_into_memory_segment(seg, hdr, segment_in_memory, desc);
+    bool skipped_blocks = false;
+    BlockFilter block_filter;
+    if (block_filter_) {
+        block_filter = [this, &skipped_blocks](const SegmentInMemory& segment) {
+            auto blocks = (*block_filter_)(segment);
+            skipped_blocks = blocks.has_value();
+            return blocks;
+        };
+    }
+    decode_into_memory_segment(seg, hdr, segment_in_memory, desc, block_filter);
     segment_in_memory.set_row_data(std::max(segment_in_memory.row_count() - 1, ranges_and_key_.row_range().diff() - 1));
-    return pipelines::SegmentAndSlice(std::move(ranges_and_key_), std::move(segment_in_memory));
+    // The cache is keyed on the columns decoded, but still only takes segments that were read and decoded in full
+    if (decoded_segment_cache_ && !seg.is_partial() && !skipped_blocks)
+        decoded_segment_cache_->put(key, columns_to_decode_, segment_in_memory);
+
+    return make_decoded_slice(std::move(ranges_and_key_), std::move(segment_in_memory));
 }
 } // namespace arcticdb::async
\ No newline at end of file
@@ -21,6 +21,7 @@
 #include <arcticdb/stream/stream_sink.hpp>
 #include <arcticdb/async/base_task.hpp>
 #include <arcticdb/async/bit_rate_stats.hpp>
+#include <arcticdb/async/decoded_segment_cache.hpp>
 #include <arcticdb/pipeline/frame_slice.hpp>
 #include <arcticdb/util/constructors.hpp>
 #include <arcticdb/codec/codec.hpp>
@@ -75,7 +76,12 @@ struct EncodeAtomTask : BaseTask {
     storage::KeySegmentPair encode() {
         ARCTICDB_DEBUG(log::codec(), "Encoding object with partial key {}", partial_key_);
         ARCTICDB_DEBUG_THROW(5)
-        auto enc_seg = ::arcticdb::encode_dispatch(std::move(segment_), *codec_meta_, encoding_version_);
+        auto enc_seg = ::arcticdb::encode_dispatch(
+                std::move(segment_),
+                *codec_meta_,
+                encoding_version_,
+                partial_key_.key_type == KeyType::TABLE_DATA
+        );
         auto content_hash = get_segment_hash(enc_seg);
 
         AtomKey k = partial_key_.build_key(creation_ts_, content_hash);
@@ -106,7 +112,9 @@ struct EncodeSegmentTask : BaseTask {
     ARCTICDB_MOVE_ONLY_DEFAULT(EncodeSegmentTask)
 
     storage::KeySegmentPair encode() {
-        auto enc_seg = ::arcticdb::encode_dispatch(std::move(segment_), *codec_meta_, encoding_version_);
+        auto enc_seg = ::arcticdb::encode_dispatch(
+                std::move(segment_), *codec_meta_, encoding_version_, variant_key_type(key_) == KeyType::TABLE_DATA
+        );
         return {std::move(key_), std::move(enc_seg)};
     }
 
@@ -456,17 +464,32 @@ struct DecodeSegmentTask : BaseTask {
     }
 };
 
+// Pairs a segment decoded with the given column selection with its slice, narrowing the slice's column range to the
+// columns the segment actually contains
+pipelines::SegmentAndSlice make_decoded_slice(
+        pipelines::RangesAndKey&& ranges_and_key, SegmentInMemory&& segment_in_memory
+);
+
 struct DecodeSliceTask : BaseTask {
     ARCTICDB_MOVE_ONLY_DEFAULT(DecodeSliceTask)
 
     pipelines::RangesAndKey ranges_and_key_;
     std::shared_ptr<std::unordered_set<std::string>> columns_to_decode_;
+    // Receives a copy of the decoded segment if set
+    std::shared_ptr<DecodedSegmentCache> decoded_segment_cache_;
+    // Decides the blocks of the segment to leave undecoded if set
+    std::shared_ptr<BlockFilter> block_filter_;
 
     explicit DecodeSliceTask(
-            pipelines::RangesAndKey&& ranges_and_key, std::shared_ptr<std::unordered_set<std::string>> columns_to_decode
+            pipelines::RangesAndKey&& ranges_and_key,
+            std::shared_ptr<std::unordered_set<std::string>> columns_to_decode,
+            std::shared_ptr<DecodedSegmentCache> decoded_segment_cache = nullptr,
+            std::shared_ptr<BlockFilter> block_filter = nullptr
     ) :
         ranges_and_key_(std::move(ranges_and_key)),
-        columns_to_decode_(std::move(columns_to_decode)) {}
+        columns_to_decode_(std::move(columns_to_decode)),
+        decoded_segment_cache_(std::move(decoded_segment_cache)),
+        block_filter_(std::move(block_filter)) {}
 
     pipelines::SegmentAndSlice operator()(storage::KeySegmentPair&& key_segment_pair) {
         ARCTICDB_SAMPLE(DecodeSliceTask, 0)
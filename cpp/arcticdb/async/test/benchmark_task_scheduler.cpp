@@ -0,0 +1,119 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <arcticdb/async/task_scheduler.hpp>
+#include <arcticdb/async/work_stealing_executor.hpp>
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/synchronization/Latch.h>
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using namespace arcticdb;
+
+// run like: --benchmark_time_unit=ms --benchmark_filter=.* --benchmark_min_time=5x
+
+namespace {
+
+constexpr size_t rows_per_slice = 100'000;
+
+// Stand-in for decode_into_frame_static: reads a source buffer belonging to the slice and writes the values into the
+// slice's region of a shared output frame, which is allocated untouched so the writer first-touches its pages
+void decode_slice(const std::vector<int64_t>& source, int64_t* output) {
+    int64_t running = 0;
+    for (size_t i = 0; i < source.size(); ++i) {
+        running += source[i];
+        output[i] = running;
+    }
+    benchmark::DoNotOptimize(output);
+}
+
+// Executor type: 0 = folly CPUThreadPoolExecutor, 1 = work stealing, 2 = work stealing pinned to NUMA nodes,
+// 3 = work stealing pinned to cores
+std::unique_ptr<folly::Executor> make_executor(int64_t type, size_t num_threads) {
+    auto factory = std::make_shared<async::InstrumentedNamedFactory>("BenchPool");
+    if (type == 0)
+        return std::make_unique<folly::CPUThreadPoolExecutor>(num_threads, factory);
+
+    return std::make_unique<async::WorkStealingExecutor>(
+            num_threads, static_cast<async::ThreadPinning>(type - 1), async::NumaTopology::detect(), factory
+    );
+}
+
+} // namespace
+
+static void BM_executor_decode_into_frame(benchmark::State& state) {
+    const auto executor_type = state.range(0);
+    const auto num_slices = static_cast<size_t>(state.range(1));
+    const auto num_threads = static_cast<size_t>(async::get_default_num_cpus("/sys/fs/cgroup"));
+    auto executor = make_executor(executor_type, num_threads);
+    std::vector<std::vector<int64_t>> sources(num_slices, std::vector<int64_t>(rows_per_slice));
+    for (auto& source : sources)
+        std::iota(source.begin(), source.end(), 0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::unique_ptr<int64_t[]> frame{new int64_t[num_slices * rows_per_slice]};
+        folly::Latch latch(static_cast<ptrdiff_t>(num_slices));
+        state.ResumeTiming();
+        for (size_t slice = 0; slice < num_slices; ++slice) {
+            executor->add([&sources, &latch, output = frame.get() + slice * rows_per_slice, slice] {
+                decode_slice(sources[slice], output);
+                latch.count_down();
+            });
+        }
+        latch.wait();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_slices * rows_per_slice));
+}
+
+// Each top level task fans out into child tasks, as clause processing does per segment
+static void BM_executor_nested_fan_out(benchmark::State& state) {
+    const auto executor_type = state.range(0);
+    const auto num_parents = static_cast<size_t>(state.range(1));
+    constexpr size_t children_per_parent = 16;
+    constexpr size_t rows_per_child = 8'192;
+    const auto num_threads = static_cast<size_t>(async::get_default_num_cpus("/sys/fs/cgroup"));
+    auto executor = make_executor(executor_type, num_threads);
+    std::vector<int64_t> source(rows_per_child);
+    std::iota(source.begin(), source.end(), 0);
+
+    for (auto _ : state) {
+        std::vector<int64_t> output(num_parents * children_per_parent * rows_per_child);
+        folly::Latch latch(static_cast<ptrdiff_t>(num_parents * children_per_parent));
+        for (size_t parent = 0; parent < num_parents; ++parent) {
+            executor->add([&, parent] {
+                for (size_t child = 0; child < children_per_parent; ++child) {
+                    executor->add([&, parent, child] {
+                        decode_slice(
+                                source, output.data() + (parent * children_per_parent + child) * rows_per_child
+                        );
+                        latch.count_down();
+                    });
+                }
+            });
+        }
+        latch.wait();
+    }
+}
+
+BENCHMARK(BM_executor_decode_into_frame)
+        ->Args({0, 64})
+        ->Args({1, 64})
+        ->Args({2, 64})
+        ->Args({3, 64})
+        ->Args({0, 1'000})
+        ->Args({1, 1'000})
+        ->Args({2, 1'000})
+        ->Args({3, 1'000})
+        ->UseRealTime();
+
+BENCHMARK(BM_executor_nested_fan_out)->Args({0, 256})->Args({1, 256})->Args({2, 256})->Args({3, 256})->UseRealTime();
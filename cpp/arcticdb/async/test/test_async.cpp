@@ -15,6 +15,9 @@
 #include <arcticdb/stream/test/stream_test_common.hpp>
 #include <arcticdb/util/test/config_common.hpp>
 #include <arcticdb/toolbox/query_stats.hpp>
+#include <arcticdb/async/fair_task_queue.hpp>
+#include <arcticdb/async/memory_budget.hpp>
+#include <arcticdb/async/decoded_segment_cache.hpp>
 
 #include <string>
 #include <vector>
@@ -302,6 +305,195 @@ TEST(Async, DynamicSizing) {
     (void)std::move(f2).get();
 }
 
+TEST(Async, FairTaskQueueRoundRobinBetweenOperations) {
+    using namespace arcticdb::async;
+    FairTaskQueue queue;
+    std::vector<OperationId> order;
+    const OperationContext big{1, TaskPriority::NORMAL};
+    const OperationContext small{2, TaskPriority::NORMAL};
+    for (auto i = 0; i < 5; ++i)
+        queue.push([&order] { order.push_back(current_operation_context().operation_id_); }, big);
+
+    for (auto i = 0; i < 2; ++i)
+        queue.push([&order] { order.push_back(current_operation_context().operation_id_); }, small);
+
+    while (queue.run_next())
+        ;
+
+    ASSERT_EQ(order, (std::vector<OperationId>{1, 2, 1, 2, 1, 1, 1}));
+    ASSERT_EQ(queue.pending(), 0u);
+}
+
+TEST(Async, FairTaskQueuePriorityLanes) {
+    using namespace arcticdb::async;
+    FairTaskQueue queue;
+    std::vector<TaskPriority> order;
+    auto record = [&order] { order.push_back(current_operation_context().priority_); };
+    queue.push(record, OperationContext{1, TaskPriority::LOW});
+    queue.push(record, OperationContext{2, TaskPriority::NORMAL});
+    queue.push(record, OperationContext{3, TaskPriority::HIGH});
+    queue.push(record, OperationContext{1, TaskPriority::LOW});
+
+    auto stats = queue.lane_stats();
+    ASSERT_EQ(stats[static_cast<size_t>(TaskPriority::LOW)].pending_, 2u);
+
+    while (queue.run_next())
+        ;
+
+    ASSERT_EQ(
+            order,
+            (std::vector<TaskPriority>{TaskPriority::HIGH, TaskPriority::NORMAL, TaskPriority::LOW, TaskPriority::LOW})
+    );
+    stats = queue.lane_stats();
+    ASSERT_EQ(stats[static_cast<size_t>(TaskPriority::HIGH)].scheduled_, 1u);
+    ASSERT_EQ(stats[static_cast<size_t>(TaskPriority::LOW)].scheduled_, 2u);
+    ASSERT_EQ(stats[static_cast<size_t>(TaskPriority::LOW)].pending_, 0u);
+    // The context of the worker thread is restored once the task has run
+    ASSERT_EQ(current_operation_context().operation_id_, no_operation_id);
+}
+
+TEST(Async, ScopedOperationNesting) {
+    using namespace arcticdb::async;
+    ASSERT_EQ(current_operation_context().operation_id_, no_operation_id);
+    {
+        ScopedOperation outer{TaskPriority::HIGH};
+        const auto outer_id = outer.operation_id();
+        ASSERT_NE(outer_id, no_operation_id);
+        {
+            ScopedOperation inner{TaskPriority::LOW};
+            ASSERT_EQ(inner.operation_id(), outer_id);
+            ASSERT_EQ(current_operation_context().priority_, TaskPriority::HIGH);
+        }
+        ASSERT_EQ(current_operation_context().operation_id_, outer_id);
+    }
+    ASSERT_EQ(current_operation_context().operation_id_, no_operation_id);
+}
+
+TEST(Async, PrioritySchedulingPropagatesResultsAndContext) {
+    using namespace arcticdb;
+    ScopedConfig priority_scheduling("VersionStore.PriorityScheduling", 1);
+    async::TaskScheduler sched{2, 2};
+    ASSERT_TRUE(sched.priority_scheduling());
+
+    async::ScopedOperation operation{async::TaskPriority::HIGH};
+    std::vector<folly::Future<int>> futures;
+    for (auto x = 0; x < 10; ++x)
+        futures.push_back(sched.submit_cpu_task(Thing{x}));
+
+    auto results = folly::collect(futures).get();
+    for (auto x = 0; x < 10; ++x)
+        ASSERT_EQ(results[x], x + 2);
+
+    ASSERT_THROW(sched.submit_io_task(MaybeThrowTask(true)).get(), std::exception);
+    ASSERT_NO_THROW(sched.submit_io_task(MaybeThrowTask(false)).get());
+
+    const auto cpu_stats = sched.cpu_lane_stats();
+    ASSERT_EQ(cpu_stats[static_cast<size_t>(async::TaskPriority::HIGH)].scheduled_, 10u);
+    ASSERT_EQ(cpu_stats[static_cast<size_t>(async::TaskPriority::NORMAL)].scheduled_, 0u);
+    const auto io_stats = sched.io_lane_stats();
+    ASSERT_EQ(io_stats[static_cast<size_t>(async::TaskPriority::HIGH)].scheduled_, 2u);
+}
+
+TEST(Async, MemoryBudgetAdmitsInOrderAsBytesDrain) {
+    using namespace arcticdb::async;
+    auto budget = std::make_shared<MemoryBudget>(100);
+    auto first = budget->acquire(60);
+    auto second = budget->acquire(60);
+    auto third = budget->acquire(10);
+    ASSERT_TRUE(first.isReady());
+    ASSERT_FALSE(second.isReady());
+    // Admission is FIFO, so a small request does not overtake a larger one that is already waiting
+    ASSERT_FALSE(third.isReady());
+    ASSERT_EQ(budget->waiting(), 2u);
+
+    budget->release(60);
+    ASSERT_TRUE(second.isReady());
+    ASSERT_TRUE(third.isReady());
+    ASSERT_EQ(budget->in_flight_bytes(), 70u);
+    budget->release(60);
+    budget->release(10);
+    ASSERT_EQ(budget->in_flight_bytes(), 0u);
+    ASSERT_EQ(budget->peak_in_flight_bytes(), 70u);
+}
+
+TEST(Async, MemoryBudgetOversizedRequest) {
+    using namespace arcticdb::async;
+    auto budget = std::make_shared<MemoryBudget>(100);
+    auto small = budget->acquire(10);
+    auto huge = budget->acquire(1000);
+    ASSERT_FALSE(huge.isReady());
+    budget->release(10);
+    ASSERT_TRUE(huge.isReady());
+    ASSERT_EQ(budget->in_flight_bytes(), 1000u);
+    budget->release(1000);
+}
+
+TEST(Async, WithMemoryBudgetReleasesOnError) {
+    using namespace arcticdb;
+    auto budget = std::make_shared<async::MemoryBudget>(100);
+    async::TaskScheduler sched{2, 2};
+    std::vector<folly::Future<folly::Unit>> futures;
+    for (auto i = 0; i < 20; ++i) {
+        futures.push_back(async::with_memory_budget(budget, 30, [&sched, i]() {
+            return sched.submit_io_task(MaybeThrowTask(i == 5));
+        }));
+    }
+    auto results = folly::collectAll(futures).get();
+    ASSERT_TRUE(results[5].hasException());
+    ASSERT_FALSE(results[6].hasException());
+    ASSERT_EQ(budget->in_flight_bytes(), 0u);
+    ASSERT_LE(budget->peak_in_flight_bytes(), 100u);
+}
+
+TEST(Async, DecodedSegmentCacheKeyedByColumns) {
+    using namespace arcticdb;
+    async::DecodedSegmentCache cache{1UL << 30};
+    ASSERT_TRUE(cache.enabled());
+    auto segment = get_test_timeseries_frame("symbol", 100, 0).segment_;
+    const auto key = atom_key_builder().version_id(1).build("symbol", KeyType::TABLE_DATA);
+    const auto columns = std::make_shared<std::unordered_set<std::string>>(std::unordered_set<std::string>{"time", "a"});
+    cache.put(key, columns, segment);
+
+    auto hit = cache.get(key, std::make_shared<std::unordered_set<std::string>>(*columns));
+    ASSERT_TRUE(hit.has_value());
+    ASSERT_EQ(hit->row_count(), segment.row_count());
+    ASSERT_EQ(hit->descriptor().field_count(), segment.descriptor().field_count());
+    // Hits are copies, so consumers may modify them without affecting the cache or each other
+    ASSERT_NE(&hit->column(0), &segment.column(0));
+    ASSERT_NE(&hit->column(0), &cache.get(key, columns)->column(0));
+
+    ASSERT_FALSE(cache.get(key, nullptr).has_value());
+    ASSERT_FALSE(cache.get(key, std::make_shared<std::unordered_set<std::string>>()).has_value());
+    const auto other_key = atom_key_builder().version_id(2).build("symbol", KeyType::TABLE_DATA);
+    ASSERT_FALSE(cache.get(other_key, columns).has_value());
+}
+
+TEST(Async, DecodedSegmentCacheEvictsToByteBudget) {
+    using namespace arcticdb;
+    auto segment = get_test_timeseries_frame("symbol", 100, 0).segment_;
+    const auto segment_bytes = async::DecodedSegmentCache::segment_bytes(segment);
+    ASSERT_GT(segment_bytes, 0u);
+    const auto key = [](VersionId version_id) {
+        return atom_key_builder().version_id(version_id).build("symbol", KeyType::TABLE_DATA);
+    };
+
+    async::DecodedSegmentCache cache{2 * segment_bytes};
+    cache.put(key(1), nullptr, segment);
+    cache.put(key(2), nullptr, segment);
+    ASSERT_TRUE(cache.get(key(1), nullptr).has_value());
+    cache.put(key(3), nullptr, segment);
+    ASSERT_EQ(cache.size(), 2u);
+    ASSERT_EQ(cache.size_bytes(), 2 * segment_bytes);
+    ASSERT_TRUE(cache.get(key(1), nullptr).has_value());
+    ASSERT_FALSE(cache.get(key(2), nullptr).has_value());
+    ASSERT_TRUE(cache.get(key(3), nullptr).has_value());
+
+    async::DecodedSegmentCache small_cache{segment_bytes - 1};
+    small_cache.put(key(1), nullptr, segment);
+    ASSERT_EQ(small_cache.size(), 0u);
+    ASSERT_FALSE(async::DecodedSegmentCache{0}.enabled());
+}
+
 TEST(Async, NumCoresCgroupV1) {
     std::string test_path{"./test_v1"};
     std::string cpu_quota_path{"./test_v1/cpu/cpu.cfs_quota_us"};
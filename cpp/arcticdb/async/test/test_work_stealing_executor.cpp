@@ -0,0 +1,135 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+#include <arcticdb/async/task_scheduler.hpp>
+#include <arcticdb/async/work_stealing_executor.hpp>
+
+#include <folly/synchronization/Latch.h>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+
+using namespace arcticdb;
+
+namespace {
+std::unique_ptr<async::WorkStealingExecutor> make_executor(size_t num_threads, async::NumaTopology topology) {
+    return std::make_unique<async::WorkStealingExecutor>(
+            num_threads,
+            async::ThreadPinning::NONE,
+            std::move(topology),
+            std::make_shared<async::InstrumentedNamedFactory>("TestPool")
+    );
+}
+} // namespace
+
+TEST(WorkStealingExecutor, ParseCpuList) {
+    ASSERT_EQ(async::parse_cpu_list("0-3,8,10-11\n"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    ASSERT_EQ(async::parse_cpu_list("5"), (std::vector<int>{5}));
+    ASSERT_TRUE(async::parse_cpu_list("").empty());
+    ASSERT_THROW(async::parse_cpu_list("3-1"), std::exception);
+}
+
+TEST(WorkStealingExecutor, DetectTopologyFromSysfs) {
+    const std::filesystem::path root{"./test_numa_topology"};
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "node0");
+    std::filesystem::create_directories(root / "node1");
+    std::filesystem::create_directories(root / "node2");
+    std::filesystem::create_directories(root / "possible");
+    std::ofstream(root / "node0" / "cpulist") << "0-1,4-5\n";
+    std::ofstream(root / "node1" / "cpulist") << "2-3,6-7\n";
+    // Memory only node
+    std::ofstream(root / "node2" / "cpulist") << "\n";
+
+    auto topology = async::NumaTopology::detect(root.string());
+    ASSERT_EQ(topology.num_nodes(), 2u);
+    ASSERT_EQ(topology.node_cpus_[0], (std::vector<int>{0, 1, 4, 5}));
+    ASSERT_EQ(topology.node_cpus_[1], (std::vector<int>{2, 3, 6, 7}));
+
+    auto missing = async::NumaTopology::detect((root / "does_not_exist").string());
+    ASSERT_EQ(missing.num_nodes(), 1u);
+    std::filesystem::remove_all(root);
+}
+
+TEST(WorkStealingExecutor, RunsAllTasks) {
+    auto executor = make_executor(4, async::NumaTopology::single_node(4));
+    constexpr size_t num_tasks = 10'000;
+    std::atomic<size_t> sum{0};
+    folly::Latch latch(num_tasks);
+    for (size_t i = 0; i < num_tasks; ++i) {
+        executor->add([&sum, &latch, i] {
+            sum += i;
+            latch.count_down();
+        });
+    }
+    latch.wait();
+    ASSERT_EQ(sum, num_tasks * (num_tasks - 1) / 2);
+    ASSERT_EQ(executor->stats().executed_, num_tasks);
+}
+
+TEST(WorkStealingExecutor, NestedTasksAreStolenByIdleWorkers) {
+    auto executor = make_executor(4, async::NumaTopology{{{0, 1}, {2, 3}}});
+    ASSERT_EQ(executor->numa_node_of_worker(0), 0u);
+    ASSERT_EQ(executor->numa_node_of_worker(1), 1u);
+    constexpr size_t num_children = 64;
+    folly::Latch latch(num_children);
+    std::mutex mutex;
+    std::set<size_t> workers_used;
+    // A single parent task pushes every child onto its own deque, so any other worker that runs a child stole it
+    executor->add([&] {
+        for (size_t i = 0; i < num_children; ++i) {
+            executor->add([&] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                {
+                    std::lock_guard lock{mutex};
+                    workers_used.insert(*executor->current_worker());
+                }
+                latch.count_down();
+            });
+        }
+    });
+    latch.wait();
+    ASSERT_GT(workers_used.size(), 1u);
+    ASSERT_GT(executor->stats().stolen_, 0u);
+    ASSERT_FALSE(executor->current_worker().has_value());
+}
+
+TEST(WorkStealingExecutor, JoinDrainsQueuedWork) {
+    auto executor = make_executor(2, async::NumaTopology::single_node(2));
+    std::atomic<size_t> count{0};
+    for (size_t i = 0; i < 1'000; ++i)
+        executor->add([&count] { ++count; });
+
+    executor->join();
+    ASSERT_EQ(count, 1'000u);
+    ASSERT_THROW(executor->add([] {}), std::exception);
+}
+
+TEST(WorkStealingExecutor, TaskSchedulerIntegration) {
+    ScopedConfig work_stealing("VersionStore.WorkStealingCPUPool", 1);
+    async::TaskScheduler sched{3, 2};
+    ASSERT_NE(sched.work_stealing_exec(), nullptr);
+
+    struct AddTwo : async::BaseTask {
+        int x_;
+        explicit AddTwo(int x) : x_(x) {}
+        int operator()() const { return x_ + 2; }
+    };
+
+    std::vector<folly::Future<int>> futures;
+    for (auto i = 0; i < 100; ++i)
+        futures.push_back(sched.submit_cpu_task(AddTwo{i}));
+
+    auto results = folly::collect(futures).get();
+    for (auto i = 0; i < 100; ++i)
+        ASSERT_EQ(results[i], i + 2);
+
+    ASSERT_EQ(sched.work_stealing_exec()->stats().executed_, 100u);
+}
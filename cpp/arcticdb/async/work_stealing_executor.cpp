@@ -0,0 +1,306 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/async/work_stealing_executor.hpp>
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/util/string_utils.hpp>
+#include <arcticdb/log/log.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace arcticdb::async {
+
+namespace {
+struct CurrentWorker {
+    const WorkStealingExecutor* executor_ = nullptr;
+    size_t index_ = 0;
+};
+
+CurrentWorker& current_worker_slot() {
+    thread_local CurrentWorker worker;
+    return worker;
+}
+
+void pin_current_thread([[maybe_unused]] const std::vector<int>& cpus) {
+#ifdef __linux__
+    if (cpus.empty())
+        return;
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (auto cpu : cpus)
+        CPU_SET(cpu, &cpu_set);
+
+    if (auto rc = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set); rc != 0)
+        log::schedule().warn("Failed to pin worker thread to {} CPUs: error {}", cpus.size(), rc);
+#endif
+}
+} // namespace
+
+std::vector<int> parse_cpu_list(std::string_view cpu_list) {
+    std::vector<int> output;
+    while (!cpu_list.empty() && std::isspace(static_cast<unsigned char>(cpu_list.back())))
+        cpu_list.remove_suffix(1);
+
+    for (auto range : util::split_to_vector(cpu_list, ',')) {
+        if (auto dash = range.find('-'); dash != std::string_view::npos) {
+            const auto first = std::stoi(std::string{range.substr(0, dash)});
+            const auto last = std::stoi(std::string{range.substr(dash + 1)});
+            util::check(first <= last, "Invalid CPU range '{}' in cpu list '{}'", range, cpu_list);
+            for (auto cpu = first; cpu <= last; ++cpu)
+                output.push_back(cpu);
+        } else {
+            output.push_back(std::stoi(std::string{range}));
+        }
+    }
+    return output;
+}
+
+NumaTopology NumaTopology::single_node(size_t num_cpus) {
+    std::vector<int> cpus(num_cpus);
+    std::iota(cpus.begin(), cpus.end(), 0);
+    return NumaTopology{{std::move(cpus)}};
+}
+
+NumaTopology NumaTopology::detect(const std::string& sysfs_node_path) {
+    const auto fallback = [] {
+        const auto hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+        return single_node(hardware_threads);
+    };
+    std::error_code ec;
+    if (!std::filesystem::is_directory(sysfs_node_path, ec))
+        return fallback();
+
+    std::vector<std::pair<int, std::vector<int>>> nodes;
+    for (const auto& entry : std::filesystem::directory_iterator(sysfs_node_path, ec)) {
+        const auto name = entry.path().filename().string();
+        if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+            !std::all_of(name.begin() + 4, name.end(), [](unsigned char c) { return std::isdigit(c); }))
+            continue;
+
+        std::ifstream strm((entry.path() / "cpulist").string());
+        if (!strm)
+            continue;
+
+        std::string cpu_list;
+        std::getline(strm, cpu_list);
+        auto cpus = parse_cpu_list(cpu_list);
+        // Memory-only nodes have no CPUs and cannot host workers
+        if (!cpus.empty())
+            nodes.emplace_back(std::stoi(name.substr(4)), std::move(cpus));
+    }
+    if (nodes.empty())
+        return fallback();
+
+    std::sort(nodes.begin(), nodes.end(), [](const auto& l, const auto& r) { return l.first < r.first; });
+    NumaTopology output;
+    for (auto& [node, cpus] : nodes)
+        output.node_cpus_.emplace_back(std::move(cpus));
+
+    return output;
+}
+
+WorkStealingExecutor::WorkStealingExecutor(
+        size_t num_threads, ThreadPinning pinning, NumaTopology topology,
+        std::shared_ptr<folly::ThreadFactory> thread_factory
+) {
+    util::check(num_threads > 0, "WorkStealingExecutor requires at least one thread");
+    util::check(topology.num_nodes() > 0, "WorkStealingExecutor requires at least one NUMA node");
+    const auto num_nodes = topology.num_nodes();
+    std::vector<size_t> next_cpu_on_node(num_nodes, 0);
+    workers_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->numa_node_ = i % num_nodes;
+        const auto& node_cpus = topology.node_cpus_[worker->numa_node_];
+        switch (pinning) {
+        case ThreadPinning::NUMA_NODE:
+            worker->cpus_ = node_cpus;
+            break;
+        case ThreadPinning::CORE:
+            if (!node_cpus.empty())
+                worker->cpus_ = {node_cpus[next_cpu_on_node[worker->numa_node_]++ % node_cpus.size()]};
+            break;
+        default:
+            break;
+        }
+        workers_.emplace_back(std::move(worker));
+    }
+
+    steal_order_.resize(num_threads);
+    for (size_t thief = 0; thief < num_threads; ++thief) {
+        auto& order = steal_order_[thief];
+        // Start just after the thief so that thieves do not all converge on worker 0
+        for (size_t offset = 1; offset < num_threads; ++offset)
+            order.push_back((thief + offset) % num_threads);
+
+        std::stable_partition(order.begin(), order.end(), [this, thief](size_t victim) {
+            return workers_[victim]->numa_node_ == workers_[thief]->numa_node_;
+        });
+    }
+
+    for (size_t i = 0; i < num_threads; ++i)
+        workers_[i]->thread_ = thread_factory->newThread([this, i] { run(i); });
+
+    ARCTICDB_RUNTIME_DEBUG(
+            log::schedule(),
+            "Work stealing executor created with {} threads over {} NUMA nodes, pinning {}",
+            num_threads,
+            num_nodes,
+            static_cast<int>(pinning)
+    );
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() { shutdown(true); }
+
+std::optional<size_t> WorkStealingExecutor::current_worker() const {
+    const auto& slot = current_worker_slot();
+    return slot.executor_ == this ? std::make_optional(slot.index_) : std::nullopt;
+}
+
+void WorkStealingExecutor::add(folly::Func func) {
+    const auto worker = current_worker();
+    // Tasks that are already running may still fan out while the executor drains
+    util::check(!stopping_ && (!draining_ || worker), "Cannot add work to a stopped WorkStealingExecutor");
+    const auto index = worker ? *worker : next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+    {
+        std::lock_guard lock{workers_[index]->mutex_};
+        workers_[index]->tasks_.emplace_back(std::move(func));
+    }
+    {
+        std::lock_guard lock{wake_mutex_};
+        ++pending_;
+        ++wake_generation_;
+    }
+    wake_cv_.notify_one();
+}
+
+std::optional<folly::Func> WorkStealingExecutor::pop_local(size_t index) {
+    auto& worker = *workers_[index];
+    std::lock_guard lock{worker.mutex_};
+    if (worker.tasks_.empty())
+        return std::nullopt;
+
+    auto func = std::move(worker.tasks_.back());
+    worker.tasks_.pop_back();
+    return func;
+}
+
+std::optional<folly::Func> WorkStealingExecutor::try_steal_from(size_t victim, bool block) {
+    auto& worker = *workers_[victim];
+    std::unique_lock lock{worker.mutex_, std::defer_lock};
+    if (block)
+        lock.lock();
+    else if (!lock.try_lock())
+        return std::nullopt;
+
+    if (worker.tasks_.empty())
+        return std::nullopt;
+
+    auto func = std::move(worker.tasks_.front());
+    worker.tasks_.pop_front();
+    return func;
+}
+
+std::optional<folly::Func> WorkStealingExecutor::steal(size_t thief, bool block) {
+    for (auto victim : steal_order_[thief]) {
+        if (auto func = try_steal_from(victim, block); func) {
+            stolen_.fetch_add(1, std::memory_order_relaxed);
+            return func;
+        }
+    }
+    return std::nullopt;
+}
+
+void WorkStealingExecutor::run(size_t index) {
+    current_worker_slot() = CurrentWorker{this, index};
+    pin_current_thread(workers_[index]->cpus_);
+    while (!stopping_) {
+        uint64_t generation;
+        {
+            std::lock_guard lock{wake_mutex_};
+            generation = wake_generation_;
+        }
+        auto func = pop_local(index);
+        if (!func)
+            func = steal(index, false);
+
+        // A round of try-locks can fail on contended deques while tasks are still queued, so check every deque
+        // properly before going to sleep rather than spinning on pending_
+        if (!func && pending_ > 0)
+            func = steal(index, true);
+
+        if (func) {
+            if (--pending_ <= 0 && draining_) {
+                std::lock_guard lock{wake_mutex_};
+                wake_cv_.notify_all();
+            }
+            try {
+                (*func)();
+            } catch (const std::exception& e) {
+                log::schedule().error("Unhandled exception in work stealing executor task: {}", e.what());
+            }
+            executed_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        // Every deque was empty when checked, so whatever pending_ still counts is being popped by other workers.
+        // Sleep until a task is added after the checks began, rather than until pending_ reaches zero
+        std::unique_lock lock{wake_mutex_};
+        wake_cv_.wait(lock, [this, generation] {
+            return wake_generation_ != generation || stopping_ || (draining_ && pending_ <= 0);
+        });
+        if (draining_ && pending_ <= 0)
+            break;
+    }
+    current_worker_slot() = CurrentWorker{};
+}
+
+void WorkStealingExecutor::shutdown(bool drain) {
+    std::call_once(shutdown_flag_, [this, drain] {
+        {
+            std::lock_guard lock{wake_mutex_};
+            if (drain)
+                draining_ = true;
+            else
+                stopping_ = true;
+        }
+        wake_cv_.notify_all();
+        for (auto& worker : workers_) {
+            if (worker->thread_.joinable())
+                worker->thread_.join();
+        }
+        for (auto& worker : workers_) {
+            std::lock_guard lock{worker->mutex_};
+            worker->tasks_.clear();
+        }
+    });
+}
+
+void WorkStealingExecutor::join() { shutdown(true); }
+
+void WorkStealingExecutor::stop() { shutdown(false); }
+
+WorkStealingExecutor::Stats WorkStealingExecutor::stats() const {
+    return Stats{
+            executed_.load(std::memory_order_relaxed),
+            stolen_.load(std::memory_order_relaxed),
+            pending_.load(std::memory_order_relaxed)
+    };
+}
+
+} // namespace arcticdb::async
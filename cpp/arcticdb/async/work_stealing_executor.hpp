@@ -0,0 +1,134 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/util/constructors.hpp>
+
+#include <folly/Executor.h>
+#include <folly/executors/thread_factory/ThreadFactory.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace arcticdb::async {
+
+// Parses the kernel's cpulist format, e.g. "0-3,8,10-11"
+std::vector<int> parse_cpu_list(std::string_view cpu_list);
+
+struct NumaTopology {
+    // CPUs belonging to each NUMA node. Never empty: machines without NUMA information are one node with every CPU.
+    std::vector<std::vector<int>> node_cpus_;
+
+    static NumaTopology detect(const std::string& sysfs_node_path = "/sys/devices/system/node");
+
+    static NumaTopology single_node(size_t num_cpus);
+
+    [[nodiscard]] size_t num_nodes() const { return node_cpus_.size(); }
+};
+
+enum class ThreadPinning : uint8_t {
+    NONE = 0,
+    // Each worker may run on any CPU of the NUMA node it is assigned to
+    NUMA_NODE = 1,
+    // Each worker is bound to a single CPU
+    CORE = 2
+};
+
+/*
+ * Alternative to folly's CPUThreadPoolExecutor, which has a single queue shared by every worker.
+ *
+ * Every worker owns a deque. Work submitted from a worker (e.g. the per-segment tasks a clause fans out) goes to the
+ * back of that worker's own deque and is popped LIFO, so it runs while its inputs are still in that core's cache.
+ * Work submitted from outside is spread round-robin. An idle worker steals from the front of other workers' deques,
+ * trying workers on its own NUMA node before remote ones.
+ *
+ * With pinning enabled workers are assigned to NUMA nodes round-robin. Output frames are allocated without touching
+ * their pages (see allocate_contiguous_frame), and read_and_continue decodes on this executor when it is enabled, so
+ * the decoding worker that first writes a slice places those pages on its own node.
+ */
+class WorkStealingExecutor : public folly::Executor {
+  public:
+    struct Stats {
+        uint64_t executed_ = 0;
+        uint64_t stolen_ = 0;
+        int64_t pending_ = 0;
+    };
+
+    WorkStealingExecutor(
+            size_t num_threads, ThreadPinning pinning, NumaTopology topology,
+            std::shared_ptr<folly::ThreadFactory> thread_factory
+    );
+
+    ~WorkStealingExecutor() override;
+
+    ARCTICDB_NO_MOVE_OR_COPY(WorkStealingExecutor)
+
+    void add(folly::Func func) override;
+
+    // Runs everything already queued, then stops the workers
+    void join();
+
+    // Stops the workers once their current task completes, discarding anything still queued
+    void stop();
+
+    [[nodiscard]] size_t num_threads() const { return workers_.size(); }
+
+    [[nodiscard]] size_t numa_node_of_worker(size_t worker) const { return workers_[worker]->numa_node_; }
+
+    // Index of the calling worker if called from one of this executor's threads
+    [[nodiscard]] std::optional<size_t> current_worker() const;
+
+    [[nodiscard]] Stats stats() const;
+
+  private:
+    struct Worker {
+        std::mutex mutex_;
+        std::deque<folly::Func> tasks_;
+        size_t numa_node_ = 0;
+        std::vector<int> cpus_;
+        std::thread thread_;
+    };
+
+    void run(size_t index);
+
+    std::optional<folly::Func> pop_local(size_t index);
+
+    // Without block, victims whose deque is locked are skipped
+    std::optional<folly::Func> steal(size_t thief, bool block);
+
+    std::optional<folly::Func> try_steal_from(size_t victim, bool block);
+
+    void shutdown(bool drain);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    // Victims to try when stealing, same-node workers first
+    std::vector<std::vector<size_t>> steal_order_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    // Incremented under wake_mutex_ whenever a task is added, so that an idle worker only sleeps until new work arrives
+    uint64_t wake_generation_ = 0;
+    std::atomic<int64_t> pending_{0};
+    std::atomic<size_t> next_worker_{0};
+    std::atomic<bool> draining_{false};
+    std::atomic<bool> stopping_{false};
+    std::atomic<uint64_t> executed_{0};
+    std::atomic<uint64_t> stolen_{0};
+    std::once_flag shutdown_flag_;
+};
+
+} // namespace arcticdb::async
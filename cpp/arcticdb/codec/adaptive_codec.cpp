@@ -0,0 +1,43 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/codec/adaptive_codec.hpp>
+#include <arcticdb/util/preconditions.hpp>
+
+#include <lz4.h>
+#include <zstd.h>
+
+namespace arcticdb::codec {
+
+size_t lz4_compressed_size(const uint8_t* data, size_t bytes) {
+    thread_local std::vector<char> scratch;
+    scratch.resize(LZ4_compressBound(static_cast<int>(bytes)));
+    const int compressed = LZ4_compress_default(
+            reinterpret_cast<const char*>(data),
+            scratch.data(),
+            static_cast<int>(bytes),
+            static_cast<int>(scratch.size())
+    );
+    return compressed > 0 ? static_cast<size_t>(compressed) : bytes;
+}
+
+size_t zstd_compressed_size(const uint8_t* data, size_t bytes, int level) {
+    thread_local std::vector<uint8_t> scratch;
+    scratch.resize(ZSTD_compressBound(bytes));
+    const size_t compressed = ZSTD_compress(scratch.data(), scratch.size(), data, bytes, level);
+    return ZSTD_isError(compressed) ? bytes : compressed;
+}
+
+CodecTrial best_trial(const std::vector<CodecTrial>& trials) {
+    util::check(!trials.empty(), "No codec trials to choose from");
+    return *std::min_element(trials.begin(), trials.end(), [](const auto& left, const auto& right) {
+        return left.bytes_ < right.bytes_;
+    });
+}
+
+} // namespace arcticdb::codec
@@ -0,0 +1,91 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/codec/default_codecs.hpp>
+#include <arcticdb/codec/tp4.hpp>
+#include <arcticdb/entity/protobufs.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace arcticdb::codec {
+
+/*
+ * The adaptive codec picks a concrete codec for each block from a trial compression of the first
+ * adaptive_sample_size values of the block with every candidate. This captures the properties that decide which codec
+ * wins (sortedness and value range favour the tp4 codecs, repeated values and low cardinality favour LZ4 and ZSTD,
+ * incompressible data favours passthrough) without modelling them separately. The chosen codec is what is recorded
+ * in the block, so readers need no knowledge of the adaptive codec.
+ *
+ * With the SPEED objective the candidates are passthrough, the tp4 codecs and LZ4, and passthrough is kept unless
+ * compression saves at least adaptive_min_saving of the sample. With the SIZE objective ZSTD at the configured level
+ * is also a candidate and the smallest result wins. Ties go to the codec that decodes faster.
+ *
+ * The trials cost a compression of the sample per candidate for every block, so the adaptive codec is only used for
+ * the columns of data segments (see ColumnTypeCodecs). Index, version and snapshot keys keep the library codec.
+ */
+constexpr size_t adaptive_sample_size = 1024;
+constexpr double adaptive_min_saving = 0.1;
+
+size_t lz4_compressed_size(const uint8_t* data, size_t bytes);
+
+size_t zstd_compressed_size(const uint8_t* data, size_t bytes, int level);
+
+struct CodecTrial {
+    arcticdb::proto::encoding::VariantCodec codec_;
+    size_t bytes_;
+};
+
+// Picks the smallest trial, the trials being ordered fastest to decode first so that ties go to the faster codec
+CodecTrial best_trial(const std::vector<CodecTrial>& trials);
+
+template<typename T>
+arcticdb::proto::encoding::VariantCodec choose_block_codec(
+        const arcticdb::proto::encoding::VariantCodec::Adaptive& opts, const T* values, size_t count
+) {
+    using Objective = arcticdb::proto::encoding::VariantCodec::Adaptive;
+    const size_t sample_count = std::min(count, adaptive_sample_size);
+    const size_t sample_bytes = sample_count * sizeof(T);
+    const auto* sample = reinterpret_cast<const uint8_t*>(values);
+    if (sample_bytes == 0)
+        return default_passthrough_codec();
+
+    std::vector<CodecTrial> trials;
+    if (opts.objective() == Objective::SIZE)
+        trials.push_back({default_passthrough_codec(), sample_bytes});
+
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        thread_local std::vector<uint8_t> scratch;
+        scratch.resize(detail::tp4::max_encoded_size(sample_bytes));
+        for (auto sub_codec : {arcticdb::proto::encoding::VariantCodec::TurboPfor::P4,
+                               arcticdb::proto::encoding::VariantCodec::TurboPfor::P4_DELTA,
+                               arcticdb::proto::encoding::VariantCodec::TurboPfor::P4_ZZ}) {
+            trials.push_back(
+                    {default_tp4_codec(sub_codec), detail::tp4::encode(sub_codec, values, sample_count, scratch.data())}
+            );
+        }
+    }
+    trials.push_back({default_lz4_codec(), lz4_compressed_size(sample, sample_bytes)});
+    if (opts.objective() == Objective::SIZE) {
+        const auto zstd_bytes = zstd_compressed_size(sample, sample_bytes, opts.zstd_level());
+        trials.push_back({default_zstd_codec(opts.zstd_level()), zstd_bytes});
+        return best_trial(trials).codec_;
+    }
+
+    auto best = best_trial(trials);
+    if (static_cast<double>(best.bytes_) > static_cast<double>(sample_bytes) * (1.0 - adaptive_min_saving))
+        return default_passthrough_codec();
+
+    return best.codec_;
+}
+
+} // namespace arcticdb::codec
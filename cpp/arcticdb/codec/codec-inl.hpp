@@ -14,10 +14,12 @@
 #include <arcticdb/codec/passthrough.hpp>
 #include <arcticdb/codec/zstd.hpp>
 #include <arcticdb/codec/lz4.hpp>
+#include <arcticdb/codec/tp4.hpp>
 #include <arcticdb/codec/encoded_field.hpp>
 #include <arcticdb/codec/magic_words.hpp>
 #include <arcticdb/util/bitset.hpp>
 #include <arcticdb/util/sparse_utils.hpp>
+#include <cstring>
 #include <type_traits>
 
 namespace arcticdb {
@@ -41,6 +43,16 @@ void decode_block(const BlockType& block, const std::uint8_t* input, T* output)
         case arcticdb::Codec::LZ4:
             arcticdb::detail::Lz4Decoder::decode_block<T>(encoder_version, input, size_to_decode, output, decoded_size);
             break;
+        case arcticdb::Codec::PFOR:
+            arcticdb::detail::TurboPForDecoder::decode_block<T>(
+                    encoder_version,
+                    static_cast<arcticdb::detail::tp4::SubCodec>(block.codec().pfor().sub_codec_),
+                    input,
+                    size_to_decode,
+                    output,
+                    decoded_size
+            );
+            break;
         default:
             util::raise_rte("Unsupported block codec {}", codec_type_to_string(block.codec().codec_type()));
         }
@@ -58,10 +70,29 @@ inline void read_shapes(
     data_sink.advance_shapes(shape.in_bytes());
 }
 
+// Whether the values of field are in the blocks that skipped_blocks describes, so that they can be skipped
+template<typename T, typename NDArrayEncodedFieldType>
+bool values_in_skippable_blocks(const NDArrayEncodedFieldType& field, const SkippedBlocks& skipped_blocks) {
+    const auto num_blocks = field.values_size();
+    if (field.sparse_map_bytes() > 0 || static_cast<size_t>(num_blocks) != skipped_blocks.skipped_.size()) {
+        return false;
+    }
+    const auto block_bytes = skipped_blocks.rows_per_block_ * sizeof(T);
+    for (auto block_num = 0; block_num < num_blocks; ++block_num) {
+        const auto block_in_bytes = field.values(block_num).in_bytes();
+        const bool is_last_block = block_num + 1 == num_blocks;
+        if (is_last_block ? block_in_bytes == 0 || block_in_bytes > block_bytes : block_in_bytes != block_bytes) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<class DataSink, typename NDArrayEncodedFieldType>
 std::size_t decode_ndarray(
         const TypeDescriptor& td, const NDArrayEncodedFieldType& field, const std::uint8_t* input, DataSink& data_sink,
-        std::optional<util::BitMagic>& bv, EncodingVersion encoding_version
+        std::optional<util::BitMagic>& bv, EncodingVersion encoding_version,
+        const SkippedBlocks* skipped_blocks = nullptr
 ) {
     ARCTICDB_SUBSAMPLE_AGG(DecodeNdArray)
 
@@ -107,6 +138,10 @@ std::size_t decode_ndarray(
                 encoding_sizes::ndarray_field_compressed_size(field),
                 num_blocks
         );
+        bool skips_blocks = false;
+        if constexpr (TD::DimensionTag::value == Dimension::Dim0) {
+            skips_blocks = skipped_blocks != nullptr && values_in_skippable_blocks<T>(field, *skipped_blocks);
+        }
         shape_t* shapes_out = nullptr;
         if constexpr (TD::DimensionTag::value != Dimension::Dim0) {
             const auto shape_size = encoding_sizes::shape_uncompressed_size(field);
@@ -128,7 +163,12 @@ std::size_t decode_ndarray(
             const auto& block_info = field.values(block_num);
             ARCTICDB_TRACE(log::codec(), "Decoding block {} at pos {}", block_num, data_in - input);
             size_t block_inflated_size;
-            decode_block<T>(block_info, data_in, reinterpret_cast<T*>(data_out));
+            if (skips_blocks && skipped_blocks->skipped_[block_num]) {
+                ARCTICDB_TRACE(log::codec(), "Skipping block {}", block_num);
+                std::memset(data_out, 0, block_info.in_bytes());
+            } else {
+                decode_block<T>(block_info, data_in, reinterpret_cast<T*>(data_out));
+            }
             block_inflated_size = block_info.in_bytes();
             data_out += block_inflated_size;
             data_sink.advance_data(block_inflated_size);
@@ -165,7 +205,7 @@ std::size_t decode_ndarray(
 template<class DataSink>
 std::size_t decode_field(
         const TypeDescriptor& td, const EncodedFieldImpl& field, const std::uint8_t* input, DataSink& data_sink,
-        std::optional<util::BitMagic>& bv, EncodingVersion encoding_version
+        std::optional<util::BitMagic>& bv, EncodingVersion encoding_version, const SkippedBlocks* skipped_blocks
 ) {
     size_t magic_size = 0u;
     if (encoding_version != EncodingVersion::V1) {
@@ -175,7 +215,7 @@ std::size_t decode_field(
 
     switch (field.encoding_case()) {
     case EncodedFieldType::NDARRAY:
-        return decode_ndarray(td, field.ndarray(), input, data_sink, bv, encoding_version) + magic_size;
+        return decode_ndarray(td, field.ndarray(), input, data_sink, bv, encoding_version, skipped_blocks) + magic_size;
     default:
         util::raise_rte("Unsupported encoding {}", field);
     }
@@ -22,23 +22,23 @@ constexpr TypeDescriptor metadata_type_desc() { return TypeDescriptor{DataType::
 
 SizeResult max_compressed_size_dispatch(
         const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
-        EncodingVersion encoding_version
+        EncodingVersion encoding_version, bool is_data_segment
 ) {
     if (encoding_version == EncodingVersion::V2) {
-        return max_compressed_size_v2(in_mem_seg, codec_opts);
+        return max_compressed_size_v2(in_mem_seg, codec_opts, is_data_segment);
     } else {
-        return max_compressed_size_v1(in_mem_seg, codec_opts);
+        return max_compressed_size_v1(in_mem_seg, codec_opts, is_data_segment);
     }
 }
 
 Segment encode_dispatch(
         SegmentInMemory&& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
-        EncodingVersion encoding_version
+        EncodingVersion encoding_version, bool is_data_segment
 ) {
     if (encoding_version == EncodingVersion::V2) {
-        return encode_v2(std::move(in_mem_seg), codec_opts);
+        return encode_v2(std::move(in_mem_seg), codec_opts, is_data_segment);
     } else {
-        return encode_v1(std::move(in_mem_seg), codec_opts);
+        return encode_v1(std::move(in_mem_seg), codec_opts, is_data_segment);
     }
 }
 
@@ -383,6 +383,18 @@ void decode_string_pool(
     }
 }
 
+// A partial decode of only non-string columns, such as of the column stats a query filters on, does not use the string
+// pool, which holds the values of the string columns left out
+bool needs_string_pool(const SegmentInMemory& res, const StreamDescriptor& desc) {
+    if (res.descriptor().field_count() >= desc.field_count()) {
+        return true;
+    }
+    const auto& fields = res.descriptor().fields();
+    return std::any_of(fields.begin(), fields.end(), [](const auto& field) {
+        return is_sequence_type(field.type().data_type());
+    });
+}
+
 ssize_t calculate_last_row(const Column& col) {
     ssize_t last_row{0};
     if (col.opt_sparse_map().has_value()) {
@@ -396,7 +408,10 @@ ssize_t calculate_last_row(const Column& col) {
     return last_row;
 }
 
-void decode_v2(const Segment& segment, const SegmentHeader& hdr, SegmentInMemory& res, const StreamDescriptor& desc) {
+void decode_v2(
+        const Segment& segment, const SegmentHeader& hdr, SegmentInMemory& res, const StreamDescriptor& desc,
+        const BlockFilter& block_filter
+) {
     ARCTICDB_SAMPLE(DecodeSegment, 0)
     if (segment.buffer().data() == nullptr) {
         ARCTICDB_DEBUG(log::codec(), "Segment contains no data in decode_v2");
@@ -438,6 +453,7 @@ void decode_v2(const Segment& segment, const SegmentHeader& hdr, SegmentInMemory
 
         auto encoded_field = encoded_fields.begin();
         res.init_column_map();
+        const auto skipped_blocks = block_filter ? block_filter(res) : std::nullopt;
 
         ssize_t seg_row_count = 0;
         for (std::size_t i = 0; i < fields_size; ++i) {
@@ -458,7 +474,8 @@ void decode_v2(const Segment& segment, const SegmentHeader& hdr, SegmentInMemory
                         data,
                         col,
                         col.opt_sparse_map(),
-                        hdr.encoding_version()
+                        hdr.encoding_version(),
+                        skipped_blocks ? &*skipped_blocks : nullptr
                 );
                 col.set_statistics(encoded_field->get_statistics());
 
@@ -471,7 +488,9 @@ void decode_v2(const Segment& segment, const SegmentHeader& hdr, SegmentInMemory
         }
 
         util::check_magic<StringPoolMagic>(data);
-        decode_string_pool(hdr, data, begin, end, res);
+        if (needs_string_pool(res, desc)) {
+            decode_string_pool(hdr, data, begin, end, res);
+        }
 
         res.set_row_data(static_cast<ssize_t>(start_row + seg_row_count));
         res.set_compacted(segment.header().compacted());
@@ -480,7 +499,7 @@ void decode_v2(const Segment& segment, const SegmentHeader& hdr, SegmentInMemory
 
 void decode_v1(
         const Segment& segment, const SegmentHeader& hdr, SegmentInMemory& res, const StreamDescriptor& desc,
-        bool is_decoding_incompletes
+        bool is_decoding_incompletes, const BlockFilter& block_filter
 ) {
     ARCTICDB_SAMPLE(DecodeSegment, 0)
     const uint8_t* data = segment.buffer().data();
@@ -511,6 +530,7 @@ void decode_v1(
         const auto start_row = res.row_count();
 
         res.init_column_map();
+        const auto skipped_blocks = block_filter ? block_filter(res) : std::nullopt;
 
         ssize_t seg_row_count = 0;
         for (std::size_t i = 0; i < fields_size; ++i) {
@@ -525,7 +545,13 @@ void decode_v1(
             if (auto col_index = res.column_index(field_name)) {
                 auto& col = res.column(static_cast<position_t>(*col_index));
                 data += decode_field(
-                        res.field(*col_index).type(), field, data, col, col.opt_sparse_map(), hdr.encoding_version()
+                        res.field(*col_index).type(),
+                        field,
+                        data,
+                        col,
+                        col.opt_sparse_map(),
+                        hdr.encoding_version(),
+                        skipped_blocks ? &*skipped_blocks : nullptr
                 );
                 seg_row_count = std::max(seg_row_count, calculate_last_row(col));
                 col.set_statistics(field.get_statistics());
@@ -535,19 +561,22 @@ void decode_v1(
                 ARCTICDB_TRACE(log::codec(), "Skipped column {}, at position {}", i, data - begin);
             }
         }
-        decode_string_pool(hdr, data, begin, end, res);
+        if (needs_string_pool(res, desc)) {
+            decode_string_pool(hdr, data, begin, end, res);
+        }
         res.set_row_data(static_cast<ssize_t>(start_row + seg_row_count));
         res.set_compacted(segment.header().compacted());
     }
 }
 
 void decode_into_memory_segment(
-        const Segment& segment, SegmentHeader& hdr, SegmentInMemory& res, const StreamDescriptor& desc
+        const Segment& segment, SegmentHeader& hdr, SegmentInMemory& res, const StreamDescriptor& desc,
+        const BlockFilter& block_filter
 ) {
     if (EncodingVersion(segment.header().encoding_version()) == EncodingVersion::V2)
-        decode_v2(segment, hdr, res, desc);
+        decode_v2(segment, hdr, res, desc, block_filter);
     else
-        decode_v1(segment, hdr, res, desc);
+        decode_v1(segment, hdr, res, desc, false, block_filter);
 }
 
 SegmentInMemory decode_segment(Segment& segment, AllocationType allocation_type) {
@@ -14,30 +14,56 @@
 #include <arcticdb/entity/stream_descriptor.hpp>
 #include <arcticdb/codec/segment_header.hpp>
 
+#include <functional>
+
 namespace arcticdb {
 
 using ShapesBlockTDT = entity::TypeDescriptorTag<
         entity::DataTypeTag<entity::DataType::INT64>, entity::DimensionTag<entity::Dimension::Dim0>>;
 
+// is_data_segment is true for the segments of TABLE_DATA keys, whose columns can use the column type codecs (see
+// codec::ColumnTypeCodecs) rather than codec_opts
 Segment encode_dispatch(
         SegmentInMemory&& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
-        EncodingVersion encoding_version
+        EncodingVersion encoding_version, bool is_data_segment = false
+);
+
+Segment encode_v2(
+        SegmentInMemory&& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        bool is_data_segment = false
+);
+
+Segment encode_v1(
+        SegmentInMemory&& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        bool is_data_segment = false
 );
 
-Segment encode_v2(SegmentInMemory&& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts);
+/*
+ * Blocks of values that decoding leaves zeroed rather than decompressing. Applies to the dense scalar columns of a
+ * segment whose values are encoded in blocks of rows_per_block_ rows, one block per element of skipped_, and skips the
+ * blocks whose element is set. Other columns are decoded in full.
+ */
+struct SkippedBlocks {
+    size_t rows_per_block_ = 0;
+    std::vector<bool> skipped_;
+};
 
-Segment encode_v1(SegmentInMemory&& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts);
+// Given a segment whose metadata has been decoded, the blocks to skip decoding its columns, if any
+using BlockFilter = std::function<std::optional<SkippedBlocks>(const SegmentInMemory&)>;
 
 void decode_v1(
         const Segment& segment, const SegmentHeader& hdr, SegmentInMemory& res, const StreamDescriptor& desc,
-        bool is_decoding_incompletes = false
+        bool is_decoding_incompletes = false, const BlockFilter& block_filter = {}
 );
 
-void decode_v2(const Segment& segment, const SegmentHeader& hdr, SegmentInMemory& res, const StreamDescriptor& desc);
+void decode_v2(
+        const Segment& segment, const SegmentHeader& hdr, SegmentInMemory& res, const StreamDescriptor& desc,
+        const BlockFilter& block_filter = {}
+);
 
 SizeResult max_compressed_size_dispatch(
         const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
-        EncodingVersion encoding_version
+        EncodingVersion encoding_version, bool is_data_segment = false
 );
 
 EncodedFieldCollection decode_encoded_fields(
@@ -47,13 +73,15 @@ EncodedFieldCollection decode_encoded_fields(
 SegmentInMemory decode_segment(Segment& segment, AllocationType allocation_type = AllocationType::DYNAMIC);
 
 void decode_into_memory_segment(
-        const Segment& segment, SegmentHeader& hdr, SegmentInMemory& res, const entity::StreamDescriptor& desc
+        const Segment& segment, SegmentHeader& hdr, SegmentInMemory& res, const entity::StreamDescriptor& desc,
+        const BlockFilter& block_filter = {}
 );
 
 template<class DataSink>
 std::size_t decode_field(
         const entity::TypeDescriptor& td, const EncodedFieldImpl& field, const uint8_t* input, DataSink& data_sink,
-        std::optional<util::BitMagic>& bv, arcticdb::EncodingVersion encoding_version
+        std::optional<util::BitMagic>& bv, arcticdb::EncodingVersion encoding_version,
+        const SkippedBlocks* skipped_blocks = nullptr
 );
 
 std::optional<google::protobuf::Any> decode_metadata_from_segment(const Segment& segment);
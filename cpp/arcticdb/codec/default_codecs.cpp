@@ -0,0 +1,72 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/codec/default_codecs.hpp>
+#include <arcticdb/codec/tp4.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/preconditions.hpp>
+
+#include <boost/algorithm/string.hpp>
+
+namespace arcticdb::codec {
+
+std::optional<arcticdb::proto::encoding::VariantCodec> codec_from_name(std::string_view name) {
+    const auto upper = boost::to_upper_copy(boost::trim_copy(std::string{name}));
+    if (upper.empty())
+        return std::nullopt;
+
+    if (upper == "LZ4")
+        return default_lz4_codec();
+
+    if (upper == "ZSTD")
+        return default_zstd_codec(0);
+
+    arcticdb::proto::encoding::VariantCodec::TurboPfor::SubCodecs sub_codec;
+    util::check(
+            arcticdb::proto::encoding::VariantCodec::TurboPfor::SubCodecs_Parse(upper, &sub_codec) &&
+                    detail::tp4::is_supported(sub_codec),
+            "Unknown codec '{}', expected one of P4, P4_DELTA, P4_ZZ, LZ4 or ZSTD",
+            name
+    );
+    return default_tp4_codec(sub_codec);
+}
+
+std::optional<arcticdb::proto::encoding::VariantCodec> adaptive_codec_from_objective(
+        std::string_view objective, int32_t zstd_level
+) {
+    const auto upper = boost::to_upper_copy(boost::trim_copy(std::string{objective}));
+    if (upper.empty())
+        return std::nullopt;
+
+    arcticdb::proto::encoding::VariantCodec::Adaptive::Objective parsed;
+    util::check(
+            arcticdb::proto::encoding::VariantCodec::Adaptive::Objective_Parse(upper, &parsed),
+            "Unknown adaptive codec objective '{}', expected SPEED or SIZE",
+            objective
+    );
+    return default_adaptive_codec(parsed, zstd_level);
+}
+
+ColumnTypeCodecs ColumnTypeCodecs::from_config() {
+    const auto config = ConfigsMap::instance();
+    return ColumnTypeCodecs{
+            codec_from_name(config->get_string("Codec.IntegerColumns", "")),
+            codec_from_name(config->get_string("Codec.TimestampColumns", "")),
+            adaptive_codec_from_objective(
+                    config->get_string("Codec.Adaptive", ""),
+                    static_cast<int32_t>(config->get_int("Codec.AdaptiveZstdLevel", 0))
+            )
+    };
+}
+
+const ColumnTypeCodecs& ColumnTypeCodecs::instance() {
+    static const auto instance_ = from_config();
+    return instance_;
+}
+
+} // namespace arcticdb::codec
@@ -9,6 +9,10 @@
 #pragma once
 
 #include <arcticdb/entity/protobufs.hpp>
+#include <arcticdb/entity/types.hpp>
+
+#include <optional>
+#include <string_view>
 
 namespace arcticdb::codec {
 
@@ -19,6 +23,13 @@ inline arcticdb::proto::encoding::VariantCodec default_lz4_codec() {
     return codec;
 }
 
+inline arcticdb::proto::encoding::VariantCodec default_zstd_codec(int32_t level) {
+    arcticdb::proto::encoding::VariantCodec codec;
+    auto zstdptr = codec.mutable_zstd();
+    zstdptr->set_level(level);
+    return codec;
+}
+
 inline arcticdb::proto::encoding::VariantCodec default_passthrough_codec() {
     arcticdb::proto::encoding::VariantCodec codec;
     auto lz4ptr = codec.mutable_passthrough();
@@ -26,5 +37,74 @@ inline arcticdb::proto::encoding::VariantCodec default_passthrough_codec() {
     return codec;
 }
 
+inline arcticdb::proto::encoding::VariantCodec default_tp4_codec(
+        arcticdb::proto::encoding::VariantCodec::TurboPfor::SubCodecs sub_codec
+) {
+    arcticdb::proto::encoding::VariantCodec codec;
+    auto tp4ptr = codec.mutable_tp4();
+    tp4ptr->set_sub_codec(sub_codec);
+    return codec;
+}
+
+inline arcticdb::proto::encoding::VariantCodec default_adaptive_codec(
+        arcticdb::proto::encoding::VariantCodec::Adaptive::Objective objective, int32_t zstd_level
+) {
+    arcticdb::proto::encoding::VariantCodec codec;
+    auto adaptiveptr = codec.mutable_adaptive();
+    adaptiveptr->set_objective(objective);
+    adaptiveptr->set_zstd_level(zstd_level);
+    return codec;
+}
+
 inline arcticdb::proto::encoding::VariantCodec default_shapes_codec() { return codec::default_lz4_codec(); }
+
+// Parses a codec name from config: a tp4 sub codec (P4, P4_DELTA or P4_ZZ), LZ4 or ZSTD. Empty gives nullopt.
+std::optional<arcticdb::proto::encoding::VariantCodec> codec_from_name(std::string_view name);
+
+// Parses an adaptive codec objective from config, SPEED or SIZE. Empty gives nullopt.
+std::optional<arcticdb::proto::encoding::VariantCodec> adaptive_codec_from_objective(
+        std::string_view objective, int32_t zstd_level
+);
+
+/*
+ * Codecs for the values of data columns, used in place of the library codec when set. Integer and timestamp columns
+ * can be given their own codec, so that they can use the tp4 integer codecs, and all other data columns can use the
+ * adaptive codec, which chooses a codec for each block. Read once from Codec.IntegerColumns, Codec.TimestampColumns
+ * and Codec.Adaptive, all unset by default which keeps the library codec. They only apply to data segments (the
+ * TABLE_DATA keys): the columns of index, version, snapshot and other keys, metadata, descriptors and string pools
+ * always use the library codec.
+ */
+struct ColumnTypeCodecs {
+    std::optional<arcticdb::proto::encoding::VariantCodec> integer_;
+    std::optional<arcticdb::proto::encoding::VariantCodec> timestamp_;
+    std::optional<arcticdb::proto::encoding::VariantCodec> adaptive_;
+
+    static ColumnTypeCodecs from_config();
+
+    static const ColumnTypeCodecs& instance();
+
+    [[nodiscard]] const arcticdb::proto::encoding::VariantCodec& codec_for(
+            const arcticdb::proto::encoding::VariantCodec& library_codec, entity::DataType data_type
+    ) const {
+        if (timestamp_ && is_time_type(data_type))
+            return *timestamp_;
+
+        if (integer_ && is_integer_type(data_type))
+            return *integer_;
+
+        if (adaptive_)
+            return *adaptive_;
+
+        return library_codec;
+    }
+};
+
+inline const arcticdb::proto::encoding::VariantCodec& column_codec(
+        const arcticdb::proto::encoding::VariantCodec& library_codec, entity::DataType data_type, bool is_data_segment
+) {
+    if (!is_data_segment)
+        return library_codec;
+
+    return ColumnTypeCodecs::instance().codec_for(library_codec, data_type);
+}
 } // namespace arcticdb::codec
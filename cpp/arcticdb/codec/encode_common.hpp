@@ -121,12 +121,14 @@ void calc_metadata_size(
 
 template<typename EncodingPolicyType>
 void calc_columns_size(
-        const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts, SizeResult& result
+        const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        bool is_data_segment, SizeResult& result
 ) {
     for (std::size_t c = 0; c < in_mem_seg.num_columns(); ++c) {
         auto column_data = in_mem_seg.column_data(c);
+        const auto& column_codec = codec::column_codec(codec_opts, column_data.type().data_type(), is_data_segment);
         const auto [uncompressed, required] =
-                EncodingPolicyType::ColumnEncoder::max_compressed_size(codec_opts, column_data);
+                EncodingPolicyType::ColumnEncoder::max_compressed_size(column_codec, column_data);
         result.uncompressed_bytes_ += uncompressed;
         result.max_compressed_bytes_ += required;
         ARCTICDB_TRACE(
@@ -206,11 +208,13 @@ void encode_string_pool(
 }
 
 [[nodiscard]] SizeResult max_compressed_size_v1(
-        const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts
+        const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        bool is_data_segment = false
 );
 
 [[nodiscard]] SizeResult max_compressed_size_v2(
-        const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts
+        const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        bool is_data_segment = false
 );
 
 } // namespace arcticdb
\ No newline at end of file
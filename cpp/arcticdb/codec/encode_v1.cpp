@@ -75,14 +75,15 @@ void ColumnEncoderV1::encode(
 using EncodingPolicyV1 = EncodingPolicyType<EncodingVersion::V1, ColumnEncoderV1>;
 
 [[nodiscard]] SizeResult max_compressed_size_v1(
-        const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts
+        const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        bool is_data_segment
 ) {
     ARCTICDB_SAMPLE(GetSegmentCompressedSize, 0)
     SizeResult result{};
     calc_metadata_size<EncodingPolicyV1>(in_mem_seg, codec_opts, result);
 
     if (in_mem_seg.row_count() > 0) {
-        calc_columns_size<EncodingPolicyV1>(in_mem_seg, codec_opts, result);
+        calc_columns_size<EncodingPolicyV1>(in_mem_seg, codec_opts, is_data_segment, result);
         calc_string_pool_size<EncodingPolicyV1>(in_mem_seg, codec_opts, result);
     }
     ARCTICDB_TRACE(log::codec(), "Max compressed size {}", result.max_compressed_bytes_);
@@ -93,7 +94,9 @@ using EncodingPolicyV1 = EncodingPolicyType<EncodingVersion::V1, ColumnEncoderV1
  * This takes an in memory segment with all the metadata, column tensors etc., loops through each column
  * and based on the type of the column, calls the typed block encoder for that column.
  */
-[[nodiscard]] Segment encode_v1(SegmentInMemory&& s, const arcticdb::proto::encoding::VariantCodec& codec_opts) {
+[[nodiscard]] Segment encode_v1(
+        SegmentInMemory&& s, const arcticdb::proto::encoding::VariantCodec& codec_opts, bool is_data_segment
+) {
     ARCTICDB_SAMPLE(EncodeSegment, 0)
     auto in_mem_seg = std::move(s);
     SegmentHeader segment_header{EncodingVersion::V1};
@@ -111,7 +114,8 @@ using EncodingPolicyV1 = EncodingPolicyType<EncodingVersion::V1, ColumnEncoderV1
     std::ptrdiff_t pos = 0;
     static auto block_to_header_ratio = ConfigsMap::instance()->get_int("Codec.EstimatedHeaderRatio", 75);
     const auto preamble = in_mem_seg.num_blocks() * block_to_header_ratio;
-    auto [max_compressed_size, uncompressed_size, encoded_buffer_size] = max_compressed_size_v1(in_mem_seg, codec_opts);
+    auto [max_compressed_size, uncompressed_size, encoded_buffer_size] =
+            max_compressed_size_v1(in_mem_seg, codec_opts, is_data_segment);
     ARCTICDB_TRACE(log::codec(), "Estimated max buffer requirement: {}", max_compressed_size);
     auto out_buffer = std::make_shared<Buffer>(max_compressed_size, preamble);
     ColumnEncoderV1 encoder;
@@ -140,7 +144,9 @@ using EncodingPolicyV1 = EncodingPolicyType<EncodingVersion::V1, ColumnEncoderV1
             auto column_data = column.data();
             auto* column_field = encoded_fields.add_field(column_data.num_blocks());
             if (column_data.num_blocks() > 0) {
-                encoder.encode(codec_opts, column_data, *column_field, *out_buffer, pos);
+                const auto& column_codec =
+                        codec::column_codec(codec_opts, column_data.type().data_type(), is_data_segment);
+                encoder.encode(column_codec, column_data, *column_field, *out_buffer, pos);
                 ARCTICDB_TRACE(
                         log::codec(),
                         "Encoded column {}: ({}) to position {}",
@@ -255,7 +255,8 @@ static void calc_stream_descriptor_fields_size(
 }
 
 [[nodiscard]] SizeResult max_compressed_size_v2(
-        const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts
+        const SegmentInMemory& in_mem_seg, const arcticdb::proto::encoding::VariantCodec& codec_opts,
+        bool is_data_segment
 ) {
     ARCTICDB_SAMPLE(GetSegmentCompressedSize, 0)
     SizeResult result{};
@@ -270,7 +271,7 @@ static void calc_stream_descriptor_fields_size(
     // Calculate fields collection size
     if (in_mem_seg.row_count() > 0) {
         result.max_compressed_bytes_ += sizeof(ColumnMagic) * in_mem_seg.descriptor().field_count();
-        calc_columns_size<EncodingPolicyV2>(in_mem_seg, codec_opts, result);
+        calc_columns_size<EncodingPolicyV2>(in_mem_seg, codec_opts, is_data_segment, result);
         result.max_compressed_bytes_ += sizeof(StringPoolMagic);
         calc_string_pool_size<EncodingPolicyV2>(in_mem_seg, codec_opts, result);
     }
@@ -293,7 +294,9 @@ static void encode_encoded_fields(
     ARCTICDB_DEBUG(log::codec(), "Encoded encoded blocks to position {}", pos);
 }
 
-[[nodiscard]] Segment encode_v2(SegmentInMemory&& s, const arcticdb::proto::encoding::VariantCodec& codec_opts) {
+[[nodiscard]] Segment encode_v2(
+        SegmentInMemory&& s, const arcticdb::proto::encoding::VariantCodec& codec_opts, bool is_data_segment
+) {
     ARCTICDB_SAMPLE(EncodeSegment, 0)
     auto in_mem_seg = std::move(s);
 
@@ -307,7 +310,8 @@ static void encode_encoded_fields(
     segment_header.set_compacted(in_mem_seg.compacted());
 
     std::ptrdiff_t pos = 0;
-    auto [max_compressed_size, uncompressed_size, encoded_buffer_size] = max_compressed_size_v2(in_mem_seg, codec_opts);
+    auto [max_compressed_size, uncompressed_size, encoded_buffer_size] =
+            max_compressed_size_v2(in_mem_seg, codec_opts, is_data_segment);
     ARCTICDB_TRACE(log::codec(), "Estimated max buffer requirement: {}", max_compressed_size);
     const auto preamble = SegmentHeader::required_bytes(in_mem_seg);
     auto out_buffer = std::make_shared<Buffer>(max_compressed_size + encoded_buffer_size, preamble);
@@ -359,7 +363,9 @@ static void encode_encoded_fields(
             );
 
             if (column_data.num_blocks() > 0) {
-                encoder.encode(codec_opts, column_data, *column_field, *out_buffer, pos);
+                const auto& column_codec =
+                        codec::column_codec(codec_opts, column_data.type().data_type(), is_data_segment);
+                encoder.encode(column_codec, column_data, *column_field, *out_buffer, pos);
                 ARCTICDB_TRACE(
                         log::codec(),
                         "Encoded column {}: ({}) to position {}",
@@ -30,6 +30,10 @@ void block_from_proto(const arcticdb::proto::encoding::Block& input, EncodedBloc
         set_codec(input.codec().lz4(), *output.mutable_codec()->mutable_lz4());
         break;
     }
+    case arcticdb::proto::encoding::VariantCodec::kTp4: {
+        set_codec(input.codec().tp4(), *output.mutable_codec()->mutable_pfor());
+        break;
+    }
     case arcticdb::proto::encoding::VariantCodec::kPassthrough: {
         set_codec(input.codec().passthrough(), *output.mutable_codec()->mutable_passthrough());
         break;
@@ -54,6 +58,10 @@ void proto_from_block(const EncodedBlock& input, arcticdb::proto::encoding::Bloc
         set_lz4(input.codec().lz4(), *output.mutable_codec()->mutable_lz4());
         break;
     }
+    case Codec::PFOR: {
+        set_tp4(input.codec().pfor(), *output.mutable_codec()->mutable_tp4());
+        break;
+    }
     case Codec::PASS: {
         set_passthrough(input.codec().passthrough(), *output.mutable_codec()->mutable_passthrough());
         break;
@@ -29,6 +29,10 @@ inline void copy_codec(Lz4Codec& codec, const arcticdb::proto::encoding::Variant
     codec.acceleration_ = lz4.acceleration();
 }
 
+inline void copy_codec(PforCodec& codec, const arcticdb::proto::encoding::VariantCodec::TurboPfor& tp4) {
+    codec.sub_codec_ = static_cast<uint32_t>(tp4.sub_codec());
+}
+
 inline void copy_codec(PassthroughCodec&, const arcticdb::proto::encoding::VariantCodec::Passthrough&) {
     // No data in passthrough
 }
@@ -64,6 +68,11 @@ inline void set_zstd(const ZstdCodec& zstd_in, arcticdb::proto::encoding::Varian
     zstd_out.set_level(zstd_in.level_);
 }
 
+inline void set_tp4(const PforCodec& pfor_in, arcticdb::proto::encoding::VariantCodec::TurboPfor& tp4_out) {
+    using SubCodecs = arcticdb::proto::encoding::VariantCodec::TurboPfor::SubCodecs;
+    tp4_out.set_sub_codec(static_cast<SubCodecs>(pfor_in.sub_codec_));
+}
+
 inline void set_passthrough(
         const PassthroughCodec& passthrough_in, arcticdb::proto::encoding::VariantCodec::Passthrough& passthrough_out
 ) {
@@ -417,6 +417,7 @@ std::tuple<uint8_t*, size_t, std::unique_ptr<Buffer>> Segment::serialize_header_
 }
 
 std::tuple<uint8_t*, size_t, std::unique_ptr<Buffer>> Segment::serialize_header() {
+    util::check(!is_partial(), "Cannot serialize a segment that was read with only some of its columns");
     if (header_.encoding_version() == EncodingVersion::V1) {
         return serialize_header_v1();
     } else {
@@ -443,6 +444,7 @@ const arcticdb::proto::encoding::SegmentHeader& Segment::generate_header_proto()
 void Segment::write_to(std::uint8_t* dst) {
     ARCTICDB_SAMPLE(SegmentWriteToStorage, RMTSF_Aggregate)
     ARCTICDB_SUBSAMPLE(SegmentWriteHeader, RMTSF_Aggregate)
+    util::check(!is_partial(), "Cannot serialize a segment that was read with only some of its columns");
 
     size_t header_size;
     if (header_.encoding_version() == EncodingVersion::V1)
@@ -62,6 +62,12 @@ void set_body_fields(SegmentHeader& seg_hdr, const uint8_t* src);
  * the primary method for decompressing a Segment into a SegmentInMemory is in codec.cpp::decode (and the reverse via
  * codec.cpp:encode).
  */
+
+// Whether a segment read from storage holds every byte of the object. Segments read with a column selection (see
+// read_segment_columns) have uninitialised bytes where the unselected columns would be, so they can only be decoded
+// with that selection, and are never cached or written back to storage.
+enum class SegmentContents : uint8_t { FULL, SELECTED_COLUMNS };
+
 class Segment {
   public:
     Segment() = default;
@@ -93,6 +99,7 @@ class Segment {
         swap(desc_, that.desc_);
         swap(keepalive_, that.keepalive_);
         swap(size_, that.size_);
+        swap(contents_, that.contents_);
         buffer_.move_buffer(std::move(that.buffer_));
     }
 
@@ -102,6 +109,7 @@ class Segment {
         swap(desc_, that.desc_);
         swap(keepalive_, that.keepalive_);
         swap(size_, that.size_);
+        swap(contents_, that.contents_);
         buffer_.move_buffer(std::move(that.buffer_));
         return *this;
     }
@@ -184,7 +192,17 @@ class Segment {
 
     [[nodiscard]] const StreamDescriptor& descriptor() const { return desc_; }
 
-    Segment clone() const { return Segment{header_.clone(), buffer_.clone(), desc_.clone(), size_}; }
+    void set_contents(SegmentContents contents) { contents_ = contents; }
+
+    [[nodiscard]] SegmentContents contents() const { return contents_; }
+
+    [[nodiscard]] bool is_partial() const { return contents_ != SegmentContents::FULL; }
+
+    Segment clone() const {
+        Segment output{header_.clone(), buffer_.clone(), desc_.clone(), size_};
+        output.contents_ = contents_;
+        return output;
+    }
 
     static Segment initialize(
             SegmentHeader&& header, std::shared_ptr<Buffer>&& buffer, std::shared_ptr<SegmentDescriptorImpl> data,
@@ -220,6 +238,7 @@ class Segment {
     std::unique_ptr<arcticdb::proto::encoding::SegmentHeader> proto_;
     size_t proto_size_ = 0UL;
     std::optional<size_t> size_;
+    SegmentContents contents_ = SegmentContents::FULL;
 };
 
 } // namespace arcticdb
@@ -0,0 +1,126 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <random>
+#include <benchmark/benchmark.h>
+#include <arcticdb/codec/tp4.hpp>
+
+#include <lz4.h>
+
+using namespace arcticdb;
+using TurboPfor = arcticdb::proto::encoding::VariantCodec::TurboPfor;
+
+// run like: --benchmark_time_unit=us --benchmark_filter=.* --benchmark_counters_tabular=true
+
+namespace {
+enum class Data : int64_t { TIMESTAMPS, SMALL_RANGE, RANDOM_WALK };
+
+std::vector<int64_t> generate(Data data, size_t count) {
+    std::mt19937_64 gen(42);
+    std::vector<int64_t> values(count);
+    int64_t value = 1'700'000'000'000'000'000L;
+    for (auto& v : values) {
+        switch (data) {
+        case Data::TIMESTAMPS:
+            value += 1'000'000 + static_cast<int64_t>(gen() % 1000);
+            v = value;
+            break;
+        case Data::SMALL_RANGE:
+            v = static_cast<int64_t>(gen() % 256);
+            break;
+        case Data::RANDOM_WALK:
+            value += static_cast<int64_t>(gen() % 201) - 100;
+            v = value;
+            break;
+        }
+    }
+    return values;
+}
+} // namespace
+
+// Compression ratio is reported as a counter, throughput as the decoded bytes per second
+static void BM_tp4_decode(benchmark::State& state) {
+    const auto sub_codec = static_cast<TurboPfor::SubCodecs>(state.range(0));
+    const auto values = generate(static_cast<Data>(state.range(1)), state.range(2));
+    const auto bytes = values.size() * sizeof(int64_t);
+    std::vector<uint8_t> encoded(detail::tp4::max_encoded_size(bytes));
+    encoded.resize(detail::tp4::encode(sub_codec, values.data(), values.size(), encoded.data()));
+    std::vector<int64_t> decoded(values.size());
+    for (auto _ : state) {
+        detail::tp4::decode(sub_codec, encoded.data(), encoded.size(), decoded.data(), decoded.size());
+        benchmark::DoNotOptimize(decoded.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+    state.counters["ratio"] = static_cast<double>(bytes) / static_cast<double>(encoded.size());
+}
+
+static void BM_tp4_encode(benchmark::State& state) {
+    const auto sub_codec = static_cast<TurboPfor::SubCodecs>(state.range(0));
+    const auto values = generate(static_cast<Data>(state.range(1)), state.range(2));
+    const auto bytes = values.size() * sizeof(int64_t);
+    std::vector<uint8_t> encoded(detail::tp4::max_encoded_size(bytes));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(detail::tp4::encode(sub_codec, values.data(), values.size(), encoded.data()));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+
+// Args are the bit width and the BitPacking kernels, which are skipped if this CPU does not support them
+static void BM_tp4_unpack(benchmark::State& state) {
+    const auto width = static_cast<size_t>(state.range(0));
+    const auto kernels = static_cast<detail::tp4::BitPacking>(state.range(1));
+    if (kernels > detail::tp4::bit_packing()) {
+        state.SkipWithError("Kernels not supported on this CPU");
+        return;
+    }
+    std::mt19937_64 gen(42);
+    std::vector<uint64_t> values(detail::tp4::frame_size);
+    for (auto& v : values)
+        v = gen() & ((uint64_t{1} << width) - 1);
+    std::vector<uint8_t> packed(detail::tp4::packed_bytes(values.size(), width));
+    detail::tp4::pack(kernels, values.data(), values.size(), width, uint64_t{0}, packed.data());
+    for (auto _ : state) {
+        detail::tp4::unpack(kernels, packed.data(), values.size(), width, uint64_t{0}, values.data());
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * values.size() * sizeof(uint64_t)));
+}
+
+// The library default, for comparison
+static void BM_lz4_decode(benchmark::State& state) {
+    const auto values = generate(static_cast<Data>(state.range(0)), state.range(1));
+    const auto bytes = static_cast<int>(values.size() * sizeof(int64_t));
+    std::vector<char> encoded(LZ4_compressBound(bytes));
+    encoded.resize(LZ4_compress_default(
+            reinterpret_cast<const char*>(values.data()), encoded.data(), bytes, static_cast<int>(encoded.size())
+    ));
+    std::vector<int64_t> decoded(values.size());
+    for (auto _ : state) {
+        LZ4_decompress_safe(
+                encoded.data(), reinterpret_cast<char*>(decoded.data()), static_cast<int>(encoded.size()), bytes
+        );
+        benchmark::DoNotOptimize(decoded.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * bytes);
+    state.counters["ratio"] = static_cast<double>(bytes) / static_cast<double>(encoded.size());
+}
+
+static void tp4_args(benchmark::internal::Benchmark* b) {
+    for (auto sub_codec : {TurboPfor::P4, TurboPfor::P4_DELTA, TurboPfor::P4_ZZ}) {
+        for (auto data : {Data::TIMESTAMPS, Data::SMALL_RANGE, Data::RANDOM_WALK})
+            b->Args({sub_codec, static_cast<int64_t>(data), 100'000});
+    }
+}
+
+BENCHMARK(BM_tp4_decode)->Apply(tp4_args);
+BENCHMARK(BM_tp4_encode)->Apply(tp4_args);
+BENCHMARK(BM_tp4_unpack)->ArgsProduct({{5, 13, 40}, {0, 1}});
+BENCHMARK(BM_lz4_decode)
+        ->Args({static_cast<int64_t>(Data::TIMESTAMPS), 100'000})
+        ->Args({static_cast<int64_t>(Data::SMALL_RANGE), 100'000})
+        ->Args({static_cast<int64_t>(Data::RANDOM_WALK), 100'000});
@@ -0,0 +1,126 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+#include <arcticdb/codec/adaptive_codec.hpp>
+#include <arcticdb/codec/codec.hpp>
+#include <arcticdb/stream/index.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace arcticdb;
+using VariantCodec = arcticdb::proto::encoding::VariantCodec;
+
+namespace {
+constexpr auto speed_objective = VariantCodec::Adaptive::SPEED;
+constexpr auto size_objective = VariantCodec::Adaptive::SIZE;
+
+template<typename T>
+VariantCodec choose(VariantCodec::Adaptive::Objective objective, const std::vector<T>& values) {
+    const auto opts = codec::default_adaptive_codec(objective, 3);
+    return codec::choose_block_codec(opts.adaptive(), values.data(), values.size());
+}
+} // namespace
+
+TEST(AdaptiveCodec, SortedTimestampsUseDelta) {
+    std::vector<timestamp> timestamps(4096);
+    for (size_t i = 0; i < timestamps.size(); ++i)
+        timestamps[i] = 1'700'000'000'000'000'000L + static_cast<timestamp>(i) * 1'000'000'000L;
+
+    for (auto objective : {speed_objective, size_objective}) {
+        const auto chosen = choose(objective, timestamps);
+        ASSERT_TRUE(chosen.has_tp4());
+        ASSERT_EQ(chosen.tp4().sub_codec(), VariantCodec::TurboPfor::P4_DELTA);
+    }
+}
+
+TEST(AdaptiveCodec, SmallRangeIntegersUseFrameOfReference) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int32_t> dist(1000, 1015);
+    std::vector<int32_t> values(4096);
+    for (auto& value : values)
+        value = dist(gen);
+
+    const auto chosen = choose(speed_objective, values);
+    ASSERT_TRUE(chosen.has_tp4());
+    ASSERT_EQ(chosen.tp4().sub_codec(), VariantCodec::TurboPfor::P4);
+}
+
+TEST(AdaptiveCodec, IncompressibleUsesPassthroughForSpeed) {
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> dist;
+    std::vector<double> values(4096);
+    for (auto& value : values)
+        value = dist(gen);
+
+    ASSERT_TRUE(choose(speed_objective, values).has_passthrough());
+}
+
+TEST(AdaptiveCodec, RepeatedValues) {
+    std::vector<double> values(4096, 1.5);
+    ASSERT_TRUE(choose(speed_objective, values).has_lz4());
+    ASSERT_FALSE(choose(size_objective, values).has_passthrough());
+}
+
+TEST(AdaptiveCodec, ObjectiveFromConfig) {
+    ASSERT_FALSE(codec::adaptive_codec_from_objective("", 0).has_value());
+    ASSERT_EQ(codec::adaptive_codec_from_objective("size", 5)->adaptive().objective(), size_objective);
+    ASSERT_EQ(codec::adaptive_codec_from_objective("size", 5)->adaptive().zstd_level(), 5);
+    ASSERT_THROW(codec::adaptive_codec_from_objective("SMALLEST", 0), std::exception);
+
+    const codec::ColumnTypeCodecs codecs{
+            codec::default_tp4_codec(VariantCodec::TurboPfor::P4),
+            std::nullopt,
+            codec::default_adaptive_codec(speed_objective, 0)
+    };
+    const auto library_codec = codec::default_lz4_codec();
+    ASSERT_TRUE(codecs.codec_for(library_codec, DataType::INT64).has_tp4());
+    ASSERT_TRUE(codecs.codec_for(library_codec, DataType::NANOSECONDS_UTC64).has_adaptive());
+    ASSERT_TRUE(codecs.codec_for(library_codec, DataType::FLOAT64).has_adaptive());
+    ASSERT_FALSE(codec::column_codec(library_codec, DataType::FLOAT64, false).has_adaptive());
+}
+
+class AdaptiveCodecSegment
+    : public testing::TestWithParam<std::tuple<EncodingVersion, VariantCodec::Adaptive::Objective>> {};
+
+TEST_P(AdaptiveCodecSegment, RoundTrip) {
+    const auto [encoding_version, objective] = GetParam();
+    const auto desc = stream::stream_descriptor(
+            StreamId{"adaptive"},
+            stream::TimeseriesIndex::default_index(),
+            {scalar_field(DataType::INT64, "ints"),
+             scalar_field(DataType::FLOAT64, "random"),
+             scalar_field(DataType::FLOAT64, "constant"),
+             scalar_field(DataType::BOOL8, "bools"),
+             scalar_field(DataType::UTF_DYNAMIC64, "strings")}
+    );
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> dist;
+    SegmentInMemory segment{desc.clone()};
+    for (auto i = 0; i < 10'000; ++i) {
+        segment.set_scalar<timestamp>(0, 1'000'000'000L * i);
+        segment.set_scalar<int64_t>(1, i % 100);
+        segment.set_scalar<double>(2, dist(gen));
+        segment.set_scalar<double>(3, 2.5);
+        segment.set_scalar<bool>(4, i % 3 == 0);
+        segment.set_string(5, fmt::format("s{}", i % 10));
+        segment.end_row();
+    }
+    auto copy = segment.clone();
+    auto encoded = encode_dispatch(std::move(segment), codec::default_adaptive_codec(objective, 3), encoding_version);
+    ASSERT_EQ(decode_segment(encoded), copy);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        AdaptiveCodec, AdaptiveCodecSegment,
+        testing::Combine(
+                testing::Values(EncodingVersion::V1, EncodingVersion::V2),
+                testing::Values(VariantCodec::Adaptive::SPEED, VariantCodec::Adaptive::SIZE)
+        )
+);
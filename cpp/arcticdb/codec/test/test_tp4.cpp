@@ -0,0 +1,215 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+#include <arcticdb/codec/codec.hpp>
+#include <arcticdb/codec/default_codecs.hpp>
+#include <arcticdb/codec/tp4.hpp>
+#include <arcticdb/stream/index.hpp>
+
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace arcticdb;
+using TurboPfor = arcticdb::proto::encoding::VariantCodec::TurboPfor;
+
+namespace {
+constexpr std::array sub_codecs{TurboPfor::P4, TurboPfor::P4_DELTA, TurboPfor::P4_ZZ};
+
+template<typename T>
+std::vector<uint8_t> tp4_encode(TurboPfor::SubCodecs sub_codec, const std::vector<T>& values) {
+    std::vector<uint8_t> encoded(detail::tp4::max_encoded_size(values.size() * sizeof(T)));
+    encoded.resize(detail::tp4::encode(sub_codec, values.data(), values.size(), encoded.data()));
+    return encoded;
+}
+
+template<typename T>
+std::vector<T> tp4_decode(TurboPfor::SubCodecs sub_codec, const std::vector<uint8_t>& encoded, size_t count) {
+    std::vector<T> decoded(count);
+    const auto consumed = detail::tp4::decode(sub_codec, encoded.data(), encoded.size(), decoded.data(), count);
+    EXPECT_EQ(consumed, encoded.size());
+    return decoded;
+}
+
+template<typename T>
+std::vector<std::vector<T>> test_inputs() {
+    std::mt19937_64 gen(42);
+    std::vector<std::vector<T>> inputs{{}, {T{1}}};
+    for (auto size : {127UL, 128UL, 129UL, 1000UL}) {
+        std::vector<T> ascending(size);
+        std::vector<T> random(size);
+        std::vector<T> extremes(size);
+        for (size_t i = 0; i < size; ++i) {
+            ascending[i] = static_cast<T>(i * 3);
+            random[i] = static_cast<T>(gen());
+            extremes[i] = i % 2 == 0 ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+        }
+        inputs.insert(inputs.end(), {ascending, random, extremes});
+    }
+    return inputs;
+}
+} // namespace
+
+template<typename T>
+class Tp4RoundTrip : public testing::Test {};
+
+using Tp4Types =
+        testing::Types<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double>;
+TYPED_TEST_SUITE(Tp4RoundTrip, Tp4Types);
+
+TYPED_TEST(Tp4RoundTrip, AllSubCodecs) {
+    for (auto sub_codec : sub_codecs) {
+        for (const auto& values : test_inputs<TypeParam>()) {
+            const auto encoded = tp4_encode(sub_codec, values);
+            ASSERT_LE(encoded.size(), detail::tp4::max_encoded_size(values.size() * sizeof(TypeParam)));
+            const auto decoded = tp4_decode<TypeParam>(sub_codec, encoded, values.size());
+            ASSERT_EQ(std::memcmp(decoded.data(), values.data(), values.size() * sizeof(TypeParam)), 0);
+        }
+    }
+}
+
+template<typename T>
+class Tp4BitPacking : public testing::Test {};
+
+using Tp4PackedTypes = testing::Types<uint8_t, uint16_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(Tp4BitPacking, Tp4PackedTypes);
+
+// The vectorised kernels must write and read exactly the stream the scalar kernels do
+TYPED_TEST(Tp4BitPacking, KernelsAgree) {
+    using U = TypeParam;
+    using detail::tp4::BitPacking;
+    constexpr auto frame_size = detail::tp4::frame_size;
+    if (detail::tp4::bit_packing() == BitPacking::SCALAR)
+        GTEST_SKIP() << "No vectorised bit packing kernels on this CPU";
+
+    std::mt19937_64 gen(42);
+    for (size_t width = 0; width <= std::numeric_limits<U>::digits; ++width) {
+        const uint64_t mask = width == 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << width) - 1;
+        for (size_t count = 0; count <= frame_size; ++count) {
+            const auto reference = static_cast<U>(gen());
+            std::vector<U> values(count);
+            for (auto& value : values)
+                value = static_cast<U>(reference + static_cast<U>(gen() & mask));
+
+            const auto bytes = detail::tp4::packed_bytes(count, width);
+            std::vector<uint8_t> scalar(bytes);
+            std::vector<uint8_t> vectorised(bytes);
+            detail::tp4::pack(BitPacking::SCALAR, values.data(), count, width, reference, scalar.data());
+            detail::tp4::pack(BitPacking::AVX2, values.data(), count, width, reference, vectorised.data());
+            ASSERT_EQ(scalar, vectorised) << "width " << width << " count " << count;
+
+            std::vector<U> unpacked(count);
+            detail::tp4::unpack(BitPacking::AVX2, scalar.data(), count, width, reference, unpacked.data());
+            ASSERT_EQ(unpacked, values) << "width " << width << " count " << count;
+        }
+    }
+}
+
+TEST(Tp4, CompressesMonotonicTimestamps) {
+    std::vector<timestamp> timestamps(100'000);
+    for (size_t i = 0; i < timestamps.size(); ++i)
+        timestamps[i] = 1'700'000'000'000'000'000L + static_cast<timestamp>(i) * 1'000'000'000L + (i % 7);
+
+    ASSERT_LT(tp4_encode(TurboPfor::P4_DELTA, timestamps).size() * 5, timestamps.size() * sizeof(timestamp));
+}
+
+TEST(Tp4, CompressesRandomWalk) {
+    std::vector<int64_t> values(100'000);
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int64_t> step(-100, 100);
+    int64_t value = 1'000'000'000;
+    for (auto& v : values) {
+        value += step(gen);
+        v = value;
+    }
+    ASSERT_LT(tp4_encode(TurboPfor::P4_ZZ, values).size() * 5, values.size() * sizeof(int64_t));
+}
+
+TEST(Tp4, SmallRangeIntegers) {
+    std::vector<int64_t> values(10'000);
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+    for (auto& value : values)
+        value = dist(gen);
+
+    const auto encoded = tp4_encode(TurboPfor::P4, values);
+    ASSERT_LT(encoded.size() * 5, values.size() * sizeof(int64_t));
+    ASSERT_EQ(tp4_decode<int64_t>(TurboPfor::P4, encoded, values.size()), values);
+}
+
+TEST(Tp4, TruncatedInputThrows) {
+    std::vector<int32_t> values(1000, 7);
+    auto encoded = tp4_encode(TurboPfor::P4_DELTA, values);
+    encoded.resize(encoded.size() / 2);
+    std::vector<int32_t> decoded(values.size());
+    ASSERT_THROW(
+            detail::tp4::decode(TurboPfor::P4_DELTA, encoded.data(), encoded.size(), decoded.data(), values.size()),
+            std::exception
+    );
+}
+
+TEST(Tp4, CodecFromName) {
+    ASSERT_FALSE(codec::codec_from_name("").has_value());
+    ASSERT_EQ(codec::codec_from_name("p4_delta")->tp4().sub_codec(), TurboPfor::P4_DELTA);
+    ASSERT_TRUE(codec::codec_from_name("LZ4")->has_lz4());
+    ASSERT_TRUE(codec::codec_from_name("zstd")->has_zstd());
+    ASSERT_THROW(codec::codec_from_name("FP_GORILLA_RLE"), std::exception);
+    ASSERT_THROW(codec::codec_from_name("BROTLI"), std::exception);
+}
+
+TEST(Tp4, ColumnTypeCodecs) {
+    const auto library_codec = codec::default_lz4_codec();
+    const codec::ColumnTypeCodecs codecs{
+            codec::default_tp4_codec(TurboPfor::P4), codec::default_tp4_codec(TurboPfor::P4_DELTA)
+    };
+    ASSERT_EQ(codecs.codec_for(library_codec, DataType::INT32).tp4().sub_codec(), TurboPfor::P4);
+    ASSERT_EQ(codecs.codec_for(library_codec, DataType::UINT8).tp4().sub_codec(), TurboPfor::P4);
+    ASSERT_EQ(codecs.codec_for(library_codec, DataType::NANOSECONDS_UTC64).tp4().sub_codec(), TurboPfor::P4_DELTA);
+    ASSERT_TRUE(codecs.codec_for(library_codec, DataType::FLOAT64).has_lz4());
+    ASSERT_TRUE(codecs.codec_for(library_codec, DataType::UTF_DYNAMIC64).has_lz4());
+    ASSERT_TRUE(codec::ColumnTypeCodecs{}.codec_for(library_codec, DataType::INT64).has_lz4());
+    // Index, version and snapshot keys keep the library codec whatever the config
+    ASSERT_TRUE(codec::column_codec(library_codec, DataType::INT64, false).has_lz4());
+    ASSERT_TRUE(codec::column_codec(library_codec, DataType::NANOSECONDS_UTC64, false).has_lz4());
+}
+
+class Tp4Segment : public testing::TestWithParam<std::tuple<EncodingVersion, TurboPfor::SubCodecs>> {};
+
+TEST_P(Tp4Segment, RoundTrip) {
+    const auto [encoding_version, sub_codec] = GetParam();
+    const auto desc = stream::stream_descriptor(
+            StreamId{"tp4"},
+            stream::TimeseriesIndex::default_index(),
+            {scalar_field(DataType::INT64, "ints"),
+             scalar_field(DataType::UINT16, "small"),
+             scalar_field(DataType::FLOAT64, "floats"),
+             scalar_field(DataType::UTF_DYNAMIC64, "strings")}
+    );
+    SegmentInMemory segment{desc.clone()};
+    for (auto i = 0; i < 1000; ++i) {
+        segment.set_scalar<timestamp>(0, 1'000'000'000L * i);
+        segment.set_scalar<int64_t>(1, (i % 2 == 0 ? -1 : 1) * int64_t{i} * i);
+        segment.set_scalar<uint16_t>(2, static_cast<uint16_t>(i % 17));
+        segment.set_scalar<double>(3, i * 0.5);
+        segment.set_string(4, fmt::format("s{}", i % 10));
+        segment.end_row();
+    }
+    auto copy = segment.clone();
+    auto encoded = encode_dispatch(std::move(segment), codec::default_tp4_codec(sub_codec), encoding_version);
+    ASSERT_EQ(decode_segment(encoded), copy);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        Tp4, Tp4Segment,
+        testing::Combine(
+                testing::Values(EncodingVersion::V1, EncodingVersion::V2),
+                testing::Values(TurboPfor::P4, TurboPfor::P4_DELTA, TurboPfor::P4_ZZ)
+        )
+);
@@ -0,0 +1,307 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/codec/tp4.hpp>
+
+#include <arcticdb/util/configs_map.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ARCTICDB_X86_SIMD_KERNELS
+#include <immintrin.h>
+#define ARCTICDB_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace arcticdb::detail::tp4 {
+
+namespace {
+
+template<typename U>
+constexpr size_t frame_words() {
+    // Spare words past the values of a full frame, for the reads and writes of values straddling the last word
+    return frame_size * sizeof(U) / sizeof(uint64_t) + 2;
+}
+
+// Bits [bit, bit + width) of the stream, for width < 64
+inline uint64_t extract(const uint64_t* words, size_t bit, uint64_t mask) {
+    const size_t shift = bit & 63;
+    return ((words[bit >> 6] >> shift) | ((words[(bit >> 6) + 1] << 1) << (63 - shift))) & mask;
+}
+
+inline uint64_t width_mask(size_t width) {
+    return width == 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << width) - 1;
+}
+
+template<typename U>
+void pack_scalar(const U* in, size_t count, size_t width, U reference, uint8_t* out) {
+    uint64_t words[frame_words<U>()] = {};
+    for (size_t i = 0; i < count; ++i) {
+        const auto value = static_cast<uint64_t>(static_cast<U>(in[i] - reference));
+        const size_t bit = i * width;
+        const size_t shift = bit & 63;
+        words[bit >> 6] |= value << shift;
+        // Spills into the next word when the value straddles a word boundary, shifts in two steps to stay defined
+        words[(bit >> 6) + 1] |= (value >> 1) >> (63 - shift);
+    }
+    std::memcpy(out, words, packed_bytes(count, width));
+}
+
+template<typename U>
+void unpack_scalar(const uint8_t* in, size_t count, size_t width, U reference, U* out) {
+    uint64_t words[frame_words<U>()] = {};
+    std::memcpy(words, in, packed_bytes(count, width));
+    const uint64_t mask = width_mask(width);
+    for (size_t i = 0; i < count; ++i)
+        out[i] = static_cast<U>(static_cast<U>(extract(words, i * width, mask)) + reference);
+}
+
+#ifdef ARCTICDB_X86_SIMD_KERNELS
+
+// A value of up to this many bits lies within the 4 (or 8) bytes starting at the byte holding its first bit, so
+// every lane can be gathered with an unaligned load at that byte and shifted into place
+constexpr size_t max_gather32_width = 25;
+constexpr size_t max_gather64_width = 57;
+
+// Adds the reference to eight offsets that fit in U and stores them as U
+template<typename U>
+ARCTICDB_TARGET_AVX2 void store_offsets_epi32(__m256i offsets, U reference, U* out) {
+    if constexpr (sizeof(U) == 4) {
+        const auto values = _mm256_add_epi32(offsets, _mm256_set1_epi32(static_cast<int32_t>(reference)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), values);
+    } else {
+        // The offsets fit in U, so the saturating narrowing leaves them unchanged
+        const auto words = _mm_packus_epi32(_mm256_castsi256_si128(offsets), _mm256_extracti128_si256(offsets, 1));
+        if constexpr (sizeof(U) == 2) {
+            const auto values = _mm_add_epi16(words, _mm_set1_epi16(static_cast<int16_t>(reference)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), values);
+        } else {
+            const auto values =
+                    _mm_add_epi8(_mm_packus_epi16(words, words), _mm_set1_epi8(static_cast<int8_t>(reference)));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), values);
+        }
+    }
+}
+
+// Adds the reference to four offsets and stores them as U, which is 32 or 64 bits
+template<typename U>
+ARCTICDB_TARGET_AVX2 void store_offsets_epi64(__m256i offsets, U reference, U* out) {
+    if constexpr (sizeof(U) == 8) {
+        const auto values = _mm256_add_epi64(offsets, _mm256_set1_epi64x(static_cast<int64_t>(reference)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), values);
+    } else {
+        const auto low_halves = _mm256_permutevar8x32_epi32(offsets, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+        const auto values =
+                _mm_add_epi32(_mm256_castsi256_si128(low_halves), _mm_set1_epi32(static_cast<int32_t>(reference)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), values);
+    }
+}
+
+// Unpacks whole groups of eight values of U of at most 32 bits, returns how many were unpacked
+template<typename U>
+ARCTICDB_TARGET_AVX2 size_t unpack_gather32(const uint8_t* bytes, size_t count, size_t width, U reference, U* out) {
+    const auto w = static_cast<int32_t>(width);
+    const auto lane_bits = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(w));
+    const auto mask = _mm256_set1_epi32(static_cast<int32_t>(width_mask(width)));
+    const auto seven = _mm256_set1_epi32(7);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto bits = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int32_t>(i) * w), lane_bits);
+        const auto gathered =
+                _mm256_i32gather_epi32(reinterpret_cast<const int*>(bytes), _mm256_srli_epi32(bits, 3), 1);
+        const auto offsets = _mm256_and_si256(_mm256_srlv_epi32(gathered, _mm256_and_si256(bits, seven)), mask);
+        store_offsets_epi32(offsets, reference, out + i);
+    }
+    return i;
+}
+
+// Unpacks whole groups of four values of U of at least 32 bits, returns how many were unpacked
+template<typename U>
+ARCTICDB_TARGET_AVX2 size_t unpack_gather64(const uint8_t* bytes, size_t count, size_t width, U reference, U* out) {
+    const auto w = static_cast<int64_t>(width);
+    const auto lane_bits = _mm256_setr_epi64x(0, w, 2 * w, 3 * w);
+    const auto mask = _mm256_set1_epi64x(static_cast<int64_t>(width_mask(width)));
+    const auto seven = _mm256_set1_epi64x(7);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const auto bits = _mm256_add_epi64(_mm256_set1_epi64x(static_cast<int64_t>(i) * w), lane_bits);
+        const auto gathered =
+                _mm256_i64gather_epi64(reinterpret_cast<const long long*>(bytes), _mm256_srli_epi64(bits, 3), 1);
+        const auto offsets = _mm256_and_si256(_mm256_srlv_epi64(gathered, _mm256_and_si256(bits, seven)), mask);
+        store_offsets_epi64(offsets, reference, out + i);
+    }
+    return i;
+}
+
+template<typename U>
+ARCTICDB_TARGET_AVX2 void unpack_avx2(const uint8_t* in, size_t count, size_t width, U reference, U* out) {
+    if (width == 0) {
+        std::fill(out, out + count, reference);
+        return;
+    }
+
+    uint64_t words[frame_words<U>()] = {};
+    std::memcpy(words, in, packed_bytes(count, width));
+    const auto* bytes = reinterpret_cast<const uint8_t*>(words);
+    size_t i = 0;
+    if constexpr (sizeof(U) <= 4) {
+        if (width <= max_gather32_width)
+            i = unpack_gather32(bytes, count, width, reference, out);
+    }
+    if constexpr (sizeof(U) >= 4) {
+        if (width > max_gather32_width || sizeof(U) == 8) {
+            if (width <= max_gather64_width)
+                i = unpack_gather64(bytes, count, width, reference, out);
+        }
+    }
+    const uint64_t mask = width_mask(width);
+    for (; i < count; ++i)
+        out[i] = static_cast<U>(static_cast<U>(extract(words, i * width, mask)) + reference);
+}
+
+// Widens the offsets of the values from the reference to 64 bits each
+template<typename U>
+ARCTICDB_TARGET_AVX2 void widen_offsets(const U* in, size_t count, U reference, uint64_t* chunks) {
+    size_t i = 0;
+    if constexpr (sizeof(U) == 8) {
+        const auto ref = _mm256_set1_epi64x(static_cast<int64_t>(reference));
+        for (; i + 4 <= count; i += 4) {
+            const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(chunks + i), _mm256_sub_epi64(values, ref));
+        }
+    } else if constexpr (sizeof(U) == 4) {
+        const auto ref = _mm_set1_epi32(static_cast<int32_t>(reference));
+        for (; i + 4 <= count; i += 4) {
+            const auto values = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), ref);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(chunks + i), _mm256_cvtepu32_epi64(values));
+        }
+    } else if constexpr (sizeof(U) == 2) {
+        const auto ref = _mm_set1_epi16(static_cast<int16_t>(reference));
+        for (; i + 8 <= count; i += 8) {
+            const auto values = _mm_sub_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), ref);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(chunks + i), _mm256_cvtepu16_epi64(values));
+            _mm256_store_si256(
+                    reinterpret_cast<__m256i*>(chunks + i + 4), _mm256_cvtepu16_epi64(_mm_srli_si128(values, 8))
+            );
+        }
+    } else {
+        const auto ref = _mm_set1_epi8(static_cast<int8_t>(reference));
+        for (; i + 8 <= count; i += 8) {
+            const auto values = _mm_sub_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i)), ref);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(chunks + i), _mm256_cvtepu8_epi64(values));
+            _mm256_store_si256(
+                    reinterpret_cast<__m256i*>(chunks + i + 4), _mm256_cvtepu8_epi64(_mm_srli_si128(values, 4))
+            );
+        }
+    }
+    for (; i < count; ++i)
+        chunks[i] = static_cast<uint64_t>(static_cast<U>(in[i] - reference));
+}
+
+/*
+ * Neighbouring offsets are merged pairwise, doubling the width of each chunk while two still fit in a word. The bit
+ * stream the chunks describe is unchanged, so the final insertion into words handles one or two chunks per word
+ * whatever the width of the values.
+ */
+template<typename U>
+ARCTICDB_TARGET_AVX2 void pack_avx2(const U* in, size_t count, size_t width, U reference, uint8_t* out) {
+    if (width == 0 || width > 32) {
+        pack_scalar(in, count, width, reference, out);
+        return;
+    }
+
+    constexpr auto round_up = [](size_t n) { return (n + 7) / 8 * 8; };
+    alignas(32) uint64_t chunks[frame_size] = {};
+    widen_offsets(in, count, reference, chunks);
+    size_t chunk_width = width;
+    size_t num_chunks = count;
+    while (chunk_width * 2 <= 64 && num_chunks > 1) {
+        const auto shift = _mm_cvtsi32_si128(static_cast<int32_t>(chunk_width));
+        for (size_t j = 0; j < num_chunks; j += 8) {
+            const auto first = _mm256_load_si256(reinterpret_cast<const __m256i*>(chunks + j));
+            const auto second = _mm256_load_si256(reinterpret_cast<const __m256i*>(chunks + j + 4));
+            // Lanes hold chunks {0, 2, 1, 3} of the four merged ones
+            const auto merged = _mm256_or_si256(
+                    _mm256_unpacklo_epi64(first, second),
+                    _mm256_sll_epi64(_mm256_unpackhi_epi64(first, second), shift)
+            );
+            _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(chunks + j / 2),
+                    _mm256_permute4x64_epi64(merged, _MM_SHUFFLE(3, 1, 2, 0))
+            );
+        }
+        num_chunks = (num_chunks + 1) / 2;
+        chunk_width *= 2;
+        // The next round reads whole groups of eight, so clear what is left of this round's input past the end
+        std::fill(chunks + num_chunks, chunks + round_up(num_chunks), uint64_t{0});
+    }
+
+    uint64_t words[frame_words<U>()] = {};
+    for (size_t k = 0; k < num_chunks; ++k) {
+        const size_t bit = k * chunk_width;
+        const size_t shift = bit & 63;
+        words[bit >> 6] |= chunks[k] << shift;
+        words[(bit >> 6) + 1] |= (chunks[k] >> 1) >> (63 - shift);
+    }
+    std::memcpy(out, words, packed_bytes(count, width));
+}
+
+#endif
+
+BitPacking detected_bit_packing() {
+#ifdef ARCTICDB_X86_SIMD_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return BitPacking::AVX2;
+#endif
+    return BitPacking::SCALAR;
+}
+
+} // namespace
+
+BitPacking bit_packing() {
+    static const BitPacking detected = detected_bit_packing();
+    const auto max_level =
+            ConfigsMap::instance()->get_int("Codec.MaxSimdLevel", static_cast<int64_t>(BitPacking::AVX2));
+    return static_cast<BitPacking>(std::clamp<int64_t>(max_level, 0, static_cast<int64_t>(detected)));
+}
+
+template<typename U>
+void pack(BitPacking kernels, const U* in, size_t count, size_t width, U reference, uint8_t* out) {
+#ifdef ARCTICDB_X86_SIMD_KERNELS
+    if (kernels == BitPacking::AVX2) {
+        pack_avx2(in, count, width, reference, out);
+        return;
+    }
+#endif
+    pack_scalar(in, count, width, reference, out);
+}
+
+template<typename U>
+void unpack(BitPacking kernels, const uint8_t* in, size_t count, size_t width, U reference, U* out) {
+#ifdef ARCTICDB_X86_SIMD_KERNELS
+    if (kernels == BitPacking::AVX2) {
+        unpack_avx2(in, count, width, reference, out);
+        return;
+    }
+#endif
+    unpack_scalar(in, count, width, reference, out);
+}
+
+#define ARCTICDB_TP4_INSTANTIATE(U)                                                                                    \
+    template void pack<U>(BitPacking, const U*, size_t, size_t, U, uint8_t*);                                          \
+    template void unpack<U>(BitPacking, const uint8_t*, size_t, size_t, U, U*);
+
+ARCTICDB_TP4_INSTANTIATE(uint8_t)
+ARCTICDB_TP4_INSTANTIATE(uint16_t)
+ARCTICDB_TP4_INSTANTIATE(uint32_t)
+ARCTICDB_TP4_INSTANTIATE(uint64_t)
+
+} // namespace arcticdb::detail::tp4
@@ -9,168 +9,276 @@
 #pragma once
 
 #include <arcticdb/codec/core.hpp>
+#include <arcticdb/codec/protobuf_mappings.hpp>
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/util/hash.hpp>
 
-#include <arcticdb/util/buffer.hpp>
-#include "hash.hpp>
-
-#include <tp4/bitutil.h>
-#include <tp4/fp.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
 #include <type_traits>
 
 namespace arcticdb::detail {
 
-struct TurboPForBase {
-    using Opts = arcticdb::proto::encoding::VariantCodec::TurboPfor;
-    static constexpr std::uint32_t VERSION = 1;
+/*
+ * Integer codecs of the TurboPFor family: the values are transformed and then bit packed in frames of
+ * frame_size values, each frame using the fewest bits that hold all of its values. The sub codecs are
+ *
+ *  - P4: frame of reference, the frame minimum is subtracted from every value. Suits small-range integers.
+ *  - P4_DELTA: the differences between consecutive values, then frame of reference. Suits monotonic columns such
+ *    as timestamps, where the differences are near constant.
+ *  - P4_ZZ: the zigzag encoded differences between consecutive values, with no reference. Suits random walks.
+ *
+ * Values of any type are coded as the unsigned integer of the same size, so floating point values round trip but
+ * only integers compress well. Stream layout, with U that unsigned type:
+ *
+ *  [U first value (delta sub codecs only)]
+ *  per frame: [uint8 bit width][U reference (not P4_ZZ)][bit packed values, padded to whole 64-bit words]
+ *
+ * The bit packing kernels in tp4.cpp have a portable scalar version and an AVX2 version chosen at runtime, in place of
+ * the hand-vectorised p4d/p4nz kernels of the TurboPFor library. The stream layout is independent of the kernels.
+ */
+namespace tp4 {
 
-    static std::size_t max_compressed_size(std::size_t size) { return (size * 3) / 2; }
-};
+using SubCodec = arcticdb::proto::encoding::VariantCodec::TurboPfor::SubCodecs;
 
-template<arcticdb::proto::encoding::VariantCodec::TurboPfor::SubCodecs S>
-struct TurboPForBlockCodec {};
+constexpr size_t frame_size = 128;
 
-template<>
-struct TurboPForBlockCodec<arcticdb::proto::encoding::VariantCodec::TurboPfor::FP_DELTA> : TurboPForBase {
+template<typename T>
+using unsigned_t = std::conditional_t<
+        sizeof(T) == 1, uint8_t,
+        std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
 
-    template<class T>
-    inline static std::size_t encode_block(
-            const T* in, Block& block, HashAccum& hasher, T* t_out, std::size_t out_capacity, std::ptrdiff_t& pos
-    ) {
-        hasher(in, block.count);
-        auto* out = reinterpret_cast<std::uint8_t*>(t_out);
-        std::size_t compressed_bytes = encode_block_(in, block, out);
-        pos += compressed_bytes;
-        return compressed_bytes;
+constexpr bool is_supported(SubCodec sub_codec) {
+    return sub_codec == arcticdb::proto::encoding::VariantCodec::TurboPfor::P4 ||
+           sub_codec == arcticdb::proto::encoding::VariantCodec::TurboPfor::P4_DELTA ||
+           sub_codec == arcticdb::proto::encoding::VariantCodec::TurboPfor::P4_ZZ;
+}
+
+constexpr bool is_delta(SubCodec sub_codec) {
+    return sub_codec != arcticdb::proto::encoding::VariantCodec::TurboPfor::P4;
+}
+
+constexpr bool has_reference(SubCodec sub_codec) {
+    return sub_codec != arcticdb::proto::encoding::VariantCodec::TurboPfor::P4_ZZ;
+}
+
+constexpr size_t packed_bytes(size_t count, size_t width) { return (count * width + 63) / 64 * sizeof(uint64_t); }
+
+// Bound over all value sizes: a one byte value per byte of input plus the per-frame and stream headers
+constexpr size_t max_encoded_size(size_t bytes) {
+    return bytes + (bytes / frame_size + 1) * (1 + 2 * sizeof(uint64_t)) + sizeof(uint64_t);
+}
+
+template<typename U>
+constexpr U zigzag_encode(U v) {
+    return static_cast<U>(static_cast<U>(v << 1) ^ static_cast<U>(U{0} - (v >> (std::numeric_limits<U>::digits - 1))));
+}
+
+template<typename U>
+constexpr U zigzag_decode(U v) {
+    return static_cast<U>((v >> 1) ^ static_cast<U>(U{0} - (v & 1)));
+}
+
+// Flips the top bit so that signed values order the same way as their unsigned representation
+template<typename U>
+constexpr U sign_bias() {
+    return static_cast<U>(U{1} << (std::numeric_limits<U>::digits - 1));
+}
+
+template<typename T, typename U>
+constexpr U value_bias(SubCodec sub_codec) {
+    if (is_delta(sub_codec) || (std::is_integral_v<T> && std::is_signed_v<T>))
+        return sign_bias<U>();
+    return U{0};
+}
+
+// Instruction sets of the bit packing kernels, all of which produce the same stream
+enum class BitPacking : uint8_t { SCALAR = 0, AVX2 = 1 };
+
+// The widest kernels this CPU supports, capped by Codec.MaxSimdLevel
+BitPacking bit_packing();
+
+// Packs the offsets of up to frame_size values from the reference into packed_bytes(count, width) bytes
+template<typename U>
+void pack(BitPacking kernels, const U* in, size_t count, size_t width, U reference, uint8_t* out);
+
+template<typename U>
+void unpack(BitPacking kernels, const uint8_t* in, size_t count, size_t width, U reference, U* out);
+
+template<typename T>
+size_t encode(SubCodec sub_codec, const T* in, size_t count, uint8_t* out) {
+    using U = unsigned_t<T>;
+    static_assert(sizeof(U) == sizeof(T));
+    util::check_arg(is_supported(sub_codec), "Unsupported tp4 sub codec {}", static_cast<int>(sub_codec));
+    const U bias = value_bias<T, U>(sub_codec);
+    const auto* const begin = out;
+    U previous{0};
+    if (is_delta(sub_codec) && count > 0) {
+        std::memcpy(&previous, in, sizeof(U));
+        std::memcpy(out, &previous, sizeof(U));
+        out += sizeof(U);
     }
 
-    template<class T>
-    inline static std::size_t encode_block_(T* in, Block& block, std::uint8_t* out) {
-        std::size_t compressed_bytes = 0;
-        if constexpr (std::is_integral_v<T>) {
-            if constexpr (std::is_unsigned_v<T>) {
-                if constexpr (std::is_same_v<T, std::uint64_t>) {
-                    compressed_bytes = fppenc64(in, block.count, out, 0);
-                } else if constexpr (std::is_same_v<T, std::uint32_t>) {
-                    compressed_bytes = fppenc32(in, block.count, out, 0);
-                } else if constexpr (std::is_same_v<T, std::uint16_t>) {
-                    compressed_bytes = fppenc16(in, block.count, out, 0);
-                } else if constexpr (std::is_same_v<T, std::uint8_t>) {
-                    compressed_bytes = fppenc8(in, block.count, out, 0);
-                }
-            } else if constexpr (std::is_signed_v<T>) {
-                using Unsigned_T = std::make_unsigned_t<T>;
-                auto u_in = reinterpret_cast<const Unsigned_T*>(in);
-                compressed_bytes = encode_block_(u_in, block, out);
-            }
-        } else if constexpr (std::is_floating_point_v<T>) {
-            if constexpr (std::is_same_v<T, double>) {
-                auto* u_in = reinterpret_cast<const std::uint64_t*>(in);
-                encode_block_(u_in, block, out);
-            } else if constexpr (std::is_same_v<T, std::uint32_t>) {
-                auto* u_in = reinterpret_cast<const std::uint32_t*>(in);
-                encode_block_(u_in, block, out);
+    const auto kernels = bit_packing();
+    U frame[frame_size];
+    for (size_t start = 0; start < count; start += frame_size) {
+        const size_t frame_count = std::min(frame_size, count - start);
+        std::memcpy(frame, in + start, frame_count * sizeof(U));
+        if (is_delta(sub_codec)) {
+            for (size_t i = 0; i < frame_count; ++i) {
+                const U value = frame[i];
+                frame[i] = static_cast<U>(value - previous);
+                previous = value;
             }
         }
-        return compressed_bytes;
+        if (has_reference(sub_codec)) {
+            for (size_t i = 0; i < frame_count; ++i)
+                frame[i] ^= bias;
+        } else {
+            for (size_t i = 0; i < frame_count; ++i)
+                frame[i] = zigzag_encode(frame[i]);
+        }
+
+        const U reference = has_reference(sub_codec) ? *std::min_element(frame, frame + frame_count) : U{0};
+        U max_offset{0};
+        for (size_t i = 0; i < frame_count; ++i)
+            max_offset = std::max(max_offset, static_cast<U>(frame[i] - reference));
+
+        const auto width = static_cast<uint8_t>(std::bit_width(max_offset));
+        *out++ = width;
+        if (has_reference(sub_codec)) {
+            std::memcpy(out, &reference, sizeof(U));
+            out += sizeof(U);
+        }
+        pack(kernels, frame, frame_count, width, reference, out);
+        out += packed_bytes(frame_count, width);
     }
-    template<class T>
-    static void decode_block(const std::uint8_t* in, std::size_t in_count, T* t_out, std::size_t out_bytes) {
-        if constexpr (std::is_integral_v<T>) {
-            if constexpr (std::is_unsigned_v<T>) {
-                std::uint8_t* in_nc = (std::uint8_t*)in;
-                std::size_t decompressed_bytes = 0;
-                if constexpr (std::is_same_v<T, std::uint64_t>) {
-                    decompressed_bytes = fppdec64(in_nc, in_count, t_out, 0);
-                } else if constexpr (std::is_same_v<T, std::uint32_t>) {
-                    decompressed_bytes = fppdec32(in_nc, in_count, t_out, 0);
-                } else if constexpr (std::is_same_v<T, std::uint16_t>) {
-                    decompressed_bytes = fppdec16(in_nc, in_count, t_out, 0);
-                } else if constexpr (std::is_same_v<T, std::uint8_t>) {
-                    decompressed_bytes = fppdec8(in_nc, in_count, t_out, 0);
-                }
-                util::check_arg(
-                        decompressed_bytes == out_bytes,
-                        "expected out_bytes == decompressed bytes, actual {} != {}",
-                        out_bytes,
-                        decompressed_bytes
-                );
-            } else if constexpr (std::is_signed_v<T>) {
-                using Unsigned_T = std::make_unsigned_t<T>;
-                auto u_out = reinterpret_cast<Unsigned_T*>(t_out);
-                decode_block(in, in_count, u_out, out_bytes);
-            }
-        } else if constexpr (std::is_floating_point_v<T>) {
-            if constexpr (std::is_same_v<T, double>) {
-                auto* u_out = reinterpret_cast<const std::uint64_t*>(t_out);
-                decode_block(in, in_count, u_out, out_bytes);
-            } else if constexpr (std::is_same_v<T, std::uint32_t>) {
-                auto* u_out = reinterpret_cast<const std::uint32_t*>(t_out);
-                decode_block(in, in_count, u_out, out_bytes);
+    return static_cast<size_t>(out - begin);
+}
+
+template<typename T>
+size_t decode(SubCodec sub_codec, const uint8_t* in, size_t in_bytes, T* t_out, size_t count) {
+    using U = unsigned_t<T>;
+    codec::check<ErrorCode::E_DECODE_ERROR>(
+            is_supported(sub_codec), "Unsupported tp4 sub codec {}", static_cast<int>(sub_codec)
+    );
+    const U bias = value_bias<T, U>(sub_codec);
+    const auto* const begin = in;
+    const auto* const end = in + in_bytes;
+    auto* out = reinterpret_cast<uint8_t*>(t_out);
+    U previous{0};
+    if (is_delta(sub_codec) && count > 0) {
+        codec::check<ErrorCode::E_DECODE_ERROR>(end - in >= ssize_t(sizeof(U)), "Truncated tp4 block");
+        std::memcpy(&previous, in, sizeof(U));
+        in += sizeof(U);
+    }
+
+    const auto kernels = bit_packing();
+    U frame[frame_size];
+    for (size_t start = 0; start < count; start += frame_size) {
+        const size_t frame_count = std::min(frame_size, count - start);
+        const size_t header_bytes = 1 + (has_reference(sub_codec) ? sizeof(U) : 0);
+        codec::check<ErrorCode::E_DECODE_ERROR>(end - in >= ssize_t(header_bytes), "Truncated tp4 frame header");
+        const size_t width = *in++;
+        codec::check<ErrorCode::E_DECODE_ERROR>(
+                width <= std::numeric_limits<U>::digits, "Invalid tp4 bit width {}", width
+        );
+        U reference{0};
+        if (has_reference(sub_codec)) {
+            std::memcpy(&reference, in, sizeof(U));
+            in += sizeof(U);
+        }
+        const size_t frame_bytes = packed_bytes(frame_count, width);
+        codec::check<ErrorCode::E_DECODE_ERROR>(end - in >= ssize_t(frame_bytes), "Truncated tp4 frame");
+        unpack(kernels, in, frame_count, width, reference, frame);
+        in += frame_bytes;
+
+        if (has_reference(sub_codec)) {
+            for (size_t i = 0; i < frame_count; ++i)
+                frame[i] ^= bias;
+        } else {
+            for (size_t i = 0; i < frame_count; ++i)
+                frame[i] = zigzag_decode(frame[i]);
+        }
+        if (is_delta(sub_codec)) {
+            for (size_t i = 0; i < frame_count; ++i) {
+                previous = static_cast<U>(previous + frame[i]);
+                frame[i] = previous;
             }
         }
+        std::memcpy(out + start * sizeof(U), frame, frame_count * sizeof(U));
     }
-};
+    return static_cast<size_t>(in - begin);
+}
 
-/**
- * Force encoded type for shapes
- */
-struct ShapeEncoder : TurboPForBlockCodec<arcticdb::proto::encoding::VariantCodec::TurboPfor::FP_DELTA> {
+using Opts = arcticdb::proto::encoding::VariantCodec::TurboPfor;
 
-    using Parent = TurboPForBlockCodec<arcticdb::proto::encoding::VariantCodec::TurboPfor::FP_DELTA>;
+inline void set_codec(arcticdb::proto::encoding::VariantCodec& out_codec, const Opts& opts) {
+    copy_codec(*out_codec.mutable_tp4(), opts);
+}
 
-    template<class T>
-    static std::size_t encode_block(
-            const T* in, Block& block, HashAccum& hasher, T* out, std::size_t out_capacity, std::ptrdiff_t& pos,
-            arcticdb::proto::encoding::VariantCodec& out_codec
-    ) {
-        std::size_t compressed_size = Parent::encode_block(in, block, hasher, out, out_capacity, pos);
+inline void set_codec(BlockCodecImpl& out_codec, const Opts& opts) {
+    copy_codec(*out_codec.mutable_pfor(), opts);
+}
 
-        out_codec.mutable_tp4()->set_sub_codec(arcticdb::proto::encoding::VariantCodec::TurboPfor::FP_DELTA);
-        return compressed_size;
-    }
-};
+} // namespace tp4
+
+struct TurboPForBlockEncoder {
+
+    using Opts = arcticdb::proto::encoding::VariantCodec::TurboPfor;
+    static constexpr std::uint32_t VERSION = 1;
 
-struct TurboPForBlockEncoder : TurboPForBase {
+    static std::size_t max_compressed_size(std::size_t size) { return tp4::max_encoded_size(size); }
 
-    template<class T>
+    static void set_shape_defaults(Opts& opts) { opts.set_sub_codec(Opts::P4); }
+
+    template<class T, class CodecType>
     static std::size_t encode_block(
-            const Opts& opts, const T* in, Block& block, HashAccum& hasher, T* out, std::size_t out_capacity,
-            std::ptrdiff_t& pos, arcticdb::proto::encoding::VariantCodec& out_codec
+            const Opts& opts, const T* in, BlockDataHelper& block_utils, HashAccum& hasher, T* out,
+            std::size_t out_capacity, std::ptrdiff_t& pos, CodecType& out_codec
     ) {
-        std::size_t compressed_size = 0;
-        switch (opts.sub_codec()) {
-        case Opts::FP_DELTA:
-            compressed_size =
-                    TurboPForBlockCodec<Opts::FP_DELTA>::encode_block(in, block, hasher, out, out_capacity, pos);
-            break;
-        default:
-            raise_unsupported_msg("Unsupported tp4 subcodec {}", opts);
-        }
-        out_codec.mutable_tp4()->MergeFrom(opts);
-        return compressed_size;
+        const auto compressed_bytes =
+                tp4::encode(opts.sub_codec(), in, block_utils.count_, reinterpret_cast<std::uint8_t*>(out));
+        util::check(
+                compressed_bytes <= out_capacity,
+                "tp4 overran its output buffer, {} > {}",
+                compressed_bytes,
+                out_capacity
+        );
+        ARCTICDB_TRACE(
+                log::storage(),
+                "Block of size {} compressed to {} bytes: {}",
+                block_utils.bytes_,
+                compressed_bytes,
+                dump_bytes(out, compressed_bytes, 10U)
+        );
+        hasher(in, block_utils.count_);
+        pos += ssize_t(compressed_bytes);
+        tp4::set_codec(out_codec, opts);
+        return compressed_bytes;
     }
 };
 
-template<template<typename> class F, class TD>
-using TurboPForEncoder = GenericBlockEncoder<F<TD>, TD, TurboPForBlockEncoder, ShapeEncoder>;
-
 struct TurboPForDecoder {
-
     template<typename T>
     static void decode_block(
-            const arcticdb::proto::encoding::Block& block, const std::uint8_t* in, std::size_t in_bytes, T* t_out,
-            std::size_t out_bytes
+            [[maybe_unused]] std::uint32_t encoder_version, tp4::SubCodec sub_codec, const std::uint8_t* in,
+            std::size_t in_bytes, T* t_out, std::size_t out_bytes
     ) {
-        switch (block.codec().tp4().sub_codec()) {
-        case arcticdb::proto::encoding::VariantCodec::TurboPfor::FP_DELTA:
-            TurboPForBlockCodec<arcticdb::proto::encoding::VariantCodec::TurboPfor::FP_DELTA>::decode_block(
-                    in, in_bytes, t_out, out_bytes
-            );
-            break;
-        default:
-            raise_unsupported_msg("Unsupported tp4 block {}", block);
-        }
+        ARCTICDB_TRACE(log::codec(), "tp4 decoder reading block: {} {}", in_bytes, out_bytes);
+        codec::check<ErrorCode::E_DECODE_ERROR>(
+                out_bytes % sizeof(T) == 0, "tp4 block of {} bytes is not a whole number of values", out_bytes
+        );
+        const auto decoded_bytes = tp4::decode(sub_codec, in, in_bytes, t_out, out_bytes / sizeof(T));
+        codec::check<ErrorCode::E_DECODE_ERROR>(
+                decoded_bytes == in_bytes,
+                "expected in_bytes == tp4 consumed bytes, actual {} != {}",
+                in_bytes,
+                decoded_bytes
+        );
     }
 };
 
-} // namespace arcticdb::detail
\ No newline at end of file
+} // namespace arcticdb::detail
@@ -2,6 +2,8 @@
 #include <arcticdb/codec/passthrough.hpp>
 #include <arcticdb/codec/zstd.hpp>
 #include <arcticdb/codec/lz4.hpp>
+#include <arcticdb/codec/tp4.hpp>
+#include <arcticdb/codec/adaptive_codec.hpp>
 #include <arcticdb/codec/encoded_field.hpp>
 #include <arcticdb/util/buffer.hpp>
 
@@ -19,6 +21,15 @@ struct TypedBlockEncoderImpl {
     static size_t max_compressed_size(
             const arcticdb::proto::encoding::VariantCodec& codec_opts, const TypedBlock<TD>& typed_block
     ) {
+        if (codec_opts.codec_case() == arcticdb::proto::encoding::VariantCodec::kAdaptive) {
+            // Any of the candidates may be chosen
+            return std::max(
+                    {ZstdEncoder::max_compressed_size(typed_block),
+                     Lz4Encoder::max_compressed_size(typed_block),
+                     TurboPForEncoder::max_compressed_size(typed_block),
+                     PassthroughEncoder::max_compressed_size(typed_block)}
+            );
+        }
         return visit_encoder(codec_opts, [&](auto encoder_tag) {
             return decltype(encoder_tag)::Encoder::max_compressed_size(typed_block);
         });
@@ -41,6 +52,10 @@ struct TypedBlockEncoderImpl {
                 encoder_version == EncodingVersion::V1,
                 "Encoding of both shapes and values at the same time is allowed only in V1 encoding"
         );
+        if (codec_opts.codec_case() == arcticdb::proto::encoding::VariantCodec::kAdaptive) {
+            encode(adaptive_block_codec(codec_opts, typed_block), typed_block, field, out, pos);
+            return;
+        }
         visit_encoder(codec_opts, [&](auto encoder_tag) {
             decltype(encoder_tag)::Encoder::encode(get_opts(codec_opts, encoder_tag), typed_block, field, out, pos);
         });
@@ -80,6 +95,10 @@ struct TypedBlockEncoderImpl {
             ARCTICDB_TRACE(log::codec(), "Encoder got values of size 0. Noting to encode.");
             return;
         }
+        if (codec_opts.codec_case() == arcticdb::proto::encoding::VariantCodec::kAdaptive) {
+            encode_values(adaptive_block_codec(codec_opts, typed_block), typed_block, field, out, pos);
+            return;
+        }
 
         encode_to_values<TypedBlock<TD>, decltype(ndarray)>(codec_opts, typed_block, out, pos, ndarray);
         const auto existing_items_count = ndarray->items_count();
@@ -110,6 +129,13 @@ struct TypedBlockEncoderImpl {
     }
 
   private:
+    static arcticdb::proto::encoding::VariantCodec adaptive_block_codec(
+            const arcticdb::proto::encoding::VariantCodec& codec_opts, const TypedBlock<TD>& typed_block
+    ) {
+        using T = typename TD::DataTypeTag::raw_type;
+        return codec::choose_block_codec(codec_opts.adaptive(), typed_block.data(), typed_block.nbytes() / sizeof(T));
+    }
+
     template<class EncoderType>
     using BlockEncoder = std::conditional_t<
             encoder_version == EncodingVersion::V1,
@@ -118,6 +144,7 @@ struct TypedBlockEncoderImpl {
 
     using ZstdEncoder = BlockEncoder<arcticdb::detail::ZstdBlockEncoder>;
     using Lz4Encoder = BlockEncoder<arcticdb::detail::Lz4BlockEncoder>;
+    using TurboPForEncoder = BlockEncoder<arcticdb::detail::TurboPForBlockEncoder>;
 
     using PassthroughEncoder = std::conditional_t<
             encoder_version == EncodingVersion::V1, arcticdb::detail::PassthroughEncoderV1<TypedBlock, TD>,
@@ -135,8 +162,12 @@ struct TypedBlockEncoderImpl {
             return f(EncoderTag<ZstdEncoder>());
         case arcticdb::proto::encoding::VariantCodec::kLz4:
             return f(EncoderTag<Lz4Encoder>());
+        case arcticdb::proto::encoding::VariantCodec::kTp4:
+            return f(EncoderTag<TurboPForEncoder>());
         case arcticdb::proto::encoding::VariantCodec::kPassthrough:
             return f(EncoderTag<PassthroughEncoder>());
+        case arcticdb::proto::encoding::VariantCodec::kAdaptive:
+            util::raise_rte("The adaptive codec must be resolved to a codec for each block");
         default:
             return f(EncoderTag<PassthroughEncoder>());
         }
@@ -150,6 +181,10 @@ struct TypedBlockEncoderImpl {
         return codec_opts.zstd();
     }
 
+    static auto get_opts(const arcticdb::proto::encoding::VariantCodec& codec_opts, EncoderTag<TurboPForEncoder>) {
+        return codec_opts.tp4();
+    }
+
     static auto get_opts(const arcticdb::proto::encoding::VariantCodec& codec_opts, EncoderTag<PassthroughEncoder>) {
         return codec_opts.passthrough();
     }
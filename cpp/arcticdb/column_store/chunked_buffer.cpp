@@ -146,4 +146,74 @@ ChunkedBufferImpl<BlockSize> truncate(const ChunkedBufferImpl<BlockSize>& input,
 template ChunkedBufferImpl<64> truncate(const ChunkedBufferImpl<64>& input, size_t start_byte, size_t end_byte);
 template ChunkedBufferImpl<3968> truncate(const ChunkedBufferImpl<3968>& input, size_t start_byte, size_t end_byte);
 
+// Inclusive of start_byte, exclusive of end_byte
+template<size_t BlockSize>
+ChunkedBufferImpl<BlockSize> view(const ChunkedBufferImpl<BlockSize>& input, size_t start_byte, size_t end_byte) {
+    ARCTICDB_DEBUG(
+            log::version(), "Viewing buffer of size {} between bytes {} and {}", input.bytes(), start_byte, end_byte
+    );
+    ChunkedBufferImpl<BlockSize> output;
+    if (input.num_blocks() == 0 || start_byte >= end_byte)
+        return output;
+
+    const auto& input_blocks = input.blocks();
+    auto start_block_and_offset = input.block_and_offset(start_byte);
+    auto start_idx = start_block_and_offset.block_index_;
+    // end_byte is the first byte NOT to include in the output
+    auto end_idx = input.block_and_offset(end_byte - 1).block_index_ + 1;
+
+    auto remaining_bytes = end_byte - start_byte;
+    for (auto idx = start_idx; idx < end_idx; idx++) {
+        const auto* input_block = input_blocks.at(idx);
+        util::check(
+                input_block->physical_bytes() == input_block->logical_size(),
+                "view should be called only for DYNAMIC and EXTERNAL blocks with no extra bytes"
+        );
+        auto source_pos = idx == start_idx ? start_block_and_offset.offset_ : 0u;
+        auto source_bytes = std::min(remaining_bytes, input_block->physical_bytes() - source_pos);
+        output.add_external_block(input_block->ptr(source_pos), source_bytes);
+        remaining_bytes -= source_bytes;
+    }
+    return output;
+}
+
+template ChunkedBufferImpl<64> view(const ChunkedBufferImpl<64>& input, size_t start_byte, size_t end_byte);
+template ChunkedBufferImpl<3968> view(const ChunkedBufferImpl<3968>& input, size_t start_byte, size_t end_byte);
+
+template<size_t BlockSize>
+ChunkedBufferImpl<BlockSize> reblock(const ChunkedBufferImpl<BlockSize>& input, size_t block_bytes) {
+    util::check(block_bytes > 0, "Cannot reblock a buffer into blocks of 0 bytes");
+    // Detachable buffers take blocks of exactly the size asked for
+    ChunkedBufferImpl<BlockSize> output(entity::AllocationType::DETACHABLE);
+    while (output.bytes() < input.bytes()) {
+        output.ensure(std::min(output.bytes() + block_bytes, input.bytes()));
+    }
+
+    auto target_block = output.blocks().begin();
+    size_t target_pos = 0;
+    for (const auto block : input.blocks()) {
+        util::check(
+                block->physical_bytes() == block->logical_size(),
+                "reblock should be called only for DYNAMIC and EXTERNAL blocks with no extra bytes"
+        );
+        size_t source_pos = 0;
+        while (source_pos != block->physical_bytes()) {
+            util::check(target_block != output.blocks().end(), "Went past end of blocks");
+            const auto this_write =
+                    std::min(block->physical_bytes() - source_pos, (*target_block)->physical_bytes() - target_pos);
+            (*target_block)->copy_from(block->ptr(source_pos), this_write, target_pos);
+            source_pos += this_write;
+            target_pos += this_write;
+            if (target_pos == (*target_block)->physical_bytes()) {
+                ++target_block;
+                target_pos = 0;
+            }
+        }
+    }
+    return output;
+}
+
+template ChunkedBufferImpl<64> reblock(const ChunkedBufferImpl<64>& input, size_t block_bytes);
+template ChunkedBufferImpl<3968> reblock(const ChunkedBufferImpl<3968>& input, size_t block_bytes);
+
 } // namespace arcticdb
\ No newline at end of file
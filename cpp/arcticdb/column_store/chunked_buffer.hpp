@@ -809,6 +809,14 @@ std::vector<ChunkedBufferImpl<BlockSize>> split(const ChunkedBufferImpl<BlockSiz
 template<size_t BlockSize>
 ChunkedBufferImpl<BlockSize> truncate(const ChunkedBufferImpl<BlockSize>& input, size_t start_byte, size_t end_byte);
 
+// A buffer of external blocks over bytes [start_byte, end_byte) of input, which must outlive it
+template<size_t BlockSize>
+ChunkedBufferImpl<BlockSize> view(const ChunkedBufferImpl<BlockSize>& input, size_t start_byte, size_t end_byte);
+
+// A copy of input in blocks of block_bytes bytes, bar the last which holds the remainder
+template<size_t BlockSize>
+ChunkedBufferImpl<BlockSize> reblock(const ChunkedBufferImpl<BlockSize>& input, size_t block_bytes);
+
 inline void hash_buffer(const ChunkedBuffer& buffer, HashAccum& accum) {
     for (const auto& block : buffer.blocks()) {
         accum(block->data(), block->physical_bytes());
@@ -963,6 +963,17 @@ std::shared_ptr<Column> Column::truncate(const std::shared_ptr<Column>& column,
     return res;
 }
 
+std::shared_ptr<Column> Column::view(const std::shared_ptr<Column>& column, size_t start_row, size_t end_row) {
+    const auto [start_byte, end_byte] = column_start_end_bytes(*column, start_row, end_row);
+    auto buffer = ::arcticdb::view(column->data_.buffer(), start_byte, end_byte);
+    auto res = std::make_shared<Column>(column->type(), column->allow_sparse_, std::move(buffer));
+    if (column->is_sparse()) {
+        res->set_sparse_map(util::truncate_sparse_map(column->sparse_map(), start_row, end_row));
+    }
+    res->set_row_data(end_row - (start_row + 1));
+    return res;
+}
+
 void Column::set_empty_array(ssize_t row_offset, int dimension_count) {
     ARCTICDB_SAMPLE(ColumnSetArray, RMTSF_Aggregate)
     magic_.check();
@@ -591,6 +591,13 @@ class Column {
     [[nodiscard]] static std::shared_ptr<Column> truncate(
             const std::shared_ptr<Column>& column, size_t start_row, size_t end_row
     );
+    /// @brief As truncate, but the new column refers to the data of column rather than copying it, so column must
+    /// outlive it
+    /// @param[in] start_row Inclusive start of the row range
+    /// @param[in] end_row Exclusive end of the row range
+    [[nodiscard]] static std::shared_ptr<Column> view(
+            const std::shared_ptr<Column>& column, size_t start_row, size_t end_row
+    );
 
     void init_buffer();
 
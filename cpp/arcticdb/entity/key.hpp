@@ -193,6 +193,16 @@ enum class KeyType : int {
      * Used for a list based reliable storage lock
      */
     ATOMIC_LOCK = 28,
+    /*
+     * A reference key holding every key in a symbol's version chain below one of its VERSION keys, so that deep loads
+     * of the version chain read one segment rather than following the chain. Rebuilt from fully loaded chains.
+     */
+    VERSION_CATALOGUE = 29,
+    /*
+     * A reference key listing the snapshots that contain a symbol and its index keys in each of them, so that deletes
+     * can check a few symbols' snapshot membership without reading every snapshot.
+     */
+    SNAPSHOT_MEMBERSHIP = 30,
     UNDEFINED
 };
 
@@ -207,9 +217,11 @@ consteval auto key_types_write_precedence() {
             KeyType::VERSION,
             KeyType::VERSION_JOURNAL,
             KeyType::VERSION_REF,
+            KeyType::VERSION_CATALOGUE,
             KeyType::SYMBOL_LIST,
             KeyType::SNAPSHOT,
             KeyType::SNAPSHOT_REF,
+            KeyType::SNAPSHOT_MEMBERSHIP,
             KeyType::SNAPSHOT_TOMBSTONE,
             KeyType::APPEND_REF,
             KeyType::APPEND_DATA,
@@ -0,0 +1,92 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/pipeline/bloom_filter.hpp>
+
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/hash.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace arcticdb {
+
+namespace {
+
+constexpr uint64_t bloom_filter_seed = 0x42;
+
+size_t bits_per_value() {
+    return static_cast<size_t>(
+            std::max<int64_t>(ConfigsMap::instance()->get_int("ColumnStats.BloomFilterBitsPerValue", 10), 1)
+    );
+}
+
+// Double hashing, see "Less Hashing, Same Performance: Building a Better Bloom Filter" (Kirsch and Mitzenmacher)
+template<typename Func>
+void for_each_probe(uint64_t hash, uint32_t num_hashes, uint64_t num_bits, Func&& func) {
+    const uint64_t step = std::rotr(hash, 32) | 1;
+    for (uint32_t i = 0; i < num_hashes; ++i) {
+        func((hash + i * step) % num_bits);
+    }
+}
+
+} // namespace
+
+uint64_t bloom_filter_hash(double value) {
+    // -0.0 == 0.0, so must hash the same
+    if (value == 0.0) {
+        value = 0.0;
+    }
+    return XXH64(&value, sizeof(value), bloom_filter_seed);
+}
+
+uint64_t bloom_filter_hash(std::string_view value) { return XXH64(value.data(), value.size(), bloom_filter_seed); }
+
+std::string BloomFilterBuilder::build() const {
+    auto hashes = hashes_;
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+    const auto bpv = bits_per_value();
+    // Whole words, with a minimum of one
+    const uint64_t num_bits = std::max<uint64_t>((hashes.size() * bpv + 63) / 64 * 64, 64);
+    // The number of probes that minimises the false positive rate for this many bits per value
+    const auto num_hashes = static_cast<uint32_t>(
+            std::clamp<long>(std::lround(static_cast<double>(bpv) * std::log(2.0)), long{1}, long{16})
+    );
+
+    // The number of probes in the first byte, then the bits
+    std::string filter(1 + num_bits / 8, '\0');
+    filter[0] = static_cast<char>(num_hashes);
+    auto* bits = reinterpret_cast<uint8_t*>(filter.data() + 1);
+    for (auto hash : hashes) {
+        for_each_probe(hash, num_hashes, num_bits, [bits](uint64_t bit) { bits[bit / 8] |= 1u << (bit % 8); });
+    }
+    return filter;
+}
+
+BloomFilterView::BloomFilterView(std::string_view filter, bool string_values) : string_values_(string_values) {
+    // Filters too short to hold any bits are treated as containing everything
+    if (filter.size() > 1) {
+        num_hashes_ = static_cast<uint8_t>(filter.front());
+        bits_ = filter.substr(1);
+    }
+}
+
+bool BloomFilterView::might_contain(uint64_t hash) const {
+    if (bits_.empty()) {
+        return true;
+    }
+    bool all_set = true;
+    for_each_probe(hash, num_hashes_, bits_.size() * 8, [this, &all_set](uint64_t bit) {
+        all_set &= (static_cast<uint8_t>(bits_[bit / 8]) & (1u << (bit % 8))) != 0;
+    });
+    return all_set;
+}
+
+} // namespace arcticdb
@@ -0,0 +1,65 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/entity/types.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace arcticdb {
+
+/*
+ * Bloom filters over the values of a column in a row slice, stored in a string column of COLUMN_STATS keys (see
+ * BLOOM_V1 in column_stats.proto for the format). They answer "might this row slice contain x", so let == and isin skip
+ * row slices of high-cardinality unsorted columns, where min and max are no help.
+ */
+
+// Type of the column stats segment columns holding the serialized filters
+constexpr DataType bloom_filter_data_type = DataType::ASCII_DYNAMIC64;
+
+// Numeric and time values are hashed as doubles, so that values of different types that compare equal hash equal
+uint64_t bloom_filter_hash(double value);
+
+uint64_t bloom_filter_hash(std::string_view value);
+
+class BloomFilterBuilder {
+  public:
+    void add(uint64_t hash) { hashes_.emplace_back(hash); }
+
+    bool empty() const { return hashes_.empty(); }
+
+    // The serialized filter, sized for the number of distinct values added with ColumnStats.BloomFilterBitsPerValue
+    // bits per value
+    std::string build() const;
+
+  private:
+    std::vector<uint64_t> hashes_;
+};
+
+class BloomFilterView {
+  public:
+    // filter is a serialized filter, which must outlive the view
+    BloomFilterView(std::string_view filter, bool string_values);
+
+    // False means that no value with this hash was added
+    bool might_contain(uint64_t hash) const;
+
+    // Whether the filter is over a string column, and so should be probed with the hashes of strings
+    bool string_values() const { return string_values_; }
+
+  private:
+    std::string_view bits_;
+    uint32_t num_hashes_{0};
+    bool string_values_;
+};
+
+} // namespace arcticdb
@@ -1,5 +1,9 @@
 #include <arcticdb/pipeline/column_stats.hpp>
+#include <arcticdb/pipeline/bloom_filter.hpp>
 #include <arcticdb/pipeline/index_fields.hpp>
+#include <arcticdb/column_store/column_algorithms.hpp>
+#include <arcticdb/column_store/string_pool.hpp>
+#include <arcticdb/util/offset_string.hpp>
 #include <arcticdb/processing/aggregation_interface.hpp>
 #include <arcticdb/processing/unsorted_aggregation.hpp>
 #include <arcticdb/entity/type_utils.hpp>
@@ -7,7 +11,28 @@
 
 namespace arcticdb {
 
-SegmentInMemory merge_column_stats_segments(const std::vector<SegmentInMemory>& segments) {
+void move_column_stats_strings(SegmentInMemory& segment, const std::shared_ptr<StringPool>& string_pool) {
+    const auto source_pool = segment.string_pool_ptr();
+    if (source_pool == string_pool) {
+        return;
+    }
+    using BloomTDT = ScalarTagType<DataTypeTag<bloom_filter_data_type>>;
+    for (position_t idx = 0; idx < position_t(segment.num_columns()); ++idx) {
+        auto& column = segment.column(idx);
+        if (column.type().data_type() != bloom_filter_data_type) {
+            continue;
+        }
+        for_each<BloomTDT>(column, [&source_pool, &string_pool](auto& offset) {
+            const auto source_offset = static_cast<OffsetString::offset_t>(offset);
+            if (is_a_string(source_offset)) {
+                offset = string_pool->get(source_pool->get_const_view(source_offset)).offset();
+            }
+        });
+    }
+    segment.set_string_pool(string_pool);
+}
+
+SegmentInMemory merge_column_stats_segments(std::vector<SegmentInMemory>& segments) {
     SegmentInMemory merged(Sparsity::PERMITTED);
     merged.init_column_map();
     merged.descriptor().set_index(IndexDescriptorImpl{IndexDescriptor::Type::ROWCOUNT, 0});
@@ -18,6 +43,7 @@ SegmentInMemory merge_column_stats_segments(const std::vector<SegmentInMemory>&
     std::vector<std::string> field_names;
     std::vector<arcticc::pb2::column_stats_pb2::ColumnStatsType> stat_types;
     std::vector<size_t> data_col_offsets;
+    arcticc::pb2::column_stats_pb2::ColumnStatsHeader merged_header;
     for (auto& segment : segments) {
         arcticc::pb2::column_stats_pb2::ColumnStatsHeader header;
         auto metadata = segment.metadata();
@@ -33,7 +59,6 @@ SegmentInMemory merge_column_stats_segments(const std::vector<SegmentInMemory>&
                 offset_lookup[entry.stats_seg_offset()] = {data_col_offset, entry.type()};
             }
         }
-
         for (const auto& [idx, field] : folly::enumerate(segment.descriptor().fields())) {
             auto new_type = field.type();
 
@@ -63,7 +88,6 @@ SegmentInMemory merge_column_stats_segments(const std::vector<SegmentInMemory>&
         }
     }
 
-    arcticc::pb2::column_stats_pb2::ColumnStatsHeader merged_header;
     merged_header.set_version(1); // see column_stats.proto for explanation of the versioning scheme
     auto end_index_offset = static_cast<size_t>(index::Fields::end_index);
     size_t stat_idx = 0;
@@ -78,6 +102,7 @@ SegmentInMemory merge_column_stats_segments(const std::vector<SegmentInMemory>&
         }
     }
     for (auto& segment : segments) {
+        move_column_stats_strings(segment, merged.string_pool_ptr());
         merged.append(segment);
     }
     merged.set_compacted(true);
@@ -96,6 +121,8 @@ std::string type_to_operator_string(ColumnStatTypeInternal type) {
         return "v1_MIN";
     case ColumnStatTypeInternal::MAX_V1:
         return "v1_MAX";
+    case ColumnStatTypeInternal::BLOOM_V1:
+        return "v1_BLOOM";
     default:
         internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unknown column stat type requested");
     }
@@ -105,6 +132,8 @@ std::string type_to_name(ColumnStatType type) {
     switch (type) {
     case ColumnStatType::MINMAX:
         return "MINMAX";
+    case ColumnStatType::BLOOM:
+        return "BLOOM";
     default:
         internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unknown column stat type requested");
     }
@@ -114,6 +143,9 @@ std::optional<ColumnStatType> name_to_type(const std::string& name) {
     if (name == "MINMAX") {
         return ColumnStatType::MINMAX;
     }
+    if (name == "BLOOM") {
+        return ColumnStatType::BLOOM;
+    }
     return std::nullopt;
 }
 
@@ -153,6 +185,14 @@ ColumnStats::ColumnStats(
 ) {
     using namespace arcticc::pb2::column_stats_pb2;
     validate_column_stats_header_version(header);
+    auto add_stat = [this, &tsd](uint32_t data_col_offset, ColumnStatType external_type) {
+        if (auto it = offset_to_stat_info_.find(data_col_offset); it != offset_to_stat_info_.end()) {
+            it->second.column_stats.insert(external_type);
+        } else {
+            std::string name{tsd.fields().at(data_col_offset).name()};
+            offset_to_stat_info_.emplace(data_col_offset, NameAndStatTypes{name, {external_type}});
+        }
+    };
 
     for (const auto& [data_col_offset, entry_list] : header.stats_by_column()) {
         for (const auto& entry : entry_list.entries()) {
@@ -162,6 +202,9 @@ ColumnStats::ColumnStats(
             case MAX_V1:
                 external_type = ColumnStatType::MINMAX;
                 break;
+            case BLOOM_V1:
+                external_type = ColumnStatType::BLOOM;
+                break;
             case UNKNOWN:
             default:
                 log::version().warn(
@@ -169,12 +212,7 @@ ColumnStats::ColumnStats(
                 );
                 continue;
             }
-            if (auto it = offset_to_stat_info_.find(data_col_offset); it != offset_to_stat_info_.end()) {
-                it->second.column_stats.insert(external_type);
-            } else {
-                std::string name{tsd.fields().at(data_col_offset).name()};
-                offset_to_stat_info_.emplace(data_col_offset, NameAndStatTypes{name, {external_type}});
-            }
+            add_stat(data_col_offset, external_type);
         }
     }
     offset_to_stat_info_set_ = true;
@@ -210,6 +248,8 @@ std::unordered_set<ColumnStatTypeInternal> external_to_internal(ColumnStatType t
     switch (type) {
     case ColumnStatType::MINMAX:
         return {ColumnStatTypeInternal::MIN_V1, ColumnStatTypeInternal::MAX_V1};
+    case ColumnStatType::BLOOM:
+        return {ColumnStatTypeInternal::BLOOM_V1};
     default:
         internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unknown column stat type");
     }
@@ -297,6 +337,15 @@ std::optional<Clause> ColumnStats::clause() const {
                         )
                 ));
                 break;
+            case ColumnStatType::BLOOM:
+                index_generation_aggregators->emplace_back(BloomFilterAggregator(
+                        ColumnName(name_and_stat_types.mangled_name),
+                        offset,
+                        ColumnName(to_segment_column_name(
+                                name_and_stat_types.mangled_name, ColumnStatTypeInternal::BLOOM_V1
+                        ))
+                ));
+                break;
             default:
                 internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unrecognised ColumnStatType");
             }
@@ -13,10 +13,14 @@
 
 namespace arcticdb {
 
-SegmentInMemory merge_column_stats_segments(const std::vector<SegmentInMemory>& segments);
+// Bloom filter columns hold offsets in to the string pool of their segment, which SegmentInMemory::append and
+// concatenate do not carry over. Moves the filters of segment in to string_pool, which segment then uses.
+void move_column_stats_strings(SegmentInMemory& segment, const std::shared_ptr<StringPool>& string_pool);
+
+SegmentInMemory merge_column_stats_segments(std::vector<SegmentInMemory>& segments);
 
 // User facing types - eg users are only allowed to create min and max together, not one or the other
-enum class ColumnStatType { MINMAX };
+enum class ColumnStatType { MINMAX, BLOOM };
 // Total universe of column stats we support - min and max are treated separately here
 using ColumnStatTypeInternal = arcticc::pb2::column_stats_pb2::ColumnStatsType;
 
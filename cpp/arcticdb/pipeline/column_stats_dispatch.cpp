@@ -9,6 +9,9 @@
 #include <arcticdb/pipeline/column_stats_dispatch.hpp>
 #include <arcticdb/entity/type_utils.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace arcticdb::column_stats_detail {
 
 namespace {
@@ -19,6 +22,48 @@ bool either_unknown(StatsComparison left, StatsComparison right) {
 
 } // namespace
 
+bool bloom_filter_might_contain(const BloomFilterView& bloom, const Value& val) {
+    return details::visit_type(val.data_type(), [&](auto val_tag) -> bool {
+        using ValTag = std::remove_reference_t<decltype(val_tag)>;
+        if constexpr (is_sequence_type(ValTag::data_type)) {
+            const std::string_view value{*val.str_data(), val.len()};
+            return !bloom.string_values() || bloom.might_contain(bloom_filter_hash(value));
+        } else if constexpr (is_numeric_type(ValTag::data_type) && ValTag::data_type != DataType::FLOAT32) {
+            // As when building the filter. float32 values are compared with integers in float32, so are not probed
+            const auto value = static_cast<double>(val.get<typename ValTag::raw_type>());
+            return bloom.string_values() || std::isnan(value) || bloom.might_contain(bloom_filter_hash(value));
+        } else {
+            return true;
+        }
+    });
+}
+
+bool bloom_filter_might_contain_any(const BloomFilterView& bloom, ValueSet& value_set) {
+    return details::visit_type(value_set.base_type().data_type(), [&](auto set_tag) -> bool {
+        using SetTag = std::remove_reference_t<decltype(set_tag)>;
+        if constexpr (is_sequence_type(SetTag::data_type)) {
+            if (!bloom.string_values()) {
+                return true;
+            }
+            return std::ranges::any_of(*value_set.get_set<std::string>(), [&bloom](const std::string& elem) {
+                return bloom.might_contain(bloom_filter_hash(std::string_view{elem}));
+            });
+        } else if constexpr (is_numeric_type(SetTag::data_type) && SetTag::data_type != DataType::FLOAT32) {
+            if (bloom.string_values()) {
+                return true;
+            }
+            using SetRawType = SetTag::raw_type;
+            return std::ranges::any_of(*value_set.get_set<SetRawType>(), [&bloom](SetRawType elem) {
+                // NaN never matches isin
+                const auto value = static_cast<double>(elem);
+                return !std::isnan(value) && bloom.might_contain(bloom_filter_hash(value));
+            });
+        } else {
+            return true;
+        }
+    });
+}
+
 size_t stats_variant_size(const StatsVariantData& v) {
     return std::visit(
             util::overload{
@@ -43,6 +88,11 @@ StatsComparison stats_membership_comparator(const ColumnStatsValues& stats, Valu
         return StatsComparison::NONE_MATCH;
     }
 
+    // A Bloom filter can only show that no value is in the set, so does not help isnotin
+    if (is_isin && stats.bloom && !bloom_filter_might_contain_any(*stats.bloom, value_set)) {
+        return StatsComparison::NONE_MATCH;
+    }
+
     if (!stats.min || !stats.max) {
         return StatsComparison::UNKNOWN;
     }
@@ -104,11 +104,22 @@ struct FlippedComparator<NotEqualsOperator> {
     using type = NotEqualsOperator;
 };
 
+// False if the Bloom filter shows that no value in the row slice equals val
+bool bloom_filter_might_contain(const BloomFilterView& bloom, const Value& val);
+
+// False if the Bloom filter shows that no value in the row slice is in value_set
+bool bloom_filter_might_contain_any(const BloomFilterView& bloom, ValueSet& value_set);
+
 template<typename Func>
 StatsComparison stats_comparator(const ColumnStatsValues& stats_lhs, const Value& val_rhs, Func&& func) {
     if (stats_lhs.column_absent) {
         return StatsComparison::NONE_MATCH;
     }
+    if constexpr (std::is_same_v<std::remove_cvref_t<Func>, EqualsOperator>) {
+        if (stats_lhs.bloom && !bloom_filter_might_contain(*stats_lhs.bloom, val_rhs)) {
+            return StatsComparison::NONE_MATCH;
+        }
+    }
     if (!stats_lhs.min) {
         return StatsComparison::UNKNOWN;
     }
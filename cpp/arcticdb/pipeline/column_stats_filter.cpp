@@ -10,14 +10,18 @@
 #include <arcticdb/pipeline/column_stats_dispatch.hpp>
 
 #include <arcticdb/codec/codec.hpp>
+#include <arcticdb/column_store/column_algorithms.hpp>
+#include <arcticdb/column_store/string_pool.hpp>
 #include <arcticdb/entity/stream_descriptor.hpp>
 #include <arcticdb/pipeline/column_stats.hpp>
 #include <arcticdb/pipeline/index_fields.hpp>
 #include <arcticdb/pipeline/value.hpp>
 #include <arcticdb/log/log.hpp>
 #include <arcticdb/stream/stream_utils.hpp>
+#include <arcticdb/util/offset_string.hpp>
 #include <arcticdb/processing/query_planner.hpp>
 
+#include <cstring>
 #include <iterator>
 #include <unordered_set>
 
@@ -143,6 +147,10 @@ std::vector<StatsMetadataForColumn> calculate_stats_metadata(
         );
         stats_metadata_for_column.col_name = std::string{tsd.fields().at(data_col_offset).name()};
         for (const auto& entry : entry_list.entries()) {
+            if (entry.type() == arcticc::pb2::column_stats_pb2::BLOOM_V1) {
+                // See ColumnStatsData::load_bloom_filters
+                continue;
+            }
             if (entry.type() != arcticc::pb2::column_stats_pb2::MIN_V1 &&
                 entry.type() != arcticc::pb2::column_stats_pb2::MAX_V1) {
                 log::version().warn(
@@ -319,6 +327,158 @@ ColumnStatsData::ColumnStatsData(
 
     stats_by_column_ = load_stats_by_column(segment, stats_metadata, first_kept, last_kept_excl, num_rows_);
     drop_duplicate_rows();
+    load_bloom_filters(segment, tsd, header, first_kept, last_kept_excl);
+}
+
+void ColumnStatsData::load_bloom_filters(
+        const SegmentInMemory& segment, const TimeseriesDescriptor& tsd,
+        const arcticc::pb2::column_stats_pb2::ColumnStatsHeader& header, size_t first_kept, size_t last_kept_excl
+) {
+    using BloomTDT = ScalarTagType<DataTypeTag<bloom_filter_data_type>>;
+    for (const auto& [data_col_offset, entry_list] : header.stats_by_column()) {
+        for (const auto& entry : entry_list.entries()) {
+            if (entry.type() != arcticc::pb2::column_stats_pb2::BLOOM_V1) {
+                continue;
+            }
+            const auto& field = tsd.fields().at(data_col_offset);
+            std::string col_name{field.name()};
+            // Only the filters of the columns the query filters on are decoded, see partial_decode_column_stats_segment
+            const auto col_index = segment.column_index(to_segment_column_name(col_name, entry.type()));
+            if (!col_index.has_value()) {
+                continue;
+            }
+            const auto& column = segment.column(static_cast<position_t>(*col_index));
+            util::check(
+                    column.type().data_type() == bloom_filter_data_type,
+                    "Unexpected type {} of Bloom filter column for {}",
+                    column.type(),
+                    col_name
+            );
+            const bool string_values = is_sequence_type(field.type().data_type());
+            const auto& string_pool = segment.const_string_pool();
+            std::vector<std::optional<BloomFilterView>> bloom_filters(num_rows_);
+            using RawType = BloomTDT::DataTypeTag::raw_type;
+            for_each_enumerated<BloomTDT>(column, [&](const ColumnData::Enumeration<RawType>& enumerating_it) {
+                auto idx = static_cast<size_t>(enumerating_it.idx());
+                const auto offset = static_cast<OffsetString::offset_t>(enumerating_it.value());
+                // Row slices with no values to filter have None
+                if (idx >= first_kept && idx < last_kept_excl && is_a_string(offset)) {
+                    bloom_filters.at(idx - first_kept).emplace(string_pool.get_const_view(offset), string_values);
+                }
+            });
+            bloom_filters_by_column_.emplace(std::move(col_name), std::move(bloom_filters));
+        }
+    }
+    if (!bloom_filters_by_column_.empty()) {
+        string_pool_ = segment.string_pool_ptr();
+    }
+}
+
+ColumnStatsData ColumnStatsData::from_index_segment(
+        const SegmentInMemory& index_segment, const std::unordered_set<std::string>& columns_of_interest
+) {
+    using namespace arcticc::pb2::column_stats_pb2;
+    ColumnStatsData column_stats;
+    if (index_segment.row_count() == 0) {
+        return column_stats;
+    }
+
+    index_segment.init_column_map();
+    const auto& fields = index_segment.descriptor().fields();
+    std::vector<StatsMetadataForColumn> stats_metadata;
+    for (const auto& col_name : columns_of_interest) {
+        StatsMetadataForColumn stats_metadata_for_column;
+        stats_metadata_for_column.col_name = col_name;
+        for (const auto stat_type : {MIN_V1, MAX_V1}) {
+            const auto col_index = index_segment.column_index(to_segment_column_name(col_name, stat_type));
+            if (!col_index.has_value()) {
+                continue;
+            }
+            const auto entry_data_type = fields.at(*col_index).type().data_type();
+            util::check(
+                    stats_metadata_for_column.data_type == DataType::UNKNOWN ||
+                            stats_metadata_for_column.data_type == entry_data_type,
+                    "MIN/MAX stats columns for {} disagree on data type",
+                    col_name
+            );
+            stats_metadata_for_column.data_type = entry_data_type;
+            stats_metadata_for_column.entries.push_back({*col_index, stat_type});
+        }
+        // Stats are embedded in pairs, for every row
+        if (stats_metadata_for_column.entries.size() == 2) {
+            stats_metadata.emplace_back(std::move(stats_metadata_for_column));
+        }
+    }
+    if (stats_metadata.empty()) {
+        return column_stats;
+    }
+
+    column_stats.num_rows_ = index_segment.row_count();
+    column_stats.stats_by_column_ = load_stats_by_column(
+            index_segment, std::move(stats_metadata), 0, column_stats.num_rows_, column_stats.num_rows_
+    );
+    return column_stats;
+}
+
+ColumnStatsData ColumnStatsData::from_zone_maps(
+        const std::vector<arcticc::pb2::column_stats_pb2::ZoneMaps>& zone_maps
+) {
+    ColumnStatsData column_stats;
+    column_stats.missing_stats_mean_column_absent_ = false;
+    if (zone_maps.empty() || zone_maps.front().rows_per_zone() == 0) {
+        return column_stats;
+    }
+    const auto row_count = zone_maps.front().row_count();
+    const auto rows_per_zone = zone_maps.front().rows_per_zone();
+    for (const auto& column_slice_zone_maps : zone_maps) {
+        util::check(
+                column_slice_zone_maps.row_count() == row_count &&
+                        column_slice_zone_maps.rows_per_zone() == rows_per_zone,
+                "Expected the zone maps of a row slice to have the same zones"
+        );
+    }
+    const auto num_zones = static_cast<size_t>((row_count + rows_per_zone - 1) / rows_per_zone);
+
+    for (const auto& column_slice_zone_maps : zone_maps) {
+        for (const auto& zone_map_column : column_slice_zone_maps.columns()) {
+            auto [it, inserted] = column_stats.stats_by_column_.try_emplace(zone_map_column.name());
+            if (!inserted) {
+                continue;
+            }
+            auto& stats_for_column = it->second;
+            stats_for_column.mins.resize(num_zones);
+            stats_for_column.maxes.resize(num_zones);
+            const auto data_type = static_cast<DataType>(zone_map_column.data_type());
+            details::visit_type(data_type, [&]<typename T>(T) {
+                using type_info = ScalarTypeInfo<T>;
+                if constexpr (is_numeric_type(type_info::data_type) || is_time_type(type_info::data_type) ||
+                              is_bool_type(type_info::data_type)) {
+                    using RawType = typename type_info::RawType;
+                    util::check(
+                            zone_map_column.mins().size() == num_zones * sizeof(RawType) &&
+                                    zone_map_column.maxes().size() == num_zones * sizeof(RawType) &&
+                                    static_cast<size_t>(zone_map_column.null_counts_size()) == num_zones,
+                            "Zone maps of column {} do not match the {} zones of the segment",
+                            zone_map_column.name(),
+                            num_zones
+                    );
+                    for (size_t zone = 0; zone < num_zones; ++zone) {
+                        if (zone_map_column.null_counts(static_cast<int>(zone)) != 0) {
+                            continue;
+                        }
+                        RawType min;
+                        RawType max;
+                        std::memcpy(&min, zone_map_column.mins().data() + zone * sizeof(RawType), sizeof(RawType));
+                        std::memcpy(&max, zone_map_column.maxes().data() + zone * sizeof(RawType), sizeof(RawType));
+                        stats_for_column.mins[zone] = Value{min, data_type};
+                        stats_for_column.maxes[zone] = Value{max, data_type};
+                    }
+                }
+            });
+        }
+    }
+    column_stats.num_rows_ = num_zones;
+    return column_stats;
 }
 
 std::optional<size_t> ColumnStatsData::find_row(timestamp start_index, timestamp end_index) const {
@@ -336,16 +496,24 @@ std::vector<ColumnStatsValues> ColumnStatsData::values_for_column(
         return result;
     }
     auto it = stats_by_column_.find(col_name);
-    if (it == stats_by_column_.end()) {
+    auto bloom_it = bloom_filters_by_column_.find(col_name);
+    if (it == stats_by_column_.end() && bloom_it == bloom_filters_by_column_.end()) {
         return result;
     }
-    const auto& stats = it->second;
     for (size_t i = 0; i < row_indices.size(); ++i) {
         const auto& maybe_row = row_indices.at(i);
         if (!maybe_row.has_value()) {
             continue;
         }
         const size_t r = *maybe_row;
+        if (bloom_it != bloom_filters_by_column_.end()) {
+            result.at(i).bloom = bloom_it->second.at(r);
+        }
+        if (it == stats_by_column_.end()) {
+            // Without min and max, a row slice without a Bloom filter may still have the column
+            continue;
+        }
+        const auto& stats = it->second;
         const bool min_set = stats.mins.at(r).has_value();
         const bool max_set = stats.maxes.at(r).has_value();
         util::check(min_set == max_set, "MIN and MAX should both be present or both be absent");
@@ -353,13 +521,73 @@ std::vector<ColumnStatsValues> ColumnStatsData::values_for_column(
         if (min_set) {
             result_entry.min = stats.mins.at(r);
             result_entry.max = stats.maxes.at(r);
-        } else {
+        } else if (missing_stats_mean_column_absent_) {
             result_entry.column_absent = true;
         }
     }
     return result;
 }
 
+namespace {
+
+/*
+ * Clears the bits of the index rows that the stats show cannot match. stats_row_for(row) gives the row of
+ * column_stats_data holding the stats of index row row, if there is one.
+ */
+template<typename StatsRowFor>
+std::unique_ptr<util::BitSet> prune_with_column_stats(
+        const index::IndexSegmentReader& isr, std::unique_ptr<util::BitSet>&& input,
+        const ColumnStatsData& column_stats_data, const ExpressionContext& expression_context,
+        StatsRowFor&& stats_row_for
+) {
+    std::unique_ptr<util::BitSet> res;
+    if (input) {
+        res = std::move(input);
+    } else {
+        res = std::make_unique<util::BitSet>(static_cast<util::BitSetSizeType>(isr.size()));
+        res->invert();
+    }
+
+    StatsRowIndices row_indices;
+    row_indices.reserve(isr.size());
+    [[maybe_unused]] size_t total_count = 0; // for debug logging only, unused in release build
+    for (size_t row = 0; row < isr.size(); ++row) {
+        if (!res->get_bit(row)) {
+            // Don't bother - we already know we don't need to look at the segment
+            row_indices.emplace_back(std::nullopt);
+            continue;
+        }
+        total_count++;
+        row_indices.emplace_back(stats_row_for(row));
+    }
+    util::check(row_indices.size() == isr.size(), "Expected row_indices.size() == isr.size()");
+
+    // Evaluate the AST
+    StatsVariantData result = evaluate_ast_node_against_stats(
+            expression_context.root_node_name_, expression_context, row_indices, column_stats_data
+    );
+    util::check(
+            std::holds_alternative<std::vector<StatsComparison>>(result),
+            "evaluate_ast_node_against_stats should evaluate to a vector<StatsComparison>"
+    );
+
+    // Convert to BitSet
+    size_t pruned_count = 0;
+    const auto& comparisons = std::get<std::vector<StatsComparison>>(result);
+    util::check(comparisons.size() == isr.size(), "Expected comparisons.size() == isr.size()");
+    for (size_t row = 0; row < isr.size(); ++row) {
+        if (comparisons.at(row) == StatsComparison::NONE_MATCH) {
+            res->set_bit(row, false);
+            pruned_count++;
+        }
+    }
+
+    log::version().debug("Column stats filter pruned {} of {} segments", pruned_count, total_count);
+    return res;
+}
+
+} // namespace
+
 FilterQuery<index::IndexSegmentReader> create_column_stats_filter(
         ColumnStatsData&& column_stats_data, ExpressionContext&& expression_context
 ) {
@@ -368,55 +596,15 @@ FilterQuery<index::IndexSegmentReader> create_column_stats_filter(
            ) mutable {
         using namespace pipelines::index;
 
-        std::unique_ptr<util::BitSet> res;
-        if (input) {
-            res = std::move(input);
-        } else {
-            res = std::make_unique<util::BitSet>(static_cast<util::BitSetSizeType>(isr.size()));
-            res->invert();
-        }
-
         auto start_index_col = isr.column(Fields::start_index).begin<stream::TimeseriesIndex::TypeDescTag>();
         auto end_index_col = isr.column(Fields::end_index).begin<stream::TimeseriesIndex::TypeDescTag>();
-
-        StatsRowIndices row_indices;
-        row_indices.reserve(isr.size());
-        [[maybe_unused]] size_t total_count = 0; // for debug logging only, unused in release build
-        for (size_t row = 0; row < isr.size(); ++row) {
-            if (!res->get_bit(row)) {
-                // Don't bother - we already know we don't need to look at the segment
-                row_indices.emplace_back(std::nullopt);
-                continue;
-            }
-            total_count++;
-            timestamp start_idx = *(start_index_col + row);
-            timestamp end_idx = *(end_index_col + row);
-            row_indices.emplace_back(column_stats_data.find_row(start_idx, end_idx));
-        }
-        util::check(row_indices.size() == isr.size(), "Expected row_indices.size() == isr.size()");
-
-        // Evaluate the AST
-        StatsVariantData result = evaluate_ast_node_against_stats(
-                expression_context.root_node_name_, expression_context, row_indices, column_stats_data
-        );
-        util::check(
-                std::holds_alternative<std::vector<StatsComparison>>(result),
-                "evaluate_ast_node_against_stats should evaluate to a vector<StatsComparison>"
+        return prune_with_column_stats(
+                isr,
+                std::move(input),
+                column_stats_data,
+                expression_context,
+                [&](size_t row) { return column_stats_data.find_row(*(start_index_col + row), *(end_index_col + row)); }
         );
-
-        // Convert to BitSet
-        size_t pruned_count = 0;
-        const auto& comparisons = std::get<std::vector<StatsComparison>>(result);
-        util::check(comparisons.size() == isr.size(), "Expected comparisons.size() == isr.size()");
-        for (size_t row = 0; row < isr.size(); ++row) {
-            if (comparisons.at(row) == StatsComparison::NONE_MATCH) {
-                res->set_bit(row, false);
-                pruned_count++;
-            }
-        }
-
-        log::version().debug("Column stats filter pruned {} of {} segments", pruned_count, total_count);
-        return res;
     };
 }
 
@@ -457,6 +645,38 @@ ColumnStatsQueryMetadata::ColumnStatsQueryMetadata(const std::vector<std::shared
     }
 }
 
+std::optional<FilterQuery<index::IndexSegmentReader>> create_embedded_column_stats_filter(
+        const index::IndexSegmentReader& index_segment_reader, ColumnStatsQueryMetadata&& query_metadata
+) {
+    util::check(
+            query_metadata.should_try_column_stats_read(),
+            "Should not try to create column stats filter if !should_try_column_stats_read()"
+    );
+    auto column_stats =
+            ColumnStatsData::from_index_segment(index_segment_reader.seg(), query_metadata.columns_of_interest);
+    if (column_stats.empty()) {
+        return std::nullopt;
+    }
+    ARCTICDB_DEBUG(log::version(), "AND-ing expression contexts from filters");
+    return [column_stats = std::move(column_stats),
+            expression_context = and_filter_expression_contexts(query_metadata.filter_expressions)](
+                   const index::IndexSegmentReader& isr, std::unique_ptr<util::BitSet>&& input
+           ) mutable {
+        util::check(
+                isr.size() == column_stats.num_rows(),
+                "Embedded column stats have {} rows but the index has {}",
+                column_stats.num_rows(),
+                isr.size()
+        );
+        // The stats were read from this index segment, so each index row is its own stats row
+        return prune_with_column_stats(
+                isr, std::move(input), column_stats, expression_context, [](size_t row) {
+                    return std::optional<size_t>{row};
+                }
+        );
+    };
+}
+
 SegmentInMemory partial_decode_column_stats_segment(
         Segment& column_stats_segment, const TimeseriesDescriptor& tsd,
         const std::unordered_set<std::string>& columns_of_interest
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <arcticdb/pipeline/bloom_filter.hpp>
 #include <arcticdb/pipeline/index_segment_reader.hpp>
 #include <arcticdb/pipeline/query.hpp>
 #include <arcticdb/processing/clause.hpp>
@@ -39,6 +40,8 @@ struct PairHasher {
 struct ColumnStatsValues {
     std::optional<Value> min;
     std::optional<Value> max;
+    // Bloom filter of the values, which may be present with or without min and max
+    std::optional<BloomFilterView> bloom;
     bool column_absent = false;
 
     ColumnStatsValues() = default;
@@ -82,6 +85,22 @@ class ColumnStatsData {
 
     ARCTICDB_MOVE_ONLY_DEFAULT(ColumnStatsData)
 
+    /**
+     * Load the stats embedded in an index segment for the given columns, see index_column_stats.hpp. Row r of the
+     * result holds the stats of row r of the index segment, so find_row is not used.
+     */
+    static ColumnStatsData from_index_segment(
+            const SegmentInMemory& index_segment, const std::unordered_set<std::string>& columns_of_interest
+    );
+
+    /**
+     * Load the zone maps of the column slices of a row slice, see zone_maps.hpp. Row z of the result holds the stats of
+     * zone z. The zone maps must all have the same zones, and a column in several is taken from the first. Zones with
+     * nulls are given no min and max, so comparisons against them are UNKNOWN rather than decided by values that
+     * ignore the nulls.
+     */
+    static ColumnStatsData from_zone_maps(const std::vector<arcticc::pb2::column_stats_pb2::ZoneMaps>& zone_maps);
+
     /**
      * Find the row index for a given row-slice identified by start_index and end_index.
      * Returns nullopt if no matching stats found.
@@ -91,14 +110,18 @@ class ColumnStatsData {
     bool empty() const { return num_rows_ == 0; }
 
     /**
-     * Return the min/max ColumnStatsValues for the requested column at each row index in row_indices.
+     * Return the min/max and Bloom filter ColumnStatsValues for the requested column at each row index in row_indices.
      * Returns a vector of default-constructed (absent) entries if the column has no stats.
      */
     std::vector<ColumnStatsValues> values_for_column(
             const std::string& col_name, const std::vector<std::optional<size_t>>& row_indices
     ) const;
 
+    size_t num_rows() const { return num_rows_; }
+
   private:
+    ColumnStatsData() = default;
+
     std::pair<size_t, size_t> calculate_start_and_end_indices(
             const std::optional<std::pair<timestamp, timestamp>>& date_range, size_t segment_row_count,
             const Column& start_index_col, const Column& end_index_col
@@ -106,10 +129,21 @@ class ColumnStatsData {
 
     void drop_duplicate_rows();
 
+    void load_bloom_filters(
+            const SegmentInMemory& segment, const TimeseriesDescriptor& tsd,
+            const arcticc::pb2::column_stats_pb2::ColumnStatsHeader& header, size_t first_kept, size_t last_kept_excl
+    );
+
     size_t num_rows_{0};
+    // Whether a row without min and max for a column, such as a row slice without it, means the column is absent
+    bool missing_stats_mean_column_absent_{true};
     std::vector<timestamp> start_indices_; // size = num_rows_
     std::vector<timestamp> end_indices_;   // size = num_rows_
     std::unordered_map<std::string, StatsForColumn> stats_by_column_;
+    // The string pool of the stats segment, which holds the filters viewed by bloom_filters_by_column_
+    std::shared_ptr<StringPool> string_pool_;
+    // By column, size == num_rows_
+    std::unordered_map<std::string, std::vector<std::optional<BloomFilterView>>> bloom_filters_by_column_;
 
     // (start_index, end_index) -> row index. The index values are rowcounts for string-indexed symbols.
     std::unordered_map<std::pair<timestamp, timestamp>, size_t, util::PairHasher> index_to_row_;
@@ -157,6 +191,16 @@ FilterQuery<index::IndexSegmentReader> create_column_stats_filter(
         ColumnStatsQueryMetadata&& query_metadata
 );
 
+/**
+ * Create a column stats filter from the stats embedded in the index segment being filtered, or std::nullopt if it has
+ * none for the query's columns.
+ *
+ * Precondition: query_metadata.should_try_column_stats_read() == true.
+ */
+std::optional<FilterQuery<index::IndexSegmentReader>> create_embedded_column_stats_filter(
+        const index::IndexSegmentReader& index_segment_reader, ColumnStatsQueryMetadata&& query_metadata
+);
+
 /**
  * Decode a column stats segment, only considering fields referenced by columns_of_interest.
  */
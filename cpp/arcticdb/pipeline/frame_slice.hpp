@@ -17,6 +17,7 @@
 
 namespace arcticdb {
 class Store;
+struct SliceColumnStats;
 }
 
 namespace arcticdb::pipelines {
@@ -141,6 +142,13 @@ struct FrameSlice {
 
     void check_magic() const { magic_.check(); }
 
+    // Stats of the slice's data to be embedded in the index, see index_column_stats.hpp
+    [[nodiscard]] const std::shared_ptr<const SliceColumnStats>& column_stats() const { return column_stats_; }
+
+    void set_column_stats(std::shared_ptr<const SliceColumnStats> column_stats) {
+        column_stats_ = std::move(column_stats);
+    }
+
     ColRange col_range;
     RowRange row_range;
 
@@ -150,6 +158,7 @@ struct FrameSlice {
     std::optional<uint64_t> hash_bucket_;
     std::optional<uint64_t> num_buckets_;
     std::optional<std::vector<size_t>> indices_;
+    std::shared_ptr<const SliceColumnStats> column_stats_;
     util::MagicNum<'F', 's', 'l', 'c'> magic_;
 };
 
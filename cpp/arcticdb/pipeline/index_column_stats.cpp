@@ -0,0 +1,231 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/pipeline/index_column_stats.hpp>
+
+#include <arcticdb/log/log.hpp>
+#include <arcticdb/pipeline/column_stats.hpp>
+#include <arcticdb/pipeline/index_fields.hpp>
+#include <arcticdb/processing/unsorted_aggregation.hpp>
+#include <arcticdb/util/configs_map.hpp>
+
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace arcticdb {
+
+namespace {
+
+size_t embed_max_columns() {
+    return static_cast<size_t>(ConfigsMap::instance()->get_int("ColumnStats.EmbedInIndexMaxColumns", 16));
+}
+
+bool can_embed_stats(const TypeDescriptor& type) {
+    const auto data_type = type.data_type();
+    return type.dimension() == Dimension::Dim0 &&
+           (is_numeric_type(data_type) || is_time_type(data_type) || is_bool_type(data_type));
+}
+
+std::string embedded_prefix(ColumnStatTypeInternal type) {
+    auto name = to_segment_column_name("", type);
+    name.pop_back();
+    return name;
+}
+
+const std::string& embedded_min_prefix() {
+    // "v1_MIN(" - the stats columns are named as in COLUMN_STATS segments
+    static const std::string prefix = embedded_prefix(ColumnStatTypeInternal::MIN_V1);
+    return prefix;
+}
+
+const std::string& embedded_max_prefix() {
+    static const std::string prefix = embedded_prefix(ColumnStatTypeInternal::MAX_V1);
+    return prefix;
+}
+
+} // namespace
+
+bool embed_column_stats_in_index() { return ConfigsMap::instance()->get_int("ColumnStats.EmbedInIndex", 0) == 1; }
+
+std::shared_ptr<const SliceColumnStats> compute_slice_column_stats(
+        const SegmentInMemory& slice_segment, size_t first_data_column
+) {
+    auto stats = std::make_shared<SliceColumnStats>();
+    const auto max_columns = embed_max_columns();
+    const auto index_field_count = slice_segment.descriptor().index().field_count();
+    for (size_t idx = index_field_count; idx < slice_segment.descriptor().field_count(); ++idx) {
+        if (first_data_column + idx - index_field_count >= max_columns) {
+            break;
+        }
+        const auto& field = slice_segment.descriptor().field(idx);
+        if (!can_embed_stats(field.type())) {
+            continue;
+        }
+        MinMaxAggregatorData min_max{idx};
+        min_max.aggregate(ColumnWithStrings{
+                slice_segment.column_ptr(static_cast<position_t>(idx)), slice_segment.string_pool_ptr(), field.name()
+        });
+        // An empty slice has no stats. As in COLUMN_STATS segments, a slice of only NaN or NaT has them as min and max
+        if (min_max.min().has_value() && min_max.max().has_value()) {
+            stats->columns.emplace_back(ColumnMinMax{std::string{field.name()}, *min_max.min(), *min_max.max()});
+        }
+    }
+    return stats;
+}
+
+void add_column_stats_to_index_segment(
+        SegmentInMemory& index_segment,
+        const std::vector<std::pair<size_t, std::shared_ptr<const SliceColumnStats>>>& row_stats
+) {
+    util::check(
+            row_stats.size() == index_segment.row_count(),
+            "Expected column stats for each of the {} index rows but got {}",
+            index_segment.row_count(),
+            row_stats.size()
+    );
+    // The stats of each row slice, gathered from all of its column slices
+    std::map<size_t, std::unordered_map<std::string_view, const ColumnMinMax*>> row_slice_stats;
+    std::vector<std::string_view> column_order;
+    std::unordered_set<std::string_view> seen_columns;
+    for (const auto& [row_start, stats] : row_stats) {
+        auto& slice_stats = row_slice_stats[row_start];
+        if (!stats) {
+            continue;
+        }
+        for (const auto& column : stats->columns) {
+            slice_stats.try_emplace(column.column_name, &column);
+            if (seen_columns.insert(column.column_name).second) {
+                column_order.emplace_back(column.column_name);
+            }
+        }
+    }
+
+    for (const auto& column_name : column_order) {
+        // A row slice without stats for the column would read as one where the column is absent
+        std::optional<DataType> data_type;
+        bool complete = true;
+        for (const auto& [row_start, slice_stats] : row_slice_stats) {
+            auto it = slice_stats.find(column_name);
+            if (it == slice_stats.end() || (data_type && *data_type != it->second->min.data_type())) {
+                complete = false;
+                break;
+            }
+            data_type = it->second->min.data_type();
+        }
+        if (!complete || !data_type) {
+            ARCTICDB_DEBUG(log::version(), "Not embedding column stats for {}", column_name);
+            continue;
+        }
+
+        details::visit_type(*data_type, [&]<typename T>(T) {
+            using type_info = ScalarTypeInfo<T>;
+            if constexpr (is_numeric_type(type_info::data_type) || is_time_type(type_info::data_type) ||
+                          is_bool_type(type_info::data_type)) {
+                using RawType = typename type_info::RawType;
+                auto min_column = std::make_shared<Column>(make_scalar_type(*data_type), Sparsity::NOT_PERMITTED);
+                auto max_column = std::make_shared<Column>(make_scalar_type(*data_type), Sparsity::NOT_PERMITTED);
+                for (const auto& [row_start, _] : row_stats) {
+                    const auto* column_stats = row_slice_stats.at(row_start).at(column_name);
+                    min_column->push_back<RawType>(column_stats->min.template get<RawType>());
+                    max_column->push_back<RawType>(column_stats->max.template get<RawType>());
+                }
+                const std::string name{column_name};
+                index_segment.add_column(
+                        scalar_field(*data_type, to_segment_column_name(name, ColumnStatTypeInternal::MIN_V1)),
+                        min_column
+                );
+                index_segment.add_column(
+                        scalar_field(*data_type, to_segment_column_name(name, ColumnStatTypeInternal::MAX_V1)),
+                        max_column
+                );
+            }
+        });
+    }
+}
+
+bool has_embedded_column_stats(const SegmentInMemory& index_segment) {
+    const auto& prefix = embedded_min_prefix();
+    for (const auto& field : index_segment.descriptor().fields()) {
+        if (field.name().starts_with(prefix)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void set_embedded_column_stats(const SegmentInMemory& index_segment, std::span<SliceAndKey> slices) {
+    if (slices.empty() || !has_embedded_column_stats(index_segment)) {
+        return;
+    }
+
+    // Every index row of a row slice holds the stats of the whole row slice, so one row per row slice is read
+    const auto& start_row_column = index_segment.column(position_t(pipelines::index::Fields::start_row));
+    std::map<size_t, std::shared_ptr<SliceColumnStats>> row_slice_stats;
+    std::map<size_t, size_t> first_index_row;
+    for (size_t row = 0; row < index_segment.row_count(); ++row) {
+        const auto start_row = start_row_column.scalar_at<size_t>(row).value();
+        if (first_index_row.try_emplace(start_row, row).second) {
+            row_slice_stats.try_emplace(start_row, std::make_shared<SliceColumnStats>());
+        }
+    }
+
+    index_segment.init_column_map();
+    const auto& fields = index_segment.descriptor().fields();
+    const auto& min_prefix = embedded_min_prefix();
+    for (size_t idx = 0; idx < fields.size(); ++idx) {
+        const auto field_name = fields.at(idx).name();
+        if (!field_name.starts_with(min_prefix)) {
+            continue;
+        }
+        // "v1_MIN(col)" holds the min of col
+        const std::string column_name{field_name.substr(min_prefix.size(), field_name.size() - min_prefix.size() - 1)};
+        const auto max_idx =
+                index_segment.column_index(to_segment_column_name(column_name, ColumnStatTypeInternal::MAX_V1));
+        if (!max_idx.has_value()) {
+            continue;
+        }
+        const auto data_type = fields.at(idx).type().data_type();
+        details::visit_type(data_type, [&]<typename T>(T) {
+            using type_info = ScalarTypeInfo<T>;
+            if constexpr (is_numeric_type(type_info::data_type) || is_time_type(type_info::data_type) ||
+                          is_bool_type(type_info::data_type)) {
+                using RawType = typename type_info::RawType;
+                const auto& min_column = index_segment.column(static_cast<position_t>(idx));
+                const auto& max_column = index_segment.column(static_cast<position_t>(*max_idx));
+                for (const auto& [start_row, row] : first_index_row) {
+                    row_slice_stats.at(start_row)->columns.emplace_back(ColumnMinMax{
+                            column_name,
+                            Value{min_column.scalar_at<RawType>(row).value(), data_type},
+                            Value{max_column.scalar_at<RawType>(row).value(), data_type}
+                    });
+                }
+            }
+        });
+    }
+
+    for (auto& slice_and_key : slices) {
+        if (auto it = row_slice_stats.find(slice_and_key.slice_.row_range.first); it != row_slice_stats.end()) {
+            slice_and_key.slice_.set_column_stats(it->second);
+        }
+    }
+}
+
+void drop_embedded_column_stats(SegmentInMemory& index_segment) {
+    std::vector<std::string> stats_columns;
+    for (const auto& field : index_segment.descriptor().fields()) {
+        if (field.name().starts_with(embedded_min_prefix()) || field.name().starts_with(embedded_max_prefix())) {
+            stats_columns.emplace_back(field.name());
+        }
+    }
+    for (const auto& name : stats_columns) {
+        index_segment.drop_column(name);
+    }
+}
+
+} // namespace arcticdb
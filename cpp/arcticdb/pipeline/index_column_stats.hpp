@@ -0,0 +1,77 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/column_store/memory_segment.hpp>
+#include <arcticdb/pipeline/frame_slice.hpp>
+#include <arcticdb/pipeline/value.hpp>
+
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace arcticdb {
+
+/*
+ * Column stats embedded in index segments.
+ *
+ * With ColumnStats.EmbedInIndex enabled, writes compute the min and max of the numeric, bool and timestamp columns of
+ * each slice as it is written, and the index writer appends them to the TABLE_INDEX segment as columns named as in
+ * COLUMN_STATS segments ("v1_MIN(col)" and "v1_MAX(col)"), one row per slice. Every index row of a row slice carries
+ * the stats of the whole row slice, so that all of its column slices are pruned together.
+ *
+ * A read that can use column stats then prunes slices from the index segment alone, without the COLUMN_STATS key or a
+ * separate create_column_stats step. Readers that predate the embedded stats ignore the extra columns.
+ */
+
+struct ColumnMinMax {
+    std::string column_name;
+    Value min;
+    Value max;
+};
+
+// The stats of one slice, carried by its FrameSlice from the write to the index writer
+struct SliceColumnStats {
+    std::vector<ColumnMinMax> columns;
+};
+
+bool embed_column_stats_in_index();
+
+/*
+ * The min and max of the slice's eligible columns. first_data_column is the position in the frame of the slice's first
+ * non-index column, and only the first ColumnStats.EmbedInIndexMaxColumns columns of the frame are considered.
+ */
+std::shared_ptr<const SliceColumnStats> compute_slice_column_stats(
+        const SegmentInMemory& slice_segment, size_t first_data_column
+);
+
+/*
+ * Appends the stats of the given index rows, each identified by the first row of its row slice, to an index segment.
+ * Only columns with stats for every row slice are embedded.
+ */
+void add_column_stats_to_index_segment(
+        SegmentInMemory& index_segment,
+        const std::vector<std::pair<size_t, std::shared_ptr<const SliceColumnStats>>>& row_stats
+);
+
+bool has_embedded_column_stats(const SegmentInMemory& index_segment);
+
+/*
+ * Sets the stats embedded in an index segment on slices read from it, each found by the first row of its row slice, so
+ * that an append or update that writes them to a new index keeps their stats. Slices written since carry stats from
+ * the write, and a rewritten part of a slice from compute_slice_column_stats.
+ */
+void set_embedded_column_stats(const SegmentInMemory& index_segment, std::span<SliceAndKey> slices);
+
+// Removes the embedded stats columns, for index segments that are returned to the user as a dataframe
+void drop_embedded_column_stats(SegmentInMemory& index_segment);
+
+} // namespace arcticdb
@@ -13,6 +13,7 @@
 #include <arcticdb/stream/schema.hpp>
 #include <arcticdb/stream/stream_utils.hpp>
 #include <arcticdb/storage/store.hpp>
+#include <arcticdb/pipeline/index_column_stats.hpp>
 #include <arcticdb/pipeline/index_fields.hpp>
 #include <arcticdb/pipeline/slicing.hpp>
 #include <arcticdb/pipeline/pipeline_common.hpp>
@@ -82,6 +83,8 @@ class IndexWriter {
             std::visit([&rb](auto&& val) { rb.set_scalar(int(Fields::start_index), val); }, key.start_index());
             add_to_row(rb);
         });
+        has_column_stats_ |= static_cast<bool>(slice.column_stats());
+        column_stats_.emplace_back(slice.row_range.first, slice.column_stats());
     }
 
     void add(const arcticdb::entity::AtomKey& key, const FrameSlice& slice) {
@@ -142,6 +145,11 @@ class IndexWriter {
     void on_segment(SegmentInMemory&& s) {
         auto seg = std::move(s);
         auto key_type = key_type_.value_or(get_key_type_for_index_stream(partial_key_.id));
+        if constexpr (std::is_same_v<Index, stream::TimeseriesIndex>) {
+            if (has_column_stats_) {
+                add_column_stats_to_index_segment(seg, column_stats_);
+            }
+        }
 
         if (sync_) {
             committed_key_ = std::make_optional(to_atom(sink_->write_sync(
@@ -175,6 +183,9 @@ class IndexWriter {
     std::optional<std::size_t> current_col_ = std::nullopt;
     std::optional<std::size_t> current_row_ = std::nullopt;
     std::optional<KeyType> key_type_ = std::nullopt;
+    // The column stats of each index row, with the first row of its row slice
+    std::vector<std::pair<size_t, std::shared_ptr<const SliceColumnStats>>> column_stats_;
+    bool has_column_stats_ = false;
 };
 
 } // namespace arcticdb::pipelines::index
\ No newline at end of file
@@ -17,6 +17,8 @@
 #include <arcticdb/pipeline/frame_utils.hpp>
 #include <arcticdb/pipeline/frame_slice_map.hpp>
 #include <arcticdb/async/task_scheduler.hpp>
+#include <arcticdb/async/memory_budget.hpp>
+#include <arcticdb/async/batch_read_args.hpp>
 #include <arcticdb/util/type_handler.hpp>
 #include <arcticdb/entity/type_utils.hpp>
 #include <arcticdb/codec/slice_data_sink.hpp>
@@ -1134,11 +1136,33 @@ folly::Future<SegmentInMemory> fetch_data(
 
     std::vector<std::pair<VariantKey, stream::StreamSource::ReadContinuation>> keys_and_continuations;
     keys_and_continuations.reserve(context->slice_and_keys_.size());
+    BatchReadArgs batch_read_args;
+    const bool use_memory_budget = async::MemoryBudget::instance()->enabled();
+    if (use_memory_budget)
+        batch_read_args.estimated_bytes_.reserve(context->slice_and_keys_.size());
+
+    if (read_query.columns) {
+        // Only the columns in the frame are decoded, so storages that support range reads need not fetch the rest
+        auto columns = std::make_shared<std::unordered_set<std::string>>();
+        for (const auto& field : frame.descriptor().fields())
+            columns->emplace(field.name());
+
+        batch_read_args.columns_ = std::move(columns);
+    }
+
     context->ensure_vectors();
     {
         ARCTICDB_SUBSAMPLE_DEFAULT(QueueReadContinuations)
         const auto dynamic_schema = read_options.dynamic_schema().value_or(false);
         for (auto& row : *context) {
+            if (use_memory_budget) {
+                // The reservation is held until the segment has been decoded into the frame, so new IO is only admitted
+                // as previously fetched data drains into the output
+                const auto& slice = row.slice_and_key().slice();
+                batch_read_args.estimated_bytes_.emplace_back(
+                        async::estimate_slice_bytes(slice.rows().diff(), slice.columns().diff())
+                );
+            }
             keys_and_continuations.emplace_back(
                     row.slice_and_key().key(),
                     [row = row,
@@ -1165,7 +1189,7 @@ folly::Future<SegmentInMemory> fetch_data(
         }
     }
     ARCTICDB_SUBSAMPLE_DEFAULT(DoBatchReadCompressed)
-    return folly::collect(ssource->batch_read_compressed(std::move(keys_and_continuations), BatchReadArgs{}))
+    return folly::collect(ssource->batch_read_compressed(std::move(keys_and_continuations), batch_read_args))
             .via(&async::io_executor())
             .thenValue([frame](auto&&) { return frame; });
 }
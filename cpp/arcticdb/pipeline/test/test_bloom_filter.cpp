@@ -0,0 +1,179 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/pipeline/bloom_filter.hpp>
+#include <arcticdb/pipeline/column_stats.hpp>
+#include <arcticdb/pipeline/column_stats_dispatch.hpp>
+#include <arcticdb/pipeline/column_stats_filter.hpp>
+#include <arcticdb/processing/unsorted_aggregation.hpp>
+#include <arcticdb/util/offset_string.hpp>
+#include <google/protobuf/any.pb.h>
+
+using namespace arcticdb;
+using namespace arcticdb::column_stats_detail;
+
+namespace {
+
+std::string build_string_filter(const std::vector<std::string>& values) {
+    BloomFilterBuilder builder;
+    for (const auto& value : values) {
+        builder.add(bloom_filter_hash(std::string_view{value}));
+    }
+    return builder.build();
+}
+
+// Row slices of a string column "id", with the filter of each slice's values in column "v1_BLOOM(id)"
+SegmentInMemory build_bloom_stats_segment(
+        const std::vector<std::tuple<timestamp, timestamp, std::vector<std::string>>>& slices
+) {
+    using namespace arcticc::pb2::column_stats_pb2;
+    SegmentInMemory seg;
+    auto start_col = std::make_shared<Column>(make_scalar_type(DataType::NANOSECONDS_UTC64), Sparsity::PERMITTED);
+    auto end_col = std::make_shared<Column>(make_scalar_type(DataType::NANOSECONDS_UTC64), Sparsity::PERMITTED);
+    auto bloom_col = std::make_shared<Column>(make_scalar_type(bloom_filter_data_type), Sparsity::PERMITTED);
+    for (const auto& [start, end, values] : slices) {
+        start_col->push_back<timestamp>(start);
+        end_col->push_back<timestamp>(end);
+        bloom_col->push_back(seg.string_pool().get(build_string_filter(values)).offset());
+    }
+
+    seg.descriptor().set_index(IndexDescriptorImpl(IndexDescriptorImpl::Type::ROWCOUNT, 0));
+    seg.add_column(scalar_field(DataType::NANOSECONDS_UTC64, start_index_column_name), start_col);
+    seg.add_column(scalar_field(DataType::NANOSECONDS_UTC64, end_index_column_name), end_col);
+    seg.add_column(scalar_field(bloom_filter_data_type, "v1_BLOOM(id)"), bloom_col);
+    seg.set_row_data(static_cast<ssize_t>(slices.size()) - 1);
+
+    ColumnStatsHeader header;
+    header.set_version(1);
+    auto* entry = (*header.mutable_stats_by_column())[1].add_entries();
+    entry->set_stats_seg_offset(2);
+    entry->set_type(BLOOM_V1);
+    google::protobuf::Any any;
+    any.PackFrom(header);
+    seg.set_metadata(std::move(any));
+    return seg;
+}
+
+// Two row slices, [0, 9] containing "a" and "b" and [10, 19] containing "c"
+SegmentInMemory build_bloom_stats_segment() { return build_bloom_stats_segment({{0, 9, {"a", "b"}}, {10, 19, {"c"}}}); }
+
+TimeseriesDescriptor build_bloom_test_tsd() {
+    TimeseriesDescriptor tsd;
+    tsd.mutable_fields().add_field(scalar_field(DataType::NANOSECONDS_UTC64, "timestamp"));
+    tsd.mutable_fields().add_field(scalar_field(DataType::UTF_DYNAMIC64, "id"));
+    return tsd;
+}
+
+Value string_value(std::string_view str) { return Value{str, DataType::UTF_DYNAMIC64}; }
+
+} // namespace
+
+TEST(BloomFilter, NoFalseNegatives) {
+    BloomFilterBuilder builder;
+    for (int64_t i = 0; i < 1000; ++i) {
+        builder.add(bloom_filter_hash(static_cast<double>(i)));
+    }
+    auto filter = builder.build();
+    BloomFilterView view{filter, false};
+    for (int64_t i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(view.might_contain(bloom_filter_hash(static_cast<double>(i))));
+    }
+    // About 1% with the default of 10 bits per value
+    size_t false_positives = 0;
+    for (int64_t i = 1000; i < 11000; ++i) {
+        false_positives += view.might_contain(bloom_filter_hash(static_cast<double>(i))) ? 1 : 0;
+    }
+    ASSERT_LT(false_positives, 300);
+}
+
+TEST(BloomFilter, EqualValuesHashEqual) {
+    ASSERT_EQ(bloom_filter_hash(static_cast<double>(int64_t{42})), bloom_filter_hash(42.0));
+    ASSERT_EQ(bloom_filter_hash(static_cast<double>(uint8_t{42})), bloom_filter_hash(42.0));
+    ASSERT_EQ(bloom_filter_hash(-0.0), bloom_filter_hash(0.0));
+    ASSERT_NE(bloom_filter_hash(std::string_view{"42"}), bloom_filter_hash(42.0));
+}
+
+TEST(BloomFilter, Aggregator) {
+    using namespace arcticc::pb2::column_stats_pb2;
+    auto column = std::make_shared<Column>(make_scalar_type(DataType::INT64), Sparsity::PERMITTED);
+    for (int64_t i = 0; i < 100; ++i) {
+        column->push_back<int64_t>(i * 3);
+    }
+    BloomFilterAggregatorData aggregator_data{3};
+    aggregator_data.aggregate(ColumnWithStrings{column, {}, "col"});
+    auto seg = aggregator_data.finalize({ColumnName{"v1_BLOOM(col)"}});
+    ASSERT_EQ(seg.num_columns(), 1);
+    ASSERT_EQ(seg.field(0).name(), "v1_BLOOM(col)");
+    ColumnStatsHeader header;
+    ASSERT_TRUE(seg.metadata()->UnpackTo(&header));
+    ASSERT_EQ(header.stats_by_column().at(3).entries_size(), 1);
+    ASSERT_EQ(header.stats_by_column().at(3).entries(0).type(), BLOOM_V1);
+    // finalize leaves setting the row count to ColumnStatsGenerationClause, so read the offset from the column
+    auto offset = seg.column(0).scalar_at<entity::position_t>(0);
+    ASSERT_TRUE(offset.has_value() && is_a_string(*offset));
+    BloomFilterView view{seg.const_string_pool().get_const_view(*offset), false};
+    for (int64_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(view.might_contain(bloom_filter_hash(static_cast<double>(i * 3))));
+    }
+
+    // float32 values are not hashed, see BloomFilterAggregatorData::aggregate
+    auto float_column = std::make_shared<Column>(make_scalar_type(DataType::FLOAT32), Sparsity::PERMITTED);
+    float_column->push_back<float>(1.5f);
+    BloomFilterAggregatorData float_aggregator_data{3};
+    float_aggregator_data.aggregate(ColumnWithStrings{float_column, {}, "col"});
+    auto float_seg = float_aggregator_data.finalize({ColumnName{"v1_BLOOM(col)"}});
+    ASSERT_EQ(float_seg.column(0).scalar_at<entity::position_t>(0), not_a_string());
+}
+
+TEST(BloomFilter, ColumnStatsHeader) {
+    using namespace arcticc::pb2::column_stats_pb2;
+    auto seg = build_bloom_stats_segment();
+    ColumnStatsHeader header;
+    ASSERT_TRUE(seg.metadata()->UnpackTo(&header));
+    ColumnStats column_stats{header, build_bloom_test_tsd()};
+    ASSERT_EQ(column_stats.to_map().at("id"), std::unordered_set<std::string>{"BLOOM"});
+}
+
+TEST(BloomFilter, EqualsAndIsinPruning) {
+    ColumnStatsData data{build_bloom_stats_segment(), build_bloom_test_tsd()};
+    auto values = data.values_for_column("id", {0, 1});
+    ASSERT_EQ(values.size(), 2);
+    for (const auto& value : values) {
+        ASSERT_TRUE(value.bloom.has_value());
+        ASSERT_FALSE(value.min.has_value());
+        ASSERT_FALSE(value.column_absent);
+    }
+
+    ASSERT_EQ(stats_comparator(values[0], string_value("c"), EqualsOperator{}), StatsComparison::NONE_MATCH);
+    ASSERT_EQ(stats_comparator(values[1], string_value("c"), EqualsOperator{}), StatsComparison::UNKNOWN);
+    // Only equality is decided by the filter
+    ASSERT_EQ(stats_comparator(values[0], string_value("c"), NotEqualsOperator{}), StatsComparison::UNKNOWN);
+
+    ValueSet value_set{std::vector<std::string>{"x", "c"}};
+    ASSERT_EQ(stats_membership_comparator(values[0], value_set, OperationType::ISIN), StatsComparison::NONE_MATCH);
+    ASSERT_EQ(stats_membership_comparator(values[1], value_set, OperationType::ISIN), StatsComparison::UNKNOWN);
+    ASSERT_EQ(stats_membership_comparator(values[0], value_set, OperationType::ISNOTIN), StatsComparison::UNKNOWN);
+}
+
+TEST(BloomFilter, MergeKeepsFiltersOfEachSegment) {
+    // Each segment has a string pool of its own
+    std::vector<SegmentInMemory> segments{
+            build_bloom_stats_segment({{10, 19, {"c"}}}), build_bloom_stats_segment({{0, 9, {"a", "b"}}})
+    };
+    auto merged = merge_column_stats_segments(segments);
+    ASSERT_EQ(merged.row_count(), 2);
+
+    ColumnStatsData data{std::move(merged), build_bloom_test_tsd()};
+    auto values = data.values_for_column("id", {data.find_row(0, 9), data.find_row(10, 19)});
+    ASSERT_EQ(stats_comparator(values[0], string_value("a"), EqualsOperator{}), StatsComparison::UNKNOWN);
+    ASSERT_EQ(stats_comparator(values[0], string_value("c"), EqualsOperator{}), StatsComparison::NONE_MATCH);
+    ASSERT_EQ(stats_comparator(values[1], string_value("c"), EqualsOperator{}), StatsComparison::UNKNOWN);
+    ASSERT_EQ(stats_comparator(values[1], string_value("a"), EqualsOperator{}), StatsComparison::NONE_MATCH);
+}
@@ -0,0 +1,187 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/pipeline/column_stats_filter.hpp>
+#include <arcticdb/pipeline/index_column_stats.hpp>
+#include <arcticdb/pipeline/index_writer.hpp>
+#include <arcticdb/pipeline/read_pipeline.hpp>
+#include <arcticdb/storage/test/in_memory_store.hpp>
+#include <arcticdb/util/configs_map.hpp>
+
+#include <cmath>
+
+using namespace arcticdb;
+using namespace arcticdb::pipelines;
+
+namespace {
+
+SegmentInMemory build_slice_segment() {
+    auto time_col = std::make_shared<Column>(make_scalar_type(DataType::NANOSECONDS_UTC64), Sparsity::NOT_PERMITTED);
+    auto price_col = std::make_shared<Column>(make_scalar_type(DataType::INT64), Sparsity::NOT_PERMITTED);
+    auto ratio_col = std::make_shared<Column>(make_scalar_type(DataType::FLOAT64), Sparsity::NOT_PERMITTED);
+    auto missing_col = std::make_shared<Column>(make_scalar_type(DataType::FLOAT64), Sparsity::NOT_PERMITTED);
+    const std::vector<int64_t> prices{5, -3, 12, 7};
+    const std::vector<double> ratios{0.5, std::numeric_limits<double>::quiet_NaN(), -1.5, 2.0};
+    for (size_t row = 0; row < prices.size(); ++row) {
+        time_col->push_back<timestamp>(static_cast<timestamp>(row));
+        price_col->push_back<int64_t>(prices[row]);
+        ratio_col->push_back<double>(ratios[row]);
+        missing_col->push_back<double>(std::numeric_limits<double>::quiet_NaN());
+    }
+
+    SegmentInMemory seg;
+    seg.descriptor().set_index(IndexDescriptorImpl(IndexDescriptorImpl::Type::TIMESTAMP, 1));
+    seg.add_column(scalar_field(DataType::NANOSECONDS_UTC64, "time"), time_col);
+    seg.add_column(scalar_field(DataType::INT64, "price"), price_col);
+    seg.add_column(scalar_field(DataType::FLOAT64, "ratio"), ratio_col);
+    seg.add_column(scalar_field(DataType::FLOAT64, "missing"), missing_col);
+    seg.set_row_data(static_cast<ssize_t>(prices.size()) - 1);
+    return seg;
+}
+
+std::shared_ptr<const SliceColumnStats> stats_of(std::vector<ColumnMinMax> columns) {
+    return std::make_shared<SliceColumnStats>(SliceColumnStats{std::move(columns)});
+}
+
+ColumnMinMax int64_stats(const std::string& name, int64_t min, int64_t max) {
+    return {name, Value{min, DataType::INT64}, Value{max, DataType::INT64}};
+}
+
+SegmentInMemory write_index_with_stats(const StreamId& stream_id) {
+    StreamDescriptor stream_desc{stream_id, IndexDescriptorImpl{IndexDescriptorImpl::Type::TIMESTAMP, 1}};
+    stream_desc.add_field(scalar_field(DataType::NANOSECONDS_UTC64, "time"));
+    stream_desc.add_field(scalar_field(DataType::INT64, "price"));
+    stream_desc.add_field(scalar_field(DataType::INT64, "qty"));
+    TimeseriesDescriptor tsd;
+    tsd.set_stream_descriptor(stream_desc);
+
+    // Two row slices of two column slices. qty has no stats for the second row slice, so is not embedded
+    const std::vector<std::tuple<ColRange, RowRange, std::shared_ptr<const SliceColumnStats>>> slices{
+            {ColRange{1, 2}, RowRange{0, 10}, stats_of({int64_stats("price", 0, 10)})},
+            {ColRange{1, 2}, RowRange{10, 20}, stats_of({int64_stats("price", 20, 30)})},
+            {ColRange{2, 3}, RowRange{0, 10}, stats_of({int64_stats("qty", 1, 2)})},
+            {ColRange{2, 3}, RowRange{10, 20}, stats_of({})}
+    };
+
+    auto store = std::make_shared<InMemoryStore>();
+    index::IndexWriter<stream::TimeseriesIndex> writer(store, IndexPartialKey{stream_id, VersionId{0}}, tsd);
+    for (const auto& [col_range, row_range, stats] : slices) {
+        FrameSlice slice{col_range, row_range};
+        slice.set_column_stats(stats);
+        const auto start = static_cast<timestamp>(row_range.first);
+        const auto end = static_cast<timestamp>(row_range.second);
+        writer.add(
+                AtomKey{stream_id,
+                        VersionId{0},
+                        0,
+                        col_range.first,
+                        IndexValue{start},
+                        IndexValue{end},
+                        KeyType::TABLE_DATA},
+                slice
+        );
+    }
+    auto key = writer.commit().get();
+    return store->read(key, storage::ReadKeyOpts{}).get().second;
+}
+
+} // namespace
+
+TEST(IndexColumnStats, SliceStats) {
+    auto seg = build_slice_segment();
+    auto stats = compute_slice_column_stats(seg, 0);
+    ASSERT_EQ(stats->columns.size(), 3);
+    ASSERT_EQ(stats->columns[0].column_name, "price");
+    ASSERT_EQ(stats->columns[0].min.get<int64_t>(), -3);
+    ASSERT_EQ(stats->columns[0].max.get<int64_t>(), 12);
+    // NaN is skipped, unless the slice has nothing else
+    ASSERT_EQ(stats->columns[1].column_name, "ratio");
+    ASSERT_EQ(stats->columns[1].min.get<double>(), -1.5);
+    ASSERT_EQ(stats->columns[1].max.get<double>(), 2.0);
+    ASSERT_EQ(stats->columns[2].column_name, "missing");
+    ASSERT_TRUE(std::isnan(stats->columns[2].min.get<double>()));
+
+    ScopedConfig max_columns("ColumnStats.EmbedInIndexMaxColumns", 2);
+    ASSERT_EQ(compute_slice_column_stats(seg, 0)->columns.size(), 2);
+    ASSERT_EQ(compute_slice_column_stats(seg, 1)->columns.size(), 1);
+}
+
+TEST(IndexColumnStats, EmbeddedInIndex) {
+    auto index_segment = write_index_with_stats(StreamId{"sym"});
+    ASSERT_TRUE(has_embedded_column_stats(index_segment));
+    ASSERT_TRUE(index_segment.column_index("v1_MIN(price)").has_value());
+    ASSERT_TRUE(index_segment.column_index("v1_MAX(price)").has_value());
+    ASSERT_FALSE(index_segment.column_index("v1_MIN(qty)").has_value());
+
+    // Every index row carries the stats of its whole row slice
+    auto data = ColumnStatsData::from_index_segment(index_segment, {"price", "qty"});
+    ASSERT_EQ(data.num_rows(), 4);
+    auto values = data.values_for_column("price", {0, 1, 2, 3});
+    ASSERT_EQ(values[0].min->get<int64_t>(), 0);
+    ASSERT_EQ(values[1].max->get<int64_t>(), 30);
+    ASSERT_EQ(values[2].max->get<int64_t>(), 10);
+    ASSERT_EQ(values[3].min->get<int64_t>(), 20);
+    ASSERT_FALSE(data.values_for_column("qty", {0})[0].min.has_value());
+}
+
+TEST(IndexColumnStats, DropEmbeddedStats) {
+    auto index_segment = write_index_with_stats(StreamId{"sym"});
+    const auto num_columns = index_segment.num_columns();
+    drop_embedded_column_stats(index_segment);
+    ASSERT_FALSE(has_embedded_column_stats(index_segment));
+    ASSERT_FALSE(index_segment.column_index("v1_MAX(price)").has_value());
+    ASSERT_EQ(index_segment.num_columns(), num_columns - 2);
+    ASSERT_EQ(index_segment.descriptor().field_count(), num_columns - 2);
+    ASSERT_TRUE(index_segment.column_index("key_type").has_value());
+}
+
+TEST(IndexColumnStats, CarriedToSlicesReadFromIndex) {
+    auto index_segment = write_index_with_stats(StreamId{"sym"});
+    std::vector<SliceAndKey> slices{
+            {FrameSlice{ColRange{2, 3}, RowRange{0, 10}}, AtomKey{}},
+            {FrameSlice{ColRange{1, 2}, RowRange{10, 20}}, AtomKey{}},
+            {FrameSlice{ColRange{1, 2}, RowRange{20, 30}}, AtomKey{}}
+    };
+    set_embedded_column_stats(index_segment, slices);
+
+    // Each slice gets the embedded stats of its whole row slice, and only those, as qty was not embedded
+    ASSERT_EQ(slices[0].slice_.column_stats()->columns.size(), 1);
+    ASSERT_EQ(slices[0].slice_.column_stats()->columns[0].column_name, "price");
+    ASSERT_EQ(slices[0].slice_.column_stats()->columns[0].max.get<int64_t>(), 10);
+    ASSERT_EQ(slices[1].slice_.column_stats()->columns[0].min.get<int64_t>(), 20);
+    ASSERT_FALSE(slices[2].slice_.column_stats());
+}
+
+TEST(IndexColumnStats, FilterPrunesRowSlices) {
+    ScopedConfig use_for_queries("ColumnStats.UseForQueries", 1);
+    index::IndexSegmentReader isr{write_index_with_stats(StreamId{"sym"})};
+
+    ExpressionContext expression_context;
+    expression_context.add_value("value", std::make_shared<Value>(int64_t{15}, DataType::INT64));
+    expression_context.add_expression_node(
+            "root", std::make_shared<ExpressionNode>(ColumnName("price"), ValueName("value"), OperationType::GT)
+    );
+    expression_context.root_node_name_ = ExpressionName("root");
+    std::vector<std::shared_ptr<Clause>> clauses{std::make_shared<Clause>(
+            FilterClause{std::unordered_set<std::string>{"price"}, std::move(expression_context), std::nullopt}
+    )};
+
+    auto filter = create_embedded_column_stats_filter(isr, ColumnStatsQueryMetadata{clauses});
+    ASSERT_TRUE(filter.has_value());
+    std::vector<FilterQuery<index::IndexSegmentReader>> queries;
+    queries.emplace_back(std::move(*filter));
+    auto slice_and_keys = filter_index(isr, combine_filter_functions(queries));
+
+    // Both column slices of the second row slice are kept, including the one without price
+    ASSERT_EQ(slice_and_keys.size(), 2);
+    for (const auto& slice_and_key : slice_and_keys) {
+        ASSERT_EQ(slice_and_key.slice().row_range.first, 10);
+    }
+}
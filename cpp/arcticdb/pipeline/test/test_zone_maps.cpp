@@ -0,0 +1,160 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/codec/default_codecs.hpp>
+#include <arcticdb/pipeline/zone_maps.hpp>
+
+#include <cmath>
+#include <cstring>
+
+using namespace arcticdb;
+
+namespace {
+
+constexpr size_t rows_per_zone = 10;
+
+// 100 rows: price is the row number and ratio is NaN in row 15 only
+SegmentInMemory build_zone_map_segment() {
+    auto price_col = std::make_shared<Column>(make_scalar_type(DataType::INT64), Sparsity::NOT_PERMITTED);
+    auto ratio_col = std::make_shared<Column>(make_scalar_type(DataType::FLOAT64), Sparsity::NOT_PERMITTED);
+    for (int64_t row = 0; row < 100; ++row) {
+        price_col->push_back<int64_t>(row);
+        ratio_col->push_back<double>(row == 15 ? std::numeric_limits<double>::quiet_NaN() : static_cast<double>(row));
+    }
+    SegmentInMemory seg;
+    seg.add_column(scalar_field(DataType::INT64, "price"), price_col);
+    seg.add_column(scalar_field(DataType::FLOAT64, "ratio"), ratio_col);
+    seg.set_row_data(99);
+    return seg;
+}
+
+std::shared_ptr<ExpressionContext> filter_context(std::string_view column, OperationType operation, double value) {
+    auto expression_context = std::make_shared<ExpressionContext>();
+    expression_context->add_value("value", std::make_shared<Value>(value, DataType::FLOAT64));
+    expression_context->add_expression_node(
+            "root", std::make_shared<ExpressionNode>(ColumnName(column), ValueName("value"), operation)
+    );
+    expression_context->root_node_name_ = ExpressionName("root");
+    return expression_context;
+}
+
+ProcessingUnit proc_with_filter(std::string_view column, OperationType operation, double value) {
+    auto seg = build_zone_map_segment();
+    add_zone_maps(seg, rows_per_zone);
+    ProcessingUnit proc{std::move(seg)};
+    proc.set_expression_context(filter_context(column, operation, value));
+    return proc;
+}
+
+} // namespace
+
+TEST(ZoneMaps, Compute) {
+    auto seg = build_zone_map_segment();
+    ASSERT_FALSE(zone_maps_of(seg).has_value());
+    add_zone_maps(seg, rows_per_zone);
+    auto zone_maps = zone_maps_of(seg);
+    ASSERT_TRUE(zone_maps.has_value());
+    ASSERT_EQ(zone_maps->row_count(), 100);
+    ASSERT_EQ(zone_maps->columns_size(), 2);
+    const auto& price = zone_maps->columns(0);
+    ASSERT_EQ(price.name(), "price");
+    ASSERT_EQ(price.null_counts_size(), 10);
+    int64_t min;
+    std::memcpy(&min, price.mins().data() + 3 * sizeof(int64_t), sizeof(int64_t));
+    ASSERT_EQ(min, 30);
+    ASSERT_EQ(zone_maps->columns(1).null_counts(1), 1);
+    ASSERT_EQ(zone_maps->columns(1).null_counts(2), 0);
+
+    // Truncated segments keep their metadata, but the zone maps no longer describe them
+    auto truncated = seg.truncate(0, 50, false);
+    ASSERT_FALSE(zone_maps_of(truncated).has_value());
+}
+
+TEST(ZoneMaps, FilterEvaluatesUndecidedZones) {
+    auto proc = proc_with_filter("price", OperationType::GT, 45.0);
+    auto result = filter_with_zone_maps(proc, ExpressionName("root"), std::nullopt);
+    ASSERT_TRUE(result.has_value());
+    const auto& bitset = std::get<util::BitSet>(*result);
+    ASSERT_EQ(bitset.count(), 54);
+    ASSERT_FALSE(bitset.get_bit(45));
+    ASSERT_TRUE(bitset.get_bit(46));
+    ASSERT_TRUE(bitset.get_bit(99));
+
+    // The same as evaluating every row
+    auto expected = std::get<util::BitSet>(proc.get(ExpressionName("root")));
+    ASSERT_EQ(bitset.count(), expected.count());
+    ASSERT_EQ((bitset & expected).count(), expected.count());
+}
+
+TEST(ZoneMaps, FilterDecidedByZoneMaps) {
+    auto none = proc_with_filter("price", OperationType::GT, 1000.0);
+    auto none_result = filter_with_zone_maps(none, ExpressionName("root"), std::nullopt);
+    ASSERT_TRUE(none_result.has_value() && std::holds_alternative<EmptyResult>(*none_result));
+
+    auto all = proc_with_filter("price", OperationType::GE, 0.0);
+    auto all_result = filter_with_zone_maps(all, ExpressionName("root"), std::nullopt);
+    ASSERT_TRUE(all_result.has_value() && std::holds_alternative<FullResult>(*all_result));
+
+    // The NaN in zone 1 does not match, so the zone is evaluated even though its min is 10
+    auto with_nan = proc_with_filter("ratio", OperationType::GE, 0.0);
+    auto nan_result = filter_with_zone_maps(with_nan, ExpressionName("root"), std::unordered_set<std::string>{"ratio"});
+    ASSERT_TRUE(nan_result.has_value());
+    const auto& bitset = std::get<util::BitSet>(*nan_result);
+    ASSERT_EQ(bitset.count(), 99);
+    ASSERT_FALSE(bitset.get_bit(15));
+}
+
+TEST(ZoneMaps, NoZoneMaps) {
+    auto proc = proc_with_filter("price", OperationType::GT, 45.0);
+    proc.segments_->front()->reset_metadata();
+    ASSERT_FALSE(filter_with_zone_maps(proc, ExpressionName("root"), std::nullopt).has_value());
+
+    // Nothing decided, so the whole segment is evaluated as before
+    auto missing_proc = proc_with_filter("missing", OperationType::GT, 45.0);
+    ASSERT_FALSE(filter_with_zone_maps(missing_proc, ExpressionName("root"), std::nullopt).has_value());
+}
+
+TEST(ZoneMaps, DecodeSkipsZonesThatCannotMatch) {
+    for (auto encoding_version : {EncodingVersion::V1, EncodingVersion::V2}) {
+        auto seg = build_zone_map_segment();
+        add_zone_maps(seg, rows_per_zone);
+        // One block per zone, so that each zone is encoded separately
+        ASSERT_EQ(seg.column(0).num_blocks(), 10);
+        auto encoded = encode_dispatch(std::move(seg), codec::default_lz4_codec(), encoding_version);
+
+        auto expression_context = filter_context("price", OperationType::GT, 45.0);
+        auto descriptor = encoded.descriptor();
+        descriptor.fields().regenerate_offsets();
+        SegmentInMemory decoded(std::move(descriptor));
+        decode_into_memory_segment(
+                encoded,
+                encoded.header(),
+                decoded,
+                decoded.descriptor(),
+                zone_map_block_filter(expression_context, ExpressionName("root"))
+        );
+        ASSERT_EQ(decoded.row_count(), 100);
+        // Zones 0 to 3 cannot match, so every column is left zeroed there
+        ASSERT_EQ(decoded.scalar_at<int64_t>(35, 0), 0);
+        ASSERT_EQ(decoded.scalar_at<double>(35, 1), 0.0);
+        ASSERT_EQ(decoded.scalar_at<int64_t>(45, 0), 45);
+        ASSERT_EQ(decoded.scalar_at<double>(45, 1), 45.0);
+
+        // Filtering never evaluates or selects the zeroed rows
+        ProcessingUnit proc{std::move(decoded)};
+        proc.set_expression_context(expression_context);
+        auto result = filter_with_zone_maps(proc, ExpressionName("root"), std::nullopt);
+        ASSERT_TRUE(result.has_value());
+        const auto& bitset = std::get<util::BitSet>(*result);
+        ASSERT_EQ(bitset.count(), 54);
+        ASSERT_FALSE(bitset.get_bit(35));
+        ASSERT_TRUE(bitset.get_bit(46));
+    }
+}
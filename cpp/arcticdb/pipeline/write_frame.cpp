@@ -10,8 +10,10 @@
 #include "column_store/memory_segment.hpp"
 #include <arcticdb/pipeline/input_frame.hpp>
 #include <arcticdb/pipeline/frame_slice.hpp>
+#include <arcticdb/pipeline/index_column_stats.hpp>
 #include <arcticdb/pipeline/index_utils.hpp>
 #include <arcticdb/pipeline/slicing.hpp>
+#include <arcticdb/pipeline/zone_maps.hpp>
 #include <arcticdb/stream/stream_sink.hpp>
 #include <arcticdb/entity/performance_tracing.hpp>
 #include <arcticdb/stream/aggregator.hpp>
@@ -51,7 +53,17 @@ std::tuple<PartialKey, SegmentInMemory, FrameSlice> WriteToSegmentTask::operator
     auto seg = slice();
     auto key = generate_partial_key(seg);
     seg.descriptor().set_id(key.stream_id);
-    return {std::move(key), std::move(seg), std::move(slice_)};
+    auto frame_slice = slice_;
+    if (typed_stream_version_.has_value() && typed_stream_version_->type == KeyType::TABLE_DATA &&
+        frame_slice.col_range.diff() > 0 && embed_column_stats_in_index()) {
+        frame_slice.set_column_stats(compute_slice_column_stats(seg, frame_slice.absolute_field_col(0)));
+    }
+    if (typed_stream_version_.has_value() && typed_stream_version_->type == KeyType::TABLE_DATA) {
+        if (const auto rows_per_zone = zone_map_rows(); rows_per_zone > 0) {
+            add_zone_maps(seg, rows_per_zone);
+        }
+    }
+    return {std::move(key), std::move(seg), std::move(frame_slice)};
 }
 
 PartialKey WriteToSegmentTask::generate_partial_key(const SegmentInMemory& seg) const {
@@ -503,6 +515,9 @@ folly::Future<AtomKey> append_frame(
 ) {
     ARCTICDB_SAMPLE_DEFAULT(AppendFrame)
     auto existing_slices = unfiltered_index(index_segment_reader);
+    if (embed_column_stats_in_index()) {
+        set_embedded_column_stats(index_segment_reader.seg(), existing_slices);
+    }
     const auto tsd =
             index::get_merged_tsd(frame->num_rows + frame->offset, dynamic_schema, index_segment_reader.tsd(), frame);
     auto keys_fut = slice_and_write(frame, slicing, IndexPartialKey{key}, store);
@@ -576,6 +591,11 @@ folly::Future<SliceAndKey> async_rewrite_partial_segment(
                                 existing.slice_.hash_bucket(),
                                 existing.slice_.num_buckets()
                         };
+                        if (key.type() == KeyType::TABLE_DATA && embed_column_stats_in_index()) {
+                            new_slice.set_column_stats(
+                                    compute_slice_column_stats(output, new_slice.absolute_field_col(0))
+                            );
+                        }
                         return store->write(key.type(), version_id, key.id(), start_ts, end_ts, std::move(output))
                                 .thenValueInline([new_slice = std::move(new_slice)](VariantKey&& k) {
                                     return SliceAndKey{new_slice, std::get<AtomKey>(std::move(k))};
@@ -0,0 +1,346 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/pipeline/zone_maps.hpp>
+
+#include <arcticdb/column_store/column_algorithms.hpp>
+#include <arcticdb/log/log.hpp>
+#include <arcticdb/pipeline/column_stats_dispatch.hpp>
+#include <arcticdb/pipeline/column_stats_filter.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/variant.hpp>
+
+#include <folly/container/Enumerate.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace arcticdb {
+
+namespace {
+
+constexpr uint32_t zone_maps_version = 1;
+
+size_t num_zones(uint64_t row_count, uint64_t rows_per_zone) {
+    return static_cast<size_t>((row_count + rows_per_zone - 1) / rows_per_zone);
+}
+
+template<typename RawType>
+void append_raw(std::string& bytes, RawType value) {
+    bytes.append(reinterpret_cast<const char*>(&value), sizeof(RawType));
+}
+
+/*
+ * Evaluates the filter over rows [start_row, end_row) of proc, in place on views of those rows of its input columns.
+ * The views share the data and string pools of the segments they are taken from.
+ */
+VariantData evaluate_filter_on_rows(
+        const ProcessingUnit& proc, const ExpressionName& root_node_name,
+        const std::optional<std::unordered_set<std::string>>& input_columns, size_t start_row, size_t end_row
+) {
+    std::vector<std::shared_ptr<SegmentInMemory>> segments;
+    std::vector<std::shared_ptr<pipelines::RowRange>> row_ranges;
+    std::vector<std::shared_ptr<pipelines::ColRange>> col_ranges;
+    for (const auto& [idx, segment] : folly::enumerate(*proc.segments_)) {
+        // Found as ProcessingUnit::get finds them, so that the names of multi-index columns are demangled
+        std::vector<size_t> field_indices;
+        if (input_columns.has_value()) {
+            segment->init_column_map();
+            for (const auto& column_name : *input_columns) {
+                if (auto field_idx = segment->column_index_with_name_demangling(column_name)) {
+                    field_indices.emplace_back(*field_idx);
+                }
+            }
+            std::ranges::sort(field_indices);
+        } else {
+            field_indices.resize(segment->descriptor().field_count());
+            std::iota(field_indices.begin(), field_indices.end(), 0);
+        }
+        auto rows_segment = std::make_shared<SegmentInMemory>();
+        for (auto field_idx : field_indices) {
+            const auto column_idx = static_cast<position_t>(field_idx);
+            rows_segment->add_column(
+                    segment->field(field_idx), Column::view(segment->column_ptr(column_idx), start_row, end_row)
+            );
+        }
+        rows_segment->set_string_pool(segment->string_pool_ptr());
+        rows_segment->set_row_data(static_cast<ssize_t>(end_row - start_row) - 1);
+        segments.emplace_back(std::move(rows_segment));
+        const auto first_row = proc.row_ranges_->at(idx)->first;
+        row_ranges.emplace_back(std::make_shared<pipelines::RowRange>(first_row + start_row, first_row + end_row));
+        col_ranges.emplace_back(proc.col_ranges_->at(idx));
+    }
+    ProcessingUnit rows_proc;
+    rows_proc.set_segments(std::move(segments));
+    rows_proc.set_row_ranges(std::move(row_ranges));
+    rows_proc.set_col_ranges(std::move(col_ranges));
+    rows_proc.set_expression_context(proc.expression_context_);
+    return rows_proc.get(root_node_name);
+}
+
+// The result of comparing the zone maps of the segments of proc with the filter, for each zone
+struct ZoneComparisons {
+    std::vector<StatsComparison> comparisons_;
+    size_t row_count_;
+    size_t rows_per_zone_;
+};
+
+// The zone maps in the metadata of segment, whether or not they still describe its rows
+std::optional<arcticc::pb2::column_stats_pb2::ZoneMaps> unpack_zone_maps(const SegmentInMemory& segment) {
+    using namespace arcticc::pb2::column_stats_pb2;
+    const auto* metadata = segment.metadata();
+    if (metadata == nullptr || !metadata->Is<ZoneMaps>()) {
+        return std::nullopt;
+    }
+    ZoneMaps zone_maps;
+    if (!metadata->UnpackTo(&zone_maps) || zone_maps.version() != zone_maps_version || zone_maps.rows_per_zone() == 0) {
+        return std::nullopt;
+    }
+    return zone_maps;
+}
+
+// The result of comparing zone_maps, which must all have the same zones, with the filter, for each zone
+std::vector<StatsComparison> compare_zones(
+        const std::vector<arcticc::pb2::column_stats_pb2::ZoneMaps>& zone_maps,
+        const ExpressionContext& expression_context, const ExpressionName& root_node_name
+) {
+    const auto zones = num_zones(zone_maps.front().row_count(), zone_maps.front().rows_per_zone());
+    const auto column_stats = ColumnStatsData::from_zone_maps(zone_maps);
+    StatsRowIndices row_indices(zones);
+    for (size_t zone = 0; zone < zones; ++zone) {
+        row_indices[zone] = zone;
+    }
+    auto result = evaluate_ast_node_against_stats(root_node_name, expression_context, row_indices, column_stats);
+    util::check(
+            std::holds_alternative<std::vector<StatsComparison>>(result),
+            "evaluate_ast_node_against_stats should evaluate to a vector<StatsComparison>"
+    );
+    return std::move(std::get<std::vector<StatsComparison>>(result));
+}
+
+std::optional<ZoneComparisons> compare_zones(const ProcessingUnit& proc, const ExpressionName& root_node_name) {
+    using namespace arcticc::pb2::column_stats_pb2;
+    util::check(proc.segments_.has_value() && proc.expression_context_, "Expected segments and an expression context");
+    std::vector<ZoneMaps> zone_maps;
+    for (const auto& segment : *proc.segments_) {
+        // Column slices without zone maps, for example those added by ProjectClause, leave their columns UNKNOWN
+        auto segment_zone_maps = zone_maps_of(*segment);
+        if (segment_zone_maps.has_value() &&
+            (zone_maps.empty() || segment_zone_maps->rows_per_zone() == zone_maps.front().rows_per_zone())) {
+            zone_maps.emplace_back(std::move(*segment_zone_maps));
+        }
+    }
+    if (zone_maps.empty()) {
+        return std::nullopt;
+    }
+
+    const auto row_count = static_cast<size_t>(zone_maps.front().row_count());
+    const auto rows_per_zone = static_cast<size_t>(zone_maps.front().rows_per_zone());
+    auto comparisons = compare_zones(zone_maps, *proc.expression_context_, root_node_name);
+    if (std::ranges::all_of(comparisons, [](auto comparison) { return comparison == StatsComparison::UNKNOWN; })) {
+        return std::nullopt;
+    }
+    return ZoneComparisons{std::move(comparisons), row_count, rows_per_zone};
+}
+
+} // namespace
+
+size_t zone_map_rows() {
+    return static_cast<size_t>(std::max<int64_t>(ConfigsMap::instance()->get_int("ColumnStats.ZoneMapRows", 0), 0));
+}
+
+void add_zone_maps(SegmentInMemory& segment, size_t rows_per_zone) {
+    using namespace arcticc::pb2::column_stats_pb2;
+    util::check(rows_per_zone > 0, "Zone maps need at least one row per zone");
+    const auto row_count = segment.row_count();
+    if (row_count == 0) {
+        return;
+    }
+    const auto zones = num_zones(row_count, rows_per_zone);
+    ZoneMaps zone_maps;
+    zone_maps.set_version(zone_maps_version);
+    zone_maps.set_row_count(row_count);
+    zone_maps.set_rows_per_zone(rows_per_zone);
+
+    for (size_t idx = 0; idx < segment.descriptor().field_count(); ++idx) {
+        const auto& field = segment.descriptor().field(idx);
+        if (field.type().dimension() != Dimension::Dim0) {
+            continue;
+        }
+        details::visit_type(field.type().data_type(), [&]<typename T>(T) {
+            using type_info = ScalarTypeInfo<T>;
+            if constexpr (is_numeric_type(type_info::data_type) || is_time_type(type_info::data_type) ||
+                          is_bool_type(type_info::data_type)) {
+                using RawType = typename type_info::RawType;
+                std::vector<RawType> mins(zones);
+                std::vector<RawType> maxes(zones);
+                std::vector<uint64_t> non_null_counts(zones, 0);
+                arcticdb::for_each_enumerated<typename type_info::TDT>(
+                        segment.column(static_cast<position_t>(idx)),
+                        [&](auto enumerated_it) {
+                            const auto value = static_cast<RawType>(enumerated_it.value());
+                            if constexpr (is_floating_point_type(type_info::data_type)) {
+                                if (std::isnan(value)) {
+                                    return;
+                                }
+                            } else if constexpr (is_time_type(type_info::data_type)) {
+                                if (value == NaT) {
+                                    return;
+                                }
+                            }
+                            const auto zone = static_cast<size_t>(enumerated_it.idx()) / rows_per_zone;
+                            if (non_null_counts[zone]++ == 0) {
+                                mins[zone] = value;
+                                maxes[zone] = value;
+                            } else {
+                                mins[zone] = std::min(mins[zone], value);
+                                maxes[zone] = std::max(maxes[zone], value);
+                            }
+                        }
+                );
+
+                auto* zone_map_column = zone_maps.add_columns();
+                zone_map_column->set_name(std::string{field.name()});
+                zone_map_column->set_data_type(static_cast<uint32_t>(type_info::data_type));
+                auto* min_bytes = zone_map_column->mutable_mins();
+                auto* max_bytes = zone_map_column->mutable_maxes();
+                min_bytes->reserve(zones * sizeof(RawType));
+                max_bytes->reserve(zones * sizeof(RawType));
+                for (size_t zone = 0; zone < zones; ++zone) {
+                    append_raw(*min_bytes, mins[zone]);
+                    append_raw(*max_bytes, maxes[zone]);
+                    const auto zone_rows = std::min<size_t>(rows_per_zone, row_count - zone * rows_per_zone);
+                    zone_map_column->add_null_counts(zone_rows - non_null_counts[zone]);
+                }
+            }
+        });
+    }
+    if (zone_maps.columns().empty()) {
+        return;
+    }
+    // One encoded block per zone, so that decoding can skip the zones a filter cannot match
+    for (size_t idx = 0; idx < segment.descriptor().field_count(); ++idx) {
+        const auto& type = segment.descriptor().field(idx).type();
+        auto& column = segment.column(static_cast<position_t>(idx));
+        if (type.dimension() == Dimension::Dim0 && !is_empty_type(type.data_type()) && !column.is_sparse() &&
+            static_cast<size_t>(column.row_count()) == row_count) {
+            column.buffer() = reblock(column.buffer(), rows_per_zone * get_type_size(type.data_type()));
+        }
+    }
+    google::protobuf::Any any;
+    any.PackFrom(zone_maps);
+    segment.set_metadata(std::move(any));
+}
+
+std::optional<arcticc::pb2::column_stats_pb2::ZoneMaps> zone_maps_of(const SegmentInMemory& segment) {
+    auto zone_maps = unpack_zone_maps(segment);
+    if (!zone_maps.has_value() || zone_maps->row_count() != segment.row_count()) {
+        return std::nullopt;
+    }
+    return zone_maps;
+}
+
+BlockFilter zone_map_block_filter(
+        std::shared_ptr<ExpressionContext> expression_context, const ExpressionName& root_node_name
+) {
+    return [expression_context = std::move(expression_context),
+            root_node_name](const SegmentInMemory& segment) -> std::optional<SkippedBlocks> {
+        // Called before the columns are decoded, so the segment has no rows to check the zone maps against yet
+        auto zone_maps = unpack_zone_maps(segment);
+        if (!zone_maps.has_value()) {
+            return std::nullopt;
+        }
+        SkippedBlocks skipped_blocks{static_cast<size_t>(zone_maps->rows_per_zone()), {}};
+        for (const auto comparison : compare_zones({*zone_maps}, *expression_context, root_node_name)) {
+            skipped_blocks.skipped_.emplace_back(comparison == StatsComparison::NONE_MATCH);
+        }
+        const auto skipped_zones = std::ranges::count(skipped_blocks.skipped_, true);
+        ARCTICDB_DEBUG(log::version(), "Zone maps skip {} of {} zones", skipped_zones, skipped_blocks.skipped_.size());
+        if (skipped_zones == 0) {
+            return std::nullopt;
+        }
+        return skipped_blocks;
+    };
+}
+
+std::optional<VariantData> filter_with_zone_maps(
+        const ProcessingUnit& proc, const ExpressionName& root_node_name,
+        const std::optional<std::unordered_set<std::string>>& input_columns
+) {
+    auto zone_comparisons = compare_zones(proc, root_node_name);
+    if (!zone_comparisons.has_value()) {
+        return std::nullopt;
+    }
+    const auto& comparisons = zone_comparisons->comparisons_;
+    const auto row_count = zone_comparisons->row_count_;
+    const auto rows_per_zone = zone_comparisons->rows_per_zone_;
+    const auto zones = comparisons.size();
+
+    util::BitSet bitset(static_cast<util::BitSetSizeType>(row_count));
+    size_t evaluated_rows = 0;
+    for (size_t zone = 0; zone < zones;) {
+        const auto comparison = comparisons[zone];
+        // Runs of zones with the same comparison, so that adjacent undecided zones are evaluated together
+        auto run_end = zone + 1;
+        while (run_end < zones && comparisons[run_end] == comparison) {
+            ++run_end;
+        }
+        const auto start_row = zone * rows_per_zone;
+        const auto end_row = std::min(run_end * rows_per_zone, row_count);
+        if (comparison == StatsComparison::ALL_MATCH) {
+            bitset.set_range(bv_size(start_row), bv_size(end_row - 1));
+        } else if (comparison == StatsComparison::UNKNOWN) {
+            evaluated_rows += end_row - start_row;
+            util::variant_match(
+                    evaluate_filter_on_rows(proc, root_node_name, input_columns, start_row, end_row),
+                    [&bitset, start_row, end_row](const util::BitSet& rows_bitset) {
+                        iterate_over_set_positions(rows_bitset, 0, end_row - start_row, [&](size_t row) {
+                            bitset.set_bit(bv_size(start_row + row));
+                        });
+                    },
+                    [&bitset, start_row, end_row](FullResult) {
+                        bitset.set_range(bv_size(start_row), bv_size(end_row - 1));
+                    },
+                    [](EmptyResult) {},
+                    [](const auto&) { util::raise_rte("Expected bitset from filter clause"); }
+            );
+        }
+        zone = run_end;
+    }
+    ARCTICDB_DEBUG(
+            log::version(), "Zone maps left {} of {} rows to evaluate, {} rows match", evaluated_rows, row_count,
+            bitset.count()
+    );
+    const auto matching_rows = static_cast<size_t>(bitset.count());
+    if (matching_rows == 0) {
+        return VariantData{EmptyResult{}};
+    }
+    if (matching_rows == row_count) {
+        return VariantData{FullResult{}};
+    }
+    return VariantData{std::move(bitset)};
+}
+
+std::optional<double> zone_map_selectivity(const ProcessingUnit& proc, const ExpressionName& root_node_name) {
+    const auto zone_comparisons = compare_zones(proc, root_node_name);
+    if (!zone_comparisons.has_value()) {
+        return std::nullopt;
+    }
+    double matching_zones = 0;
+    for (const auto comparison : zone_comparisons->comparisons_) {
+        if (comparison == StatsComparison::ALL_MATCH) {
+            matching_zones += 1;
+        } else if (comparison == StatsComparison::UNKNOWN) {
+            matching_zones += 0.5;
+        }
+    }
+    return matching_zones / static_cast<double>(zone_comparisons->comparisons_.size());
+}
+
+} // namespace arcticdb
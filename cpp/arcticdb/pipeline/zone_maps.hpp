@@ -0,0 +1,66 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/codec/codec.hpp>
+#include <arcticdb/column_store/memory_segment.hpp>
+#include <arcticdb/processing/expression_node.hpp>
+#include <arcticdb/processing/processing_unit.hpp>
+
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <column_stats.pb.h>
+
+namespace arcticdb {
+
+/*
+ * Zone maps are the min, max and null count of the numeric, time and bool columns of a data segment over each run
+ * ("zone") of ColumnStats.ZoneMapRows rows, stored in the segment's metadata (see ZoneMaps in column_stats.proto).
+ * Whereas column stats prune whole segments before they are read, zone maps let decoding skip the zones of a segment
+ * that survived that which cannot match, and FilterClause take the zones that all match without evaluating the filter.
+ */
+
+// ColumnStats.ZoneMapRows, with 0 meaning that no zone maps are written
+size_t zone_map_rows();
+
+// Sets the zone maps of segment as its metadata, which must not already be set
+void add_zone_maps(SegmentInMemory& segment, size_t rows_per_zone);
+
+// The zone maps of segment, if it has any that still describe its rows
+std::optional<arcticc::pb2::column_stats_pb2::ZoneMaps> zone_maps_of(const SegmentInMemory& segment);
+
+/*
+ * A BlockFilter for decoding a data segment that skips decompressing the zones that the filter with root node
+ * root_node_name cannot match, going by the zone maps of that segment alone. The skipped zones are left zeroed, and
+ * filter_with_zone_maps never evaluates or selects their rows, so it must be the first thing run on the segment.
+ */
+BlockFilter zone_map_block_filter(
+        std::shared_ptr<ExpressionContext> expression_context, const ExpressionName& root_node_name
+);
+
+/*
+ * The result of the filter with root node root_node_name over the rows of proc, using the zone maps of its segments
+ * (the column slices of one row slice). This is an EmptyResult, a FullResult or a util::BitSet. The filter is only
+ * evaluated on the zones the zone maps leave undecided, in place on views of those rows of input_columns (all columns
+ * if not set). std::nullopt means that the zone maps decide nothing, or there are none, so the whole of proc must be
+ * evaluated.
+ */
+std::optional<VariantData> filter_with_zone_maps(
+        const ProcessingUnit& proc, const ExpressionName& root_node_name,
+        const std::optional<std::unordered_set<std::string>>& input_columns
+);
+
+/*
+ * An estimate of the fraction of the rows of proc that match the filter with root node root_node_name, from the zone
+ * maps of its segments, counting the zones they leave undecided as half matching. std::nullopt if they decide nothing.
+ */
+std::optional<double> zone_map_selectivity(const ProcessingUnit& proc, const ExpressionName& root_node_name);
+
+} // namespace arcticdb
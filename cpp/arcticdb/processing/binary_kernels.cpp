@@ -0,0 +1,636 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/processing/binary_kernels.hpp>
+
+#include <arcticdb/column_store/column_data.hpp>
+#include <arcticdb/util/configs_map.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ARCTICDB_X86_SIMD_KERNELS
+#include <immintrin.h>
+#define ARCTICDB_TARGET_AVX2 __attribute__((target("avx2")))
+#define ARCTICDB_TARGET_AVX512 __attribute__((target("avx512f,avx512dq,avx512bw,avx512vl")))
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ARCTICDB_KERNEL_INLINE [[gnu::always_inline]] inline
+#else
+#define ARCTICDB_KERNEL_INLINE inline
+#endif
+
+namespace arcticdb {
+
+namespace {
+
+constexpr size_t bits_per_word = 64;
+
+enum class Cmp : uint8_t { EQ, NE, LT, LE, GT, GE };
+
+template<typename Op>
+constexpr Cmp cmp_of() {
+    if constexpr (std::is_same_v<Op, EqualsOperator>) {
+        return Cmp::EQ;
+    } else if constexpr (std::is_same_v<Op, NotEqualsOperator>) {
+        return Cmp::NE;
+    } else if constexpr (std::is_same_v<Op, LessThanOperator>) {
+        return Cmp::LT;
+    } else if constexpr (std::is_same_v<Op, LessThanEqualsOperator>) {
+        return Cmp::LE;
+    } else if constexpr (std::is_same_v<Op, GreaterThanOperator>) {
+        return Cmp::GT;
+    } else {
+        return Cmp::GE;
+    }
+}
+
+// value < row is row > value, so a reversed comparison is the mirrored comparison with the arguments swapped back
+constexpr Cmp mirrored(Cmp cmp) {
+    switch (cmp) {
+    case Cmp::LT:
+        return Cmp::GT;
+    case Cmp::LE:
+        return Cmp::GE;
+    case Cmp::GT:
+        return Cmp::LT;
+    case Cmp::GE:
+        return Cmp::LE;
+    default:
+        return cmp;
+    }
+}
+
+template<Cmp cmp, typename T>
+ARCTICDB_KERNEL_INLINE bool compare(T left, T right) {
+    if constexpr (cmp == Cmp::EQ) {
+        return left == right;
+    } else if constexpr (cmp == Cmp::NE) {
+        return left != right;
+    } else if constexpr (cmp == Cmp::LT) {
+        return left < right;
+    } else if constexpr (cmp == Cmp::LE) {
+        return left <= right;
+    } else if constexpr (cmp == Cmp::GT) {
+        return left > right;
+    } else {
+        return left >= right;
+    }
+}
+
+/*
+ * Scalar kernels. The comparison results for a word are written as bytes first and then packed eight at a time, which
+ * the compiler vectorises with whatever the baseline instruction set is, rather than shifting each bit into place.
+ */
+
+ARCTICDB_KERNEL_INLINE uint64_t pack_flags(const uint8_t* flags) {
+    uint64_t word = 0;
+    for (size_t byte = 0; byte < bits_per_word / 8; ++byte) {
+        uint64_t eight_flags;
+        std::memcpy(&eight_flags, flags + 8 * byte, sizeof(eight_flags));
+        // Moves the low bit of each of the eight bytes into the top byte, with the first byte as the lowest bit
+        word |= ((eight_flags * 0x0102040810204080ULL) >> 56) << (8 * byte);
+    }
+    return word;
+}
+
+template<Cmp cmp, bool right_is_column, typename T>
+void compare_words_scalar(const T* left, const T* right, T value, size_t num_words, uint64_t* words) {
+    std::array<uint8_t, bits_per_word> flags;
+    for (size_t word = 0; word < num_words; ++word) {
+        const T* word_left = left + word * bits_per_word;
+        for (size_t idx = 0; idx < bits_per_word; ++idx) {
+            if constexpr (right_is_column) {
+                flags[idx] = compare<cmp>(word_left[idx], right[word * bits_per_word + idx]) ? 1 : 0;
+            } else {
+                flags[idx] = compare<cmp>(word_left[idx], value) ? 1 : 0;
+            }
+        }
+        words[word] = pack_flags(flags.data());
+    }
+}
+
+template<typename Op, typename T>
+ARCTICDB_KERNEL_INLINE T apply(T left, T right) {
+    return Op{}.template apply<T, T, T>(left, right);
+}
+
+template<typename Op, bool right_is_column, bool reversed, typename T>
+ARCTICDB_KERNEL_INLINE void apply_loop(
+        const T* __restrict left, const T* __restrict right, T value, T* __restrict out, size_t count
+) {
+    for (size_t idx = 0; idx < count; ++idx) {
+        if constexpr (right_is_column) {
+            out[idx] = apply<Op>(left[idx], right[idx]);
+        } else if constexpr (reversed) {
+            out[idx] = apply<Op>(value, left[idx]);
+        } else {
+            out[idx] = apply<Op>(left[idx], value);
+        }
+    }
+}
+
+template<typename Op, bool right_is_column, bool reversed, typename T>
+void apply_scalar(const T* left, const T* right, T value, T* out, size_t count) {
+    apply_loop<Op, right_is_column, reversed>(left, right, value, out, count);
+}
+
+#ifdef ARCTICDB_X86_SIMD_KERNELS
+
+/*
+ * AVX2 kernels. AVX2 only has equality and signed greater than for integers, so the other comparisons are built from
+ * them by swapping the arguments and inverting the mask, and unsigned integers are compared after flipping their sign
+ * bits. Each vector comparison gives one mask bit per lane through movemask.
+ */
+
+template<size_t width>
+ARCTICDB_TARGET_AVX2 inline uint32_t avx2_movemask(__m256i vec) {
+    if constexpr (width == 8) {
+        return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(vec)));
+    } else {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(vec)));
+    }
+}
+
+template<Cmp cmp, size_t width>
+ARCTICDB_TARGET_AVX2 inline uint32_t avx2_signed_mask(__m256i left, __m256i right) {
+    constexpr uint32_t all_lanes = width == 8 ? 0xFu : 0xFFu;
+    if constexpr (cmp == Cmp::EQ || cmp == Cmp::NE) {
+        const auto equal = width == 8 ? _mm256_cmpeq_epi64(left, right) : _mm256_cmpeq_epi32(left, right);
+        return cmp == Cmp::EQ ? avx2_movemask<width>(equal) : avx2_movemask<width>(equal) ^ all_lanes;
+    } else if constexpr (cmp == Cmp::GT || cmp == Cmp::LE) {
+        const auto greater = width == 8 ? _mm256_cmpgt_epi64(left, right) : _mm256_cmpgt_epi32(left, right);
+        return cmp == Cmp::GT ? avx2_movemask<width>(greater) : avx2_movemask<width>(greater) ^ all_lanes;
+    } else {
+        const auto less = width == 8 ? _mm256_cmpgt_epi64(right, left) : _mm256_cmpgt_epi32(right, left);
+        return cmp == Cmp::LT ? avx2_movemask<width>(less) : avx2_movemask<width>(less) ^ all_lanes;
+    }
+}
+
+template<typename T>
+struct Avx2Ops {
+    static_assert(std::is_integral_v<T>);
+    static constexpr size_t width = sizeof(T);
+    static constexpr size_t lanes = 32 / width;
+    using Vec = __m256i;
+
+    ARCTICDB_TARGET_AVX2 static Vec load(const T* ptr) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    }
+
+    ARCTICDB_TARGET_AVX2 static Vec broadcast(T value) {
+        if constexpr (width == 8) {
+            return _mm256_set1_epi64x(static_cast<int64_t>(value));
+        } else {
+            return _mm256_set1_epi32(static_cast<int32_t>(value));
+        }
+    }
+
+    template<Cmp cmp>
+    ARCTICDB_TARGET_AVX2 static uint32_t mask(Vec left, Vec right) {
+        if constexpr (std::is_unsigned_v<T> && cmp != Cmp::EQ && cmp != Cmp::NE) {
+            const auto sign = width == 8 ? _mm256_set1_epi64x(std::numeric_limits<int64_t>::min())
+                                         : _mm256_set1_epi32(std::numeric_limits<int32_t>::min());
+            return avx2_signed_mask<cmp, width>(_mm256_xor_si256(left, sign), _mm256_xor_si256(right, sign));
+        } else {
+            return avx2_signed_mask<cmp, width>(left, right);
+        }
+    }
+};
+
+// Ordered comparisons are false with NaN and unordered not-equals is true, as with the scalar operators
+template<Cmp cmp>
+constexpr int float_predicate() {
+    switch (cmp) {
+    case Cmp::EQ:
+        return _CMP_EQ_OQ;
+    case Cmp::NE:
+        return _CMP_NEQ_UQ;
+    case Cmp::LT:
+        return _CMP_LT_OQ;
+    case Cmp::LE:
+        return _CMP_LE_OQ;
+    case Cmp::GT:
+        return _CMP_GT_OQ;
+    default:
+        return _CMP_GE_OQ;
+    }
+}
+
+template<>
+struct Avx2Ops<double> {
+    static constexpr size_t lanes = 4;
+    using Vec = __m256d;
+
+    ARCTICDB_TARGET_AVX2 static Vec load(const double* ptr) { return _mm256_loadu_pd(ptr); }
+
+    ARCTICDB_TARGET_AVX2 static Vec broadcast(double value) { return _mm256_set1_pd(value); }
+
+    template<Cmp cmp>
+    ARCTICDB_TARGET_AVX2 static uint32_t mask(Vec left, Vec right) {
+        constexpr int predicate = float_predicate<cmp>();
+        return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(left, right, predicate)));
+    }
+};
+
+template<>
+struct Avx2Ops<float> {
+    static constexpr size_t lanes = 8;
+    using Vec = __m256;
+
+    ARCTICDB_TARGET_AVX2 static Vec load(const float* ptr) { return _mm256_loadu_ps(ptr); }
+
+    ARCTICDB_TARGET_AVX2 static Vec broadcast(float value) { return _mm256_set1_ps(value); }
+
+    template<Cmp cmp>
+    ARCTICDB_TARGET_AVX2 static uint32_t mask(Vec left, Vec right) {
+        constexpr int predicate = float_predicate<cmp>();
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(left, right, predicate)));
+    }
+};
+
+template<Cmp cmp, bool right_is_column, typename T>
+ARCTICDB_TARGET_AVX2 void compare_words_avx2(
+        const T* left, const T* right, T value, size_t num_words, uint64_t* words
+) {
+    using Ops = Avx2Ops<T>;
+    const auto broadcast = Ops::broadcast(value);
+    for (size_t word = 0; word < num_words; ++word) {
+        const T* word_left = left + word * bits_per_word;
+        uint64_t bits = 0;
+        for (size_t lane = 0; lane < bits_per_word; lane += Ops::lanes) {
+            if constexpr (right_is_column) {
+                const auto right_vec = Ops::load(right + word * bits_per_word + lane);
+                bits |= static_cast<uint64_t>(Ops::template mask<cmp>(Ops::load(word_left + lane), right_vec)) << lane;
+            } else {
+                bits |= static_cast<uint64_t>(Ops::template mask<cmp>(Ops::load(word_left + lane), broadcast)) << lane;
+            }
+        }
+        words[word] = bits;
+    }
+}
+
+template<typename Op, bool right_is_column, bool reversed, typename T>
+ARCTICDB_TARGET_AVX2 void apply_avx2(const T* left, const T* right, T value, T* out, size_t count) {
+    apply_loop<Op, right_is_column, reversed>(left, right, value, out, count);
+}
+
+/*
+ * AVX-512 kernels. Every comparison, signed or unsigned, is a single instruction that writes a mask register with one
+ * bit per lane.
+ */
+
+template<Cmp cmp>
+constexpr int integer_predicate() {
+    switch (cmp) {
+    case Cmp::EQ:
+        return _MM_CMPINT_EQ;
+    case Cmp::NE:
+        return _MM_CMPINT_NE;
+    case Cmp::LT:
+        return _MM_CMPINT_LT;
+    case Cmp::LE:
+        return _MM_CMPINT_LE;
+    case Cmp::GT:
+        return _MM_CMPINT_NLE;
+    default:
+        return _MM_CMPINT_NLT;
+    }
+}
+
+template<typename T>
+struct Avx512Ops {
+    static_assert(std::is_integral_v<T>);
+    static constexpr size_t lanes = 64 / sizeof(T);
+    using Vec = __m512i;
+
+    ARCTICDB_TARGET_AVX512 static Vec load(const T* ptr) { return _mm512_loadu_si512(ptr); }
+
+    ARCTICDB_TARGET_AVX512 static Vec broadcast(T value) {
+        if constexpr (sizeof(T) == 8) {
+            return _mm512_set1_epi64(static_cast<int64_t>(value));
+        } else {
+            return _mm512_set1_epi32(static_cast<int32_t>(value));
+        }
+    }
+
+    template<Cmp cmp>
+    ARCTICDB_TARGET_AVX512 static uint32_t mask(Vec left, Vec right) {
+        constexpr auto predicate = integer_predicate<cmp>();
+        if constexpr (sizeof(T) == 8 && std::is_signed_v<T>) {
+            return _mm512_cmp_epi64_mask(left, right, predicate);
+        } else if constexpr (sizeof(T) == 8) {
+            return _mm512_cmp_epu64_mask(left, right, predicate);
+        } else if constexpr (std::is_signed_v<T>) {
+            return _mm512_cmp_epi32_mask(left, right, predicate);
+        } else {
+            return _mm512_cmp_epu32_mask(left, right, predicate);
+        }
+    }
+};
+
+template<>
+struct Avx512Ops<double> {
+    static constexpr size_t lanes = 8;
+    using Vec = __m512d;
+
+    ARCTICDB_TARGET_AVX512 static Vec load(const double* ptr) { return _mm512_loadu_pd(ptr); }
+
+    ARCTICDB_TARGET_AVX512 static Vec broadcast(double value) { return _mm512_set1_pd(value); }
+
+    template<Cmp cmp>
+    ARCTICDB_TARGET_AVX512 static uint32_t mask(Vec left, Vec right) {
+        constexpr int predicate = float_predicate<cmp>();
+        return _mm512_cmp_pd_mask(left, right, predicate);
+    }
+};
+
+template<>
+struct Avx512Ops<float> {
+    static constexpr size_t lanes = 16;
+    using Vec = __m512;
+
+    ARCTICDB_TARGET_AVX512 static Vec load(const float* ptr) { return _mm512_loadu_ps(ptr); }
+
+    ARCTICDB_TARGET_AVX512 static Vec broadcast(float value) { return _mm512_set1_ps(value); }
+
+    template<Cmp cmp>
+    ARCTICDB_TARGET_AVX512 static uint32_t mask(Vec left, Vec right) {
+        constexpr int predicate = float_predicate<cmp>();
+        return _mm512_cmp_ps_mask(left, right, predicate);
+    }
+};
+
+template<Cmp cmp, bool right_is_column, typename T>
+ARCTICDB_TARGET_AVX512 void compare_words_avx512(
+        const T* left, const T* right, T value, size_t num_words, uint64_t* words
+) {
+    using Ops = Avx512Ops<T>;
+    const auto broadcast = Ops::broadcast(value);
+    for (size_t word = 0; word < num_words; ++word) {
+        const T* word_left = left + word * bits_per_word;
+        uint64_t bits = 0;
+        for (size_t lane = 0; lane < bits_per_word; lane += Ops::lanes) {
+            if constexpr (right_is_column) {
+                const auto right_vec = Ops::load(right + word * bits_per_word + lane);
+                bits |= static_cast<uint64_t>(Ops::template mask<cmp>(Ops::load(word_left + lane), right_vec)) << lane;
+            } else {
+                bits |= static_cast<uint64_t>(Ops::template mask<cmp>(Ops::load(word_left + lane), broadcast)) << lane;
+            }
+        }
+        words[word] = bits;
+    }
+}
+
+template<typename Op, bool right_is_column, bool reversed, typename T>
+ARCTICDB_TARGET_AVX512 void apply_avx512(const T* left, const T* right, T value, T* out, size_t count) {
+    apply_loop<Op, right_is_column, reversed>(left, right, value, out, count);
+}
+
+#endif
+
+SimdLevel detected_simd_level() {
+#ifdef ARCTICDB_X86_SIMD_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+}
+
+template<Cmp cmp, bool right_is_column, typename T>
+void compare_words(SimdLevel level, const T* left, const T* right, T value, size_t num_words, uint64_t* words) {
+#ifdef ARCTICDB_X86_SIMD_KERNELS
+    if (level == SimdLevel::AVX512) {
+        compare_words_avx512<cmp, right_is_column>(left, right, value, num_words, words);
+        return;
+    }
+    if (level == SimdLevel::AVX2) {
+        compare_words_avx2<cmp, right_is_column>(left, right, value, num_words, words);
+        return;
+    }
+#endif
+    compare_words_scalar<cmp, right_is_column>(left, right, value, num_words, words);
+}
+
+template<typename Op, bool right_is_column, bool reversed, typename T>
+void apply_run(SimdLevel level, const T* left, const T* right, T value, T* out, size_t count) {
+#ifdef ARCTICDB_X86_SIMD_KERNELS
+    if (level == SimdLevel::AVX512) {
+        apply_avx512<Op, right_is_column, reversed>(left, right, value, out, count);
+        return;
+    }
+    if (level == SimdLevel::AVX2) {
+        apply_avx2<Op, right_is_column, reversed>(left, right, value, out, count);
+        return;
+    }
+#endif
+    apply_scalar<Op, right_is_column, reversed>(left, right, value, out, count);
+}
+
+/*
+ * Compares rows words at a time straight from the column blocks. A word that straddles two blocks, and the final
+ * partial word, are copied out first.
+ */
+template<Cmp cmp, typename T>
+void compare_rows(
+        SimdLevel level, DenseRows<T>& left, DenseRows<T>* right, T value, size_t rows, util::BitSet& output_bitset
+) {
+    std::vector<uint64_t> words((rows + bits_per_word - 1) / bits_per_word, 0);
+    std::array<T, bits_per_word> left_stage{};
+    std::array<T, bits_per_word> right_stage{};
+    size_t row = 0;
+    while (row < rows) {
+        const auto remaining = rows - row;
+        auto contiguous = std::min(left.contiguous_rows(row), remaining);
+        if (right != nullptr) {
+            contiguous = std::min(contiguous, right->contiguous_rows(row));
+        }
+        auto num_words = contiguous / bits_per_word;
+        const T* left_ptr;
+        const T* right_ptr = nullptr;
+        if (num_words > 0) {
+            left_ptr = left.ptr(row);
+            if (right != nullptr) {
+                right_ptr = right->ptr(row);
+            }
+        } else {
+            num_words = 1;
+            const auto count = std::min(remaining, bits_per_word);
+            left.copy(row, count, left_stage.data());
+            left_ptr = left_stage.data();
+            if (right != nullptr) {
+                right->copy(row, count, right_stage.data());
+                right_ptr = right_stage.data();
+            }
+        }
+        auto* out = words.data() + row / bits_per_word;
+        if (right != nullptr) {
+            compare_words<cmp, true>(level, left_ptr, right_ptr, value, num_words, out);
+        } else {
+            compare_words<cmp, false>(level, left_ptr, right_ptr, value, num_words, out);
+        }
+        row += num_words * bits_per_word;
+    }
+    // The final word compared the stale entries of the stage past the last row
+    if (const auto tail = rows % bits_per_word; tail != 0) {
+        words.back() &= (uint64_t{1} << tail) - 1;
+    }
+    packed_words_to_bitset(words.data(), rows, output_bitset);
+}
+
+template<typename Op, bool right_is_column, bool reversed, typename T>
+std::unique_ptr<Column> apply_rows(SimdLevel level, DenseRows<T>& left, DenseRows<T>* right, T value, size_t rows) {
+    constexpr auto output_data_type = data_type_from_raw_type<T>();
+    auto output_column = std::make_unique<Column>(
+            make_scalar_type(output_data_type), rows, AllocationType::PRESIZED, Sparsity::PERMITTED
+    );
+    if (rows == 0) {
+        return output_column;
+    }
+    auto* out = reinterpret_cast<T*>(output_column->ptr());
+    size_t row = 0;
+    while (row < rows) {
+        auto count = std::min(left.contiguous_rows(row), rows - row);
+        const T* right_ptr = nullptr;
+        if constexpr (right_is_column) {
+            count = std::min(count, right->contiguous_rows(row));
+            right_ptr = right->ptr(row);
+        }
+        apply_run<Op, right_is_column, reversed>(level, left.ptr(row), right_ptr, value, out + row, count);
+        row += count;
+    }
+    output_column->set_row_data(rows - 1);
+    return output_column;
+}
+
+} // namespace
+
+SimdLevel simd_level() {
+    static const SimdLevel detected = detected_simd_level();
+    const auto max_level =
+            ConfigsMap::instance()->get_int("Processing.MaxSimdLevel", static_cast<int64_t>(SimdLevel::AVX512));
+    return static_cast<SimdLevel>(std::clamp<int64_t>(max_level, 0, static_cast<int64_t>(detected)));
+}
+
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_comparison<Op>
+void simd_compare(
+        const Column& column, T value, bool arguments_reversed, util::BitSet& output_bitset, SimdLevel level
+) {
+    DenseRows<T> rows{column};
+    const auto row_count = static_cast<size_t>(column.row_count());
+    if (arguments_reversed) {
+        compare_rows<mirrored(cmp_of<Op>())>(level, rows, nullptr, value, row_count, output_bitset);
+    } else {
+        compare_rows<cmp_of<Op>()>(level, rows, nullptr, value, row_count, output_bitset);
+    }
+}
+
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_comparison<Op>
+void simd_compare(const Column& left, const Column& right, util::BitSet& output_bitset, SimdLevel level) {
+    util::check(left.row_count() == right.row_count(), "Expected columns of the same length in simd_compare");
+    DenseRows<T> left_rows{left};
+    DenseRows<T> right_rows{right};
+    compare_rows<cmp_of<Op>()>(
+            level, left_rows, &right_rows, T{}, static_cast<size_t>(left.row_count()), output_bitset
+    );
+}
+
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_arithmetic<Op, T>
+std::unique_ptr<Column> simd_apply(const Column& column, T value, bool arguments_reversed, SimdLevel level) {
+    DenseRows<T> rows{column};
+    const auto row_count = static_cast<size_t>(column.row_count());
+    if (arguments_reversed) {
+        return apply_rows<Op, false, true>(level, rows, nullptr, value, row_count);
+    }
+    return apply_rows<Op, false, false>(level, rows, nullptr, value, row_count);
+}
+
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_arithmetic<Op, T>
+std::unique_ptr<Column> simd_apply(const Column& left, const Column& right, SimdLevel level) {
+    util::check(left.row_count() == right.row_count(), "Expected columns of the same length in simd_apply");
+    DenseRows<T> left_rows{left};
+    DenseRows<T> right_rows{right};
+    return apply_rows<Op, true, false>(level, left_rows, &right_rows, T{}, static_cast<size_t>(left.row_count()));
+}
+
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_comparison<Op>
+void simd_compare_words(
+        const T* left, const T* right, T value, bool arguments_reversed, size_t num_words, uint64_t* words,
+        SimdLevel level
+) {
+    if (right != nullptr) {
+        compare_words<cmp_of<Op>(), true>(level, left, right, value, num_words, words);
+    } else if (arguments_reversed) {
+        compare_words<mirrored(cmp_of<Op>()), false>(level, left, right, value, num_words, words);
+    } else {
+        compare_words<cmp_of<Op>(), false>(level, left, right, value, num_words, words);
+    }
+}
+
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_arithmetic<Op, T>
+void simd_apply_run(
+        const T* left, const T* right, T value, bool arguments_reversed, T* out, size_t count, SimdLevel level
+) {
+    util::check(right == nullptr || !arguments_reversed, "Unexpected reversed arguments with two columns");
+    if (right != nullptr) {
+        apply_run<Op, true, false>(level, left, right, value, out, count);
+    } else if (arguments_reversed) {
+        apply_run<Op, false, true>(level, left, right, value, out, count);
+    } else {
+        apply_run<Op, false, false>(level, left, right, value, out, count);
+    }
+}
+
+#define ARCTICDB_INSTANTIATE_SIMD_COMPARE(T, Op)                                                                       \
+    template void simd_compare<T, Op>(const Column&, T, bool, util::BitSet&, SimdLevel);                               \
+    template void simd_compare<T, Op>(const Column&, const Column&, util::BitSet&, SimdLevel);                         \
+    template void simd_compare_words<T, Op>(const T*, const T*, T, bool, size_t, uint64_t*, SimdLevel);
+
+#define ARCTICDB_INSTANTIATE_SIMD_APPLY(T, Op)                                                                         \
+    template std::unique_ptr<Column> simd_apply<T, Op>(const Column&, T, bool, SimdLevel);                             \
+    template std::unique_ptr<Column> simd_apply<T, Op>(const Column&, const Column&, SimdLevel);                       \
+    template void simd_apply_run<T, Op>(const T*, const T*, T, bool, T*, size_t, SimdLevel);
+
+#define ARCTICDB_INSTANTIATE_SIMD_KERNELS(T)                                                                           \
+    ARCTICDB_INSTANTIATE_SIMD_COMPARE(T, EqualsOperator)                                                               \
+    ARCTICDB_INSTANTIATE_SIMD_COMPARE(T, NotEqualsOperator)                                                            \
+    ARCTICDB_INSTANTIATE_SIMD_COMPARE(T, LessThanOperator)                                                             \
+    ARCTICDB_INSTANTIATE_SIMD_COMPARE(T, LessThanEqualsOperator)                                                       \
+    ARCTICDB_INSTANTIATE_SIMD_COMPARE(T, GreaterThanOperator)                                                          \
+    ARCTICDB_INSTANTIATE_SIMD_COMPARE(T, GreaterThanEqualsOperator)                                                    \
+    ARCTICDB_INSTANTIATE_SIMD_APPLY(T, PlusOperator)                                                                   \
+    ARCTICDB_INSTANTIATE_SIMD_APPLY(T, MinusOperator)                                                                  \
+    ARCTICDB_INSTANTIATE_SIMD_APPLY(T, TimesOperator)
+
+ARCTICDB_INSTANTIATE_SIMD_KERNELS(int32_t)
+ARCTICDB_INSTANTIATE_SIMD_KERNELS(int64_t)
+ARCTICDB_INSTANTIATE_SIMD_KERNELS(uint32_t)
+ARCTICDB_INSTANTIATE_SIMD_KERNELS(uint64_t)
+ARCTICDB_INSTANTIATE_SIMD_KERNELS(float)
+ARCTICDB_INSTANTIATE_SIMD_KERNELS(double)
+ARCTICDB_INSTANTIATE_SIMD_APPLY(float, DivideOperator)
+ARCTICDB_INSTANTIATE_SIMD_APPLY(double, DivideOperator)
+
+} // namespace arcticdb
@@ -0,0 +1,189 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/column_store/column.hpp>
+#include <arcticdb/processing/operation_types.hpp>
+#include <arcticdb/util/bitset.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace arcticdb {
+
+/*
+ * Vectorised kernels for the binary comparisons and arithmetic of dense numeric columns with a value or with another
+ * column of the same type. The comparison kernels produce the result 64 rows at a time as a packed word of bits, with
+ * AVX2 or AVX-512 compare and mask instructions on x86-64 when the CPU has them, and a branch-free scalar loop
+ * elsewhere. The arithmetic kernels are the same loop over contiguous blocks, compiled once per instruction set.
+ * The instruction set is chosen at runtime, so the binaries still run on CPUs without AVX2.
+ *
+ * Sparse columns, time columns (which need NaT handling), mixed types and the remaining operators use the element by
+ * element path in operation_dispatch_binary.hpp.
+ */
+
+enum class SimdLevel : uint8_t { SCALAR = 0, AVX2 = 1, AVX512 = 2 };
+
+// The widest instruction set this CPU supports, capped by Processing.MaxSimdLevel
+SimdLevel simd_level();
+
+template<typename T>
+inline constexpr bool is_simd_kernel_type = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t> ||
+                                            std::is_same_v<T, uint32_t> || std::is_same_v<T, uint64_t> ||
+                                            std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+template<typename Op>
+inline constexpr bool is_simd_kernel_comparison =
+        std::is_same_v<Op, EqualsOperator> || std::is_same_v<Op, NotEqualsOperator> ||
+        std::is_same_v<Op, LessThanOperator> || std::is_same_v<Op, LessThanEqualsOperator> ||
+        std::is_same_v<Op, GreaterThanOperator> || std::is_same_v<Op, GreaterThanEqualsOperator>;
+
+// Integer division is excluded as its result is always promoted to a floating point type
+template<typename Op, typename T>
+inline constexpr bool is_simd_kernel_arithmetic =
+        std::is_same_v<Op, PlusOperator> || std::is_same_v<Op, MinusOperator> || std::is_same_v<Op, TimesOperator> ||
+        (std::is_same_v<Op, DivideOperator> && std::is_floating_point_v<T>);
+
+// Whether every From converts to To without changing its value
+template<typename From, typename To>
+inline constexpr bool is_exact_conversion =
+        std::is_same_v<From, To> ||
+        (std::is_integral_v<From> && std::is_integral_v<To> &&
+         ((std::is_signed_v<From> == std::is_signed_v<To> && sizeof(To) >= sizeof(From)) ||
+          (std::is_unsigned_v<From> && std::is_signed_v<To> && sizeof(To) > sizeof(From)))) ||
+        (std::is_arithmetic_v<From> && std::is_floating_point_v<To> &&
+         std::numeric_limits<To>::digits >= std::numeric_limits<From>::digits);
+
+// value as a T, if it is exactly representable as one
+template<typename T, typename U>
+std::optional<T> exactly_as(U value) {
+    if constexpr (std::is_integral_v<U> && std::is_integral_v<T>) {
+        return std::in_range<T>(value) ? std::optional<T>{static_cast<T>(value)} : std::nullopt;
+    } else if constexpr (std::is_integral_v<U>) {
+        // Conservatively, only integers no wider than the mantissa
+        constexpr auto limit = int64_t{1} << std::numeric_limits<T>::digits;
+        return std::cmp_less_equal(value, limit) && std::cmp_greater_equal(value, -limit)
+                       ? std::optional<T>{static_cast<T>(value)}
+                       : std::nullopt;
+    } else {
+        // Converting an out of range floating point value is undefined, and NaN fails both checks
+        if constexpr (std::is_integral_v<T>) {
+            constexpr auto bound = static_cast<U>(std::numeric_limits<T>::max() / 2 + 1) * 2;
+            if (!(value >= static_cast<U>(std::numeric_limits<T>::min()) && value < bound)) {
+                return std::nullopt;
+            }
+        } else if (!(std::abs(value) <= static_cast<U>(std::numeric_limits<T>::max()))) {
+            return std::nullopt;
+        }
+        const auto converted = static_cast<T>(value);
+        return static_cast<U>(converted) == value ? std::optional<T>{converted} : std::nullopt;
+    }
+}
+
+/*
+ * Walks the rows of a dense column in increasing order, giving pointers to runs of them that are contiguous in memory.
+ * A column's rows can be spread over several blocks of its ChunkedBuffer.
+ */
+template<typename T>
+class DenseRows {
+  public:
+    explicit DenseRows(const Column& column) {
+        util::check(!column.is_sparse(), "Expected a dense column in binary kernel");
+        auto column_data = column.data();
+        while (auto block = column_data.next<ScalarTagType<DataTypeTag<data_type_from_raw_type<T>()>>>()) {
+            if (block->row_count() > 0) {
+                blocks_.emplace_back(block->data(), block->row_count());
+            }
+        }
+    }
+
+    // The number of rows from row to the end of the block holding it
+    size_t contiguous_rows(size_t row) {
+        seek(row);
+        return block_start_ + blocks_[block_].second - row;
+    }
+
+    const T* ptr(size_t row) {
+        seek(row);
+        return blocks_[block_].first + (row - block_start_);
+    }
+
+    void copy(size_t row, size_t count, T* dest) {
+        while (count > 0) {
+            const auto rows = std::min(count, contiguous_rows(row));
+            std::memcpy(dest, ptr(row), rows * sizeof(T));
+            row += rows;
+            dest += rows;
+            count -= rows;
+        }
+    }
+
+  private:
+    void seek(size_t row) {
+        while (row >= block_start_ + blocks_[block_].second) {
+            block_start_ += blocks_[block_].second;
+            ++block_;
+        }
+    }
+
+    std::vector<std::pair<const T*, size_t>> blocks_;
+    size_t block_ = 0;
+    size_t block_start_ = 0;
+};
+
+// Sets output_bitset to the rows of the dense column where Op(row, value) holds, or Op(value, row) if
+// arguments_reversed
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_comparison<Op>
+void simd_compare(
+        const Column& column, T value, bool arguments_reversed, util::BitSet& output_bitset, SimdLevel level
+);
+
+// Sets output_bitset to the rows where Op(left row, right row) holds, for dense columns with the same row count
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_comparison<Op>
+void simd_compare(const Column& left, const Column& right, util::BitSet& output_bitset, SimdLevel level);
+
+// Op.apply(row, value) for each row of the dense column, or Op.apply(value, row) if arguments_reversed
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_arithmetic<Op, T>
+std::unique_ptr<Column> simd_apply(const Column& column, T value, bool arguments_reversed, SimdLevel level);
+
+// Op.apply(left row, right row) for dense columns with the same row count
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_arithmetic<Op, T>
+std::unique_ptr<Column> simd_apply(const Column& left, const Column& right, SimdLevel level);
+
+/*
+ * The kernels on contiguous rows, for callers that stage their own inputs. simd_compare_words compares num_words * 64
+ * rows of left with right, or with value if right is null, into packed words. simd_apply_run writes count results
+ * to out. arguments_reversed puts value on the left and requires right to be null.
+ */
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_comparison<Op>
+void simd_compare_words(
+        const T* left, const T* right, T value, bool arguments_reversed, size_t num_words, uint64_t* words,
+        SimdLevel level
+);
+
+template<typename T, typename Op>
+requires is_simd_kernel_type<T> && is_simd_kernel_arithmetic<Op, T>
+void simd_apply_run(
+        const T* left, const T* right, T value, bool arguments_reversed, T* out, size_t count, SimdLevel level
+);
+
+} // namespace arcticdb
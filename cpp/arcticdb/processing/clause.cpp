@@ -16,11 +16,13 @@
 #include <arcticdb/stream/merge.hpp>
 
 #include <arcticdb/processing/clause.hpp>
+#include <arcticdb/processing/group_hash_table.hpp>
 
 #include <arcticdb/pipeline/column_name_resolution.hpp>
 #include <arcticdb/pipeline/column_stats.hpp>
 #include <arcticdb/pipeline/frame_slice.hpp>
 #include <arcticdb/pipeline/query.hpp>
+#include <arcticdb/pipeline/zone_maps.hpp>
 #include <arcticdb/util/test/random_throw.hpp>
 #include <ankerl/unordered_dense.h>
 #include <arcticdb/util/movable_priority_queue.hpp>
@@ -42,38 +44,52 @@ using namespace pipelines;
 
 class GroupingMap {
     using NumericMapType = std::variant<
-            std::monostate, std::shared_ptr<ankerl::unordered_dense::map<bool, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<uint8_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<uint16_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<uint32_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<uint64_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<int8_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<int16_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<int32_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<int64_t, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<float, size_t>>,
-            std::shared_ptr<ankerl::unordered_dense::map<double, size_t>>>;
+            std::monostate, std::shared_ptr<GroupHashTable<bool>>, std::shared_ptr<GroupHashTable<uint8_t>>,
+            std::shared_ptr<GroupHashTable<uint16_t>>, std::shared_ptr<GroupHashTable<uint32_t>>,
+            std::shared_ptr<GroupHashTable<uint64_t>>, std::shared_ptr<GroupHashTable<int8_t>>,
+            std::shared_ptr<GroupHashTable<int16_t>>, std::shared_ptr<GroupHashTable<int32_t>>,
+            std::shared_ptr<GroupHashTable<int64_t>>, std::shared_ptr<GroupHashTable<float>>,
+            std::shared_ptr<GroupHashTable<double>>>;
 
     NumericMapType map_;
 
   public:
     size_t size() const {
         return util::variant_match(
-                map_, [](const std::monostate&) { return size_t(0); }, [](const auto& other) { return other->size(); }
+                map_,
+                [](const std::monostate&) { return size_t(0); },
+                [](const auto& other) { return other->keys().size(); }
+        );
+    }
+
+    // Including any group reserved for missing values
+    size_t num_groups() const {
+        return util::variant_match(
+                map_,
+                [](const std::monostate&) { return size_t(0); },
+                [](const auto& other) { return other->num_groups(); }
+        );
+    }
+
+    bool has_reserved_group() const {
+        return util::variant_match(
+                map_,
+                [](const std::monostate&) { return false; },
+                [](const auto& other) { return other->has_reserved_group(); }
         );
     }
 
     template<typename T>
-    std::shared_ptr<ankerl::unordered_dense::map<T, size_t>> get() {
+    std::shared_ptr<GroupHashTable<T>> get() {
         ARCTICDB_DEBUG_THROW(5)
         return util::variant_match(
                 map_,
                 [that = this](const std::monostate&) {
-                    that->map_ = std::make_shared<ankerl::unordered_dense::map<T, size_t>>();
-                    return std::get<std::shared_ptr<ankerl::unordered_dense::map<T, size_t>>>(that->map_);
+                    that->map_ = std::make_shared<GroupHashTable<T>>();
+                    return std::get<std::shared_ptr<GroupHashTable<T>>>(that->map_);
                 },
-                [](const std::shared_ptr<ankerl::unordered_dense::map<T, size_t>>& ptr) { return ptr; },
-                [](const auto&) -> std::shared_ptr<ankerl::unordered_dense::map<T, size_t>> {
+                [](const std::shared_ptr<GroupHashTable<T>>& ptr) { return ptr; },
+                [](const auto&) -> std::shared_ptr<GroupHashTable<T>> {
                     schema::raise<ErrorCode::E_UNSUPPORTED_COLUMN_TYPE>(
                             "GroupBy does not support the grouping column type changing with dynamic schema"
                     );
@@ -82,6 +98,108 @@ class GroupingMap {
     }
 };
 
+namespace {
+
+/*
+ * The group of each row of col, adding groups to grouping_map for values not seen before. The rows of sparse columns
+ * without a value are in group 0, which is reserved for them. String columns are grouped by their offsets in
+ * string_pool, the string pool of the output.
+ */
+std::vector<size_t> group_rows(const ColumnWithStrings& col, GroupingMap& grouping_map, StringPool& string_pool) {
+    // Initialised to zero, the missing value group of the rows of sparse columns without a value
+    std::vector<size_t> row_to_group(col.column_->last_row() + 1, 0);
+    details::visit_type(col.column_->type().data_type(), [&](auto data_type_tag) {
+        using col_type_info = ScalarTypeInfo<decltype(data_type_tag)>;
+        using RawType = typename col_type_info::RawType;
+        auto hash_to_group = grouping_map.get<RawType>();
+        // String grouping columns are grouped by offsets in the output string pool. Each distinct offset in this column
+        // is given a local group, and only looked up in the string pools when first seen
+        GroupHashTable<RawType> offset_to_local_group;
+        std::vector<size_t> local_to_group;
+        const auto add_new_offsets = [&]() {
+            if constexpr (is_sequence_type(col_type_info::data_type)) {
+                const auto& offsets = offset_to_local_group.keys();
+                for (auto idx = local_to_group.size(); idx < offsets.size(); ++idx) {
+                    RawType val = offsets[idx];
+                    if (std::optional<std::string_view> str = col.string_at_offset(val); str.has_value()) {
+                        val = string_pool.get(*str, true).offset();
+                    }
+                    local_to_group.emplace_back(hash_to_group->find_or_insert(val));
+                }
+            }
+        };
+
+        if (col.column_->is_sparse()) {
+            if (hash_to_group->num_groups() == 0) {
+                // We use 0 for the missing value group id
+                hash_to_group->reserve_group();
+            }
+            arcticdb::for_each_enumerated<typename col_type_info::TDT>(
+                    *col.column_,
+                    [&] ARCTICDB_LAMBDA_INLINE(auto enumerating_it) {
+                        if constexpr (is_sequence_type(col_type_info::data_type)) {
+                            const auto local_group = offset_to_local_group.find_or_insert(enumerating_it.value());
+                            add_new_offsets();
+                            row_to_group[enumerating_it.idx()] = local_to_group[local_group];
+                        } else {
+                            row_to_group[enumerating_it.idx()] = hash_to_group->find_or_insert(enumerating_it.value());
+                        }
+                    }
+            );
+        } else {
+            // Whole blocks at a time, so that the keys are hashed in batches
+            size_t row = 0;
+            auto column_data = col.column_->data();
+            while (auto block = column_data.template next<typename col_type_info::TDT>()) {
+                const auto block_rows = block->row_count();
+                auto groups = row_to_group.data() + row;
+                if constexpr (is_sequence_type(col_type_info::data_type)) {
+                    offset_to_local_group.find_or_insert(block->data(), block_rows, groups);
+                    add_new_offsets();
+                    for (size_t idx = 0; idx < block_rows; ++idx) {
+                        groups[idx] = local_to_group[groups[idx]];
+                    }
+                } else {
+                    hash_to_group->find_or_insert(block->data(), block_rows, groups);
+                }
+                row += block_rows;
+            }
+        }
+    });
+    return row_to_group;
+}
+
+/*
+ * Replaces the group of each row in row_to_group, that of its values in the grouping columns so far, with the group of
+ * the pair of it and the group of the row in the next grouping column, key_groups. The pairs are packed into 64 bits
+ * and numbered by pair_to_group, so that composite keys are grouped a column at a time. Rows in a reserved group of
+ * either are missing a value, and go in the reserved group of pair_to_group.
+ */
+void combine_groups(
+        std::vector<size_t>& row_to_group, bool previous_reserved, const std::vector<size_t>& key_groups,
+        bool key_reserved, GroupHashTable<uint64_t>& pair_to_group
+) {
+    std::vector<uint64_t> pairs(row_to_group.size());
+    bool any_missing = false;
+    for (size_t row = 0; row < row_to_group.size(); ++row) {
+        pairs[row] = (static_cast<uint64_t>(row_to_group[row]) << 32) | key_groups[row];
+        any_missing |= (previous_reserved && row_to_group[row] == 0) || (key_reserved && key_groups[row] == 0);
+    }
+    if (!any_missing) {
+        pair_to_group.find_or_insert(pairs.data(), pairs.size(), row_to_group.data());
+        return;
+    }
+    internal::check<ErrorCode::E_ASSERTION_FAILURE>(
+            pair_to_group.has_reserved_group(), "Rows missing a grouping value but no group reserved for them"
+    );
+    for (size_t row = 0; row < row_to_group.size(); ++row) {
+        const bool missing = (previous_reserved && row_to_group[row] == 0) || (key_reserved && key_groups[row] == 0);
+        row_to_group[row] = missing ? 0 : pair_to_group.find_or_insert(pairs[row]);
+    }
+}
+
+} // namespace
+
 struct SegmentWrapper {
     SegmentInMemory seg_;
     SegmentInMemory::iterator it_;
@@ -118,9 +236,8 @@ std::vector<EntityId> FilterClause::process(std::vector<EntityId>&& entity_ids)
     auto proc = gather_entities<std::shared_ptr<SegmentInMemory>, std::shared_ptr<RowRange>, std::shared_ptr<ColRange>>(
             *component_manager_, std::move(entity_ids)
     );
-    proc.set_expression_context(expression_context_);
     ARCTICDB_RUNTIME_DEBUG(log::memory(), "Doing filter {} for entity ids {}", root_node_name_, entity_ids);
-    auto variant_data = proc.get(root_node_name_);
+    auto variant_data = evaluate(proc);
     std::vector<EntityId> output;
     util::variant_match(
             variant_data,
@@ -139,6 +256,12 @@ std::vector<EntityId> FilterClause::process(std::vector<EntityId>&& entity_ids)
     return output;
 }
 
+VariantData FilterClause::evaluate(ProcessingUnit& proc) const {
+    proc.set_expression_context(expression_context_);
+    auto zone_map_result = filter_with_zone_maps(proc, root_node_name_, clause_info_.input_columns_);
+    return zone_map_result.has_value() ? std::move(*zone_map_result) : proc.get(root_node_name_);
+}
+
 OutputSchema FilterClause::modify_schema(OutputSchema&& output_schema) const {
     check_column_presence(output_schema, *clause_info_.input_columns_, "Filter");
     auto root_expr = expression_context_->expression_nodes_.get_value(root_node_name_.value);
@@ -280,13 +403,28 @@ void ProjectClause::add_column(ProcessingUnit& proc, const ColumnWithStrings& co
 AggregationClause::AggregationClause(
         const std::string& grouping_column, const std::vector<NamedAggregator>& named_aggregators
 ) :
-    grouping_column_(grouping_column) {
+    AggregationClause(std::vector<std::string>{grouping_column}, named_aggregators) {}
+
+AggregationClause::AggregationClause(
+        const std::vector<std::string>& grouping_columns, const std::vector<NamedAggregator>& named_aggregators
+) :
+    grouping_columns_(grouping_columns) {
     ARCTICDB_DEBUG_THROW(5)
 
     clause_info_.input_structure_ = ProcessingStructure::HASH_BUCKETED;
     clause_info_.can_combine_with_column_selection_ = false;
-    clause_info_.index_ = NewIndex(grouping_column_);
-    clause_info_.input_columns_ = std::make_optional<std::unordered_set<std::string>>({grouping_column_});
+    clause_info_.input_columns_ =
+            std::make_optional<std::unordered_set<std::string>>(grouping_columns_.begin(), grouping_columns_.end());
+    user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+            !grouping_columns_.empty() && clause_info_.input_columns_->size() == grouping_columns_.size(),
+            "Aggregation requires one or more distinct grouping columns"
+    );
+    // The first grouping column is the index, and those after it are the levels of a multi-index
+    NewIndex new_index{grouping_columns_.front()};
+    for (const auto& grouping_column : grouping_columns_ | std::views::drop(1)) {
+        new_index.emplace_back(stream::mangled_name(grouping_column));
+    }
+    clause_info_.index_ = std::move(new_index);
     str_ = "AGGREGATE {";
     for (const auto& named_aggregator : named_aggregators) {
         str_.append(fmt::format(
@@ -398,141 +536,142 @@ std::vector<EntityId> AggregationClause::process(std::vector<EntityId>&& entity_
         }
     }
 
+    const auto num_keys = grouping_columns_.size();
     size_t num_unique{0};
-    size_t next_group_id{0};
     auto string_pool = std::make_shared<StringPool>();
-    DataType grouping_data_type;
-    GroupingMap grouping_map;
+    std::vector<DataType> grouping_data_types(num_keys);
+    // The values of each grouping column, numbered by group
+    std::vector<GroupingMap> grouping_maps(num_keys);
+    // With several grouping columns, pair_tables[idx] numbers the pairs of the group of a row in the grouping columns
+    // up to idx, and its group in grouping column idx + 1. The groups of the last are the groups of the composite keys
+    std::vector<GroupHashTable<uint64_t>> pair_tables(num_keys - 1);
     // Iterating backwards as we are going to erase from this vector as we go along
     // This is to spread out deallocation of the input segments
     auto it = row_slices.rbegin();
     while (it != row_slices.rend()) {
         auto& row_slice = *it;
-        auto partitioning_column = row_slice.get(ColumnName(grouping_column_));
-        if (std::holds_alternative<ColumnWithStrings>(partitioning_column)) {
-            ColumnWithStrings col = std::get<ColumnWithStrings>(partitioning_column);
-            details::visit_type(col.column_->type().data_type(), [&, this](auto data_type_tag) {
-                using col_type_info = ScalarTypeInfo<decltype(data_type_tag)>;
-                grouping_data_type = col_type_info::data_type;
-                // Faster to initialise to zero (missing value group) and use raw ptr than repeated calls to
-                // emplace_back
-                std::vector<size_t> row_to_group(col.column_->last_row() + 1, 0);
-                size_t* row_to_group_ptr = row_to_group.data();
-                auto hash_to_group = grouping_map.get<typename col_type_info::RawType>();
-                // For string grouping columns, keep a local map within this ProcessingUnit
-                // from offsets to groups, to avoid needless calls to col.string_at_offset and
-                // string_pool->get
-                // This could be slower in cases where there aren't many repeats in string
-                // grouping columns. Maybe track hit ratio of finds and stop using it if it is
-                // too low?
-                // Tested with 100,000,000 row dataframe with 100,000 unique values in the grouping column. Timings:
-                // 11.14 seconds without caching
-                // 11.01 seconds with caching
-                // Not worth worrying about right now
-                ankerl::unordered_dense::map<typename col_type_info::RawType, size_t> offset_to_group;
-
-                const bool is_sparse = col.column_->is_sparse();
-                if (is_sparse && next_group_id == 0) {
-                    // We use 0 for the missing value group id
-                    ++next_group_id;
+        std::vector<std::vector<size_t>> key_groups;
+        bool any_sparse = false;
+        for (auto&& [key_idx, grouping_column] : folly::enumerate(grouping_columns_)) {
+            auto partitioning_column = row_slice.get(ColumnName(grouping_column));
+            if (!std::holds_alternative<ColumnWithStrings>(partitioning_column)) {
+                util::raise_rte("Expected single column from expression");
+            }
+            const auto& col = std::get<ColumnWithStrings>(partitioning_column);
+            grouping_data_types[key_idx] = col.column_->type().data_type();
+            any_sparse |= col.column_->is_sparse();
+            key_groups.emplace_back(group_rows(col, grouping_maps[key_idx], *string_pool));
+        }
+        auto row_to_group = std::move(key_groups.front());
+        if (num_keys == 1) {
+            num_unique = grouping_maps.front().num_groups();
+        } else {
+            // Rows beyond the last value of a sparse grouping column are missing a value in it
+            size_t num_rows = row_to_group.size();
+            for (const auto& groups : key_groups | std::views::drop(1)) {
+                num_rows = std::max(num_rows, groups.size());
+            }
+            row_to_group.resize(num_rows, 0);
+            for (size_t key_idx = 1; key_idx < num_keys; ++key_idx) {
+                auto& pair_table = pair_tables[key_idx - 1];
+                const auto previous_groups =
+                        key_idx == 1 ? grouping_maps.front().num_groups() : pair_tables[key_idx - 2].num_groups();
+                util::check(
+                        previous_groups <= std::numeric_limits<uint32_t>::max() &&
+                                grouping_maps[key_idx].num_groups() <= std::numeric_limits<uint32_t>::max(),
+                        "GroupBy supports at most {} groups per grouping column",
+                        std::numeric_limits<uint32_t>::max()
+                );
+                if (any_sparse && pair_table.num_groups() == 0) {
+                    pair_table.reserve_group();
                 }
-                ssize_t previous_value_index = 0;
-
-                arcticdb::for_each_enumerated<typename col_type_info::TDT>(
-                        *col.column_,
-                        [&] ARCTICDB_LAMBDA_INLINE(auto enumerating_it) {
-                            typename col_type_info::RawType val;
-                            if constexpr (is_sequence_type(col_type_info::data_type)) {
-                                auto offset = enumerating_it.value();
-                                if (auto it = offset_to_group.find(offset); it != offset_to_group.end()) {
-                                    val = it->second;
-                                } else {
-                                    std::optional<std::string_view> str = col.string_at_offset(offset);
-                                    if (str.has_value()) {
-                                        val = string_pool->get(*str, true).offset();
-                                    } else {
-                                        val = offset;
-                                    }
-                                    typename col_type_info::RawType val_copy(val);
-                                    offset_to_group.emplace(offset, val_copy);
-                                }
-                            } else {
-                                val = enumerating_it.value();
-                            }
-
-                            if (is_sparse) {
-                                for (auto j = previous_value_index; j != enumerating_it.idx(); ++j) {
-                                    static constexpr size_t missing_value_group_id = 0;
-                                    *row_to_group_ptr++ = missing_value_group_id;
-                                }
-                                previous_value_index = enumerating_it.idx() + 1;
-                            }
-
-                            if (auto it = hash_to_group->find(val); it == hash_to_group->end()) {
-                                *row_to_group_ptr++ = next_group_id;
-                                auto group_id = next_group_id++;
-                                hash_to_group->emplace(val, group_id);
-                            } else {
-                                *row_to_group_ptr++ = it->second;
-                            }
-                        }
+                key_groups[key_idx].resize(num_rows, 0);
+                combine_groups(
+                        row_to_group,
+                        key_idx == 1 ? grouping_maps.front().has_reserved_group()
+                                     : pair_tables[key_idx - 2].has_reserved_group(),
+                        key_groups[key_idx],
+                        grouping_maps[key_idx].has_reserved_group(),
+                        pair_table
                 );
-
-                num_unique = next_group_id;
-                util::check(num_unique != 0, "Got zero unique values");
-                for (auto agg_data : folly::enumerate(aggregators_data)) {
-                    auto input_column_name = aggregators_.at(agg_data.index).get_input_column_name();
-                    auto input_column = row_slice.get(input_column_name);
-                    std::optional<ColumnWithStrings> opt_input_column;
-                    if (std::holds_alternative<ColumnWithStrings>(input_column)) {
-                        auto column_with_strings = std::get<ColumnWithStrings>(input_column);
-                        // Empty columns don't contribute to aggregations
-                        if (!is_empty_type(column_with_strings.column_->type().data_type())) {
-                            opt_input_column.emplace(std::move(column_with_strings));
-                        }
-                    }
-                    if (opt_input_column) {
-                        // The column is missing from the segment. Do not perform any aggregation and leave it to
-                        // the NullValueReducer to take care of the default values.
-                        agg_data->aggregate(*opt_input_column, row_to_group, num_unique);
-                    }
+            }
+            num_unique = pair_tables.back().num_groups();
+        }
+        util::check(num_unique != 0, "Got zero unique values");
+        for (auto agg_data : folly::enumerate(aggregators_data)) {
+            auto input_column_name = aggregators_.at(agg_data.index).get_input_column_name();
+            auto input_column = row_slice.get(input_column_name);
+            std::optional<ColumnWithStrings> opt_input_column;
+            if (std::holds_alternative<ColumnWithStrings>(input_column)) {
+                auto column_with_strings = std::get<ColumnWithStrings>(input_column);
+                // Empty columns don't contribute to aggregations
+                if (!is_empty_type(column_with_strings.column_->type().data_type())) {
+                    opt_input_column.emplace(std::move(column_with_strings));
                 }
-            });
-        } else {
-            util::raise_rte("Expected single column from expression");
+            }
+            if (opt_input_column) {
+                // The column is missing from the segment. Do not perform any aggregation and leave it to
+                // the NullValueReducer to take care of the default values.
+                agg_data->aggregate(*opt_input_column, row_to_group, num_unique);
+            }
         }
         it = static_cast<decltype(row_slices)::reverse_iterator>((row_slices.erase(std::next(it).base())));
     }
-    SegmentInMemory seg;
-    auto index_col = std::make_shared<Column>(
-            make_scalar_type(grouping_data_type), grouping_map.size(), AllocationType::PRESIZED, Sparsity::NOT_PERMITTED
-    );
-
-    seg.add_column(scalar_field(grouping_data_type, grouping_column_), index_col);
-    seg.descriptor().set_index(IndexDescriptorImpl(IndexDescriptorImpl::Type::ROWCOUNT, 0));
 
-    details::visit_type(grouping_data_type, [&grouping_map, &index_col](auto data_type_tag) {
-        using col_type_info = ScalarTypeInfo<decltype(data_type_tag)>;
-        auto hashes = grouping_map.get<typename col_type_info::RawType>();
-        std::vector<std::pair<typename col_type_info::RawType, size_t>> elements;
-        for (const auto& hash : *hashes)
-            elements.emplace_back(hash.first, hash.second);
-
-        ranges::sort(
-                elements,
-                [](const std::pair<typename col_type_info::RawType, size_t>& l,
-                   const std::pair<typename col_type_info::RawType, size_t>& r) { return l.second < r.second; }
-        );
+    // The group of each output row in each grouping column, unpacked from the pairs of groups of the composite keys
+    std::vector<std::vector<size_t>> output_key_groups(num_keys);
+    if (num_keys > 1) {
+        const auto key_index = [](const auto& table, size_t group) {
+            return group - (table.num_groups() - table.keys().size());
+        };
+        const auto& composite_keys = pair_tables.back().keys();
+        for (auto& groups : output_key_groups) {
+            groups.resize(composite_keys.size());
+        }
+        for (size_t row = 0; row < composite_keys.size(); ++row) {
+            uint64_t pair = composite_keys[row];
+            for (auto key_idx = num_keys - 1; key_idx > 0; --key_idx) {
+                output_key_groups[key_idx][row] = pair & std::numeric_limits<uint32_t>::max();
+                const auto previous_group = pair >> 32;
+                if (key_idx > 1) {
+                    const auto& previous_table = pair_tables[key_idx - 2];
+                    pair = previous_table.keys()[key_index(previous_table, previous_group)];
+                } else {
+                    output_key_groups.front()[row] = previous_group;
+                }
+            }
+        }
+    }
+    const auto num_output_rows = num_keys == 1 ? grouping_maps.front().size() : pair_tables.back().keys().size();
 
-        auto column_data = index_col->data();
-        std::transform(
-                elements.cbegin(),
-                elements.cend(),
-                column_data.begin<typename col_type_info::TDT>(),
-                [](const auto& element) { return element.first; }
+    SegmentInMemory seg;
+    const auto& index_columns = std::get<NewIndex>(clause_info_.index_);
+    for (size_t key_idx = 0; key_idx < num_keys; ++key_idx) {
+        const auto grouping_data_type = grouping_data_types[key_idx];
+        auto index_col = std::make_shared<Column>(
+                make_scalar_type(grouping_data_type), num_output_rows, AllocationType::PRESIZED, Sparsity::NOT_PERMITTED
         );
-    });
-    index_col->set_row_data(grouping_map.size() - 1);
+        seg.add_column(scalar_field(grouping_data_type, index_columns[key_idx]), index_col);
+
+        details::visit_type(grouping_data_type, [&](auto data_type_tag) {
+            using col_type_info = ScalarTypeInfo<decltype(data_type_tag)>;
+            auto hash_to_group = grouping_maps[key_idx].get<typename col_type_info::RawType>();
+            // The keys are in group order already
+            const auto& keys = hash_to_group->keys();
+            auto column_data = index_col->data();
+            auto output_it = column_data.begin<typename col_type_info::TDT>();
+            if (num_keys == 1) {
+                std::copy(keys.cbegin(), keys.cend(), output_it);
+            } else {
+                const auto first_group = hash_to_group->num_groups() - keys.size();
+                for (auto group : output_key_groups[key_idx]) {
+                    *output_it++ = keys[group - first_group];
+                }
+            }
+        });
+        index_col->set_row_data(num_output_rows - 1);
+    }
+    seg.descriptor().set_index(IndexDescriptorImpl(IndexDescriptorImpl::Type::ROWCOUNT, 0));
 
     for (auto agg_data : folly::enumerate(aggregators_data)) {
         seg.concatenate(agg_data->finalize(
@@ -550,7 +689,11 @@ OutputSchema AggregationClause::modify_schema(OutputSchema&& output_schema) cons
     output_schema.clear_default_values();
     const auto& input_stream_desc = output_schema.stream_descriptor();
     StreamDescriptor stream_desc(input_stream_desc.id());
-    stream_desc.add_field(input_stream_desc.field(*input_stream_desc.find_field(grouping_column_)));
+    const auto& index_columns = std::get<NewIndex>(clause_info_.index_);
+    for (auto&& [key_idx, grouping_column] : folly::enumerate(grouping_columns_)) {
+        const auto& field = input_stream_desc.field(*input_stream_desc.find_field(grouping_column));
+        stream_desc.add_field(FieldRef{field.type(), index_columns[key_idx]});
+    }
     stream_desc.set_index({IndexDescriptorImpl::Type::ROWCOUNT, 0});
 
     for (const auto& agg : aggregators_) {
@@ -568,10 +711,7 @@ OutputSchema AggregationClause::modify_schema(OutputSchema&& output_schema) cons
     }
 
     output_schema.set_stream_descriptor(std::move(stream_desc));
-    auto mutable_index = output_schema.norm_metadata_.mutable_df()->mutable_common()->mutable_index();
-    mutable_index->set_name(grouping_column_);
-    mutable_index->clear_fake_name();
-    mutable_index->set_is_physically_stored(true);
+    set_new_index_norm_meta(index_columns, output_schema.norm_metadata_);
     return output_schema;
 }
 
@@ -878,6 +1018,7 @@ std::vector<EntityId> ColumnStatsGenerationClause::process(std::vector<EntityId>
                 new_entry->set_type(entry.type());
             }
         }
+        move_column_stats_strings(finalized, seg.string_pool_ptr());
         seg.concatenate(std::move(finalized));
     }
     google::protobuf::Any any;
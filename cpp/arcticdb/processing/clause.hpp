@@ -20,6 +20,7 @@
 #include <arcticdb/processing/sorted_aggregation.hpp>
 #include <arcticdb/stream/aggregator.hpp>
 #include <folly/Poly.h>
+#include <fmt/ranges.h>
 #include <arcticdb/pipeline/pipeline_common.hpp>
 #include <arcticdb/version/merge_options.hpp>
 #include <arcticdb/util/string_utils.hpp>
@@ -177,6 +178,9 @@ struct FilterClause {
 
     [[nodiscard]] std::vector<EntityId> process(std::vector<EntityId>&& entity_ids) const;
 
+    // The util::BitSet, EmptyResult or FullResult of the filter over the rows of proc
+    [[nodiscard]] VariantData evaluate(ProcessingUnit& proc) const;
+
     [[nodiscard]] const ClauseInfo& clause_info() const { return clause_info_; }
 
     void set_processing_config(const ProcessingConfig& processing_config) {
@@ -264,10 +268,19 @@ struct PartitionClause {
     ClauseInfo clause_info_;
     std::shared_ptr<ComponentManager> component_manager_;
     ProcessingConfig processing_config_;
-    std::string grouping_column_;
+    // Rows are grouped by the tuple of their values in these columns
+    std::vector<std::string> grouping_columns_;
+
+    explicit PartitionClause(const std::string& grouping_column) :
+        PartitionClause(std::vector<std::string>{grouping_column}) {}
 
-    explicit PartitionClause(const std::string& grouping_column) : grouping_column_(grouping_column) {
-        clause_info_.input_columns_ = {grouping_column_};
+    explicit PartitionClause(const std::vector<std::string>& grouping_columns) : grouping_columns_(grouping_columns) {
+        clause_info_.input_columns_ =
+                std::unordered_set<std::string>(grouping_columns_.begin(), grouping_columns_.end());
+        user_input::check<ErrorCode::E_INVALID_USER_ARGUMENT>(
+                !grouping_columns_.empty() && clause_info_.input_columns_->size() == grouping_columns_.size(),
+                "GroupBy requires one or more distinct grouping columns"
+        );
     }
     PartitionClause() = delete;
 
@@ -293,7 +306,7 @@ struct PartitionClause {
                         *component_manager_, std::move(entity_ids)
                 );
         std::vector<ProcessingUnit> partitioned_procs = partition_processing_segment<GrouperType, BucketizerType>(
-                proc, ColumnName(grouping_column_), processing_config_.dynamic_schema_
+                proc, grouping_columns_, processing_config_.dynamic_schema_
         );
         std::vector<EntityId> output;
         for (auto&& partitioned_proc : partitioned_procs) {
@@ -320,7 +333,12 @@ struct PartitionClause {
         util::raise_rte("GroupByClause::join_schemas should never be called");
     }
 
-    [[nodiscard]] std::string to_string() const { return fmt::format("GROUPBY Column[\"{}\"]", grouping_column_); }
+    [[nodiscard]] std::string to_string() const {
+        if (grouping_columns_.size() == 1) {
+            return fmt::format("GROUPBY Column[\"{}\"]", grouping_columns_.front());
+        }
+        return fmt::format("GROUPBY Columns[\"{}\"]", fmt::join(grouping_columns_, "\", \""));
+    }
 };
 
 struct NamedAggregator {
@@ -341,7 +359,7 @@ struct AggregationClause {
     ClauseInfo clause_info_;
     std::shared_ptr<ComponentManager> component_manager_;
     ProcessingConfig processing_config_;
-    std::string grouping_column_;
+    std::vector<std::string> grouping_columns_;
     std::vector<GroupingAggregator> aggregators_;
     std::string str_;
 
@@ -351,6 +369,11 @@ struct AggregationClause {
 
     AggregationClause(const std::string& grouping_column, const std::vector<NamedAggregator>& aggregations);
 
+    // The output is indexed by the grouping columns, as a multi-index when there are several
+    AggregationClause(
+            const std::vector<std::string>& grouping_columns, const std::vector<NamedAggregator>& aggregations
+    );
+
     [[noreturn]] std::vector<std::vector<size_t>> structure_for_processing(std::vector<RangesAndKey>&) {
         internal::raise<ErrorCode::E_ASSERTION_FAILURE>("AggregationClause should never be first in the pipeline");
     }
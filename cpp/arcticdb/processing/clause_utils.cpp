@@ -443,4 +443,21 @@ void check_is_timeseries(const StreamDescriptor& stream_descriptor, std::string_
     );
 }
 
+void set_new_index_norm_meta(const NewIndex& new_index, NormalizationMetadata& norm_meta) {
+    internal::check<ErrorCode::E_ASSERTION_FAILURE>(!new_index.empty(), "A new index needs at least one column");
+    auto common = norm_meta.mutable_df()->mutable_common();
+    if (new_index.size() == 1) {
+        auto mutable_index = common->mutable_index();
+        mutable_index->set_name(new_index.front());
+        mutable_index->clear_fake_name();
+        mutable_index->set_is_physically_stored(true);
+    } else {
+        // Levels after the first are read back from the columns following it, named with the multi-index prefix
+        auto mutable_multi_index = common->mutable_multi_index();
+        mutable_multi_index->Clear();
+        mutable_multi_index->set_name(new_index.front());
+        mutable_multi_index->set_field_count(static_cast<uint32_t>(new_index.size() - 1));
+    }
+}
+
 } // namespace arcticdb
\ No newline at end of file
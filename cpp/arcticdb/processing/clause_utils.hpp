@@ -37,7 +37,8 @@ enum class ProcessingStructure {
 
 struct KeepCurrentIndex {};
 struct KeepCurrentTopLevelIndex {};
-using NewIndex = std::string;
+// The names of the new index columns, which form a multi-index when there are several
+using NewIndex = std::vector<std::string>;
 
 // Contains constant data about the clause identifiable at construction time
 struct ClauseInfo {
@@ -52,7 +53,7 @@ struct ClauseInfo {
     std::optional<std::unordered_set<std::string>> input_columns_{std::nullopt};
     // KeepCurrentIndex if this clause does not modify the index in any way
     // KeepCurrentTopLevelIndex if this clause requires multi-index levels>0 to be dropped, but otherwise does not
-    // modify it NewIndex if this clause has changed the index to a new (supplied) name
+    // modify it NewIndex if this clause has changed the index to new (supplied) columns
     std::variant<KeepCurrentIndex, KeepCurrentTopLevelIndex, NewIndex> index_{KeepCurrentIndex()};
     // Whether this clause operates on one or multiple symbols
     bool multi_symbol_{false};
@@ -244,4 +245,7 @@ void check_column_presence(
 
 void check_is_timeseries(const StreamDescriptor& stream_descriptor, std::string_view clause_name);
 
+// Describes new_index in the pandas normalization metadata, as a multi-index if it has several columns
+void set_new_index_norm_meta(const NewIndex& new_index, proto::descriptors::NormalizationMetadata& norm_meta);
+
 } // namespace arcticdb
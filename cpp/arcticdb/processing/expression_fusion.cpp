@@ -0,0 +1,554 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/processing/expression_fusion.hpp>
+
+#include <arcticdb/entity/type_conversion.hpp>
+#include <arcticdb/log/log.hpp>
+#include <arcticdb/processing/binary_kernels.hpp>
+#include <arcticdb/processing/expression_context.hpp>
+#include <arcticdb/processing/operation_dispatch_binary.hpp>
+#include <arcticdb/processing/processing_unit.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/variant.hpp>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace arcticdb {
+
+namespace {
+
+constexpr size_t bits_per_word = 64;
+// Small enough that the buffers of every node of an expression stay in cache
+constexpr size_t fused_chunk_rows = 2048;
+constexpr size_t fused_chunk_words = fused_chunk_rows / bits_per_word;
+
+bool is_fused_arithmetic(OperationType operation) {
+    return operation == OperationType::ADD || operation == OperationType::SUB || operation == OperationType::MUL ||
+           operation == OperationType::DIV;
+}
+
+bool is_fused_comparison(OperationType operation) {
+    return operation == OperationType::EQ || operation == OperationType::NE || operation == OperationType::LT ||
+           operation == OperationType::LE || operation == OperationType::GT || operation == OperationType::GE;
+}
+
+template<typename F>
+void visit_fused_arithmetic(OperationType operation, F&& f) {
+    switch (operation) {
+    case OperationType::ADD:
+        f(PlusOperator{});
+        break;
+    case OperationType::SUB:
+        f(MinusOperator{});
+        break;
+    case OperationType::MUL:
+        f(TimesOperator{});
+        break;
+    case OperationType::DIV:
+        f(DivideOperator{});
+        break;
+    default:
+        internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unexpected operator {} in fused expression", operation);
+    }
+}
+
+template<typename F>
+void visit_fused_comparison(OperationType operation, F&& f) {
+    switch (operation) {
+    case OperationType::EQ:
+        f(EqualsOperator{});
+        break;
+    case OperationType::NE:
+        f(NotEqualsOperator{});
+        break;
+    case OperationType::LT:
+        f(LessThanOperator{});
+        break;
+    case OperationType::LE:
+        f(LessThanEqualsOperator{});
+        break;
+    case OperationType::GT:
+        f(GreaterThanOperator{});
+        break;
+    case OperationType::GE:
+        f(GreaterThanEqualsOperator{});
+        break;
+    default:
+        internal::raise<ErrorCode::E_ASSERTION_FAILURE>("Unexpected comparison {} in fused expression", operation);
+    }
+}
+
+bool is_fused_data_type(const TypeDescriptor& type) {
+    bool fused = false;
+    if (type.dimension() == Dimension::Dim0) {
+        details::visit_type(type.data_type(), [&fused](auto tag) {
+            using type_info = ScalarTypeInfo<decltype(tag)>;
+            fused = is_simd_kernel_type<typename type_info::RawType> && !is_time_type(type_info::data_type);
+        });
+    }
+    return fused;
+}
+
+/*
+ * The value of a comparison with a side of type T, if comparing in T gives the same result as binary_comparator, which
+ * compares the column in comp::left_type with the value in comp::right_type
+ */
+template<typename T, bool arguments_reversed>
+std::optional<T> comparison_value(const Value& val) {
+    std::optional<T> result;
+    details::visit_type(val.data_type(), [&result, &val](auto val_tag) {
+        using val_type_info = ScalarTypeInfo<decltype(val_tag)>;
+        if constexpr (is_numeric_type(val_type_info::data_type) && !is_time_type(val_type_info::data_type)) {
+            using ValType = typename val_type_info::RawType;
+            using comp = std::conditional_t<arguments_reversed, Comparable<ValType, T>, Comparable<T, ValType>>;
+            using CommonType = std::common_type_t<typename comp::left_type, typename comp::right_type>;
+            if constexpr (is_exact_conversion<T, typename comp::left_type> &&
+                          is_exact_conversion<typename comp::left_type, CommonType>) {
+                result = exactly_as<T>(static_cast<typename comp::right_type>(val.get<ValType>()));
+            }
+        }
+    });
+    return result;
+}
+
+// The value of an arithmetic operation with a side of type T, if binary_operator would give a result of type T too
+template<typename T, typename Op>
+std::optional<std::pair<T, std::string>> arithmetic_value(const Value& val) {
+    std::optional<std::pair<T, std::string>> result;
+    details::visit_type(val.data_type(), [&result, &val](auto val_tag) {
+        using val_type_info = ScalarTypeInfo<decltype(val_tag)>;
+        if constexpr (is_numeric_type(val_type_info::data_type) && !is_time_type(val_type_info::data_type)) {
+            using ValType = typename val_type_info::RawType;
+            if constexpr (std::is_same_v<typename binary_operation_promoted_type<T, ValType, Op>::type, T>) {
+                const auto raw_value = val.get<ValType>();
+                result.emplace(static_cast<T>(raw_value), fmt::format("{}", raw_value));
+            }
+        }
+    });
+    return result;
+}
+
+// An arithmetic expression over columns and values, before the type it is evaluated in is chosen
+struct TermPlan {
+    std::shared_ptr<Column> column_;
+    std::string column_name_;
+    std::shared_ptr<Value> value_;
+    OperationType operation_{OperationType::IDENTITY};
+    std::unique_ptr<TermPlan> left_;
+    std::unique_ptr<TermPlan> right_;
+};
+
+struct ComparisonPlan {
+    OperationType operation_;
+    std::unique_ptr<TermPlan> left_;
+    std::unique_ptr<TermPlan> right_;
+    DataType data_type_;
+};
+
+/*
+ * Walks an expression tree from the ExpressionContext of a ProcessingUnit, checking that it is a shape that is fused.
+ * The columns of each comparison, or of a projection, must share a data type, and all of them must be dense and have
+ * the same number of rows.
+ */
+class FusionPlanner {
+  public:
+    explicit FusionPlanner(ProcessingUnit& proc) : proc_(proc) {}
+
+    // Adds the comparisons of the conjunction rooted at node, returning false if it is not one
+    bool add_conjunction(const ExpressionNode& node) {
+        if (node.operation_type_ == OperationType::AND) {
+            const auto left = child_expression(node.left_);
+            const auto right = child_expression(node.right_);
+            ++operations_;
+            return left && right && add_conjunction(*left) && add_conjunction(*right);
+        }
+        if (!is_fused_comparison(node.operation_type_)) {
+            return false;
+        }
+        std::optional<DataType> data_type;
+        auto left = plan_term(node.left_, data_type);
+        if (!left) {
+            return false;
+        }
+        auto right = plan_term(node.right_, data_type);
+        if (!right || !data_type.has_value() || (left->value_ && right->value_)) {
+            return false;
+        }
+        ++operations_;
+        comparisons_.emplace_back(ComparisonPlan{node.operation_type_, std::move(left), std::move(right), *data_type});
+        return true;
+    }
+
+    // The arithmetic expression rooted at node, or nullptr if it is not one that is fused
+    std::unique_ptr<TermPlan> plan_operation(const ExpressionNode& node, std::optional<DataType>& data_type) {
+        if (!is_fused_arithmetic(node.operation_type_)) {
+            return nullptr;
+        }
+        auto left = plan_term(node.left_, data_type);
+        if (!left) {
+            return nullptr;
+        }
+        auto right = plan_term(node.right_, data_type);
+        if (!right || (left->value_ && right->value_)) {
+            return nullptr;
+        }
+        ++operations_;
+        auto term = std::make_unique<TermPlan>();
+        term->operation_ = node.operation_type_;
+        term->left_ = std::move(left);
+        term->right_ = std::move(right);
+        return term;
+    }
+
+    [[nodiscard]] std::vector<ComparisonPlan>& comparisons() { return comparisons_; }
+
+    [[nodiscard]] size_t operations() const { return operations_; }
+
+    [[nodiscard]] size_t row_count() const { return row_count_.value_or(0); }
+
+  private:
+    std::shared_ptr<ExpressionNode> child_expression(const VariantNode& node) const {
+        if (const auto* expression_name = std::get_if<ExpressionName>(&node)) {
+            return proc_.expression_context_->expression_nodes_.get_value(expression_name->value);
+        }
+        return nullptr;
+    }
+
+    std::unique_ptr<TermPlan> plan_term(const VariantNode& node, std::optional<DataType>& data_type) {
+        return util::variant_match(
+                node,
+                [&](const ColumnName& column_name) -> std::unique_ptr<TermPlan> {
+                    auto column = find_column(column_name.value);
+                    if (!column || column->is_sparse() || column->row_count() == 0 ||
+                        !is_fused_data_type(column->type()) ||
+                        (data_type.has_value() && *data_type != column->type().data_type()) ||
+                        (row_count_.has_value() && *row_count_ != static_cast<size_t>(column->row_count()))) {
+                        return nullptr;
+                    }
+                    data_type = column->type().data_type();
+                    row_count_ = static_cast<size_t>(column->row_count());
+                    auto term = std::make_unique<TermPlan>();
+                    term->column_ = std::move(column);
+                    term->column_name_ = column_name.value;
+                    return term;
+                },
+                [&](const ValueName& value_name) -> std::unique_ptr<TermPlan> {
+                    auto term = std::make_unique<TermPlan>();
+                    term->value_ = proc_.expression_context_->values_.get_value(value_name.value);
+                    return term;
+                },
+                [&](const ExpressionName& expression_name) -> std::unique_ptr<TermPlan> {
+                    const auto expression =
+                            proc_.expression_context_->expression_nodes_.get_value(expression_name.value);
+                    return plan_operation(*expression, data_type);
+                },
+                [](const auto&) -> std::unique_ptr<TermPlan> { return nullptr; }
+        );
+    }
+
+    // As ProcessingUnit::get finds columns, without building the string dictionaries it keeps for string columns
+    std::shared_ptr<Column> find_column(const std::string& name) const {
+        for (const auto& segment : *proc_.segments_) {
+            segment->init_column_map();
+            if (const auto idx = segment->column_index_with_name_demangling(name)) {
+                return segment->column_ptr(static_cast<position_t>(*idx));
+            }
+        }
+        return nullptr;
+    }
+
+    ProcessingUnit& proc_;
+    std::vector<ComparisonPlan> comparisons_;
+    std::optional<size_t> row_count_;
+    size_t operations_ = 0;
+};
+
+/*
+ * An arithmetic expression evaluated in T a chunk of rows at a time. A column gives pointers straight into its blocks
+ * where it can, and an operation writes to its own buffer unless given somewhere else to write.
+ */
+template<typename T>
+class TypedTerm {
+  public:
+    // nullptr if an operation in plan would not give a T
+    static std::unique_ptr<TypedTerm> make(const TermPlan& plan) {
+        auto term = std::make_unique<TypedTerm>();
+        if (plan.column_) {
+            term->column_ = plan.column_;
+            term->rows_.emplace(*plan.column_);
+            term->name_ = plan.column_name_;
+            return term;
+        }
+        term->operation_ = plan.operation_;
+        term->buffer_.resize(fused_chunk_rows);
+        bool valid = true;
+        visit_fused_arithmetic(plan.operation_, [&](auto func) {
+            using Op = decltype(func);
+            if constexpr (!is_simd_kernel_arithmetic<Op, T>) {
+                valid = false;
+            } else {
+                std::string left_name;
+                std::string right_name;
+                if (plan.left_->value_) {
+                    auto value = arithmetic_value<T, Op>(*plan.left_->value_);
+                    term->right_ = make(*plan.right_);
+                    valid = value.has_value() && term->right_;
+                    if (valid) {
+                        term->value_ = value->first;
+                        left_name = std::move(value->second);
+                        right_name = term->right_->name_;
+                    }
+                } else if (plan.right_->value_) {
+                    auto value = arithmetic_value<T, Op>(*plan.right_->value_);
+                    term->left_ = make(*plan.left_);
+                    valid = value.has_value() && term->left_;
+                    if (valid) {
+                        term->value_ = value->first;
+                        left_name = term->left_->name_;
+                        right_name = std::move(value->second);
+                    }
+                } else {
+                    term->left_ = make(*plan.left_);
+                    term->right_ = make(*plan.right_);
+                    valid = std::is_same_v<typename binary_operation_promoted_type<T, T, Op>::type, T> &&
+                            term->left_ && term->right_;
+                    if (valid) {
+                        left_name = term->left_->name_;
+                        right_name = term->right_->name_;
+                    }
+                }
+                if (valid) {
+                    term->name_ = binary_operation_column_name(left_name, func, right_name);
+                }
+            }
+        });
+        if (!valid) {
+            return nullptr;
+        }
+        return term;
+    }
+
+    /*
+     * The rows [row, row + count) of the term. The pointer is valid for padded_count rows, a multiple of 64 no more
+     * than fused_chunk_rows, as the comparisons read whole words. Results are written to out if it is not null.
+     */
+    const T* evaluate(size_t row, size_t count, size_t padded_count, T* out, SimdLevel level) {
+        if (rows_.has_value()) {
+            if (rows_->contiguous_rows(row) >= padded_count) {
+                return rows_->ptr(row);
+            }
+            buffer_.resize(fused_chunk_rows);
+            rows_->copy(row, count, buffer_.data());
+            return buffer_.data();
+        }
+        if (out == nullptr) {
+            out = buffer_.data();
+        }
+        const T* left = left_ ? left_->evaluate(row, count, padded_count, nullptr, level) : nullptr;
+        const T* right = right_ ? right_->evaluate(row, count, padded_count, nullptr, level) : nullptr;
+        visit_fused_arithmetic(operation_, [&](auto func) {
+            using Op = decltype(func);
+            if constexpr (is_simd_kernel_arithmetic<Op, T>) {
+                if (left == nullptr) {
+                    simd_apply_run<T, Op>(right, nullptr, *value_, true, out, count, level);
+                } else {
+                    simd_apply_run<T, Op>(left, right, value_.value_or(T{}), false, out, count, level);
+                }
+            }
+        });
+        return out;
+    }
+
+    [[nodiscard]] const std::string& name() const { return name_; }
+
+  private:
+    std::shared_ptr<Column> column_;
+    std::optional<DenseRows<T>> rows_;
+    OperationType operation_{OperationType::IDENTITY};
+    // The value side of an operation, if it has one
+    std::optional<T> value_;
+    std::unique_ptr<TypedTerm> left_;
+    std::unique_ptr<TypedTerm> right_;
+    std::vector<T> buffer_;
+    std::string name_;
+};
+
+class FusedPredicate {
+  public:
+    virtual ~FusedPredicate() = default;
+
+    // Sets padded_count / 64 words to the result of the comparison for rows [row, row + count)
+    virtual void evaluate(size_t row, size_t count, size_t padded_count, uint64_t* words, SimdLevel level) = 0;
+};
+
+template<typename T>
+class TypedPredicate final : public FusedPredicate {
+  public:
+    // nullptr if the comparison in T would not give the same result as binary_comparator
+    static std::unique_ptr<FusedPredicate> make(const ComparisonPlan& plan) {
+        auto predicate = std::make_unique<TypedPredicate>();
+        predicate->operation_ = plan.operation_;
+        if (plan.left_->value_) {
+            auto value = comparison_value<T, true>(*plan.left_->value_);
+            predicate->right_ = TypedTerm<T>::make(*plan.right_);
+            if (!value.has_value() || !predicate->right_) {
+                return nullptr;
+            }
+            predicate->value_ = *value;
+        } else if (plan.right_->value_) {
+            auto value = comparison_value<T, false>(*plan.right_->value_);
+            predicate->left_ = TypedTerm<T>::make(*plan.left_);
+            if (!value.has_value() || !predicate->left_) {
+                return nullptr;
+            }
+            predicate->value_ = *value;
+        } else {
+            predicate->left_ = TypedTerm<T>::make(*plan.left_);
+            predicate->right_ = TypedTerm<T>::make(*plan.right_);
+            if (!predicate->left_ || !predicate->right_) {
+                return nullptr;
+            }
+        }
+        return predicate;
+    }
+
+    void evaluate(size_t row, size_t count, size_t padded_count, uint64_t* words, SimdLevel level) override {
+        const T* left = left_ ? left_->evaluate(row, count, padded_count, nullptr, level) : nullptr;
+        const T* right = right_ ? right_->evaluate(row, count, padded_count, nullptr, level) : nullptr;
+        const auto num_words = padded_count / bits_per_word;
+        visit_fused_comparison(operation_, [&](auto func) {
+            using Op = decltype(func);
+            if (left == nullptr) {
+                simd_compare_words<T, Op>(right, nullptr, value_, true, num_words, words, level);
+            } else {
+                simd_compare_words<T, Op>(left, right, value_, false, num_words, words, level);
+            }
+        });
+    }
+
+  private:
+    OperationType operation_{OperationType::EQ};
+    std::unique_ptr<TypedTerm<T>> left_;
+    std::unique_ptr<TypedTerm<T>> right_;
+    T value_{};
+};
+
+std::unique_ptr<FusedPredicate> make_predicate(const ComparisonPlan& plan) {
+    std::unique_ptr<FusedPredicate> predicate;
+    details::visit_type(plan.data_type_, [&predicate, &plan](auto tag) {
+        using RawType = typename ScalarTypeInfo<decltype(tag)>::RawType;
+        if constexpr (is_simd_kernel_type<RawType>) {
+            predicate = TypedPredicate<RawType>::make(plan);
+        }
+    });
+    return predicate;
+}
+
+util::BitSet evaluate_conjunction(const std::vector<std::unique_ptr<FusedPredicate>>& predicates, size_t rows) {
+    const auto level = simd_level();
+    std::vector<uint64_t> words((rows + bits_per_word - 1) / bits_per_word, 0);
+    std::array<uint64_t, fused_chunk_words> predicate_words;
+    for (size_t row = 0; row < rows; row += fused_chunk_rows) {
+        const auto count = std::min(fused_chunk_rows, rows - row);
+        const auto num_words = (count + bits_per_word - 1) / bits_per_word;
+        auto* chunk_words = words.data() + row / bits_per_word;
+        predicates.front()->evaluate(row, count, num_words * bits_per_word, chunk_words, level);
+        for (auto it = std::next(predicates.begin()); it != predicates.end(); ++it) {
+            // Once every row of the chunk is ruled out the other comparisons cannot change it
+            if (std::all_of(chunk_words, chunk_words + num_words, [](uint64_t word) { return word == 0; })) {
+                break;
+            }
+            (*it)->evaluate(row, count, num_words * bits_per_word, predicate_words.data(), level);
+            for (size_t word = 0; word < num_words; ++word) {
+                chunk_words[word] &= predicate_words[word];
+            }
+        }
+    }
+    // The final word compared whatever was in the buffers past the last row
+    if (const auto tail = rows % bits_per_word; tail != 0) {
+        words.back() &= (uint64_t{1} << tail) - 1;
+    }
+    util::BitSet bitset;
+    packed_words_to_bitset(words.data(), rows, bitset);
+    return bitset;
+}
+
+template<typename T>
+ColumnWithStrings evaluate_projection(TypedTerm<T>& term, size_t rows) {
+    const auto level = simd_level();
+    auto output_column = std::make_unique<Column>(
+            make_scalar_type(data_type_from_raw_type<T>()), rows, AllocationType::PRESIZED, Sparsity::PERMITTED
+    );
+    auto* out = reinterpret_cast<T*>(output_column->ptr());
+    for (size_t row = 0; row < rows; row += fused_chunk_rows) {
+        const auto count = std::min(fused_chunk_rows, rows - row);
+        term.evaluate(row, count, count, out + row, level);
+    }
+    output_column->set_row_data(rows - 1);
+    return ColumnWithStrings(std::move(output_column), term.name());
+}
+
+std::optional<VariantData> compute_fused_conjunction(const ExpressionNode& node, ProcessingUnit& proc) {
+    FusionPlanner planner(proc);
+    if (!planner.add_conjunction(node) || planner.operations() < 2) {
+        return std::nullopt;
+    }
+    std::vector<std::unique_ptr<FusedPredicate>> predicates;
+    for (const auto& comparison : planner.comparisons()) {
+        auto predicate = make_predicate(comparison);
+        if (!predicate) {
+            return std::nullopt;
+        }
+        predicates.emplace_back(std::move(predicate));
+    }
+    ARCTICDB_DEBUG(log::version(), "Fused {} comparisons over {} rows", predicates.size(), planner.row_count());
+    return VariantData{evaluate_conjunction(predicates, planner.row_count())};
+}
+
+std::optional<VariantData> compute_fused_projection(const ExpressionNode& node, ProcessingUnit& proc) {
+    FusionPlanner planner(proc);
+    std::optional<DataType> data_type;
+    const auto plan = planner.plan_operation(node, data_type);
+    if (!plan || !data_type.has_value() || planner.operations() < 2) {
+        return std::nullopt;
+    }
+    std::optional<VariantData> result;
+    details::visit_type(*data_type, [&](auto tag) {
+        using RawType = typename ScalarTypeInfo<decltype(tag)>::RawType;
+        if constexpr (is_simd_kernel_type<RawType>) {
+            if (auto term = TypedTerm<RawType>::make(*plan)) {
+                ARCTICDB_DEBUG(
+                        log::version(), "Fused {} operations over {} rows", planner.operations(), planner.row_count()
+                );
+                result = VariantData{evaluate_projection(*term, planner.row_count())};
+            }
+        }
+    });
+    return result;
+}
+
+} // namespace
+
+std::optional<VariantData> compute_fused(const ExpressionNode& node, ProcessingUnit& proc) {
+    if (!proc.segments_.has_value() || !proc.expression_context_ ||
+        ConfigsMap::instance()->get_int("Processing.FuseExpressions", 1) == 0) {
+        return std::nullopt;
+    }
+    if (node.operation_type_ == OperationType::AND || is_fused_comparison(node.operation_type_)) {
+        return compute_fused_conjunction(node, proc);
+    }
+    if (is_fused_arithmetic(node.operation_type_)) {
+        return compute_fused_projection(node, proc);
+    }
+    return std::nullopt;
+}
+
+} // namespace arcticdb
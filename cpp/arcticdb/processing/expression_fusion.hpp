@@ -0,0 +1,34 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/processing/expression_node.hpp>
+
+#include <optional>
+
+namespace arcticdb {
+
+/*
+ * Expression fusion evaluates a whole expression tree in one pass over the rows, a chunk of rows at a time, instead of
+ * materialising a Column or util::BitSet for every node as ExpressionNode::compute does. The intermediate results of
+ * a chunk stay in small buffers that fit in cache, and the kernels of binary_kernels.hpp do the work.
+ *
+ * Two shapes are fused:
+ *  - Conjunctions: comparisons joined by AND, giving a util::BitSet. Once the rows of a chunk are all ruled out the
+ *    remaining comparisons are skipped for that chunk.
+ *  - Projections: +, -, * and / of columns and values, giving a new Column.
+ * The sides of each comparison, and projections, are arithmetic over dense columns of one numeric type, with every
+ * operation keeping that type, so that the results are exactly those of the interpreter. Anything else, or
+ * expressions with a single operation, is left to ExpressionNode::compute.
+ */
+
+// The result of node over the rows of proc, or std::nullopt if node is not fused and must be interpreted
+std::optional<VariantData> compute_fused(const ExpressionNode& node, ProcessingUnit& proc);
+
+} // namespace arcticdb
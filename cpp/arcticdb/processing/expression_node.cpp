@@ -7,12 +7,14 @@
  */
 
 #include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/processing/expression_fusion.hpp>
 #include <arcticdb/processing/expression_node.hpp>
 #include <arcticdb/processing/processing_unit.hpp>
 #include <arcticdb/processing/operation_types.hpp>
 #include <arcticdb/processing/operation_dispatch_binary.hpp>
 #include <arcticdb/processing/operation_dispatch_ternary.hpp>
 #include <arcticdb/processing/operation_dispatch_unary.hpp>
+#include <arcticdb/processing/short_circuit.hpp>
 #include <arcticdb/stream/index.hpp>
 
 namespace arcticdb {
@@ -95,6 +97,12 @@ ExpressionNode::ExpressionNode(VariantNode left, OperationType op) : left_(std::
 }
 
 VariantData ExpressionNode::compute(ProcessingUnit& seg) const {
+    if (auto fused = compute_fused(*this, seg)) {
+        return std::move(*fused);
+    }
+    if (operation_type_ == OperationType::AND || operation_type_ == OperationType::OR) {
+        return compute_short_circuit(*this, seg);
+    }
     if (is_ternary_operation(operation_type_)) {
         return dispatch_ternary(seg.get(condition_), seg.get(left_), seg.get(right_), operation_type_);
     } else if (is_binary_operation(operation_type_)) {
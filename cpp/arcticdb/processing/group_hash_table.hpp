@@ -0,0 +1,136 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/util/preconditions.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace arcticdb {
+
+// Mixes the bits of a grouping key, so that the high bits of the result depend on all of them (the murmur3 finaliser)
+template<typename T>
+inline uint64_t group_key_hash(T key) {
+    uint64_t bits;
+    if constexpr (std::is_same_v<T, float>) {
+        // 0.0 and -0.0 compare equal, so must hash equally
+        bits = std::bit_cast<uint32_t>(key == 0 ? 0.0f : key);
+    } else if constexpr (std::is_same_v<T, double>) {
+        bits = std::bit_cast<uint64_t>(key == 0 ? 0.0 : key);
+    } else {
+        bits = static_cast<uint64_t>(key);
+    }
+    bits ^= bits >> 33;
+    bits *= 0xff51afd7ed558ccdULL;
+    bits ^= bits >> 33;
+    bits *= 0xc4ceb9fe1a85ec53ULL;
+    bits ^= bits >> 33;
+    return bits;
+}
+
+/*
+ * Maps the keys of a groupby to dense group ids, numbered in the order the keys are first seen. An open addressing
+ * table with linear probing, whose slots hold the key alongside its group so that a lookup usually touches a single
+ * cache line. The slot is taken from the high bits of group_key_hash, which are independent of the low bits that
+ * HashingGroupers uses to partition the rows, so the keys of one partition still spread over the whole table.
+ *
+ * find_or_insert over many keys hashes them a batch at a time before probing, a loop the compiler vectorises, and which
+ * leaves the probes free to overlap their cache misses. As with operator==, every NaN key gets a group of its own.
+ */
+template<typename T>
+class GroupHashTable {
+  public:
+    static constexpr size_t batch_size = 256;
+
+    explicit GroupHashTable(size_t expected_groups = 0) {
+        rehash(std::bit_ceil(std::max<size_t>(expected_groups * 2, 16)));
+    }
+
+    // Reserves group 0 for rows without a key, so that keys are numbered from 1. Only valid while the table is empty.
+    void reserve_group() {
+        util::check(keys_.empty() && first_group_ == 0, "Can only reserve the first group of an empty GroupHashTable");
+        first_group_ = 1;
+    }
+
+    size_t find_or_insert(T key) { return find_or_insert_hashed(key, group_key_hash(key)); }
+
+    // Sets groups[idx] to the group of keys[idx] for idx in [0, count), adding groups for keys not seen before
+    void find_or_insert(const T* keys, size_t count, size_t* groups) {
+        std::array<uint64_t, batch_size> hashes;
+        for (size_t start = 0; start < count; start += batch_size) {
+            const auto rows = std::min(batch_size, count - start);
+            for (size_t idx = 0; idx < rows; ++idx) {
+                hashes[idx] = group_key_hash(keys[start + idx]);
+            }
+            for (size_t idx = 0; idx < rows; ++idx) {
+                groups[start + idx] = find_or_insert_hashed(keys[start + idx], hashes[idx]);
+            }
+        }
+    }
+
+    [[nodiscard]] bool has_reserved_group() const { return first_group_ != 0; }
+
+    // The number of groups, including any reserved group
+    [[nodiscard]] size_t num_groups() const { return first_group_ + keys_.size(); }
+
+    // The key of each group after any reserved group, in group order
+    [[nodiscard]] const std::vector<T>& keys() const { return keys_; }
+
+  private:
+    static constexpr size_t empty_slot = std::numeric_limits<size_t>::max();
+
+    struct Slot {
+        T key_;
+        size_t group_ = empty_slot;
+    };
+
+    size_t find_or_insert_hashed(T key, uint64_t hash) {
+        if ((keys_.size() + 1) * 2 > slots_.size()) {
+            rehash(slots_.size() * 2);
+        }
+        for (auto slot_idx = hash >> shift_;; slot_idx = (slot_idx + 1) & mask_) {
+            auto& slot = slots_[slot_idx];
+            if (slot.group_ == empty_slot) {
+                slot.key_ = key;
+                slot.group_ = num_groups();
+                keys_.emplace_back(key);
+                return slot.group_;
+            } else if (slot.key_ == key) {
+                return slot.group_;
+            }
+        }
+    }
+
+    void rehash(size_t num_slots) {
+        slots_.assign(num_slots, Slot{});
+        mask_ = num_slots - 1;
+        shift_ = 64 - std::countr_zero(num_slots);
+        for (size_t idx = 0; idx < keys_.size(); ++idx) {
+            auto slot_idx = group_key_hash(keys_[idx]) >> shift_;
+            while (slots_[slot_idx].group_ != empty_slot) {
+                slot_idx = (slot_idx + 1) & mask_;
+            }
+            slots_[slot_idx] = Slot{keys_[idx], first_group_ + idx};
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::vector<T> keys_;
+    size_t first_group_ = 0;
+    size_t mask_ = 0;
+    int shift_ = 0;
+};
+
+} // namespace arcticdb
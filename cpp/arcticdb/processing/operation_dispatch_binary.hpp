@@ -16,6 +16,7 @@
 #include <arcticdb/util/variant.hpp>
 #include <arcticdb/entity/types.hpp>
 #include <arcticdb/entity/type_utils.hpp>
+#include <arcticdb/processing/binary_kernels.hpp>
 #include <arcticdb/processing/operation_dispatch.hpp>
 #include <arcticdb/processing/expression_node.hpp>
 #include <arcticdb/entity/type_conversion.hpp>
@@ -240,6 +241,18 @@ VariantData binary_comparator(const ColumnWithStrings& left, const ColumnWithStr
                                  )) {
                 using comp = typename arcticdb::
                         Comparable<typename left_type_info::RawType, typename right_type_info::RawType>;
+                using LeftType = typename left_type_info::RawType;
+                if constexpr (std::is_same_v<LeftType, typename right_type_info::RawType> &&
+                              is_simd_kernel_type<LeftType> && is_simd_kernel_comparison<std::remove_cvref_t<Func>> &&
+                              !is_time_type(left_type_info::data_type) && !is_time_type(right_type_info::data_type)) {
+                    if (!left.column_->is_sparse() && !right.column_->is_sparse() &&
+                        left.column_->row_count() == right.column_->row_count()) {
+                        simd_compare<LeftType, std::remove_cvref_t<Func>>(
+                                *left.column_, *right.column_, output_bitset, simd_level()
+                        );
+                        return;
+                    }
+                }
                 arcticdb::transform<typename left_type_info::TDT, typename right_type_info::TDT>(
                         *left.column_,
                         *right.column_,
@@ -350,6 +363,26 @@ VariantData binary_comparator(const ColumnWithStrings& column_with_strings, cons
                                 return;
                             }
                         }
+                        using CommonType = std::common_type_t<typename comp::left_type, typename comp::right_type>;
+                        if constexpr (is_simd_kernel_type<ColType> &&
+                                      is_simd_kernel_comparison<std::remove_cvref_t<Func>> &&
+                                      !is_time_type(col_type_info::data_type) &&
+                                      is_exact_conversion<ColType, typename comp::left_type> &&
+                                      is_exact_conversion<typename comp::left_type, CommonType>) {
+                            // Rows convert exactly to the type they are compared in, so if the value does too then
+                            // comparing in ColType gives the same result
+                            if (auto kernel_value = exactly_as<ColType>(value);
+                                kernel_value.has_value() && !column_with_strings.column_->is_sparse()) {
+                                simd_compare<ColType, std::remove_cvref_t<Func>>(
+                                        *column_with_strings.column_,
+                                        *kernel_value,
+                                        arguments_reversed,
+                                        output_bitset,
+                                        simd_level()
+                                );
+                                return;
+                            }
+                        }
                         arcticdb::transform<typename col_type_info::TDT>(
                                 *column_with_strings.column_,
                                 output_bitset,
@@ -539,6 +572,18 @@ VariantData binary_operator(const ColumnWithStrings& left, const ColumnWithStrin
                     typename left_type_info::RawType,
                     typename right_type_info::RawType,
                     std::remove_reference_t<decltype(func)>>::type;
+            if constexpr (std::is_same_v<typename left_type_info::RawType, TargetType> &&
+                          std::is_same_v<typename right_type_info::RawType, TargetType> &&
+                          is_simd_kernel_type<TargetType> &&
+                          is_simd_kernel_arithmetic<std::remove_cvref_t<Func>, TargetType>) {
+                if (!left.column_->is_sparse() && !right.column_->is_sparse() &&
+                    left.column_->row_count() == right.column_->row_count()) {
+                    output_column = simd_apply<TargetType, std::remove_cvref_t<Func>>(
+                            *left.column_, *right.column_, simd_level()
+                    );
+                    return;
+                }
+            }
             constexpr auto output_data_type = data_type_from_raw_type<TargetType>();
             output_column = std::make_unique<Column>(make_scalar_type(output_data_type), Sparsity::PERMITTED);
             arcticdb::transform<
@@ -590,6 +635,23 @@ VariantData binary_operator(const ColumnWithStrings& col, const Value& val, Func
                     typename col_type_info::RawType,
                     typename val_type_info::RawType,
                     std::remove_reference_t<decltype(func)>>::type;
+            if constexpr (std::is_same_v<typename col_type_info::RawType, TargetType> &&
+                          is_simd_kernel_type<TargetType> &&
+                          is_simd_kernel_arithmetic<std::remove_cvref_t<Func>, TargetType>) {
+                if (!col.column_->is_sparse()) {
+                    column_name = arguments_reversed
+                                          ? binary_operation_column_name(
+                                                    fmt::format("{}", raw_value), func, col.column_name_
+                                            )
+                                          : binary_operation_column_name(
+                                                    col.column_name_, func, fmt::format("{}", raw_value)
+                                            );
+                    output_column = simd_apply<TargetType, std::remove_cvref_t<Func>>(
+                            *col.column_, static_cast<TargetType>(raw_value), arguments_reversed, simd_level()
+                    );
+                    return;
+                }
+            }
             if constexpr (arguments_reversed) {
                 column_name = binary_operation_column_name(fmt::format("{}", raw_value), func, col.column_name_);
                 constexpr auto output_data_type = data_type_from_raw_type<TargetType>();
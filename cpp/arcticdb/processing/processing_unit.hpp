@@ -157,6 +157,97 @@ std::pair<std::vector<bucket_id>, std::vector<uint64_t>> get_buckets(
     return {std::move(row_to_bucket), std::move(bucket_counts)};
 }
 
+/*
+ * As get_buckets, with rows grouped by the tuple of their values in several columns. The groups of the values of each
+ * row are combined into a single group, and rows without a group in any of the columns (missing, None or NaN) are in
+ * no bucket.
+ */
+template<typename GrouperType, typename Bucketizer>
+std::pair<std::vector<bucket_id>, std::vector<uint64_t>> get_composite_buckets(
+        const std::vector<ColumnWithStrings>& cols, const Bucketizer& bucketizer
+) {
+    size_t num_rows = 0;
+    for (const auto& col : cols) {
+        num_rows = std::max(num_rows, static_cast<size_t>(col.column_->last_row() + 1));
+    }
+    // The combined groups of the values of each row, and how many of its values have a group
+    std::vector<uint64_t> row_to_hash(num_rows, 0);
+    std::vector<uint32_t> row_to_grouped_values(num_rows, 0);
+    for (const auto& col : cols) {
+        details::visit_scalar(col.column_->type(), [&](auto type_desc_tag) {
+            using TDT = decltype(type_desc_tag);
+            if constexpr (!is_empty_type(TDT::DataTypeTag::data_type)) {
+                typename GrouperType::template Grouper<TDT> grouper;
+                arcticdb::for_each_enumerated<TDT>(*col.column_, [&] ARCTICDB_LAMBDA_INLINE(auto enumerating_it) {
+                    auto opt_group = grouper.group(enumerating_it.value(), col.string_pool_);
+                    if (ARCTICDB_LIKELY(opt_group.has_value())) {
+                        const auto row = enumerating_it.idx();
+                        // FNV-1a, whose top byte depends on every group combined
+                        row_to_hash[row] = (row_to_hash[row] ^ *opt_group) * 0x100000001b3ULL;
+                        ++row_to_grouped_values[row];
+                    }
+                });
+            }
+        });
+    }
+    std::vector<bucket_id> row_to_bucket(num_rows, std::numeric_limits<bucket_id>::max());
+    std::vector<uint64_t> bucket_counts(bucketizer.num_buckets(), 0);
+    for (size_t row = 0; row < num_rows; ++row) {
+        if (ARCTICDB_LIKELY(row_to_grouped_values[row] == cols.size())) {
+            auto bucket = bucketizer.bucket(static_cast<uint8_t>(row_to_hash[row] >> 56));
+            row_to_bucket[row] = bucket;
+            ++bucket_counts[bucket];
+        }
+    }
+    return {std::move(row_to_bucket), std::move(bucket_counts)};
+}
+
+inline bucket_id partition_num_buckets() {
+    auto num_buckets = ConfigsMap::instance()->get_int(
+            "Partition.NumBuckets", async::TaskScheduler::instance()->cpu_thread_count()
+    );
+    if (num_buckets > std::numeric_limits<bucket_id>::max()) {
+        log::version().warn(
+                "GroupBy partitioning buckets capped at {} (received {})",
+                std::numeric_limits<bucket_id>::max(),
+                num_buckets
+        );
+        num_buckets = std::numeric_limits<bucket_id>::max();
+    }
+    return static_cast<bucket_id>(num_buckets);
+}
+
+// Splits the rows of input into a ProcessingUnit per non-empty bucket
+inline std::vector<ProcessingUnit> partition_by_buckets(
+        ProcessingUnit& input, const std::vector<bucket_id>& row_to_bucket, const std::vector<uint64_t>& bucket_counts
+) {
+    std::vector<ProcessingUnit> procs(bucket_counts.size());
+    for (auto&& [input_idx, seg] : folly::enumerate(input.segments_.value())) {
+        auto new_segs = partition_segment(*seg, row_to_bucket, bucket_counts);
+        for (auto&& [output_idx, new_seg] : folly::enumerate(new_segs)) {
+            if (bucket_counts.at(output_idx) > 0) {
+                auto& proc = procs.at(output_idx);
+                if (!proc.segments_.has_value()) {
+                    proc.segments_ = std::make_optional<std::vector<std::shared_ptr<SegmentInMemory>>>();
+                    proc.row_ranges_ = std::make_optional<std::vector<std::shared_ptr<pipelines::RowRange>>>();
+                    proc.col_ranges_ = std::make_optional<std::vector<std::shared_ptr<pipelines::ColRange>>>();
+                }
+                proc.segments_->emplace_back(std::make_shared<SegmentInMemory>(std::move(new_seg)));
+                proc.row_ranges_->emplace_back(input.row_ranges_->at(input_idx));
+                proc.col_ranges_->emplace_back(input.col_ranges_->at(input_idx));
+            }
+        }
+    }
+    std::vector<ProcessingUnit> output;
+    for (auto&& [idx, proc] : folly::enumerate(procs)) {
+        if (bucket_counts.at(idx) > 0) {
+            proc.bucket_ = idx;
+            output.emplace_back(std::move(proc));
+        }
+    }
+    return output;
+}
+
 template<typename GrouperType, typename BucketizerType>
 std::vector<ProcessingUnit> partition_processing_segment(
         ProcessingUnit& input, const ColumnName& grouping_column_name, bool dynamic_schema
@@ -177,45 +268,9 @@ std::vector<ProcessingUnit> partition_processing_segment(
                     // Partitioning on an empty column should return an empty composite
                     if constexpr (!is_empty_type(TagType::data_type)) {
                         ResolvedGrouperType grouper;
-                        auto num_buckets = ConfigsMap::instance()->get_int(
-                                "Partition.NumBuckets", async::TaskScheduler::instance()->cpu_thread_count()
-                        );
-                        if (num_buckets > std::numeric_limits<bucket_id>::max()) {
-                            log::version().warn(
-                                    "GroupBy partitioning buckets capped at {} (received {})",
-                                    std::numeric_limits<bucket_id>::max(),
-                                    num_buckets
-                            );
-                            num_buckets = std::numeric_limits<bucket_id>::max();
-                        }
-                        std::vector<ProcessingUnit> procs{static_cast<bucket_id>(num_buckets)};
-                        BucketizerType bucketizer(num_buckets);
+                        BucketizerType bucketizer(partition_num_buckets());
                         auto [row_to_bucket, bucket_counts] = get_buckets(partitioning_column, grouper, bucketizer);
-                        for (auto&& [input_idx, seg] : folly::enumerate(input.segments_.value())) {
-                            auto new_segs = partition_segment(*seg, row_to_bucket, bucket_counts);
-                            for (auto&& [output_idx, new_seg] : folly::enumerate(new_segs)) {
-                                if (bucket_counts.at(output_idx) > 0) {
-                                    auto& proc = procs.at(output_idx);
-                                    if (!proc.segments_.has_value()) {
-                                        proc.segments_ =
-                                                std::make_optional<std::vector<std::shared_ptr<SegmentInMemory>>>();
-                                        proc.row_ranges_ =
-                                                std::make_optional<std::vector<std::shared_ptr<pipelines::RowRange>>>();
-                                        proc.col_ranges_ =
-                                                std::make_optional<std::vector<std::shared_ptr<pipelines::ColRange>>>();
-                                    }
-                                    proc.segments_->emplace_back(std::make_shared<SegmentInMemory>(std::move(new_seg)));
-                                    proc.row_ranges_->emplace_back(input.row_ranges_->at(input_idx));
-                                    proc.col_ranges_->emplace_back(input.col_ranges_->at(input_idx));
-                                }
-                            }
-                        }
-                        for (auto&& [idx, proc] : folly::enumerate(procs)) {
-                            if (bucket_counts.at(idx) > 0) {
-                                proc.bucket_ = idx;
-                                output.emplace_back(std::move(proc));
-                            }
-                        }
+                        output = partition_by_buckets(input, row_to_bucket, bucket_counts);
                     }
                 }
         );
@@ -227,4 +282,31 @@ std::vector<ProcessingUnit> partition_processing_segment(
     return output;
 }
 
+// Partitions by the tuple of values in several grouping columns, so that equal tuples share a bucket
+template<typename GrouperType, typename BucketizerType>
+std::vector<ProcessingUnit> partition_processing_segment(
+        ProcessingUnit& input, const std::vector<std::string>& grouping_column_names, bool dynamic_schema
+) {
+    if (grouping_column_names.size() == 1) {
+        return partition_processing_segment<GrouperType, BucketizerType>(
+                input, ColumnName(grouping_column_names.front()), dynamic_schema
+        );
+    }
+    std::vector<ColumnWithStrings> partitioning_columns;
+    for (const auto& grouping_column_name : grouping_column_names) {
+        auto get_result = input.get(ColumnName(grouping_column_name));
+        if (!std::holds_alternative<ColumnWithStrings>(get_result)) {
+            // No row has a value in every grouping column
+            internal::check<ErrorCode::E_ASSERTION_FAILURE>(
+                    dynamic_schema, "Grouping column missing from row-slice in static schema symbol"
+            );
+            return {};
+        }
+        partitioning_columns.emplace_back(std::get<ColumnWithStrings>(std::move(get_result)));
+    }
+    BucketizerType bucketizer(partition_num_buckets());
+    auto [row_to_bucket, bucket_counts] = get_composite_buckets<GrouperType>(partitioning_columns, bucketizer);
+    return partition_by_buckets(input, row_to_bucket, bucket_counts);
+}
+
 } // namespace arcticdb
\ No newline at end of file
@@ -0,0 +1,290 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/processing/short_circuit.hpp>
+
+#include <arcticdb/pipeline/zone_maps.hpp>
+#include <arcticdb/processing/expression_context.hpp>
+#include <arcticdb/processing/operation_dispatch.hpp>
+#include <arcticdb/processing/operation_dispatch_binary.hpp>
+#include <arcticdb/processing/processing_unit.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/variant.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+namespace arcticdb {
+
+namespace {
+
+// Without column stats, equality is assumed to be selective and ranges to keep a third of the rows
+double default_selectivity(OperationType operation) {
+    switch (operation) {
+    case OperationType::EQ:
+    case OperationType::REGEX_MATCH:
+    case OperationType::ISNULL:
+        return 0.1;
+    case OperationType::NE:
+    case OperationType::NOTNULL:
+        return 0.9;
+    case OperationType::ISIN:
+        return 0.2;
+    case OperationType::ISNOTIN:
+        return 0.8;
+    case OperationType::LT:
+    case OperationType::LE:
+    case OperationType::GT:
+    case OperationType::GE:
+        return 1.0 / 3;
+    default:
+        return 0.5;
+    }
+}
+
+double operation_cost(OperationType operation) {
+    switch (operation) {
+    case OperationType::REGEX_MATCH:
+        return 8;
+    case OperationType::ISIN:
+    case OperationType::ISNOTIN:
+    case OperationType::POW:
+    case OperationType::TERNARY:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+// The cost of computing the operands of a comparison, which are columns, values or arithmetic
+double operand_cost(const VariantNode& node, const ExpressionContext& expression_context) {
+    const auto* expression_name = std::get_if<ExpressionName>(&node);
+    if (expression_name == nullptr) {
+        return 0;
+    }
+    const auto expression_node = expression_context.expression_nodes_.get_value(expression_name->value);
+    return operation_cost(expression_node->operation_type_) +
+           operand_cost(expression_node->condition_, expression_context) +
+           operand_cost(expression_node->left_, expression_context) +
+           operand_cost(expression_node->right_, expression_context);
+}
+
+void collect_input_columns(
+        const VariantNode& node, const ExpressionContext& expression_context,
+        std::unordered_set<std::string>& input_columns
+) {
+    util::variant_match(
+            node,
+            [&input_columns](const ColumnName& column_name) { input_columns.emplace(column_name.value); },
+            [&](const ExpressionName& expression_name) {
+                const auto expression_node = expression_context.expression_nodes_.get_value(expression_name.value);
+                collect_input_columns(expression_node->condition_, expression_context, input_columns);
+                collect_input_columns(expression_node->left_, expression_context, input_columns);
+                collect_input_columns(expression_node->right_, expression_context, input_columns);
+            },
+            [](const auto&) {}
+    );
+}
+
+/*
+ * The result of node over the selected rows of proc, in the rows of proc, with the rows not selected unset. node is
+ * evaluated on copies of the selected rows of its input columns, sharing the string pools of the segments of proc.
+ * std::nullopt if node is not an expression, or if none of its input columns are in proc, which can happen with
+ * dynamic schema and is left to ProcessingUnit::get.
+ */
+std::optional<util::BitSet> compute_on_selected_rows(
+        const VariantNode& node, ProcessingUnit& proc, const util::BitSet& selection
+) {
+    const auto* expression_name = std::get_if<ExpressionName>(&node);
+    if (expression_name == nullptr) {
+        return std::nullopt;
+    }
+    std::vector<util::BitSetSizeType> rows;
+    rows.reserve(selection.count());
+    for (auto row = selection.first(); row != selection.end(); ++row) {
+        rows.emplace_back(*row);
+    }
+    util::BitSet output(selection.size());
+    if (rows.empty()) {
+        return output;
+    }
+
+    std::unordered_set<std::string> input_columns;
+    collect_input_columns(node, *proc.expression_context_, input_columns);
+    std::vector<std::shared_ptr<SegmentInMemory>> segments;
+    std::vector<std::shared_ptr<pipelines::RowRange>> row_ranges;
+    std::vector<std::shared_ptr<pipelines::ColRange>> col_ranges;
+    for (size_t idx = 0; idx < proc.segments_->size(); ++idx) {
+        const auto& segment = proc.segments_->at(idx);
+        // Found as ProcessingUnit::get finds them, so that the names of multi-index columns are demangled
+        std::vector<size_t> field_indices;
+        segment->init_column_map();
+        for (const auto& column_name : input_columns) {
+            if (auto field_idx = segment->column_index_with_name_demangling(column_name)) {
+                field_indices.emplace_back(*field_idx);
+            }
+        }
+        if (field_indices.empty()) {
+            continue;
+        }
+        std::ranges::sort(field_indices);
+        SegmentInMemory input_segment;
+        for (auto field_idx : field_indices) {
+            const auto column_idx = static_cast<position_t>(field_idx);
+            input_segment.add_column(segment->field(field_idx), segment->column_ptr(column_idx));
+        }
+        input_segment.set_string_pool(segment->string_pool_ptr());
+        input_segment.set_row_data(segment->row_count() - 1);
+        segments.emplace_back(std::make_shared<SegmentInMemory>(input_segment.filter(util::BitSet(selection))));
+        if (proc.row_ranges_ && proc.col_ranges_) {
+            const auto first_row = proc.row_ranges_->at(idx)->first;
+            row_ranges.emplace_back(std::make_shared<pipelines::RowRange>(first_row, first_row + rows.size()));
+            col_ranges.emplace_back(proc.col_ranges_->at(idx));
+        }
+    }
+    if (segments.empty()) {
+        return std::nullopt;
+    }
+    ProcessingUnit rows_proc;
+    rows_proc.set_segments(std::move(segments));
+    if (!row_ranges.empty()) {
+        rows_proc.set_row_ranges(std::move(row_ranges));
+        rows_proc.set_col_ranges(std::move(col_ranges));
+    }
+    rows_proc.set_expression_context(proc.expression_context_);
+    util::BitSet::bulk_insert_iterator inserter(output);
+    util::variant_match(
+            transform_to_bitset(rows_proc.get(*expression_name)),
+            [&](const util::BitSet& bitset) {
+                for (auto idx = bitset.first(); idx != bitset.end(); ++idx) {
+                    inserter = rows[*idx];
+                }
+            },
+            [&](FullResult) {
+                for (auto row : rows) {
+                    inserter = row;
+                }
+            },
+            [](EmptyResult) {},
+            [](const auto&) { util::raise_rte("Unexpected result of boolean operand on selected rows"); }
+    );
+    inserter.flush();
+    output.resize(selection.size());
+    return output;
+}
+
+} // namespace
+
+PredicateEstimate estimate_predicate(const VariantNode& node, ProcessingUnit& proc) {
+    const auto* expression_name = std::get_if<ExpressionName>(&node);
+    if (expression_name == nullptr) {
+        // A bool column
+        return {0.5, 1};
+    }
+    if (auto it = proc.computed_data_.find(expression_name->value); it != proc.computed_data_.end()) {
+        return util::variant_match(
+                it->second,
+                [](const util::BitSet& bitset) {
+                    return PredicateEstimate{
+                            bitset.size() > 0 ? static_cast<double>(bitset.count()) / bitset.size() : 0.0, 0
+                    };
+                },
+                [](FullResult) { return PredicateEstimate{1, 0}; },
+                [](EmptyResult) { return PredicateEstimate{0, 0}; },
+                [](const auto&) { return PredicateEstimate{0.5, 0}; }
+        );
+    }
+    const auto& expression_context = *proc.expression_context_;
+    const auto expression_node = expression_context.expression_nodes_.get_value(expression_name->value);
+    switch (expression_node->operation_type_) {
+    case OperationType::AND: {
+        const auto left = estimate_predicate(expression_node->left_, proc);
+        const auto right = estimate_predicate(expression_node->right_, proc);
+        return {left.selectivity_ * right.selectivity_, left.cost_ + left.selectivity_ * right.cost_};
+    }
+    case OperationType::OR: {
+        const auto left = estimate_predicate(expression_node->left_, proc);
+        const auto right = estimate_predicate(expression_node->right_, proc);
+        return {left.selectivity_ + right.selectivity_ - left.selectivity_ * right.selectivity_,
+                left.cost_ + (1 - left.selectivity_) * right.cost_};
+    }
+    case OperationType::XOR: {
+        const auto left = estimate_predicate(expression_node->left_, proc);
+        const auto right = estimate_predicate(expression_node->right_, proc);
+        return {left.selectivity_ + right.selectivity_ - 2 * left.selectivity_ * right.selectivity_,
+                left.cost_ + right.cost_};
+    }
+    case OperationType::NOT: {
+        const auto operand = estimate_predicate(expression_node->left_, proc);
+        return {1 - operand.selectivity_, operand.cost_};
+    }
+    case OperationType::IDENTITY:
+        return estimate_predicate(expression_node->left_, proc);
+    default: {
+        const auto selectivity = zone_map_selectivity(proc, *expression_name)
+                                         .value_or(default_selectivity(expression_node->operation_type_));
+        return {selectivity,
+                operation_cost(expression_node->operation_type_) +
+                        operand_cost(expression_node->condition_, expression_context) +
+                        operand_cost(expression_node->left_, expression_context) +
+                        operand_cost(expression_node->right_, expression_context)};
+    }
+    }
+}
+
+VariantData compute_short_circuit(const ExpressionNode& node, ProcessingUnit& proc) {
+    const auto operation = node.operation_type_;
+    util::check(
+            operation == OperationType::AND || operation == OperationType::OR,
+            "Unexpected operator {} in short-circuit evaluation",
+            operation
+    );
+    const bool is_and = operation == OperationType::AND;
+    // Evaluate first the child that decides the most rows for its cost: those it rules out for AND, those it matches
+    // for OR
+    const auto left = estimate_predicate(node.left_, proc);
+    const auto right = estimate_predicate(node.right_, proc);
+    const auto decided = [is_and](const PredicateEstimate& estimate) {
+        return (is_and ? 1 - estimate.selectivity_ : estimate.selectivity_) / std::max(estimate.cost_, 1e-3);
+    };
+    const bool right_first = decided(right) > decided(left);
+    const auto& first = right_first ? node.right_ : node.left_;
+    const auto& second = right_first ? node.left_ : node.right_;
+
+    auto first_result = transform_to_bitset(proc.get(first));
+    if (is_and && std::holds_alternative<EmptyResult>(first_result)) {
+        return EmptyResult{};
+    }
+    if (!is_and && std::holds_alternative<FullResult>(first_result)) {
+        return FullResult{};
+    }
+    if (const auto* bitset = std::get_if<util::BitSet>(&first_result); bitset != nullptr && bitset->size() > 0) {
+        const auto max_percent = ConfigsMap::instance()->get_int("Processing.SelectionVectorMaxPercent", 5);
+        const uint64_t undecided_rows = is_and ? bitset->count() : bitset->size() - bitset->count();
+        if (undecided_rows * 100 <= static_cast<uint64_t>(std::max<int64_t>(max_percent, 0)) * bitset->size()) {
+            util::BitSet selection;
+            if (is_and) {
+                selection = *bitset;
+            } else {
+                selection = ~*bitset;
+                selection.resize(bitset->size());
+            }
+            if (auto second_result = compute_on_selected_rows(second, proc, selection)) {
+                if (!is_and) {
+                    *second_result |= *bitset;
+                    second_result->resize(bitset->size());
+                }
+                return transform_to_placeholder(VariantData{std::move(*second_result)});
+            }
+        }
+    }
+    return visit_binary_boolean(first_result, proc.get(second), operation);
+}
+
+} // namespace arcticdb
@@ -0,0 +1,38 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/processing/expression_node.hpp>
+
+namespace arcticdb {
+
+/*
+ * Short-circuit evaluation of AND and OR. The child that is cheaper for the rows it decides is evaluated first, using
+ * estimates of the selectivity and cost of each child. Selectivities come from the zone maps of the segments when
+ * they decide anything, and otherwise from defaults for each operation.
+ *
+ * The second child is then skipped entirely if the first decides every row, and when the first leaves only a few rows
+ * undecided (those it matched for AND, those it did not match for OR), the second is evaluated on copies of just those
+ * rows of its input columns. The undecided rows form the selection vector, and Processing.SelectionVectorMaxPercent
+ * bounds its size as a percentage of the rows.
+ */
+
+// The result of node, an AND or an OR, over the rows of proc
+VariantData compute_short_circuit(const ExpressionNode& node, ProcessingUnit& proc);
+
+struct PredicateEstimate {
+    // The expected fraction of rows matched
+    double selectivity_;
+    // The expected work per row, in units of a simple comparison
+    double cost_;
+};
+
+PredicateEstimate estimate_predicate(const VariantNode& node, ProcessingUnit& proc);
+
+} // namespace arcticdb
@@ -6,7 +6,11 @@
  * will be governed by the Apache License, version 2.0.
  */
 #include <arcticdb/processing/test/benchmark_common.hpp>
+#include <arcticdb/processing/binary_kernels.hpp>
+#include <arcticdb/processing/expression_context.hpp>
 #include <arcticdb/processing/operation_dispatch_binary.hpp>
+#include <arcticdb/processing/processing_unit.hpp>
+#include <arcticdb/util/configs_map.hpp>
 #include <arcticdb/util/regex_filter.hpp>
 
 using namespace arcticdb;
@@ -28,4 +32,130 @@ BENCHMARK(BM_regex_match)
         ->Args({100'000, 1'000, true})
         ->Args({100'000, 1'000, false})
         ->Args({100'000, 10'000, true})
-        ->Args({100'000, 10'000, false});
\ No newline at end of file
+        ->Args({100'000, 10'000, false});
+
+template<typename T>
+static Column generate_kernel_column(size_t num_rows) {
+    Column column(
+            make_scalar_type(data_type_from_raw_type<T>()), num_rows, AllocationType::PRESIZED, Sparsity::NOT_PERMITTED
+    );
+    auto* data = reinterpret_cast<T*>(column.ptr());
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int32_t> dis(-1'000, 1'000);
+    for (size_t idx = 0; idx < num_rows; ++idx) {
+        data[idx] = static_cast<T>(dis(gen));
+    }
+    column.set_row_data(num_rows - 1);
+    return column;
+}
+
+// Args are the number of rows and the SimdLevel, which is skipped if this CPU does not support it
+template<typename T>
+static void BM_simd_compare_value(benchmark::State& state) {
+    const auto level = static_cast<SimdLevel>(state.range(1));
+    if (level > simd_level()) {
+        state.SkipWithError("SIMD level not supported");
+        return;
+    }
+    const auto column = generate_kernel_column<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        util::BitSet bitset;
+        simd_compare<T, LessThanOperator>(column, T{0}, false, bitset, level);
+        benchmark::DoNotOptimize(bitset);
+    }
+}
+
+template<typename T>
+static void BM_simd_compare_column(benchmark::State& state) {
+    const auto level = static_cast<SimdLevel>(state.range(1));
+    if (level > simd_level()) {
+        state.SkipWithError("SIMD level not supported");
+        return;
+    }
+    const auto left = generate_kernel_column<T>(static_cast<size_t>(state.range(0)));
+    const auto right = generate_kernel_column<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        util::BitSet bitset;
+        simd_compare<T, EqualsOperator>(left, right, bitset, level);
+        benchmark::DoNotOptimize(bitset);
+    }
+}
+
+template<typename T>
+static void BM_simd_apply_column(benchmark::State& state) {
+    const auto level = static_cast<SimdLevel>(state.range(1));
+    if (level > simd_level()) {
+        state.SkipWithError("SIMD level not supported");
+        return;
+    }
+    const auto left = generate_kernel_column<T>(static_cast<size_t>(state.range(0)));
+    const auto right = generate_kernel_column<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(simd_apply<T, PlusOperator>(left, right, level));
+    }
+}
+
+// The element by element path the kernels replace, for comparison
+static void BM_elementwise_compare_value(benchmark::State& state) {
+    const auto column = generate_kernel_column<int64_t>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        util::BitSet bitset;
+        arcticdb::transform<ScalarTagType<DataTypeTag<DataType::INT64>>>(
+                column, bitset, false, [](auto input_value) { return input_value < 0; }
+        );
+        benchmark::DoNotOptimize(bitset);
+    }
+}
+
+// (a > 0) & (b < 500.0) & (c != 0), with Processing.FuseExpressions as the second arg
+static void BM_fused_conjunction(benchmark::State& state) {
+    const auto num_rows = static_cast<size_t>(state.range(0));
+    ScopedConfig fusion("Processing.FuseExpressions", state.range(1));
+    SegmentInMemory seg;
+    seg.add_column(
+            scalar_field(DataType::INT64, "a"), std::make_shared<Column>(generate_kernel_column<int64_t>(num_rows))
+    );
+    seg.add_column(
+            scalar_field(DataType::FLOAT64, "b"), std::make_shared<Column>(generate_kernel_column<double>(num_rows))
+    );
+    seg.add_column(
+            scalar_field(DataType::INT64, "c"), std::make_shared<Column>(generate_kernel_column<int64_t>(num_rows))
+    );
+    seg.set_row_data(static_cast<ssize_t>(num_rows) - 1);
+    auto expression_context = std::make_shared<ExpressionContext>();
+    expression_context->add_value("zero", std::make_shared<Value>(int64_t{0}, DataType::INT64));
+    expression_context->add_value("five_hundred", std::make_shared<Value>(500.0, DataType::FLOAT64));
+    expression_context->add_expression_node(
+            "a", std::make_shared<ExpressionNode>(ColumnName("a"), ValueName("zero"), OperationType::GT)
+    );
+    expression_context->add_expression_node(
+            "b", std::make_shared<ExpressionNode>(ColumnName("b"), ValueName("five_hundred"), OperationType::LT)
+    );
+    expression_context->add_expression_node(
+            "c", std::make_shared<ExpressionNode>(ColumnName("c"), ValueName("zero"), OperationType::NE)
+    );
+    expression_context->add_expression_node(
+            "a_and_b", std::make_shared<ExpressionNode>(ExpressionName("a"), ExpressionName("b"), OperationType::AND)
+    );
+    expression_context->add_expression_node(
+            "root", std::make_shared<ExpressionNode>(ExpressionName("a_and_b"), ExpressionName("c"), OperationType::AND)
+    );
+    ProcessingUnit proc{std::move(seg)};
+    proc.set_expression_context(expression_context);
+    for (auto _ : state) {
+        proc.computed_data_.clear();
+        benchmark::DoNotOptimize(proc.get(ExpressionName("root")));
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_simd_compare_value, int32_t)->ArgsProduct({{1'000'000}, {0, 1, 2}});
+BENCHMARK_TEMPLATE(BM_simd_compare_value, int64_t)->ArgsProduct({{1'000'000}, {0, 1, 2}});
+BENCHMARK_TEMPLATE(BM_simd_compare_value, uint64_t)->ArgsProduct({{1'000'000}, {0, 1, 2}});
+BENCHMARK_TEMPLATE(BM_simd_compare_value, float)->ArgsProduct({{1'000'000}, {0, 1, 2}});
+BENCHMARK_TEMPLATE(BM_simd_compare_value, double)->ArgsProduct({{1'000'000}, {0, 1, 2}});
+BENCHMARK_TEMPLATE(BM_simd_compare_column, int64_t)->ArgsProduct({{1'000'000}, {0, 1, 2}});
+BENCHMARK_TEMPLATE(BM_simd_compare_column, double)->ArgsProduct({{1'000'000}, {0, 1, 2}});
+BENCHMARK_TEMPLATE(BM_simd_apply_column, int64_t)->ArgsProduct({{1'000'000}, {0, 1, 2}});
+BENCHMARK_TEMPLATE(BM_simd_apply_column, double)->ArgsProduct({{1'000'000}, {0, 1, 2}});
+BENCHMARK(BM_elementwise_compare_value)->Arg(1'000'000);
+BENCHMARK(BM_fused_conjunction)->Args({1'000'000, 0})->Args({1'000'000, 1});
@@ -9,10 +9,12 @@
 #include <random>
 
 #include <benchmark/benchmark.h>
+#include <ankerl/unordered_dense.h>
 
 #include <arcticdb/processing/clause.hpp>
 #include <arcticdb/util/test/generators.hpp>
 #include <arcticdb/processing/grouper.hpp>
+#include <arcticdb/processing/group_hash_table.hpp>
 
 using namespace arcticdb;
 
@@ -170,6 +172,54 @@ void BM_hash_grouping_string(benchmark::State& state) {
     }
 }
 
+// Maps keys with num_unique_values distinct values to groups with GroupHashTable, or with the ankerl map that
+// AggregationClause used before it if state.range(2) is 0
+void BM_group_keys(benchmark::State& state) {
+    const auto num_rows = static_cast<size_t>(state.range(0));
+    const auto num_unique_values = static_cast<int64_t>(state.range(1));
+    const bool use_group_hash_table = state.range(2) != 0;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int64_t> dis(0, num_unique_values - 1);
+    std::vector<int64_t> keys(num_rows);
+    for (auto& key : keys) {
+        // Spread over the whole range, as real keys such as timestamps or ids are
+        key = dis(gen) * 0x9E3779B97F4A7C15LL;
+    }
+    std::vector<size_t> groups(num_rows);
+    for (auto _ : state) {
+        if (use_group_hash_table) {
+            GroupHashTable<int64_t> table;
+            table.find_or_insert(keys.data(), num_rows, groups.data());
+            benchmark::DoNotOptimize(table.num_groups());
+        } else {
+            ankerl::unordered_dense::map<int64_t, size_t> map;
+            for (size_t idx = 0; idx < num_rows; ++idx) {
+                groups[idx] = map.try_emplace(keys[idx], map.size()).first->second;
+            }
+            benchmark::DoNotOptimize(map.size());
+        }
+        benchmark::DoNotOptimize(groups.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_rows));
+}
+
+// A sum groupby over one bucket of rows, as AggregationClause::process runs for each bucket in parallel
+void BM_aggregation_clause(benchmark::State& state) {
+    const auto num_rows = static_cast<size_t>(state.range(0));
+    const auto num_unique_values = static_cast<size_t>(state.range(1));
+    const auto segment = generate_groupby_testing_segment(num_rows, num_unique_values);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto component_manager = std::make_shared<ComponentManager>();
+        AggregationClause aggregation("int_repeated_values", {{"sum", "sum_int", "sum_int"}});
+        aggregation.set_component_manager(component_manager);
+        auto entity_ids = push_entities(*component_manager, ProcessingUnit{segment.clone()});
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(aggregation.process(std::move(entity_ids)));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_rows));
+}
+
 BENCHMARK(BM_merge_interleaved)->Args({10'000, 100});
 BENCHMARK(BM_merge_ordered)->Args({10'000, 100});
 
@@ -183,3 +233,7 @@ BENCHMARK(BM_hash_grouping_string)
         ->Args({100'000, 100'000, 2, 10})
         ->Args({100'000, 10, 2, 100})
         ->Args({100'000, 100'000, 2, 100});
+
+BENCHMARK(BM_group_keys)->ArgsProduct({{10'000'000}, {100, 1'000'000, 5'000'000}, {0, 1}});
+
+BENCHMARK(BM_aggregation_clause)->Args({10'000'000, 100})->Args({10'000'000, 1'000'000});
@@ -0,0 +1,204 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/processing/binary_kernels.hpp>
+#include <arcticdb/processing/operation_dispatch_binary.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace arcticdb;
+
+namespace {
+
+// Enough rows to span several blocks of a dynamically allocated column, and not a multiple of 64
+constexpr size_t num_rows = 10'007;
+
+template<typename T>
+std::vector<T> kernel_test_values(size_t offset) {
+    std::vector<T> values;
+    values.reserve(num_rows);
+    for (size_t idx = 0; idx < num_rows; ++idx) {
+        const auto value = static_cast<T>((idx * 7 + offset) % 101);
+        if constexpr (std::is_floating_point_v<T>) {
+            values.emplace_back(idx % 97 == 0 ? std::numeric_limits<T>::quiet_NaN() : value);
+        } else if constexpr (std::is_signed_v<T>) {
+            values.emplace_back(value - 50);
+        } else {
+            values.emplace_back(idx % 89 == 0 ? std::numeric_limits<T>::max() : value);
+        }
+    }
+    return values;
+}
+
+template<typename T>
+Column kernel_test_column(const std::vector<T>& values) {
+    Column column(make_scalar_type(data_type_from_raw_type<T>()), Sparsity::NOT_PERMITTED);
+    for (auto value : values) {
+        column.push_back<T>(value);
+    }
+    return column;
+}
+
+std::vector<SimdLevel> supported_levels() {
+    std::vector<SimdLevel> levels;
+    for (auto level : {SimdLevel::SCALAR, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (level <= simd_level()) {
+            levels.emplace_back(level);
+        }
+    }
+    return levels;
+}
+
+template<typename T, typename Op>
+void check_comparison(const std::vector<T>& left_values, const std::vector<T>& right_values) {
+    const auto left = kernel_test_column(left_values);
+    const auto right = kernel_test_column(right_values);
+    const auto value = left_values[5];
+    for (auto level : supported_levels()) {
+        util::BitSet value_bitset;
+        simd_compare<T, Op>(left, value, false, value_bitset, level);
+        util::BitSet reversed_bitset;
+        simd_compare<T, Op>(left, value, true, reversed_bitset, level);
+        util::BitSet column_bitset;
+        simd_compare<T, Op>(left, right, column_bitset, level);
+        ASSERT_EQ(value_bitset.size(), num_rows);
+        ASSERT_EQ(column_bitset.size(), num_rows);
+        for (size_t idx = 0; idx < num_rows; ++idx) {
+            const auto bit = static_cast<util::BitSetSizeType>(idx);
+            ASSERT_EQ(value_bitset.get_bit(bit), Op{}(left_values[idx], value)) << idx;
+            ASSERT_EQ(reversed_bitset.get_bit(bit), Op{}(value, left_values[idx])) << idx;
+            ASSERT_EQ(column_bitset.get_bit(bit), Op{}(left_values[idx], right_values[idx])) << idx;
+        }
+    }
+}
+
+template<typename T>
+void check_comparisons() {
+    const auto left_values = kernel_test_values<T>(0);
+    const auto right_values = kernel_test_values<T>(13);
+    check_comparison<T, EqualsOperator>(left_values, right_values);
+    check_comparison<T, NotEqualsOperator>(left_values, right_values);
+    check_comparison<T, LessThanOperator>(left_values, right_values);
+    check_comparison<T, LessThanEqualsOperator>(left_values, right_values);
+    check_comparison<T, GreaterThanOperator>(left_values, right_values);
+    check_comparison<T, GreaterThanEqualsOperator>(left_values, right_values);
+}
+
+template<typename T>
+bool same_result(T expected, T actual) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return (std::isnan(expected) && std::isnan(actual)) || expected == actual;
+    } else {
+        return expected == actual;
+    }
+}
+
+template<typename T, typename Op>
+void check_arithmetic(const std::vector<T>& left_values, const std::vector<T>& right_values) {
+    const auto left = kernel_test_column(left_values);
+    const auto right = kernel_test_column(right_values);
+    const auto value = static_cast<T>(3);
+    for (auto level : supported_levels()) {
+        const auto value_column = simd_apply<T, Op>(left, value, false, level);
+        const auto reversed_column = simd_apply<T, Op>(left, value, true, level);
+        const auto output_column = simd_apply<T, Op>(left, right, level);
+        ASSERT_EQ(value_column->row_count(), num_rows);
+        ASSERT_EQ(output_column->row_count(), num_rows);
+        for (size_t idx = 0; idx < num_rows; ++idx) {
+            const auto row = static_cast<ssize_t>(idx);
+            ASSERT_TRUE(same_result<T>(
+                    Op{}.template apply<T, T, T>(left_values[idx], value), *value_column->scalar_at<T>(row)
+            )) << idx;
+            ASSERT_TRUE(same_result<T>(
+                    Op{}.template apply<T, T, T>(value, left_values[idx]), *reversed_column->scalar_at<T>(row)
+            )) << idx;
+            ASSERT_TRUE(same_result<T>(
+                    Op{}.template apply<T, T, T>(left_values[idx], right_values[idx]),
+                    *output_column->scalar_at<T>(row)
+            )) << idx;
+        }
+    }
+}
+
+template<typename T>
+void check_arithmetics() {
+    const auto left_values = kernel_test_values<T>(0);
+    const auto right_values = kernel_test_values<T>(13);
+    check_arithmetic<T, PlusOperator>(left_values, right_values);
+    check_arithmetic<T, MinusOperator>(left_values, right_values);
+    check_arithmetic<T, TimesOperator>(left_values, right_values);
+    if constexpr (std::is_floating_point_v<T>) {
+        check_arithmetic<T, DivideOperator>(left_values, right_values);
+    }
+}
+
+} // namespace
+
+TEST(BinaryKernels, Comparisons) {
+    check_comparisons<int32_t>();
+    check_comparisons<int64_t>();
+    check_comparisons<uint32_t>();
+    check_comparisons<uint64_t>();
+    check_comparisons<float>();
+    check_comparisons<double>();
+}
+
+TEST(BinaryKernels, Arithmetic) {
+    check_arithmetics<int32_t>();
+    check_arithmetics<int64_t>();
+    check_arithmetics<uint32_t>();
+    check_arithmetics<uint64_t>();
+    check_arithmetics<float>();
+    check_arithmetics<double>();
+}
+
+TEST(BinaryKernels, EmptyColumn) {
+    const Column column(make_scalar_type(DataType::INT64), Sparsity::NOT_PERMITTED);
+    util::BitSet bitset;
+    simd_compare<int64_t, LessThanOperator>(column, int64_t{1}, false, bitset, simd_level());
+    ASSERT_EQ(bitset.count(), 0);
+    ASSERT_EQ(simd_apply<int64_t, PlusOperator>(column, int64_t{1}, false, simd_level())->row_count(), 0);
+}
+
+TEST(BinaryKernels, ExactlyAs) {
+    ASSERT_EQ(exactly_as<int32_t>(int64_t{-5}), -5);
+    ASSERT_FALSE(exactly_as<int32_t>(int64_t{1} << 40).has_value());
+    ASSERT_FALSE(exactly_as<uint32_t>(int64_t{-1}).has_value());
+    ASSERT_EQ(exactly_as<int64_t>(2.0), 2);
+    ASSERT_FALSE(exactly_as<int64_t>(2.5).has_value());
+    ASSERT_FALSE(exactly_as<int64_t>(std::numeric_limits<double>::quiet_NaN()).has_value());
+    ASSERT_FALSE(exactly_as<int64_t>(1e19).has_value());
+    ASSERT_EQ(exactly_as<float>(0.5), 0.5f);
+    ASSERT_FALSE(exactly_as<float>(0.1).has_value());
+    ASSERT_FALSE(exactly_as<float>((int64_t{1} << 24) + 1).has_value());
+}
+
+TEST(BinaryKernels, DispatchMatchesElementwise) {
+    // A float value compared with an int64 column is only handed to the kernels when it is an exact integer
+    const auto values = kernel_test_values<int64_t>(0);
+    const auto column = ColumnWithStrings(std::make_unique<Column>(kernel_test_column(values)), "col");
+    for (double value : {10.0, 10.5, -1e300}) {
+        const auto result =
+                visit_binary_comparator(column, std::make_shared<Value>(value, DataType::FLOAT64), LessThanOperator{});
+        for (size_t idx = 0; idx < num_rows; ++idx) {
+            const auto expected = static_cast<double>(values[idx]) < value;
+            const auto bit = static_cast<util::BitSetSizeType>(idx);
+            const auto actual = util::variant_match(
+                    result,
+                    [bit](const util::BitSet& bitset) { return bitset.get_bit(bit); },
+                    [](FullResult) { return true; },
+                    [](const auto&) { return false; }
+            );
+            ASSERT_EQ(expected, actual) << value << " " << idx;
+        }
+    }
+}
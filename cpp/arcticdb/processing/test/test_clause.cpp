@@ -13,6 +13,9 @@
 #include <folly/futures/Future.h>
 #include <arcticdb/pipeline/frame_slice.hpp>
 #include <arcticdb/processing/grouper.hpp>
+#include <arcticdb/stream/index.hpp>
+
+#include <map>
 
 template<typename T>
 void segment_scalar_assert_all_values_equal(
@@ -305,6 +308,120 @@ TEST(Clause, AggregationSparseGroupby) {
     });
 }
 
+namespace {
+
+// Grouped by symbol, a string, and side, a double, with a NaN side every 13 rows
+arcticdb::SegmentInMemory generate_multi_key_groupby_segment(size_t num_rows) {
+    using namespace arcticdb;
+    SegmentInMemory seg{stream::stream_descriptor(
+            StreamId{"multi_key"},
+            stream::RowCountIndex{},
+            {scalar_field(DataType::UTF_DYNAMIC64, "symbol"),
+             scalar_field(DataType::FLOAT64, "side"),
+             scalar_field(DataType::INT64, "quantity")}
+    )};
+    for (size_t row = 0; row < num_rows; ++row) {
+        seg.set_string(0, fmt::format("symbol_{}", row % 7));
+        seg.set_scalar<double>(1, row % 13 == 0 ? std::numeric_limits<double>::quiet_NaN() : double(row % 3));
+        seg.set_scalar<int64_t>(2, static_cast<int64_t>(row));
+        seg.end_row();
+    }
+    return seg;
+}
+
+} // namespace
+
+TEST(Clause, PartitionMultipleColumns) {
+    using namespace arcticdb;
+    ScopedConfig scoped_config({{"Partition.NumBuckets", 4}});
+    auto component_manager = std::make_shared<ComponentManager>();
+
+    PartitionClause<arcticdb::grouping::HashingGroupers, arcticdb::grouping::ModuloBucketizer> partition{
+            std::vector<std::string>{"symbol", "side"}
+    };
+    partition.set_component_manager(component_manager);
+    ASSERT_EQ(partition.to_string(), R"(GROUPBY Columns["symbol", "side"])");
+
+    constexpr size_t num_rows{1000};
+    auto entity_ids = push_entities(*component_manager, ProcessingUnit{generate_multi_key_groupby_segment(num_rows)});
+    auto processed = partition.process(std::move(entity_ids));
+    ASSERT_GT(processed.size(), 1);
+
+    // Each tuple of keys is in a single bucket, and the rows with a NaN key are in none
+    std::map<std::pair<std::string, double>, bucket_id> key_to_bucket;
+    size_t partitioned_rows{0};
+    auto [buckets] = component_manager->get_entities<bucket_id>(processed);
+    for (auto&& [idx, entity_id] : folly::enumerate(processed)) {
+        auto proc =
+                gather_entities<std::shared_ptr<SegmentInMemory>, std::shared_ptr<RowRange>, std::shared_ptr<ColRange>>(
+                        *component_manager, {entity_id}
+                );
+        const auto bucket = buckets[idx];
+        const auto& seg = *proc.segments_->front();
+        for (size_t row = 0; row < seg.row_count(); ++row) {
+            const auto side = seg.scalar_at<double>(row, 1).value();
+            ASSERT_FALSE(std::isnan(side));
+            const std::pair key{std::string(seg.string_at(row, 0).value()), side};
+            const auto [it, inserted] = key_to_bucket.try_emplace(key, bucket);
+            ASSERT_EQ(it->second, bucket);
+        }
+        partitioned_rows += seg.row_count();
+    }
+    ASSERT_EQ(key_to_bucket.size(), 21);
+    ASSERT_EQ(partitioned_rows, num_rows - (num_rows + 12) / 13);
+}
+
+TEST(Clause, AggregationMultipleColumns) {
+    using namespace arcticdb;
+    auto component_manager = std::make_shared<ComponentManager>();
+
+    AggregationClause aggregation(
+            std::vector<std::string>{"symbol", "side"},
+            {{"sum", "quantity", "sum_quantity"}, {"count", "quantity", "count_quantity"}}
+    );
+    aggregation.set_component_manager(component_manager);
+    ASSERT_EQ(std::get<NewIndex>(aggregation.clause_info().index_), NewIndex({"symbol", "__idx__side"}));
+
+    // Without the NaN sides, which the partitioning drops
+    constexpr size_t num_rows{1000};
+    auto seg = generate_multi_key_groupby_segment(num_rows);
+    util::BitSet rows(num_rows);
+    std::map<std::pair<std::string, double>, std::pair<int64_t, uint64_t>> expected;
+    for (size_t row = 0; row < num_rows; ++row) {
+        if (row % 13 != 0) {
+            rows.set(row);
+            auto& [sum, count] = expected[{fmt::format("symbol_{}", row % 7), double(row % 3)}];
+            sum += static_cast<int64_t>(row);
+            ++count;
+        }
+    }
+    auto entity_ids = push_entities(*component_manager, ProcessingUnit{seg.filter(std::move(rows))});
+
+    const auto aggregated =
+            gather_entities<std::shared_ptr<SegmentInMemory>, std::shared_ptr<RowRange>, std::shared_ptr<ColRange>>(
+                    *component_manager, aggregation.process(std::move(entity_ids))
+            );
+    ASSERT_TRUE(aggregated.segments_.has_value());
+    auto output = *aggregated.segments_->front();
+    output.init_column_map();
+    ASSERT_EQ(output.row_count(), expected.size());
+    const auto symbol_idx = output.column_index("symbol").value();
+    const auto side_idx = output.column_index("__idx__side").value();
+    const auto sum_idx = output.column_index("sum_quantity").value();
+    const auto count_idx = output.column_index("count_quantity").value();
+    ASSERT_EQ(symbol_idx, 0);
+    ASSERT_EQ(side_idx, 1);
+    for (size_t row = 0; row < output.row_count(); ++row) {
+        const std::pair key{
+                std::string(output.string_at(row, symbol_idx).value()), output.scalar_at<double>(row, side_idx).value()
+        };
+        ASSERT_TRUE(expected.contains(key)) << key.first << " " << key.second;
+        ASSERT_EQ(output.scalar_at<int64_t>(row, sum_idx).value(), expected.at(key).first);
+        ASSERT_EQ(output.scalar_at<uint64_t>(row, count_idx).value(), expected.at(key).second);
+        expected.erase(key);
+    }
+}
+
 TEST(Clause, Passthrough) {
     using namespace arcticdb;
     auto component_manager = std::make_shared<ComponentManager>();
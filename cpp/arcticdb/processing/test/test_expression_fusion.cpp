@@ -0,0 +1,168 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/processing/expression_context.hpp>
+#include <arcticdb/processing/expression_fusion.hpp>
+#include <arcticdb/processing/processing_unit.hpp>
+#include <arcticdb/util/configs_map.hpp>
+
+#include <cmath>
+#include <limits>
+
+using namespace arcticdb;
+
+namespace {
+
+// Several blocks of each column, and not a multiple of the rows fused at a time
+constexpr size_t num_rows = 10'007;
+
+SegmentInMemory build_fusion_segment() {
+    auto a_col = std::make_shared<Column>(make_scalar_type(DataType::INT64), Sparsity::NOT_PERMITTED);
+    auto b_col = std::make_shared<Column>(make_scalar_type(DataType::FLOAT64), Sparsity::NOT_PERMITTED);
+    auto c_col = std::make_shared<Column>(make_scalar_type(DataType::INT64), Sparsity::NOT_PERMITTED);
+    auto sparse_col = std::make_shared<Column>(make_scalar_type(DataType::INT64), Sparsity::PERMITTED);
+    for (size_t row = 0; row < num_rows; ++row) {
+        a_col->push_back<int64_t>(static_cast<int64_t>(row % 17) - 8);
+        b_col->push_back<double>(
+                row % 31 == 0 ? std::numeric_limits<double>::quiet_NaN() : static_cast<double>(row % 7)
+        );
+        c_col->push_back<int64_t>(static_cast<int64_t>(row % 5));
+        if (row % 2 == 0) {
+            sparse_col->set_scalar<int64_t>(static_cast<ssize_t>(row), 1);
+        }
+    }
+    SegmentInMemory seg;
+    seg.add_column(scalar_field(DataType::INT64, "a"), a_col);
+    seg.add_column(scalar_field(DataType::FLOAT64, "b"), b_col);
+    seg.add_column(scalar_field(DataType::INT64, "c"), c_col);
+    seg.add_column(scalar_field(DataType::INT64, "sparse"), sparse_col);
+    seg.set_row_data(static_cast<ssize_t>(num_rows) - 1);
+    return seg;
+}
+
+// ((a > -3) & (b < 4.0)) & ((a + c) * 2 != 6)
+std::shared_ptr<ExpressionContext> conjunction_context(std::string_view b_column = "b") {
+    auto expression_context = std::make_shared<ExpressionContext>();
+    expression_context->add_value("minus_three", std::make_shared<Value>(int64_t{-3}, DataType::INT64));
+    expression_context->add_value("four", std::make_shared<Value>(4.0, DataType::FLOAT64));
+    expression_context->add_value("two", std::make_shared<Value>(uint8_t{2}, DataType::UINT8));
+    expression_context->add_value("six", std::make_shared<Value>(int64_t{6}, DataType::INT64));
+    expression_context->add_expression_node(
+            "a_gt", std::make_shared<ExpressionNode>(ColumnName("a"), ValueName("minus_three"), OperationType::GT)
+    );
+    expression_context->add_expression_node(
+            "b_lt", std::make_shared<ExpressionNode>(ColumnName(b_column), ValueName("four"), OperationType::LT)
+    );
+    expression_context->add_expression_node(
+            "a_plus_c", std::make_shared<ExpressionNode>(ColumnName("a"), ColumnName("c"), OperationType::ADD)
+    );
+    expression_context->add_expression_node(
+            "times_two",
+            std::make_shared<ExpressionNode>(ExpressionName("a_plus_c"), ValueName("two"), OperationType::MUL)
+    );
+    expression_context->add_expression_node(
+            "ne_six", std::make_shared<ExpressionNode>(ValueName("six"), ExpressionName("times_two"), OperationType::NE)
+    );
+    expression_context->add_expression_node(
+            "left", std::make_shared<ExpressionNode>(ExpressionName("a_gt"), ExpressionName("b_lt"), OperationType::AND)
+    );
+    expression_context->add_expression_node(
+            "root",
+            std::make_shared<ExpressionNode>(ExpressionName("left"), ExpressionName("ne_six"), OperationType::AND)
+    );
+    expression_context->root_node_name_ = ExpressionName("root");
+    return expression_context;
+}
+
+VariantData evaluate(const std::shared_ptr<ExpressionContext>& expression_context, std::string_view node) {
+    ProcessingUnit proc{build_fusion_segment()};
+    proc.set_expression_context(expression_context);
+    return proc.get(ExpressionName(node));
+}
+
+VariantData interpret(const std::shared_ptr<ExpressionContext>& expression_context, std::string_view node) {
+    ScopedConfig fusion_disabled("Processing.FuseExpressions", 0);
+    return evaluate(expression_context, node);
+}
+
+} // namespace
+
+TEST(ExpressionFusion, Conjunction) {
+    const auto expression_context = conjunction_context();
+    ProcessingUnit proc{build_fusion_segment()};
+    proc.set_expression_context(expression_context);
+    const auto result = proc.get(ExpressionName("root"));
+    const auto& bitset = std::get<util::BitSet>(result);
+    ASSERT_EQ(bitset.size(), num_rows);
+    for (size_t row = 0; row < num_rows; ++row) {
+        const auto a = static_cast<int64_t>(row % 17) - 8;
+        const auto b = row % 31 == 0 ? std::numeric_limits<double>::quiet_NaN() : static_cast<double>(row % 7);
+        const auto c = static_cast<int64_t>(row % 5);
+        ASSERT_EQ(bitset.get_bit(row), a > -3 && b < 4.0 && (a + c) * 2 != 6) << row;
+    }
+    // The whole tree was evaluated in one pass, without computing the nodes below the root
+    ASSERT_FALSE(proc.computed_data_.contains("left"));
+    ASSERT_FALSE(proc.computed_data_.contains("a_plus_c"));
+
+    const auto interpreted = interpret(expression_context, "root");
+    ASSERT_EQ(bitset.count(), std::get<util::BitSet>(interpreted).count());
+}
+
+TEST(ExpressionFusion, Projection) {
+    const auto expression_context = conjunction_context();
+    const auto fused = evaluate(expression_context, "times_two");
+    const auto interpreted = interpret(expression_context, "times_two");
+    const auto& fused_column = std::get<ColumnWithStrings>(fused);
+    const auto& interpreted_column = std::get<ColumnWithStrings>(interpreted);
+    ASSERT_EQ(fused_column.column_->type(), interpreted_column.column_->type());
+    ASSERT_EQ(fused_column.column_name_, interpreted_column.column_name_);
+    ASSERT_EQ(fused_column.column_->row_count(), num_rows);
+    for (size_t row = 0; row < num_rows; ++row) {
+        ASSERT_EQ(
+                fused_column.column_->scalar_at<int64_t>(static_cast<ssize_t>(row)),
+                interpreted_column.column_->scalar_at<int64_t>(static_cast<ssize_t>(row))
+        );
+    }
+}
+
+TEST(ExpressionFusion, FallsBackToInterpreter) {
+    // A sparse column is not fused, but the expression is still evaluated
+    const auto expression_context = conjunction_context("sparse");
+    ProcessingUnit proc{build_fusion_segment()};
+    proc.set_expression_context(expression_context);
+    ASSERT_FALSE(compute_fused(*expression_context->expression_nodes_.get_value("root"), proc).has_value());
+    // The other side of the conjunction is fused on its own
+    ASSERT_TRUE(compute_fused(*expression_context->expression_nodes_.get_value("ne_six"), proc).has_value());
+    // A single comparison is left to the interpreter
+    ASSERT_FALSE(compute_fused(*expression_context->expression_nodes_.get_value("a_gt"), proc).has_value());
+
+    const auto result = evaluate(expression_context, "root");
+    const auto interpreted = interpret(expression_context, "root");
+    ASSERT_EQ(std::get<util::BitSet>(result).count(), std::get<util::BitSet>(interpreted).count());
+}
+
+TEST(ExpressionFusion, InexactValueFallsBack) {
+    // An int64 sum compared with a double is compared as doubles, which int64 kernels cannot reproduce
+    auto expression_context = conjunction_context();
+    expression_context->add_value("two_and_a_half", std::make_shared<Value>(2.5, DataType::FLOAT64));
+    expression_context->add_expression_node(
+            "inexact",
+            std::make_shared<ExpressionNode>(ExpressionName("a_plus_c"), ValueName("two_and_a_half"), OperationType::LT)
+    );
+    ProcessingUnit proc{build_fusion_segment()};
+    proc.set_expression_context(expression_context);
+    ASSERT_FALSE(compute_fused(*expression_context->expression_nodes_.get_value("inexact"), proc).has_value());
+    const auto result = proc.get(ExpressionName("inexact"));
+    const auto& bitset = std::get<util::BitSet>(result);
+    for (size_t row = 0; row < num_rows; ++row) {
+        const auto sum = static_cast<int64_t>(row % 17) - 8 + static_cast<int64_t>(row % 5);
+        ASSERT_EQ(bitset.get_bit(row), static_cast<double>(sum) < 2.5);
+    }
+}
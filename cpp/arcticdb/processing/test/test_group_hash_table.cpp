@@ -0,0 +1,70 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/processing/group_hash_table.hpp>
+
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+using namespace arcticdb;
+
+TEST(GroupHashTable, GroupsInOrderOfFirstAppearance) {
+    GroupHashTable<int64_t> table;
+    ASSERT_EQ(table.find_or_insert(30), 0);
+    ASSERT_EQ(table.find_or_insert(-10), 1);
+    ASSERT_EQ(table.find_or_insert(30), 0);
+    ASSERT_EQ(table.find_or_insert(20), 2);
+    ASSERT_EQ(table.num_groups(), 3);
+    ASSERT_EQ(table.keys(), (std::vector<int64_t>{30, -10, 20}));
+}
+
+TEST(GroupHashTable, BatchesMatchSingleKeys) {
+    // Enough distinct keys to grow the table several times, spanning several batches
+    constexpr size_t num_rows = 100'003;
+    std::vector<uint64_t> keys(num_rows);
+    for (size_t idx = 0; idx < num_rows; ++idx) {
+        keys[idx] = (idx * 7919) % 20'011 << 20;
+    }
+    GroupHashTable<uint64_t> table;
+    std::vector<size_t> groups(num_rows);
+    table.find_or_insert(keys.data(), num_rows, groups.data());
+
+    std::unordered_map<uint64_t, size_t> expected;
+    for (size_t idx = 0; idx < num_rows; ++idx) {
+        const auto [it, inserted] = expected.try_emplace(keys[idx], expected.size());
+        ASSERT_EQ(groups[idx], it->second) << idx;
+        ASSERT_EQ(table.keys()[groups[idx]], keys[idx]);
+        ASSERT_EQ(table.find_or_insert(keys[idx]), groups[idx]);
+    }
+    ASSERT_EQ(table.num_groups(), expected.size());
+}
+
+TEST(GroupHashTable, ReservedGroup) {
+    GroupHashTable<int32_t> table;
+    table.reserve_group();
+    ASSERT_EQ(table.find_or_insert(5), 1);
+    ASSERT_EQ(table.find_or_insert(6), 2);
+    ASSERT_EQ(table.num_groups(), 3);
+    ASSERT_EQ(table.keys(), (std::vector<int32_t>{5, 6}));
+    ASSERT_THROW(table.reserve_group(), std::runtime_error);
+}
+
+TEST(GroupHashTable, FloatingPointKeys) {
+    GroupHashTable<double> table;
+    ASSERT_EQ(table.find_or_insert(0.0), 0);
+    ASSERT_EQ(table.find_or_insert(-0.0), 0);
+    // NaN is not equal to itself, so every NaN is a group of its own
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    ASSERT_EQ(table.find_or_insert(nan), 1);
+    ASSERT_EQ(table.find_or_insert(nan), 2);
+    ASSERT_EQ(table.find_or_insert(1.5), 3);
+}
@@ -0,0 +1,179 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/pipeline/value.hpp>
+#include <arcticdb/processing/expression_context.hpp>
+#include <arcticdb/processing/processing_unit.hpp>
+#include <arcticdb/processing/short_circuit.hpp>
+#include <arcticdb/stream/index.hpp>
+#include <arcticdb/util/configs_map.hpp>
+
+using namespace arcticdb;
+
+namespace {
+
+constexpr size_t num_rows = 10'007;
+
+int64_t a_at(size_t row) { return static_cast<int64_t>(row % 50); }
+
+double b_at(size_t row) { return static_cast<double>(row % 7); }
+
+bool is_sell(size_t row) { return row % 4 == 0; }
+
+SegmentInMemory build_short_circuit_segment() {
+    SegmentInMemory segment{stream::stream_descriptor(
+            StreamId{"short_circuit"},
+            stream::RowCountIndex{},
+            {scalar_field(DataType::INT64, "a"),
+             scalar_field(DataType::FLOAT64, "b"),
+             scalar_field(DataType::UTF_DYNAMIC64, "side")}
+    )};
+    for (size_t row = 0; row < num_rows; ++row) {
+        segment.set_scalar<int64_t>(0, a_at(row));
+        segment.set_scalar<double>(1, b_at(row));
+        segment.set_string(2, is_sell(row) ? "SELL" : "BUY");
+        segment.end_row();
+    }
+    return segment;
+}
+
+std::shared_ptr<ExpressionContext> short_circuit_context() {
+    auto expression_context = std::make_shared<ExpressionContext>();
+    expression_context->add_value("three", std::make_shared<Value>(int64_t{3}, DataType::INT64));
+    expression_context->add_value("thousand", std::make_shared<Value>(int64_t{1000}, DataType::INT64));
+    expression_context->add_value("four", std::make_shared<Value>(4.0, DataType::FLOAT64));
+    expression_context->add_value("sell", std::make_shared<Value>(construct_string_value("SELL")));
+    expression_context->add_expression_node(
+            "a_eq", std::make_shared<ExpressionNode>(ColumnName("a"), ValueName("three"), OperationType::EQ)
+    );
+    expression_context->add_expression_node(
+            "a_ne", std::make_shared<ExpressionNode>(ColumnName("a"), ValueName("three"), OperationType::NE)
+    );
+    expression_context->add_expression_node(
+            "a_eq_missing",
+            std::make_shared<ExpressionNode>(ColumnName("a"), ValueName("thousand"), OperationType::EQ)
+    );
+    expression_context->add_expression_node(
+            "b_lt", std::make_shared<ExpressionNode>(ColumnName("b"), ValueName("four"), OperationType::LT)
+    );
+    expression_context->add_expression_node(
+            "side_eq", std::make_shared<ExpressionNode>(ColumnName("side"), ValueName("sell"), OperationType::EQ)
+    );
+    expression_context->add_expression_node(
+            "c_lt", std::make_shared<ExpressionNode>(ColumnName("c"), ValueName("four"), OperationType::LT)
+    );
+    // The less selective child on the left, so that it is evaluated second
+    expression_context->add_expression_node(
+            "b_and_a",
+            std::make_shared<ExpressionNode>(ExpressionName("b_lt"), ExpressionName("a_eq"), OperationType::AND)
+    );
+    expression_context->add_expression_node(
+            "a_and_side",
+            std::make_shared<ExpressionNode>(ExpressionName("a_eq"), ExpressionName("side_eq"), OperationType::AND)
+    );
+    expression_context->add_expression_node(
+            "side_or_a",
+            std::make_shared<ExpressionNode>(ExpressionName("side_eq"), ExpressionName("a_ne"), OperationType::OR)
+    );
+    expression_context->add_expression_node(
+            "missing_and_b",
+            std::make_shared<ExpressionNode>(ExpressionName("a_eq_missing"), ExpressionName("b_lt"), OperationType::AND)
+    );
+    expression_context->add_expression_node(
+            "a_and_c",
+            std::make_shared<ExpressionNode>(ExpressionName("a_eq"), ExpressionName("c_lt"), OperationType::AND)
+    );
+    return expression_context;
+}
+
+ProcessingUnit short_circuit_proc() {
+    ProcessingUnit proc{build_short_circuit_segment()};
+    proc.set_expression_context(short_circuit_context());
+    return proc;
+}
+
+template<typename Expected>
+void check_bitset(const VariantData& result, Expected&& expected) {
+    const auto& bitset = std::get<util::BitSet>(result);
+    ASSERT_EQ(bitset.size(), num_rows);
+    for (size_t row = 0; row < num_rows; ++row) {
+        ASSERT_EQ(bitset.get_bit(row), expected(row)) << row;
+    }
+}
+
+} // namespace
+
+TEST(ShortCircuit, AndEvaluatesSecondChildOnSelectedRows) {
+    // Otherwise the comparisons are fused into a single pass
+    ScopedConfig fusion_disabled("Processing.FuseExpressions", 0);
+    auto proc = short_circuit_proc();
+    const auto result = proc.get(ExpressionName("b_and_a"));
+    check_bitset(result, [](size_t row) { return b_at(row) < 4.0 && a_at(row) == 3; });
+    // The equality was evaluated first, and the range only on the rows it matched
+    ASSERT_TRUE(proc.computed_data_.contains("a_eq"));
+    ASSERT_FALSE(proc.computed_data_.contains("b_lt"));
+}
+
+TEST(ShortCircuit, StringsOnSelectedRows) {
+    ScopedConfig fusion_disabled("Processing.FuseExpressions", 0);
+    auto proc = short_circuit_proc();
+    const auto result = proc.get(ExpressionName("a_and_side"));
+    check_bitset(result, [](size_t row) { return a_at(row) == 3 && is_sell(row); });
+    ASSERT_FALSE(proc.computed_data_.contains("side_eq"));
+}
+
+TEST(ShortCircuit, OrEvaluatesSecondChildOnUnmatchedRows) {
+    ScopedConfig fusion_disabled("Processing.FuseExpressions", 0);
+    auto proc = short_circuit_proc();
+    const auto result = proc.get(ExpressionName("side_or_a"));
+    check_bitset(result, [](size_t row) { return is_sell(row) || a_at(row) != 3; });
+    ASSERT_TRUE(proc.computed_data_.contains("a_ne"));
+    ASSERT_FALSE(proc.computed_data_.contains("side_eq"));
+}
+
+TEST(ShortCircuit, EmptyFirstChild) {
+    ScopedConfig fusion_disabled("Processing.FuseExpressions", 0);
+    auto proc = short_circuit_proc();
+    ASSERT_TRUE(std::holds_alternative<EmptyResult>(proc.get(ExpressionName("missing_and_b"))));
+    ASSERT_FALSE(proc.computed_data_.contains("b_lt"));
+}
+
+TEST(ShortCircuit, SecondChildColumnMissingDynamicSchema) {
+    ScopedConfig fusion_disabled("Processing.FuseExpressions", 0);
+    auto proc = short_circuit_proc();
+    proc.expression_context_->dynamic_schema_ = true;
+    // Column c is in no segment, so there are no selected rows to evaluate c_lt on
+    ASSERT_TRUE(std::holds_alternative<EmptyResult>(proc.get(ExpressionName("a_and_c"))));
+    ASSERT_TRUE(proc.computed_data_.contains("a_eq"));
+}
+
+TEST(ShortCircuit, DenseSelectionEvaluatesBothChildren) {
+    ScopedConfig fusion_disabled("Processing.FuseExpressions", 0);
+    ScopedConfig selection_disabled("Processing.SelectionVectorMaxPercent", 0);
+    auto proc = short_circuit_proc();
+    const auto result = proc.get(ExpressionName("b_and_a"));
+    check_bitset(result, [](size_t row) { return b_at(row) < 4.0 && a_at(row) == 3; });
+    ASSERT_TRUE(proc.computed_data_.contains("b_lt"));
+}
+
+TEST(ShortCircuit, Estimates) {
+    auto proc = short_circuit_proc();
+    const auto equality = estimate_predicate(ExpressionName("a_eq"), proc);
+    const auto range = estimate_predicate(ExpressionName("b_lt"), proc);
+    ASSERT_LT(equality.selectivity_, range.selectivity_);
+    const auto conjunction = estimate_predicate(ExpressionName("b_and_a"), proc);
+    ASSERT_LT(conjunction.selectivity_, equality.selectivity_);
+    ASSERT_GT(conjunction.cost_, range.cost_);
+    // Once computed, the selectivity is known exactly and there is nothing left to pay
+    proc.get(ExpressionName("a_eq"));
+    const auto computed = estimate_predicate(ExpressionName("a_eq"), proc);
+    ASSERT_DOUBLE_EQ(computed.selectivity_, 201.0 / num_rows);
+    ASSERT_EQ(computed.cost_, 0);
+}
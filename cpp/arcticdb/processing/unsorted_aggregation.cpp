@@ -10,8 +10,11 @@
 #include <arcticdb/processing/unsorted_aggregation.hpp>
 #include <arcticdb/processing/aggregation_utils.hpp>
 #include <arcticdb/entity/types.hpp>
+#include <arcticdb/entity/type_utils.hpp>
 #include <arcticdb/util/constants.hpp>
 #include <arcticdb/column_store/memory_segment.hpp>
+#include <arcticdb/column_store/string_pool.hpp>
+#include <arcticdb/util/offset_string.hpp>
 #include <column_stats.pb.h>
 
 #include <cmath>
@@ -113,6 +116,66 @@ SegmentInMemory MinMaxAggregatorData::finalize(const std::vector<ColumnName>& ou
     return seg;
 }
 
+void BloomFilterAggregatorData::aggregate(const ColumnWithStrings& input_column) {
+    details::visit_type(input_column.column_->type().data_type(), [&](auto col_tag) {
+        using type_info = ScalarTypeInfo<decltype(col_tag)>;
+        if constexpr (type_info::data_type == DataType::FLOAT32 || is_empty_type(type_info::data_type)) {
+            // Comparisons of float32 with integers are made in float32, so values that compare equal need not be
+            // equal as doubles. Row slices of float32 values have no filter, and so are never pruned
+            return;
+        } else if constexpr (is_numeric_type(type_info::data_type)) {
+            using RawType = typename type_info::RawType;
+            arcticdb::for_each<typename type_info::TDT>(*input_column.column_, [&](auto value) {
+                const auto curr = static_cast<double>(static_cast<RawType>(value));
+                // NaN never compares equal, so is never probed for
+                if (!std::isnan(curr)) {
+                    builder_.add(bloom_filter_hash(curr));
+                }
+            });
+        } else if constexpr (is_dynamic_string_type(type_info::data_type)) {
+            arcticdb::for_each<typename type_info::TDT>(*input_column.column_, [&](auto offset) {
+                // None and NaN strings never compare equal
+                if (auto str = input_column.string_at_offset(offset); str.has_value()) {
+                    builder_.add(bloom_filter_hash(*str));
+                }
+            });
+        } else {
+            schema::raise<ErrorCode::E_UNSUPPORTED_COLUMN_TYPE>(
+                    "Bloom filter column stat generation only supported with numeric, timestamp and dynamic string "
+                    "types, column '{}' has type {}",
+                    input_column.column_name_,
+                    get_user_friendly_type_string(input_column.column_->type())
+            );
+        }
+    });
+}
+
+SegmentInMemory BloomFilterAggregatorData::finalize(const std::vector<ColumnName>& output_column_names) const {
+    internal::check<ErrorCode::E_ASSERTION_FAILURE>(
+            output_column_names.size() == 1,
+            "Expected 1 output column name in BloomFilterAggregatorData::finalize, but got {}",
+            output_column_names.size()
+    );
+    SegmentInMemory seg;
+    arcticc::pb2::column_stats_pb2::ColumnStatsHeader header;
+    // The column holds an offset in to the string pool of seg. Row slices with no values to filter get None rather
+    // than no row, so that the column is never sparse and reads back without placeholder strings.
+    auto bloom_col = std::make_shared<Column>(make_scalar_type(bloom_filter_data_type), Sparsity::PERMITTED);
+    bloom_col->push_back(builder_.empty() ? not_a_string() : seg.string_pool().get(builder_.build()).offset());
+
+    auto* bloom_entry = (*header.mutable_stats_by_column())[data_col_offset_].add_entries();
+    bloom_entry->set_stats_seg_offset(0);
+    bloom_entry->set_type(arcticc::pb2::column_stats_pb2::BLOOM_V1);
+
+    seg.add_column(scalar_field(bloom_filter_data_type, output_column_names[0].value), bloom_col);
+
+    google::protobuf::Any any;
+    bool packed = any.PackFrom(header);
+    util::check(packed, "Failed to pack header in to Any?");
+    seg.set_metadata(std::move(any));
+    return seg;
+}
+
 namespace {
 
 template<typename T, typename T2 = void>
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <arcticdb/entity/types.hpp>
+#include <arcticdb/pipeline/bloom_filter.hpp>
 #include <arcticdb/processing/expression_node.hpp>
 
 namespace arcticdb {
@@ -21,6 +22,9 @@ class MinMaxAggregatorData {
     void aggregate(const ColumnWithStrings& input_column);
     SegmentInMemory finalize(const std::vector<ColumnName>& output_column_names) const;
 
+    [[nodiscard]] const std::optional<Value>& min() const { return min_; }
+    [[nodiscard]] const std::optional<Value>& max() const { return max_; }
+
   private:
     std::optional<Value> min_;
     std::optional<Value> max_;
@@ -53,6 +57,41 @@ class MinMaxAggregator {
     ColumnName output_column_name_max_;
 };
 
+class BloomFilterAggregatorData {
+  public:
+    BloomFilterAggregatorData(size_t data_col_offset) : data_col_offset_(data_col_offset) {}
+    ARCTICDB_MOVE_COPY_DEFAULT(BloomFilterAggregatorData)
+
+    void aggregate(const ColumnWithStrings& input_column);
+    // The filter is returned as a string, in a column of the segment with a string pool of its own
+    SegmentInMemory finalize(const std::vector<ColumnName>& output_column_names) const;
+
+  private:
+    BloomFilterBuilder builder_;
+    size_t data_col_offset_;
+};
+
+class BloomFilterAggregator {
+  public:
+    explicit BloomFilterAggregator(ColumnName column_name, size_t data_col_offset, ColumnName output_column_name) :
+        column_name_(std::move(column_name)),
+        data_col_offset_(data_col_offset),
+        output_column_name_(std::move(output_column_name)) {}
+
+    ARCTICDB_MOVE_COPY_DEFAULT(BloomFilterAggregator)
+
+    [[nodiscard]] ColumnName get_input_column_name() const { return column_name_; }
+    [[nodiscard]] std::vector<ColumnName> get_output_column_names() const { return {output_column_name_}; }
+    [[nodiscard]] BloomFilterAggregatorData get_aggregator_data() const {
+        return BloomFilterAggregatorData(data_col_offset_);
+    }
+
+  private:
+    ColumnName column_name_;
+    size_t data_col_offset_;
+    ColumnName output_column_name_;
+};
+
 class AggregatorDataBase {
   public:
     AggregatorDataBase() = default;
@@ -152,6 +152,22 @@ Segment RealAzureClient::read_blob(
     return Segment::from_buffer(std::move(buffer));
 }
 
+RangeReadOutput RealAzureClient::read_blob_range(
+        const std::string& blob_name, uint64_t offset, uint64_t length, uint8_t* dest,
+        const Azure::Storage::Blobs::DownloadBlobToOptions& download_option, unsigned int request_timeout
+) {
+    ARCTICDB_DEBUG(log::storage(), "Reading {} bytes at offset {} of blob {}", length, offset, blob_name);
+    auto blob_client = container_client.GetBlockBlobClient(blob_name);
+    auto range_option = download_option;
+    range_option.Range = Azure::Core::Http::HttpRange{static_cast<int64_t>(offset), static_cast<int64_t>(length)};
+    const auto result = blob_client.DownloadTo(dest, length, range_option, get_context(request_timeout)).Value;
+    const auto object_size = static_cast<uint64_t>(result.BlobSize);
+    const auto bytes_read = result.ContentRange.Length.HasValue()
+                                    ? static_cast<uint64_t>(result.ContentRange.Length.Value())
+                                    : std::min(length, object_size - offset);
+    return RangeReadOutput{bytes_read, object_size};
+}
+
 void RealAzureClient::delete_blobs(const std::vector<std::string>& blob_names, unsigned int request_timeout) {
 
     util::check(
@@ -12,6 +12,7 @@
 #include <azure/core.hpp>
 #include <azure/storage/blobs.hpp>
 
+#include <arcticdb/storage/storage.hpp>
 #include <arcticdb/storage/storage_utils.hpp>
 
 namespace arcticdb::storage::azure {
@@ -66,6 +67,12 @@ class AzureClientWrapper {
             unsigned int request_timeout
     ) = 0;
 
+    // Downloads up to length bytes of the blob starting at offset into dest
+    virtual RangeReadOutput read_blob_range(
+            const std::string& blob_name, uint64_t offset, uint64_t length, uint8_t* dest,
+            const Azure::Storage::Blobs::DownloadBlobToOptions& download_option, unsigned int request_timeout
+    ) = 0;
+
     virtual void delete_blobs(const std::vector<std::string>& blob_names, unsigned int request_timeout) = 0;
 
     virtual Azure::Storage::Blobs::ListBlobsPagedResponse list_blobs(const std::string& prefix) = 0;
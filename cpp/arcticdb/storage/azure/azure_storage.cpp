@@ -296,6 +296,29 @@ bool do_key_exists_impl(const VariantKey& key, const std::string& root_folder, A
     }
     return false;
 }
+RangeReadOutput do_read_range_impl(
+        const VariantKey& variant_key, uint64_t offset, uint64_t length, uint8_t* dest, const std::string& root_folder,
+        AzureClientWrapper& azure_client, const Azure::Storage::Blobs::DownloadBlobToOptions& download_option,
+        unsigned int request_timeout
+) {
+    auto key_type_dir = key_type_folder(root_folder, variant_key_type(variant_key));
+    auto blob_name = object_path(FlatBucketizer{}.bucketize(key_type_dir, variant_key), variant_key);
+    try {
+        return azure_client.read_blob_range(blob_name, offset, length, dest, download_option, request_timeout);
+    } catch (const Azure::Core::RequestFailedException& e) {
+        raise_if_unexpected_error(e, blob_name);
+        throw KeyNotFoundException(
+                variant_key,
+                fmt::format(
+                        "Failed to read range of azure segment with key '{}' {} {}: {}",
+                        variant_key,
+                        blob_name,
+                        static_cast<int>(e.StatusCode),
+                        e.ReasonPhrase
+                )
+        );
+    }
+}
 } // namespace detail
 
 std::string AzureStorage::name() const { return fmt::format("azure_storage-{}/{}", container_name_, root_folder_); }
@@ -355,6 +378,14 @@ bool AzureStorage::do_iterate_type_until_match(
     return detail::do_iterate_type_impl(key_type, visitor, root_folder_, *azure_client_, prefix);
 }
 
+folly::Future<RangeReadOutput> AzureStorage::do_read_range(
+        const VariantKey& variant_key, uint64_t offset, uint64_t length, uint8_t* dest
+) {
+    return folly::makeFuture(detail::do_read_range_impl(
+            variant_key, offset, length, dest, root_folder_, *azure_client_, download_option_, request_timeout_
+    ));
+}
+
 bool AzureStorage::do_key_exists(const VariantKey& key) {
     return detail::do_key_exists_impl(key, root_folder_, *azure_client_);
 }
@@ -27,6 +27,8 @@ class AzureStorage final : public Storage {
 
     std::optional<size_t> max_delete_batch_size() const final override;
 
+    bool supports_range_reads() const final { return true; }
+
   protected:
     void do_write(KeySegmentPair& key_seg) final;
 
@@ -50,6 +52,11 @@ class AzureStorage final : public Storage {
 
     bool do_key_exists(const VariantKey& key) final;
 
+    // Azure has no async API here, so each range is downloaded before the future is returned
+    folly::Future<RangeReadOutput> do_read_range(
+            const VariantKey& variant_key, uint64_t offset, uint64_t length, uint8_t* dest
+    ) final;
+
     bool do_supports_prefix_matching() const final { return true; }
 
     SupportsAtomicWrites do_supports_atomic_writes() const final { return SupportsAtomicWrites::NO; }
@@ -0,0 +1,346 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/storage/disk_cache.hpp>
+#include <arcticdb/entity/serialized_key.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
+#include <arcticdb/util/buffer.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/hash.hpp>
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/util/string_utils.hpp>
+#include <arcticdb/log/log.hpp>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+namespace arcticdb::storage {
+
+namespace fs = std::filesystem;
+
+namespace {
+constexpr std::string_view default_key_types = "TABLE_DATA,TABLE_INDEX";
+constexpr std::string_view tmp_extension = ".tmp";
+constexpr uint64_t entry_magic = 0x41444244'43414348;
+
+// Precedes the identity and segment bytes of every cache file
+struct EntryHeader {
+    uint64_t magic_;
+    uint64_t identity_bytes_;
+    uint64_t segment_bytes_;
+};
+
+std::string_view trim(std::string_view str) {
+    const auto begin = str.find_first_not_of(" \t");
+    if (begin == std::string_view::npos)
+        return {};
+
+    const auto end = str.find_last_not_of(" \t");
+    return str.substr(begin, end - begin + 1);
+}
+
+std::string key_type_name(KeyType key_type) {
+    std::string_view description = get_key_description(key_type);
+    const auto token_pos = description.find("::"); // KeyType::TABLE_DATA -> TABLE_DATA
+    return std::string{token_pos == std::string_view::npos ? description : description.substr(token_pos + 2)};
+}
+
+// Storage name and key, which the cache file is checked against so that hash collisions read as misses
+std::string entry_identity(const std::string& storage_name, const VariantKey& key) {
+    return fmt::format("{}\n{}", storage_name, to_serialized_key(key));
+}
+
+std::string entry_name_for(const std::string& identity) {
+    HashAccum accum;
+    accum(identity.data(), identity.size());
+    return fmt::format("{:016x}", accum.digest());
+}
+
+std::string tmp_suffix() {
+    thread_local std::mt19937_64 gen{std::random_device{}()};
+    return fmt::format(".{:016x}{}", gen(), tmp_extension);
+}
+
+bool read_exactly(std::ifstream& file, void* dest, uint64_t bytes) {
+    file.read(static_cast<char*>(dest), static_cast<std::streamsize>(bytes));
+    return static_cast<uint64_t>(file.gcount()) == bytes;
+}
+} // namespace
+
+std::unordered_set<KeyType> parse_cacheable_key_types(std::string_view key_types) {
+    std::unordered_map<std::string, KeyType> key_types_by_name;
+    foreach_key_type([&key_types_by_name](KeyType key_type) {
+        key_types_by_name.try_emplace(key_type_name(key_type), key_type);
+    });
+
+    std::unordered_set<KeyType> output;
+    for (auto name : util::split_to_vector(key_types, ',')) {
+        name = trim(name);
+        if (name.empty())
+            continue;
+
+        const auto it = key_types_by_name.find(boost::to_upper_copy(std::string{name}));
+        util::check(it != key_types_by_name.end(), "Unknown key type '{}' in DiskCache.KeyTypes", name);
+        util::check(
+                !is_ref_key_class(it->second) && it->second != KeyType::VERSION,
+                "Key type {} cannot be disk cached as its keys are not immutable",
+                name
+        );
+        output.insert(it->second);
+    }
+    return output;
+}
+
+DiskCacheConfig DiskCacheConfig::from_config() {
+    DiskCacheConfig config;
+    config.path_ = ConfigsMap::instance()->get_string("DiskCache.Path", "");
+    const auto max_bytes = ConfigsMap::instance()->get_int("DiskCache.MaxBytes", 0);
+    util::check(max_bytes >= 0, "DiskCache.MaxBytes must not be negative, got {}", max_bytes);
+    config.max_bytes_ = static_cast<uint64_t>(max_bytes);
+    config.key_types_ = parse_cacheable_key_types(
+            ConfigsMap::instance()->get_string("DiskCache.KeyTypes", std::string{default_key_types})
+    );
+    return config;
+}
+
+std::shared_ptr<DiskCache> DiskCache::instance() {
+    static const auto instance_ = std::make_shared<DiskCache>(DiskCacheConfig::from_config());
+    return instance_;
+}
+
+DiskCache::DiskCache(DiskCacheConfig config) : config_(std::move(config)) {
+    if (enabled())
+        load_existing_entries();
+}
+
+fs::path DiskCache::entry_path(const std::string& entry_name) const {
+    // Spread entries over subdirectories so that no single directory grows too large
+    return fs::path{config_.path_} / entry_name.substr(0, 2) / entry_name;
+}
+
+void DiskCache::load_existing_entries() {
+    fs::create_directories(config_.path_);
+    struct ExistingEntry {
+        std::string name_;
+        uint64_t size_bytes_;
+        fs::file_time_type last_used_;
+    };
+    std::vector<ExistingEntry> existing;
+    std::error_code scan_ec;
+    for (const auto& file : fs::recursive_directory_iterator{config_.path_, scan_ec}) {
+        std::error_code ec;
+        if (!file.is_regular_file(ec))
+            continue;
+
+        // Left behind by a process that stopped part way through writing an entry
+        if (file.path().extension() == tmp_extension) {
+            fs::remove(file.path(), ec);
+            continue;
+        }
+        const auto size_bytes = file.file_size(ec);
+        if (ec)
+            continue;
+
+        const auto last_used = file.last_write_time(ec);
+        if (!ec)
+            existing.push_back({file.path().filename().string(), size_bytes, last_used});
+    }
+    util::check(!scan_ec, "Failed to scan disk cache directory {}: {}", config_.path_, scan_ec.message());
+
+    std::sort(existing.begin(), existing.end(), [](const auto& l, const auto& r) {
+        return l.last_used_ < r.last_used_;
+    });
+    std::vector<std::string> evicted;
+    {
+        std::lock_guard lock{mutex_};
+        for (const auto& entry : existing)
+            insert_entry(entry.name_, entry.size_bytes_);
+
+        evicted = evict_to_budget();
+    }
+    std::error_code ec;
+    for (const auto& name : evicted)
+        fs::remove(entry_path(name), ec);
+
+    log::storage().info(
+            "Opened disk cache at {} with {} entries totalling {} bytes", config_.path_, num_entries(), size_bytes()
+    );
+}
+
+void DiskCache::insert_entry(const std::string& entry_name, uint64_t size_bytes) {
+    if (entries_.contains(entry_name))
+        return;
+
+    lru_.push_back(entry_name);
+    entries_.try_emplace(entry_name, Entry{size_bytes, std::prev(lru_.end())});
+    size_bytes_ += size_bytes;
+}
+
+void DiskCache::erase_entry(const std::string& entry_name) {
+    const auto it = entries_.find(entry_name);
+    if (it == entries_.end())
+        return;
+
+    size_bytes_ -= it->second.size_bytes_;
+    lru_.erase(it->second.lru_position_);
+    entries_.erase(it);
+}
+
+std::vector<std::string> DiskCache::evict_to_budget() {
+    std::vector<std::string> evicted;
+    while (size_bytes_ > config_.max_bytes_ && !lru_.empty()) {
+        auto entry_name = lru_.front();
+        erase_entry(entry_name);
+        evicted.push_back(std::move(entry_name));
+    }
+    return evicted;
+}
+
+std::optional<Segment> DiskCache::get(const std::string& storage_name, const VariantKey& key) {
+    const auto key_type = variant_key_type(key);
+    if (!caches(key_type))
+        return std::nullopt;
+
+    const auto identity = entry_identity(storage_name, key);
+    const auto entry_name = entry_name_for(identity);
+    {
+        std::lock_guard lock{mutex_};
+        const auto it = entries_.find(entry_name);
+        if (it == entries_.end()) {
+            query_stats::add(query_stats::TaskType::DiskCache_Miss, key_type, query_stats::StatType::COUNT, 1);
+            return std::nullopt;
+        }
+        lru_.splice(lru_.end(), lru_, it->second.lru_position_);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto path = entry_path(entry_name);
+    std::ifstream file{path, std::ios::binary};
+    EntryHeader header{};
+    std::string stored_identity;
+    std::shared_ptr<Buffer> buffer;
+    bool valid = file && read_exactly(file, &header, sizeof(header)) && header.magic_ == entry_magic &&
+                 header.identity_bytes_ == identity.size();
+    if (valid) {
+        stored_identity.resize(header.identity_bytes_);
+        valid = read_exactly(file, stored_identity.data(), header.identity_bytes_) && stored_identity == identity;
+    }
+    if (valid) {
+        buffer = std::make_shared<Buffer>(header.segment_bytes_);
+        valid = read_exactly(file, buffer->data(), header.segment_bytes_);
+    }
+    if (!valid) {
+        // Removed by another process sharing the directory, truncated, or a hash collision
+        ARCTICDB_DEBUG(log::storage(), "Discarding unreadable disk cache entry {} for {}", path.string(), identity);
+        remove(storage_name, key);
+        query_stats::add(query_stats::TaskType::DiskCache_Miss, key_type, query_stats::StatType::COUNT, 1);
+        return std::nullopt;
+    }
+
+    // Record the use in the file so that the recency order survives a restart
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    auto query_stat_operation_time =
+            query_stats::add_task_count_and_time(query_stats::TaskType::DiskCache_Hit, key_type, start);
+    query_stats::add(
+            query_stats::TaskType::DiskCache_Hit, key_type, query_stats::StatType::SIZE_BYTES, header.segment_bytes_
+    );
+    return Segment::from_buffer(buffer);
+}
+
+void DiskCache::put(const std::string& storage_name, const VariantKey& key, Segment& segment) {
+    const auto key_type = variant_key_type(key);
+    if (!caches(key_type) || segment.is_partial())
+        return;
+
+    const auto identity = entry_identity(storage_name, key);
+    const auto entry_name = entry_name_for(identity);
+    {
+        std::lock_guard lock{mutex_};
+        if (entries_.contains(entry_name))
+            return;
+    }
+
+    const auto segment_bytes = segment.calculate_size();
+    const auto file_bytes = sizeof(EntryHeader) + identity.size() + segment_bytes;
+    if (file_bytes > config_.max_bytes_)
+        return;
+
+    auto query_stat_operation_time =
+            query_stats::add_task_count_and_time(query_stats::TaskType::DiskCache_PutObject, key_type);
+    Buffer buffer{file_bytes};
+    const EntryHeader header{entry_magic, identity.size(), segment_bytes};
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::memcpy(buffer.data() + sizeof(header), identity.data(), identity.size());
+    segment.write_to(buffer.data() + sizeof(header) + identity.size());
+
+    const auto path = entry_path(entry_name);
+    auto tmp_path = path;
+    tmp_path += tmp_suffix();
+    std::error_code ec;
+    fs::create_directories(path.parent_path(), ec);
+    {
+        std::ofstream file{tmp_path, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(file_bytes));
+        if (!file) {
+            // The cache is an optimisation, so failing to populate it must not fail the write
+            log::storage().warn("Failed to write disk cache entry {} for {}", tmp_path.string(), identity);
+            file.close();
+            fs::remove(tmp_path, ec);
+            return;
+        }
+    }
+    fs::rename(tmp_path, path, ec);
+    if (ec) {
+        log::storage().warn("Failed to rename disk cache entry {}: {}", tmp_path.string(), ec.message());
+        fs::remove(tmp_path, ec);
+        return;
+    }
+    query_stats::add(
+            query_stats::TaskType::DiskCache_PutObject, key_type, query_stats::StatType::SIZE_BYTES, file_bytes
+    );
+
+    std::vector<std::string> evicted;
+    {
+        std::lock_guard lock{mutex_};
+        insert_entry(entry_name, file_bytes);
+        evicted = evict_to_budget();
+    }
+    for (const auto& name : evicted)
+        fs::remove(entry_path(name), ec);
+}
+
+void DiskCache::remove(const std::string& storage_name, const VariantKey& key) {
+    if (!caches(variant_key_type(key)))
+        return;
+
+    const auto entry_name = entry_name_for(entry_identity(storage_name, key));
+    {
+        std::lock_guard lock{mutex_};
+        erase_entry(entry_name);
+    }
+    std::error_code ec;
+    fs::remove(entry_path(entry_name), ec);
+}
+
+uint64_t DiskCache::size_bytes() const {
+    std::lock_guard lock{mutex_};
+    return size_bytes_;
+}
+
+size_t DiskCache::num_entries() const {
+    std::lock_guard lock{mutex_};
+    return entries_.size();
+}
+
+} // namespace arcticdb::storage
@@ -0,0 +1,109 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/codec/segment.hpp>
+#include <arcticdb/entity/key.hpp>
+#include <arcticdb/entity/variant_key.hpp>
+#include <arcticdb/util/constructors.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace arcticdb::storage {
+
+struct DiskCacheConfig {
+    // Directory holding the cache. Empty disables the cache.
+    std::string path_;
+    uint64_t max_bytes_ = 0;
+    std::unordered_set<KeyType> key_types_;
+
+    [[nodiscard]] bool enabled() const { return !path_.empty() && max_bytes_ != 0; }
+
+    // Reads DiskCache.Path, DiskCache.MaxBytes and DiskCache.KeyTypes
+    static DiskCacheConfig from_config();
+};
+
+// Parses a comma separated list of key type names such as "TABLE_DATA,TABLE_INDEX". Only key types whose contents
+// never change once written can be cached, so ref keys and version keys are rejected.
+std::unordered_set<KeyType> parse_cacheable_key_types(std::string_view key_types);
+
+/*
+ * Local disk cache of immutable segments, sitting in front of remote storages. Keys are content addressed, so an
+ * entry can never be stale and the cache needs no invalidation beyond removing entries for deleted keys.
+ *
+ * Each entry is one file named after a hash of the storage name and key, holding the storage name and serialized key
+ * (checked on read, so a hash collision is a miss) followed by the serialized segment. Files are written under a
+ * temporary name and renamed into place, so a crash never leaves a partial entry behind.
+ *
+ * Entries are evicted least recently used first once the cache exceeds max_bytes_. Reads touch the modification time
+ * of the file, which is how the recency order is recovered when the cache directory is reopened by a later process.
+ *
+ * Hits, misses and bytes are reported to query_stats under DiskCache_Hit, DiskCache_Miss and DiskCache_PutObject.
+ */
+class DiskCache {
+  public:
+    explicit DiskCache(DiskCacheConfig config);
+
+    ARCTICDB_NO_MOVE_OR_COPY(DiskCache)
+
+    static std::shared_ptr<DiskCache> instance();
+
+    [[nodiscard]] bool enabled() const { return config_.enabled(); }
+
+    [[nodiscard]] bool caches(KeyType key_type) const { return enabled() && config_.key_types_.contains(key_type); }
+
+    // storage_name distinguishes identical keys written to different storages
+    std::optional<Segment> get(const std::string& storage_name, const VariantKey& key);
+
+    void put(const std::string& storage_name, const VariantKey& key, Segment& segment);
+
+    void remove(const std::string& storage_name, const VariantKey& key);
+
+    [[nodiscard]] uint64_t size_bytes() const;
+
+    [[nodiscard]] size_t num_entries() const;
+
+  private:
+    struct Entry {
+        uint64_t size_bytes_;
+        std::list<std::string>::iterator lru_position_;
+    };
+
+    void load_existing_entries();
+
+    [[nodiscard]] std::filesystem::path entry_path(const std::string& entry_name) const;
+
+    // The functions below must be called with mutex_ held
+    void insert_entry(const std::string& entry_name, uint64_t size_bytes);
+
+    void erase_entry(const std::string& entry_name);
+
+    // Drops least recently used entries until the cache fits its budget, returning the names of the entries dropped
+    // so that their files can be deleted once the mutex is released
+    std::vector<std::string> evict_to_budget();
+
+    const DiskCacheConfig config_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    // Least recently used at the front
+    std::list<std::string> lru_;
+    uint64_t size_bytes_ = 0;
+};
+
+} // namespace arcticdb::storage
@@ -34,7 +34,8 @@ size_t max_data_size(
     auto max_file_size = 0UL;
     for (const auto& item : items) {
         const auto& [pk, seg, slice] = item;
-        auto result = max_compressed_size_dispatch(seg, codec_opts, encoding_version);
+        auto result =
+                max_compressed_size_dispatch(seg, codec_opts, encoding_version, pk.key_type == KeyType::TABLE_DATA);
         max_file_size += result.max_compressed_bytes_ + result.encoded_blocks_bytes_;
         const auto header_size = SegmentHeader::required_bytes(seg);
         max_file_size += header_size;
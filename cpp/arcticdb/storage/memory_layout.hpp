@@ -66,7 +66,7 @@ struct PassthroughCodec {
 struct PforCodec {
     static constexpr Codec type_ = Codec::PFOR;
 
-    uint32_t unused_ = 0;
+    uint32_t sub_codec_ = 0;
     uint16_t padding_ = 0;
 };
 
@@ -8,6 +8,8 @@
 #include <arcticdb/storage/azure/azure_client_interface.hpp>
 #include <arcticdb/storage/mock/azure_mock_client.hpp>
 
+#include <cstring>
+
 namespace arcticdb::storage::azure {
 
 std::string MockAzureClient::get_failure_trigger(
@@ -97,6 +99,41 @@ Segment MockAzureClient::read_blob(
     return std::move(pos->second);
 }
 
+RangeReadOutput MockAzureClient::read_blob_range(
+        const std::string& blob_name, uint64_t offset, uint64_t length, uint8_t* dest,
+        const Azure::Storage::Blobs::DownloadBlobToOptions&, unsigned int
+) {
+    auto maybe_exception = has_failure_trigger(blob_name, StorageOperation::READ);
+    if (maybe_exception.has_value()) {
+        throw *maybe_exception;
+    }
+
+    auto pos = azure_contents.find(blob_name);
+    if (pos == azure_contents.end()) {
+        auto error_code = AzureErrorCode_to_string(AzureErrorCode::BlobNotFound);
+        std::string message = fmt::format(
+                "Simulated Error, message: Read failed {} {}",
+                error_code,
+                static_cast<int>(Azure::Core::Http::HttpStatusCode::NotFound)
+        );
+        throw get_exception(message, error_code, Azure::Core::Http::HttpStatusCode::NotFound);
+    }
+
+    // Serialize the segment as it would be laid out in a real blob
+    auto segment = pos->second.clone();
+    std::vector<uint8_t> bytes(segment.calculate_size());
+    segment.write_to(bytes.data());
+    if (offset >= bytes.size()) {
+        std::string message =
+                fmt::format("Simulated Error, message: Range at {} past end of {} bytes", offset, bytes.size());
+        throw get_exception(message, "InvalidRange", Azure::Core::Http::HttpStatusCode::RangeNotSatisfiable);
+    }
+
+    const auto bytes_read = std::min<uint64_t>(length, bytes.size() - offset);
+    std::memcpy(dest, bytes.data() + offset, bytes_read);
+    return RangeReadOutput{bytes_read, bytes.size()};
+}
+
 void MockAzureClient::delete_blobs(const std::vector<std::string>& blob_names, unsigned int) {
     for (auto& blob_name : blob_names) {
         auto maybe_exception = has_failure_trigger(blob_name, StorageOperation::DELETE);
@@ -27,6 +27,11 @@ class MockAzureClient : public AzureClientWrapper {
             unsigned int request_timeout
     ) override;
 
+    RangeReadOutput read_blob_range(
+            const std::string& blob_name, uint64_t offset, uint64_t length, uint8_t* dest,
+            const Azure::Storage::Blobs::DownloadBlobToOptions& download_option, unsigned int request_timeout
+    ) override;
+
     void delete_blobs(const std::vector<std::string>& blob_names, unsigned int request_timeout) override;
 
     bool blob_exists(const std::string& blob_name) override;
@@ -11,6 +11,8 @@
 
 #include <aws/s3/S3Errors.h>
 
+#include <cstring>
+
 namespace arcticdb::storage {
 
 using namespace object_store_utils;
@@ -63,6 +65,10 @@ const Aws::S3::S3Error not_implemented_error = create_error(
         Aws::S3::S3Errors::UNKNOWN, "NotImplemented",
         "A header you provided implies functionality that is not implemented", false
 );
+const Aws::S3::S3Error invalid_range_error = create_error(
+        Aws::S3::S3Errors::UNKNOWN, "InvalidRange", "The requested range is not satisfiable", false,
+        Aws::Http::HttpResponseCode::REQUESTED_RANGE_NOT_SATISFIABLE
+);
 
 S3Result<std::monostate> MockS3Client::head_object(const std::string& s3_object_name, const std::string& bucket_name)
         const {
@@ -89,6 +95,43 @@ folly::Future<S3Result<Segment>> MockS3Client::get_object_async(
     return folly::makeFuture(get_object(s3_object_name, bucket_name));
 }
 
+folly::Future<S3Result<uint64_t>> MockS3Client::get_object_size_async(
+        const std::string& s3_object_name, const std::string& bucket_name
+) const {
+    std::scoped_lock<std::mutex> lock(mutex_);
+    auto pos = s3_contents_.find({bucket_name, s3_object_name});
+    if (pos == s3_contents_.end() || !pos->second.has_value()) {
+        return folly::makeFuture<S3Result<uint64_t>>({not_found_error});
+    }
+    return folly::makeFuture<S3Result<uint64_t>>({static_cast<uint64_t>(pos->second->calculate_size())});
+}
+
+folly::Future<S3Result<GetObjectRangeOutput>> MockS3Client::get_object_range_async(
+        const std::string& s3_object_name, const std::string& bucket_name, uint64_t offset, uint64_t length,
+        uint8_t* dest
+) const {
+    std::optional<Segment> segment;
+    {
+        std::scoped_lock<std::mutex> lock(mutex_);
+        auto pos = s3_contents_.find({bucket_name, s3_object_name});
+        if (pos == s3_contents_.end() || !pos->second.has_value()) {
+            return folly::makeFuture<S3Result<GetObjectRangeOutput>>({not_found_error});
+        }
+        segment = pos->second.value().clone();
+    }
+
+    // Serialize the segment as it would be laid out in a real object
+    std::vector<uint8_t> bytes(segment->calculate_size());
+    segment->write_to(bytes.data());
+    if (offset >= bytes.size()) {
+        return folly::makeFuture<S3Result<GetObjectRangeOutput>>({invalid_range_error});
+    }
+
+    const auto bytes_read = std::min<uint64_t>(length, bytes.size() - offset);
+    std::memcpy(dest, bytes.data() + offset, bytes_read);
+    return folly::makeFuture<S3Result<GetObjectRangeOutput>>({GetObjectRangeOutput{bytes_read, bytes.size()}});
+}
+
 S3Result<std::monostate> MockS3Client::put_object(
         const std::string& s3_object_name, Segment& segment, const std::string& bucket_name, PutHeader header
 ) {
@@ -16,6 +16,7 @@ namespace arcticdb::storage::s3 {
 extern const Aws::S3::S3Error not_found_error;
 extern const Aws::S3::S3Error precondition_failed_error;
 extern const Aws::S3::S3Error not_implemented_error;
+extern const Aws::S3::S3Error invalid_range_error;
 
 std::optional<Aws::S3::S3Error> has_object_failure_trigger(
         const std::string& s3_object_name, StorageOperation operation
@@ -46,6 +47,15 @@ class MockS3Client : public S3ClientInterface {
             const std::string& s3_object_name, const std::string& bucket_name
     ) const override;
 
+    [[nodiscard]] folly::Future<S3Result<uint64_t>> get_object_size_async(
+            const std::string& s3_object_name, const std::string& bucket_name
+    ) const override;
+
+    [[nodiscard]] folly::Future<S3Result<GetObjectRangeOutput>> get_object_range_async(
+            const std::string& s3_object_name, const std::string& bucket_name, uint64_t offset, uint64_t length,
+            uint8_t* dest
+    ) const override;
+
     S3Result<std::monostate> put_object(
             const std::string& s3_object_name, Segment& segment, const std::string& bucket_name,
             PutHeader header = PutHeader::NONE
@@ -0,0 +1,226 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/storage/partial_segment_read.hpp>
+#include <arcticdb/storage/memory_layout.hpp>
+#include <arcticdb/codec/segment.hpp>
+#include <arcticdb/codec/encoding_sizes.hpp>
+#include <arcticdb/codec/magic_words.hpp>
+#include <arcticdb/entity/performance_tracing.hpp>
+#include <arcticdb/util/buffer.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/log/log.hpp>
+
+#include <folly/futures/Future.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace arcticdb::storage {
+
+namespace {
+constexpr int64_t default_prefix_bytes = 64 * 1024;
+constexpr int64_t default_coalesce_bytes = 1024 * 1024;
+
+struct ByteRange {
+    uint64_t begin_;
+    uint64_t end_;
+};
+
+std::vector<ByteRange> coalesce_ranges(std::vector<ByteRange> ranges, uint64_t max_gap) {
+    std::sort(ranges.begin(), ranges.end(), [](const auto& l, const auto& r) { return l.begin_ < r.begin_; });
+    std::vector<ByteRange> output;
+    for (const auto& range : ranges) {
+        if (!output.empty() && range.begin_ <= output.back().end_ + max_gap)
+            output.back().end_ = std::max(output.back().end_, range.end_);
+        else
+            output.push_back(range);
+    }
+    return output;
+}
+
+// Fetches every range concurrently into the same offsets of base
+void read_ranges(
+        Storage& storage, const VariantKey& variant_key, uint8_t* base, const std::vector<ByteRange>& ranges,
+        uint64_t object_size
+) {
+    std::vector<folly::Future<RangeReadOutput>> reads;
+    reads.reserve(ranges.size());
+    for (const auto& range : ranges)
+        reads.emplace_back(
+                storage.read_range(variant_key, range.begin_, range.end_ - range.begin_, base + range.begin_)
+        );
+
+    const auto results = folly::collect(std::move(reads)).get();
+    for (size_t i = 0; i < results.size(); ++i) {
+        util::check(
+                results[i].bytes_read_ == ranges[i].end_ - ranges[i].begin_ && results[i].object_size_ == object_size,
+                "Range [{}, {}) of key {} returned {} bytes of an object of size {}, expected an object of size {}",
+                ranges[i].begin_,
+                ranges[i].end_,
+                variant_key_view(variant_key),
+                results[i].bytes_read_,
+                results[i].object_size_,
+                object_size
+        );
+    }
+}
+} // namespace
+
+ColumnProjectedReadConfig ColumnProjectedReadConfig::from_config() {
+    ColumnProjectedReadConfig config;
+    const auto prefix_bytes = ConfigsMap::instance()->get_int("ColumnProjectedRead.PrefixBytes", default_prefix_bytes);
+    const auto coalesce_bytes =
+            ConfigsMap::instance()->get_int("ColumnProjectedRead.CoalesceBytes", default_coalesce_bytes);
+    util::check(
+            prefix_bytes >= static_cast<int64_t>(FIXED_HEADER_SIZE),
+            "ColumnProjectedRead.PrefixBytes must be at least {}, got {}",
+            FIXED_HEADER_SIZE,
+            prefix_bytes
+    );
+    util::check(coalesce_bytes >= 0, "ColumnProjectedRead.CoalesceBytes must not be negative, got {}", coalesce_bytes);
+    config.prefix_bytes_ = static_cast<uint64_t>(prefix_bytes);
+    config.coalesce_bytes_ = static_cast<uint64_t>(coalesce_bytes);
+    return config;
+}
+
+bool use_column_projected_read(const Storage& storage, const VariantKey& variant_key, const ReadKeyOpts& opts) {
+    return opts.columns_ && variant_key_type(variant_key) == KeyType::TABLE_DATA && storage.supports_range_reads() &&
+           ConfigsMap::instance()->get_int("ColumnProjectedRead.Enabled", 0) == 1;
+}
+
+KeySegmentPair read_segment_columns(
+        Storage& storage, const VariantKey& variant_key, const std::unordered_set<std::string>& columns,
+        const ColumnProjectedReadConfig& config
+) {
+    ARCTICDB_SAMPLE(ReadSegmentColumns, 0)
+    auto buffer = std::make_shared<Buffer>(config.prefix_bytes_);
+    const auto [prefix_bytes, object_size] =
+            storage.read_range(variant_key, 0, config.prefix_bytes_, buffer->data()).get();
+    if (prefix_bytes == object_size) {
+        auto fitted = std::make_shared<Buffer>(object_size);
+        std::memcpy(fitted->data(), buffer->data(), object_size);
+        return {VariantKey{variant_key}, Segment::from_buffer(fitted)};
+    }
+
+    util::check(
+            prefix_bytes >= FIXED_HEADER_SIZE && prefix_bytes < object_size,
+            "Unexpected prefix of {} bytes for key {} of size {}",
+            prefix_bytes,
+            variant_key_view(variant_key),
+            object_size
+    );
+    buffer->ensure(object_size);
+    auto* base = buffer->data();
+    uint64_t fetched = prefix_bytes;
+    const auto read_remainder = [&]() -> KeySegmentPair {
+        read_ranges(storage, variant_key, base, {{fetched, object_size}}, object_size);
+        return {VariantKey{variant_key}, Segment::from_buffer(buffer)};
+    };
+
+    const auto* fixed_hdr = reinterpret_cast<const FixedHeader*>(base);
+    if (fixed_hdr->encoding_version != HEADER_VERSION_V2)
+        return read_remainder();
+
+    const uint64_t header_end = FIXED_HEADER_SIZE + fixed_hdr->header_bytes;
+    util::check(
+            header_end < object_size, "Header of key {} runs past the end of the object", variant_key_view(variant_key)
+    );
+    if (header_end > fetched) {
+        read_ranges(storage, variant_key, base, {{fetched, header_end}}, object_size);
+        fetched = header_end;
+    }
+
+    SegmentHeader seg_hdr;
+    seg_hdr.deserialize_from_bytes(base + FIXED_HEADER_SIZE, true);
+    if (!seg_hdr.has_column_fields())
+        return read_remainder();
+
+    const uint64_t string_pool_bytes =
+            sizeof(StringPoolMagic) +
+            (seg_hdr.has_string_pool_field() ? encoding_sizes::field_compressed_size(seg_hdr.string_pool_field()) : 0);
+    const uint64_t footer_start = header_end + seg_hdr.footer_offset();
+    util::check(
+            footer_start >= header_end + string_pool_bytes && footer_start < object_size,
+            "Footer offset {} of key {} is inconsistent with an object of size {}",
+            seg_hdr.footer_offset(),
+            variant_key_view(variant_key),
+            object_size
+    );
+    const uint64_t columns_end = footer_start - string_pool_bytes;
+    if (const auto tail_start = std::max(columns_end, fetched); tail_start < object_size)
+        read_ranges(storage, variant_key, base, {{tail_start, object_size}}, object_size);
+
+    set_body_fields(seg_hdr, base + header_end);
+    uint64_t column_bytes = 0;
+    const auto& body_fields = seg_hdr.body_fields();
+    for (size_t i = 0; i < body_fields.size(); ++i)
+        column_bytes += encoding_sizes::field_compressed_size(body_fields.at(i)) + sizeof(ColumnMagic);
+
+    util::check(
+            header_end + column_bytes <= columns_end,
+            "Columns of key {} ({} bytes) do not fit before its string pool at {}",
+            variant_key_view(variant_key),
+            column_bytes,
+            columns_end
+    );
+    const uint64_t columns_start = columns_end - column_bytes;
+    if (columns_start > fetched) {
+        read_ranges(storage, variant_key, base, {{fetched, columns_start}}, object_size);
+        fetched = columns_start;
+    }
+
+    // The heading fields and footer are now in place, which is all that constructing the segment reads
+    auto segment = Segment::from_buffer(buffer);
+    const auto& desc = segment.descriptor();
+    util::check(
+            body_fields.size() == desc.field_count(),
+            "Key {} has {} encoded columns but {} fields in its descriptor",
+            variant_key_view(variant_key),
+            body_fields.size(),
+            desc.field_count()
+    );
+    const auto index_field_count = desc.index().field_count();
+    std::vector<ByteRange> ranges;
+    uint64_t skipped_bytes = 0;
+    uint64_t pos = columns_start;
+    for (size_t i = 0; i < body_fields.size(); ++i) {
+        const uint64_t size = encoding_sizes::field_compressed_size(body_fields.at(i)) + sizeof(ColumnMagic);
+        if (i < index_field_count || columns.contains(std::string{desc.field(i).name()})) {
+            // Decoding a column checks the magic number at the start of whatever follows it, so fetch that too
+            const auto end = std::min<uint64_t>(pos + size + sizeof(ColumnMagic), columns_end);
+            if (const auto begin = std::max(pos, fetched); begin < end)
+                ranges.push_back({begin, end});
+        } else {
+            skipped_bytes += size;
+        }
+        pos += size;
+    }
+
+    ARCTICDB_RUNTIME_DEBUG(
+            log::storage(),
+            "Column projected read of key {} skipped {} of {} bytes",
+            variant_key_view(variant_key),
+            skipped_bytes,
+            object_size
+    );
+    if (!ranges.empty())
+        read_ranges(
+                storage, variant_key, base, coalesce_ranges(std::move(ranges), config.coalesce_bytes_), object_size
+        );
+
+    if (skipped_bytes > 0)
+        segment.set_contents(SegmentContents::SELECTED_COLUMNS);
+
+    return {VariantKey{variant_key}, std::move(segment)};
+}
+
+} // namespace arcticdb::storage
@@ -0,0 +1,58 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/storage/storage.hpp>
+#include <arcticdb/storage/storage_options.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+
+namespace arcticdb::storage {
+
+struct ColumnProjectedReadConfig {
+    // Size of the first request for a segment, which should cover the header and leading fields of most segments
+    uint64_t prefix_bytes_ = 0;
+    // Selected columns separated by fewer bytes than this are fetched by one request, reading the unselected columns
+    // between them rather than paying for another round trip
+    uint64_t coalesce_bytes_ = 0;
+
+    // Reads ColumnProjectedRead.PrefixBytes and ColumnProjectedRead.CoalesceBytes
+    static ColumnProjectedReadConfig from_config();
+};
+
+// Whether the read of variant_key should go through read_segment_columns rather than fetching the whole object, which
+// requires ColumnProjectedRead.Enabled, a column selection in opts and a storage that supports range reads
+bool use_column_projected_read(const Storage& storage, const VariantKey& variant_key, const ReadKeyOpts& opts);
+
+/*
+ * Reads a TABLE_DATA segment fetching only the bytes needed to decode the given columns, plus the index columns and
+ * the string pool. The V2 layout is
+ *
+ *   fixed header | segment header | heading fields | column 0 | ... | column n | string pool | encoded fields
+ *
+ * where the segment header records the offset of the encoded fields, and the encoded fields give the compressed size
+ * of every column. The object is read as:
+ *   1. A prefix, which tells us the object size and usually contains the whole segment header.
+ *   2. The string pool and encoded fields, found from the footer offset in the segment header.
+ *   3. Anything remaining of the heading fields, which end where the columns start.
+ *   4. The selected columns, concurrently, with nearby ranges coalesced.
+ *
+ * The result is a Segment over a buffer the size of the whole object in which the unselected columns were never
+ * written. It is marked SegmentContents::SELECTED_COLUMNS, so it cannot be serialized, and the disk and decoded segment
+ * caches do not take it. It must only be decoded with the same column selection. Segments that are not V2 encoded or
+ * have no rows are read in full.
+ */
+KeySegmentPair read_segment_columns(
+        Storage& storage, const VariantKey& variant_key, const std::unordered_set<std::string>& columns,
+        const ColumnProjectedReadConfig& config
+);
+
+} // namespace arcticdb::storage
@@ -262,6 +262,8 @@ void register_common_storage_bindings(py::module& storage, BindingScope scope) {
             .value("TOMBSTONE_ALL", KeyType::TOMBSTONE_ALL)
             .value("SNAPSHOT_TOMBSTONE", KeyType::SNAPSHOT_TOMBSTONE)
             .value("LOG_COMPACTED", KeyType::LOG_COMPACTED)
-            .value("COLUMN_STATS", KeyType::COLUMN_STATS);
+            .value("COLUMN_STATS", KeyType::COLUMN_STATS)
+            .value("VERSION_CATALOGUE", KeyType::VERSION_CATALOGUE)
+            .value("SNAPSHOT_MEMBERSHIP", KeyType::SNAPSHOT_MEMBERSHIP);
 }
 } // namespace arcticdb::storage::apy
@@ -13,6 +13,8 @@
 #include <arcticdb/storage/storage_utils.hpp>
 #include <arcticdb/storage/storage_exceptions.hpp>
 #include <arcticdb/storage/s3/s3_client_interface.hpp>
+#include <arcticdb/storage/s3/s3_ranged_get.hpp>
+#include <arcticdb/async/task_scheduler.hpp>
 #include <arcticdb/entity/serialized_key.hpp>
 #include <arcticdb/util/exponential_backoff.hpp>
 #include <arcticdb/util/configs_map.hpp>
@@ -177,7 +179,8 @@ void do_update_impl(
 template<class KeyBucketizer, class KeyDecoder>
 KeySegmentPair do_read_impl(
         VariantKey&& variant_key, const std::string& root_folder, const std::string& bucket_name,
-        const S3ClientInterface& s3_client, KeyBucketizer&& bucketizer, KeyDecoder&& key_decoder, ReadKeyOpts opts
+        const std::shared_ptr<S3ClientInterface>& s3_client, KeyBucketizer&& bucketizer, KeyDecoder&& key_decoder,
+        ReadKeyOpts opts
 ) {
     ARCTICDB_SAMPLE(S3StorageRead, 0)
     auto key_type = variant_key_type(variant_key);
@@ -185,7 +188,10 @@ KeySegmentPair do_read_impl(
     auto s3_object_name = object_path(bucketizer.bucketize(key_type_dir, variant_key), variant_key);
     auto query_stat_operation_time =
             query_stats::add_task_count_and_time(query_stats::TaskType::S3_GetObject, key_type);
-    auto get_object_result = s3_client.get_object(s3_object_name, bucket_name);
+    const auto ranged_get = RangedGetConfig::from_config();
+    auto get_object_result = ranged_get.applies_to(key_type)
+                                     ? get_object_ranged(s3_client, s3_object_name, bucket_name, ranged_get).get()
+                                     : s3_client->get_object(s3_object_name, bucket_name);
     auto unencoded_key = key_decoder(std::move(variant_key));
 
     if (get_object_result.is_success()) {
@@ -218,12 +224,18 @@ KeySegmentPair do_read_impl(
 template<class KeyBucketizer, class KeyDecoder>
 folly::Future<KeySegmentPair> do_async_read_impl(
         VariantKey&& variant_key, const std::string& root_folder, const std::string& bucket_name,
-        const S3ClientInterface& s3_client, KeyBucketizer&& bucketizer, KeyDecoder&& key_decoder, ReadKeyOpts
+        const std::shared_ptr<S3ClientInterface>& s3_client, KeyBucketizer&& bucketizer, KeyDecoder&& key_decoder,
+        ReadKeyOpts
 ) {
     auto key_type = variant_key_type(variant_key);
     auto key_type_dir = key_type_folder(root_folder, key_type);
     auto s3_object_name = object_path(bucketizer.bucketize(key_type_dir, variant_key), variant_key);
-    return s3_client.get_object_async(s3_object_name, bucket_name)
+    const auto ranged_get = RangedGetConfig::from_config();
+    auto get_object_future = ranged_get.applies_to(key_type)
+                                     ? get_object_ranged(s3_client, s3_object_name, bucket_name, ranged_get)
+                                               .via(&async::io_executor())
+                                     : s3_client->get_object_async(s3_object_name, bucket_name);
+    return std::move(get_object_future)
             .thenValue(
                     [vk = std::move(variant_key),
                      decoder = std::forward<KeyDecoder>(key_decoder),
@@ -252,7 +264,7 @@ folly::Future<KeySegmentPair> do_async_read_impl(
 template<class KeyBucketizer, class KeyDecoder>
 void do_read_impl(
         VariantKey&& variant_key, const ReadVisitor& visitor, const std::string& root_folder,
-        const std::string& bucket_name, const S3ClientInterface& s3_client, KeyBucketizer&& bucketizer,
+        const std::string& bucket_name, const std::shared_ptr<S3ClientInterface>& s3_client, KeyBucketizer&& bucketizer,
         KeyDecoder&& key_decoder, ReadKeyOpts opts
 ) {
     auto key_seg = do_read_impl(
@@ -267,6 +279,35 @@ void do_read_impl(
     visitor(key_seg.variant_key(), std::move(*key_seg.segment_ptr()));
 }
 
+template<class KeyBucketizer>
+folly::Future<RangeReadOutput> do_read_range_impl(
+        const VariantKey& variant_key, uint64_t offset, uint64_t length, uint8_t* dest, const std::string& root_folder,
+        const std::string& bucket_name, const S3ClientInterface& s3_client, KeyBucketizer&& bucketizer
+) {
+    auto key_type = variant_key_type(variant_key);
+    auto key_type_dir = key_type_folder(root_folder, key_type);
+    auto s3_object_name = object_path(bucketizer.bucketize(key_type_dir, variant_key), variant_key);
+    return s3_client.get_object_range_async(s3_object_name, bucket_name, offset, length, dest)
+            .thenValue([s3_object_name, key_type, start = std::chrono::steady_clock::now()](
+                               S3Result<GetObjectRangeOutput>&& result
+                       ) -> RangeReadOutput {
+                auto query_stat_operation_time = query_stats::add_task_count_and_time(
+                        query_stats::TaskType::S3_GetObjectAsync, key_type, start
+                );
+                if (!result.is_success())
+                    raise_s3_exception(result.get_error(), s3_object_name);
+
+                const auto& output = result.get_output();
+                query_stats::add(
+                        query_stats::TaskType::S3_GetObjectAsync,
+                        key_type,
+                        query_stats::StatType::SIZE_BYTES,
+                        output.bytes_read
+                );
+                return RangeReadOutput{output.bytes_read, output.object_size};
+            });
+}
+
 struct FailedDelete {
     std::string failed_key_name;
     std::string error_message;
@@ -188,7 +188,7 @@ void NfsBackedStorage::do_read(VariantKey&& variant_key, const ReadVisitor& visi
             visitor,
             root_folder_,
             bucket_name_,
-            *s3_client_,
+            s3_client_,
             NfsBucketizer{},
             std::move(decoder),
             opts
@@ -199,7 +199,7 @@ KeySegmentPair NfsBackedStorage::do_read(VariantKey&& variant_key, ReadKeyOpts o
     auto encoded_key = encode_object_id(variant_key);
     auto decoder = [](auto&& k) { return unencode_object_id(std::move(k)); };
     return s3::detail::do_read_impl(
-            std::move(encoded_key), root_folder_, bucket_name_, *s3_client_, NfsBucketizer{}, std::move(decoder), opts
+            std::move(encoded_key), root_folder_, bucket_name_, s3_client_, NfsBucketizer{}, std::move(decoder), opts
     );
 }
 
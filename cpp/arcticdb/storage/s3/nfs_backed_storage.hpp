@@ -67,7 +67,7 @@ class NfsBackedStorage final : public Storage {
     const std::string& region() const { return region_; }
 
     std::shared_ptr<s3::S3ApiInstance> s3_api_;
-    std::unique_ptr<storage::s3::S3ClientInterface> s3_client_;
+    std::shared_ptr<storage::s3::S3ClientInterface> s3_client_;
     std::string root_folder_;
     std::string bucket_name_;
     std::string region_;
@@ -8,6 +8,7 @@
 
 #include <arcticdb/storage/s3/s3_client_impl.hpp>
 #include <arcticdb/storage/s3/s3_client_interface.hpp>
+#include <arcticdb/storage/s3/s3_ranged_get.hpp>
 
 #include <aws/s3/S3Client.h>
 
@@ -158,6 +159,99 @@ folly::Future<S3Result<Segment>> S3ClientImpl::get_object_async(
     return future;
 }
 
+struct GetObjectSizeAsyncHandler {
+    std::shared_ptr<folly::Promise<S3Result<uint64_t>>> promise_;
+
+    GetObjectSizeAsyncHandler(std::shared_ptr<folly::Promise<S3Result<uint64_t>>>&& promise) :
+        promise_(std::move(promise)) {}
+
+    ARCTICDB_MOVE_COPY_DEFAULT(GetObjectSizeAsyncHandler)
+
+    void
+    operator()(const Aws::S3::S3Client*, const Aws::S3::Model::HeadObjectRequest&, const Aws::S3::Model::HeadObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) {
+        if (outcome.IsSuccess()) {
+            promise_->setValue<S3Result<uint64_t>>({static_cast<uint64_t>(outcome.GetResult().GetContentLength())});
+        } else {
+            promise_->setValue<S3Result<uint64_t>>({outcome.GetError()});
+        }
+    }
+};
+
+folly::Future<S3Result<uint64_t>> S3ClientImpl::get_object_size_async(
+        const std::string& s3_object_name, const std::string& bucket_name
+) const {
+    auto promise = std::make_shared<folly::Promise<S3Result<uint64_t>>>();
+    auto future = promise->getFuture();
+    Aws::S3::Model::HeadObjectRequest request;
+    request.WithBucket(bucket_name.c_str()).WithKey(s3_object_name.c_str());
+    ARCTICDB_RUNTIME_DEBUG(log::storage(), "Scheduling head of {}", s3_object_name);
+    s3_client.HeadObjectAsync(request, GetObjectSizeAsyncHandler{std::move(promise)});
+    return future;
+}
+
+struct GetObjectRangeAsyncHandler {
+    std::shared_ptr<folly::Promise<S3Result<GetObjectRangeOutput>>> promise_;
+    uint64_t length_;
+
+    GetObjectRangeAsyncHandler(
+            std::shared_ptr<folly::Promise<S3Result<GetObjectRangeOutput>>>&& promise, uint64_t length
+    ) :
+        promise_(std::move(promise)),
+        length_(length) {}
+
+    ARCTICDB_MOVE_COPY_DEFAULT(GetObjectRangeAsyncHandler)
+
+    void
+    operator()(const Aws::S3::S3Client*, const Aws::S3::Model::GetObjectRequest& request, const Aws::S3::Model::GetObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) {
+        if (!outcome.IsSuccess()) {
+            promise_->setValue<S3Result<GetObjectRangeOutput>>({outcome.GetError()});
+            return;
+        }
+
+        const auto& result = outcome.GetResult();
+        const auto bytes_read = static_cast<uint64_t>(result.GetContentLength());
+        auto object_size = parse_content_range_object_size(result.GetContentRange());
+        if (!object_size) {
+            // A server that ignores the Range header sends the whole object, which only fits if it is no longer than
+            // the range that was asked for
+            if (bytes_read > length_) {
+                promise_->setValue<S3Result<GetObjectRangeOutput>>({Aws::S3::S3Error(
+                        Aws::Client::AWSError<Aws::S3::S3Errors>(
+                                Aws::S3::S3Errors::UNKNOWN,
+                                "InvalidRange",
+                                fmt::format("Ranged read of {} was answered without a Content-Range", request.GetKey()),
+                                false
+                        )
+                )});
+                return;
+            }
+            object_size = bytes_read;
+        }
+        promise_->setValue<S3Result<GetObjectRangeOutput>>({GetObjectRangeOutput{bytes_read, *object_size}});
+    }
+};
+
+folly::Future<S3Result<GetObjectRangeOutput>> S3ClientImpl::get_object_range_async(
+        const std::string& s3_object_name, const std::string& bucket_name, uint64_t offset, uint64_t length,
+        uint8_t* dest
+) const {
+    util::check(length > 0, "Cannot read an empty range of {}", s3_object_name);
+    auto promise = std::make_shared<folly::Promise<S3Result<GetObjectRangeOutput>>>();
+    auto future = promise->getFuture();
+    Aws::S3::Model::GetObjectRequest request;
+    request.WithBucket(bucket_name.c_str()).WithKey(s3_object_name.c_str());
+    request.SetRange(fmt::format("bytes={}-{}", offset, offset + length - 1));
+    // The body is written straight into the caller's buffer
+    request.SetResponseStreamFactory([dest, length]() {
+        return Aws::New<boost::interprocess::bufferstream>("", reinterpret_cast<char*>(dest), length);
+    });
+    ARCTICDB_RUNTIME_DEBUG(
+            log::storage(), "Scheduling ranged read of {} bytes at {} of {}", length, offset, s3_object_name
+    );
+    s3_client.GetObjectAsync(request, GetObjectRangeAsyncHandler{std::move(promise), length});
+    return future;
+}
+
 S3Result<std::monostate> S3ClientImpl::put_object(
         const std::string& s3_object_name, Segment& segment, const std::string& bucket_name, PutHeader header
 ) {
@@ -26,6 +26,15 @@ class S3ClientImpl : public S3ClientInterface {
     folly::Future<S3Result<Segment>> get_object_async(const std::string& s3_object_name, const std::string& bucket_name)
             const override;
 
+    folly::Future<S3Result<uint64_t>> get_object_size_async(
+            const std::string& s3_object_name, const std::string& bucket_name
+    ) const override;
+
+    folly::Future<S3Result<GetObjectRangeOutput>> get_object_range_async(
+            const std::string& s3_object_name, const std::string& bucket_name, uint64_t offset, uint64_t length,
+            uint8_t* dest
+    ) const override;
+
     S3Result<std::monostate> put_object(
             const std::string& s3_object_name, Segment& segment, const std::string& bucket_name,
             PutHeader header = PutHeader::NONE
@@ -64,6 +64,12 @@ struct DeleteObjectsOutput {
     std::vector<FailedDelete> failed_deletes;
 };
 
+struct GetObjectRangeOutput {
+    uint64_t bytes_read;
+    // Size of the whole object, not just the range that was read
+    uint64_t object_size;
+};
+
 enum class PutHeader { NONE, IF_NONE_MATCH };
 
 // An abstract class, which is responsible for sending the requests and parsing the responses from S3.
@@ -82,6 +88,18 @@ class S3ClientInterface {
             const std::string& s3_object_name, const std::string& bucket_name
     ) const = 0;
 
+    // The size of the object in bytes, from a HEAD request
+    [[nodiscard]] virtual folly::Future<S3Result<uint64_t>> get_object_size_async(
+            const std::string& s3_object_name, const std::string& bucket_name
+    ) const = 0;
+
+    // Reads up to length bytes of the object, starting at offset, into dest, which must have room for length bytes.
+    // dest must stay valid until the returned future completes.
+    [[nodiscard]] virtual folly::Future<S3Result<GetObjectRangeOutput>> get_object_range_async(
+            const std::string& s3_object_name, const std::string& bucket_name, uint64_t offset, uint64_t length,
+            uint8_t* dest
+    ) const = 0;
+
     virtual S3Result<std::monostate> put_object(
             const std::string& s3_object_name, Segment& segment, const std::string& bucket_name,
             PutHeader header = PutHeader::NONE
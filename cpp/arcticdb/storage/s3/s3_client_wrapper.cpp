@@ -119,6 +119,27 @@ folly::Future<S3Result<Segment>> S3ClientTestWrapper::get_object_async(
     return actual_client_->get_object_async(s3_object_name, bucket_name);
 }
 
+folly::Future<S3Result<uint64_t>> S3ClientTestWrapper::get_object_size_async(
+        const std::string& s3_object_name, const std::string& bucket_name
+) const {
+    if (auto maybe_error = has_failure_trigger(s3_object_name, bucket_name, StorageOperation::READ)) {
+        return folly::makeFuture<S3Result<uint64_t>>({*maybe_error});
+    }
+
+    return actual_client_->get_object_size_async(s3_object_name, bucket_name);
+}
+
+folly::Future<S3Result<GetObjectRangeOutput>> S3ClientTestWrapper::get_object_range_async(
+        const std::string& s3_object_name, const std::string& bucket_name, uint64_t offset, uint64_t length,
+        uint8_t* dest
+) const {
+    if (auto maybe_error = has_failure_trigger(s3_object_name, bucket_name, StorageOperation::READ)) {
+        return folly::makeFuture<S3Result<GetObjectRangeOutput>>({*maybe_error});
+    }
+
+    return actual_client_->get_object_range_async(s3_object_name, bucket_name, offset, length, dest);
+}
+
 S3Result<std::monostate> S3ClientTestWrapper::put_object(
         const std::string& s3_object_name, Segment& segment, const std::string& bucket_name, PutHeader header
 ) {
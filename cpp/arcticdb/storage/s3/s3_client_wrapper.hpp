@@ -17,7 +17,7 @@ namespace arcticdb::storage::s3 {
 // to simulate failures or track operations for testing purposes.
 class S3ClientTestWrapper : public S3ClientInterface {
   public:
-    explicit S3ClientTestWrapper(std::unique_ptr<S3ClientInterface> actual_client) :
+    explicit S3ClientTestWrapper(std::shared_ptr<S3ClientInterface> actual_client) :
         actual_client_(std::move(actual_client)) {}
 
     ~S3ClientTestWrapper() override = default;
@@ -45,6 +45,15 @@ class S3ClientTestWrapper : public S3ClientInterface {
             const std::string& s3_object_name, const std::string& bucket_name
     ) const override;
 
+    [[nodiscard]] folly::Future<S3Result<uint64_t>> get_object_size_async(
+            const std::string& s3_object_name, const std::string& bucket_name
+    ) const override;
+
+    [[nodiscard]] folly::Future<S3Result<GetObjectRangeOutput>> get_object_range_async(
+            const std::string& s3_object_name, const std::string& bucket_name, uint64_t offset, uint64_t length,
+            uint8_t* dest
+    ) const override;
+
     S3Result<std::monostate> put_object(
             const std::string& s3_object_name, Segment& segment, const std::string& bucket_name,
             PutHeader header = PutHeader::NONE
@@ -72,7 +81,7 @@ class S3ClientTestWrapper : public S3ClientInterface {
             const std::string& s3_object_name, const std::string& bucket_name, StorageOperation operation
     ) const;
 
-    std::unique_ptr<S3ClientInterface> actual_client_;
+    std::shared_ptr<S3ClientInterface> actual_client_;
     // Failing listing operations based on symbol names isn't sufficient for testing the express bucket fallback
     // mechanism. Allow setting a list of failure modes for list_objects calls. This list will be popped from until
     // empty, at which point the listing operation will succeed.
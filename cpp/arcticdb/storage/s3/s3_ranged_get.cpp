@@ -0,0 +1,121 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/storage/s3/s3_ranged_get.hpp>
+#include <arcticdb/util/buffer.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/util/preconditions.hpp>
+#include <arcticdb/log/log.hpp>
+
+#include <folly/futures/Future.h>
+
+#include <algorithm>
+#include <charconv>
+#include <memory>
+#include <vector>
+
+namespace arcticdb::storage::s3 {
+
+namespace {
+constexpr int64_t default_part_bytes = 8 * 1024 * 1024;
+
+folly::Future<S3Result<Segment>> fetch_parts(
+        std::shared_ptr<const S3ClientInterface> s3_client, const std::string& s3_object_name,
+        const std::string& bucket_name, const RangedGetConfig& config, uint64_t object_size
+) {
+    auto buffer = std::make_shared<Buffer>(object_size);
+    std::vector<folly::Future<S3Result<GetObjectRangeOutput>>> parts;
+    parts.reserve((object_size + config.part_bytes_ - 1) / config.part_bytes_);
+    std::vector<uint64_t> part_lengths;
+    for (uint64_t offset = 0; offset < object_size; offset += config.part_bytes_) {
+        const auto length = std::min(config.part_bytes_, object_size - offset);
+        part_lengths.push_back(length);
+        parts.emplace_back(
+                s3_client->get_object_range_async(s3_object_name, bucket_name, offset, length, buffer->data() + offset)
+        );
+    }
+    ARCTICDB_RUNTIME_DEBUG(
+            log::storage(), "Reading {} bytes of {} in {} parts", object_size, s3_object_name, parts.size()
+    );
+    return folly::collectAll(std::move(parts))
+            .thenValue([s3_client = std::move(s3_client),
+                        buffer = std::move(buffer),
+                        part_lengths = std::move(part_lengths),
+                        object_size,
+                        s3_object_name](std::vector<folly::Try<S3Result<GetObjectRangeOutput>>>&& results
+                       ) -> S3Result<Segment> {
+                for (size_t i = 0; i < results.size(); ++i) {
+                    auto& part = results[i].value();
+                    if (!part.is_success())
+                        return {part.get_error()};
+
+                    const auto& output = part.get_output();
+                    util::check(
+                            output.object_size == object_size && output.bytes_read == part_lengths[i],
+                            "Part {} of {} returned {} bytes of an object of size {}, expected {} bytes of {}",
+                            i,
+                            s3_object_name,
+                            output.bytes_read,
+                            output.object_size,
+                            part_lengths[i],
+                            object_size
+                    );
+                }
+                return {Segment::from_buffer(buffer)};
+            });
+}
+} // namespace
+
+RangedGetConfig RangedGetConfig::from_config() {
+    RangedGetConfig config;
+    const auto threshold = ConfigsMap::instance()->get_int("S3Storage.RangedGetThresholdBytes", 0);
+    const auto part_bytes = ConfigsMap::instance()->get_int("S3Storage.RangedGetPartBytes", default_part_bytes);
+    util::check(threshold >= 0, "S3Storage.RangedGetThresholdBytes must not be negative, got {}", threshold);
+    util::check(part_bytes > 0, "S3Storage.RangedGetPartBytes must be positive, got {}", part_bytes);
+    config.threshold_bytes_ = static_cast<uint64_t>(threshold);
+    config.part_bytes_ = static_cast<uint64_t>(part_bytes);
+    return config;
+}
+
+std::optional<uint64_t> parse_content_range_object_size(std::string_view content_range) {
+    const auto slash = content_range.rfind('/');
+    if (slash == std::string_view::npos)
+        return std::nullopt;
+
+    // The complete length is "*" when the server does not know it
+    const auto size_str = content_range.substr(slash + 1);
+    uint64_t object_size = 0;
+    const auto [end, ec] = std::from_chars(size_str.data(), size_str.data() + size_str.size(), object_size);
+    if (ec != std::errc{} || end != size_str.data() + size_str.size())
+        return std::nullopt;
+
+    return object_size;
+}
+
+folly::Future<S3Result<Segment>> get_object_ranged(
+        std::shared_ptr<const S3ClientInterface> s3_client, const std::string& s3_object_name,
+        const std::string& bucket_name, const RangedGetConfig& config
+) {
+    util::check(config.enabled(), "Ranged read of {} requested with ranged reads disabled", s3_object_name);
+    auto size_future = s3_client->get_object_size_async(s3_object_name, bucket_name);
+    return std::move(size_future)
+            .thenValue([s3_client = std::move(s3_client), s3_object_name, bucket_name, config](
+                               S3Result<uint64_t>&& object_size
+                       ) mutable -> folly::Future<S3Result<Segment>> {
+                if (!object_size.is_success())
+                    return folly::makeFuture<S3Result<Segment>>({object_size.get_error()});
+
+                const auto size = object_size.get_output();
+                if (size <= config.threshold_bytes_)
+                    return s3_client->get_object_async(s3_object_name, bucket_name);
+
+                return fetch_parts(std::move(s3_client), s3_object_name, bucket_name, config, size);
+            });
+}
+
+} // namespace arcticdb::storage::s3
@@ -0,0 +1,56 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/storage/s3/s3_client_interface.hpp>
+
+#include <folly/futures/Future.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace arcticdb::storage::s3 {
+
+struct RangedGetConfig {
+    // Objects larger than this are fetched in parts, and smaller ones by a plain GetObject. 0 disables ranged reads.
+    uint64_t threshold_bytes_ = 0;
+    // Larger objects are fetched by concurrent requests of this many bytes each
+    uint64_t part_bytes_ = 0;
+
+    [[nodiscard]] bool enabled() const { return threshold_bytes_ != 0; }
+
+    // Only TABLE_DATA keys are large enough to benefit, so other keys are read without the extra HEAD request.
+    // TABLE_DATA keys are never overwritten, so the parts of an object cannot come from different versions of it
+    [[nodiscard]] bool applies_to(KeyType key_type) const { return enabled() && key_type == KeyType::TABLE_DATA; }
+
+    // Reads S3Storage.RangedGetThresholdBytes and S3Storage.RangedGetPartBytes
+    static RangedGetConfig from_config();
+};
+
+// Returns the complete length from a Content-Range header such as "bytes 0-99/1234", if it is known
+std::optional<uint64_t> parse_content_range_object_size(std::string_view content_range);
+
+/*
+ * Fetches an object with byte-range GETs. A HEAD request gives the size of the object. Objects no larger than the
+ * threshold are then read with a single GetObject. For larger ones a buffer of the size of the whole object is
+ * allocated, and every part is requested at once, each written by its response stream directly into its place in that
+ * buffer. The result is a Segment over the one buffer, exactly as get_object would return. The object size reported
+ * by every part is checked against the HEAD.
+ *
+ * The client is held by the returned future, which can outlive the caller.
+ */
+folly::Future<S3Result<Segment>> get_object_ranged(
+        std::shared_ptr<const S3ClientInterface> s3_client, const std::string& s3_object_name,
+        const std::string& bucket_name, const RangedGetConfig& config
+);
+
+} // namespace arcticdb::storage::s3
@@ -61,7 +61,7 @@ void S3Storage::do_read(VariantKey&& variant_key, const ReadVisitor& visitor, Re
             visitor,
             root_folder_,
             bucket_name_,
-            client(),
+            s3_client_,
             FlatBucketizer{},
             std::move(identity),
             opts
@@ -71,7 +71,7 @@ void S3Storage::do_read(VariantKey&& variant_key, const ReadVisitor& visitor, Re
 KeySegmentPair S3Storage::do_read(VariantKey&& variant_key, ReadKeyOpts opts) {
     auto identity = [](auto&& k) { return k; };
     return detail::do_read_impl(
-            std::move(variant_key), root_folder_, bucket_name_, client(), FlatBucketizer{}, std::move(identity), opts
+            std::move(variant_key), root_folder_, bucket_name_, s3_client_, FlatBucketizer{}, std::move(identity), opts
     );
 }
 
@@ -83,7 +83,7 @@ folly::Future<folly::Unit> S3Storage::do_async_read(
                    std::move(variant_key),
                    root_folder_,
                    bucket_name_,
-                   client(),
+                   s3_client_,
                    FlatBucketizer{},
                    std::move(identity),
                    opts
@@ -97,7 +97,7 @@ folly::Future<folly::Unit> S3Storage::do_async_read(
 folly::Future<KeySegmentPair> S3Storage::do_async_read(entity::VariantKey&& variant_key, ReadKeyOpts opts) {
     auto identity = [](auto&& k) { return k; };
     return detail::do_async_read_impl(
-            std::move(variant_key), root_folder_, bucket_name_, client(), FlatBucketizer{}, std::move(identity), opts
+            std::move(variant_key), root_folder_, bucket_name_, s3_client_, FlatBucketizer{}, std::move(identity), opts
     );
 }
 
@@ -172,6 +172,14 @@ void S3Storage::do_visit_object_sizes(KeyType key_type, const std::string& prefi
     }
 }
 
+folly::Future<RangeReadOutput> S3Storage::do_read_range(
+        const VariantKey& variant_key, uint64_t offset, uint64_t length, uint8_t* dest
+) {
+    return detail::do_read_range_impl(
+            variant_key, offset, length, dest, root_folder_, bucket_name_, client(), FlatBucketizer{}
+    );
+}
+
 bool S3Storage::do_key_exists(const VariantKey& key) {
     return detail::do_key_exists_impl(key, root_folder_, bucket_name_, client(), FlatBucketizer{});
 }
@@ -40,6 +40,8 @@ class S3Storage : public Storage, AsyncStorage {
 
     bool supports_object_size_calculation() const final;
 
+    bool supports_range_reads() const final { return true; }
+
     std::optional<size_t> max_delete_batch_size() const override;
 
     // These are only public for testing purposes
@@ -69,6 +71,10 @@ class S3Storage : public Storage, AsyncStorage {
 
     void do_visit_object_sizes(KeyType key_type, const std::string& prefix, const ObjectSizesVisitor& visitor) final;
 
+    folly::Future<RangeReadOutput> do_read_range(
+            const VariantKey& variant_key, uint64_t offset, uint64_t length, uint8_t* dest
+    ) final;
+
     bool do_iterate_type_until_match(KeyType key_type, const IterateTypePredicate& visitor, const std::string& prefix)
             final;
 
@@ -88,7 +94,8 @@ class S3Storage : public Storage, AsyncStorage {
     const std::string& root_folder() const { return root_folder_; }
 
     std::shared_ptr<S3ApiInstance> s3_api_;
-    std::unique_ptr<S3ClientInterface> s3_client_;
+    // Shared with the continuations of ranged reads, which can outlive a call into the storage
+    std::shared_ptr<S3ClientInterface> s3_client_;
     // aws sdk annoyingly requires raw pointer being passed in the sts client factory to the s3 client
     // thus sts_client_ should have same life span as s3_client_
     std::unique_ptr<Aws::STS::STSClient> sts_client_;
@@ -56,6 +56,12 @@ struct ObjectSizes {
     std::atomic_uint64_t compressed_size_;
 };
 
+struct RangeReadOutput {
+    uint64_t bytes_read_ = 0;
+    // Size of the whole object, not just the range that was read
+    uint64_t object_size_ = 0;
+};
+
 enum class SupportsAtomicWrites {
     NO,
     YES,
@@ -163,6 +169,20 @@ class Storage {
         do_visit_object_sizes(key_type, prefix, visitor);
     }
 
+    // Whether read_range is available, allowing part of a segment to be fetched without downloading all of it
+    [[nodiscard]] virtual bool supports_range_reads() const { return false; }
+
+    // Reads up to length bytes of the object for variant_key, starting at offset, into dest, which must stay valid
+    // until the returned future completes
+    folly::Future<RangeReadOutput> read_range(
+            const VariantKey& variant_key, uint64_t offset, uint64_t length, uint8_t* dest
+    ) {
+        util::check(
+                supports_range_reads(), "read_range called on storage {} which does not support range reads", name()
+        );
+        return do_read_range(variant_key, offset, length, dest);
+    }
+
     bool scan_for_matching_key(KeyType key_type, const IterateTypePredicate& predicate) {
         return do_iterate_type_until_match(key_type, predicate, std::string());
     }
@@ -269,6 +289,14 @@ class Storage {
         );
     }
 
+    virtual folly::Future<RangeReadOutput> do_read_range(
+            [[maybe_unused]] const VariantKey& variant_key, [[maybe_unused]] uint64_t offset,
+            [[maybe_unused]] uint64_t length, [[maybe_unused]] uint8_t* dest
+    ) {
+        // Must be overridden if you want to use this
+        util::raise_rte("do_read_range called on storage {} that does not support range reads", name());
+    }
+
     [[nodiscard]] virtual std::string do_key_path(const VariantKey& key) const = 0;
 
     [[nodiscard]] virtual const std::set<char>& do_unsupported_symbol_chars() const {
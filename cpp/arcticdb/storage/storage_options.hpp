@@ -8,6 +8,10 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <unordered_set>
+
 namespace arcticdb::storage {
 
 /**
@@ -35,6 +39,12 @@ struct ReadKeyOpts {
      * - s3_storage-inl.cpp:do_read_impl()
      */
     bool dont_warn_about_missing_key = false;
+
+    /**
+     * If set, the caller will only decode these columns (and the index) of the segment. Storages that support range
+     * reads may then fetch only the parts of the object holding them, see partial_segment_read.hpp.
+     */
+    std::shared_ptr<const std::unordered_set<std::string>> columns_;
 };
 
 /**
@@ -15,6 +15,8 @@
 #include <arcticdb/util/configs_map.hpp>
 #include <arcticdb/storage/single_file_storage.hpp>
 #include <arcticdb/storage/storage.hpp>
+#include <arcticdb/storage/partial_segment_read.hpp>
+#include <arcticdb/storage/disk_cache.hpp>
 
 #include <memory>
 #include <vector>
@@ -29,6 +31,9 @@ namespace arcticdb::storage {
  *  - Disaster recovery for Storages: if the first storage fails we can fall back to the second one, etc.
  *  - Tiered storage: recent data goes to a fast, comparatively expensive storage and then is gradually moved
  *  into a slower, cheaper one.
+ *
+ * Immutable keys read from or written to the primary storage go through the local DiskCache when it is enabled for
+ * their key type.
  */
 class Storages {
   public:
@@ -39,11 +44,18 @@ class Storages {
 
     using StorageVector = std::vector<std::shared_ptr<Storage>>;
 
-    Storages(StorageVector&& storages, OpenMode mode) : storages_(std::move(storages)), mode_(mode) {}
+    Storages(
+            StorageVector&& storages, OpenMode mode, std::shared_ptr<DiskCache> disk_cache = DiskCache::instance()
+    ) :
+        storages_(std::move(storages)),
+        mode_(mode),
+        disk_cache_(std::move(disk_cache)) {}
 
     void write(KeySegmentPair& key_seg) {
         ARCTICDB_SAMPLE(StoragesWrite, 0)
         primary().write(key_seg);
+        if (use_disk_cache(key_seg.variant_key()))
+            disk_cache_->put(disk_cache_name(), key_seg.variant_key(), *key_seg.segment_ptr());
     }
 
     void write_if_none(KeySegmentPair& kv) { primary().write_if_none(kv); }
@@ -107,6 +119,12 @@ class Storages {
             const VariantKey& variant_key, const ReadVisitor& visitor, ReadKeyOpts opts, bool primary_only = true
     ) {
         ARCTICDB_RUNTIME_SAMPLE(StoragesRead, 0)
+        if (primary_only && use_disk_cache(variant_key)) {
+            auto key_seg = read_through_disk_cache(variant_key, std::move(opts));
+            visitor(key_seg.variant_key(), std::move(*key_seg.segment_ptr()));
+            return;
+        }
+
         if (primary_only || variant_key_type(variant_key) != KeyType::TABLE_DATA)
             return primary().read(VariantKey{variant_key}, visitor, opts);
 
@@ -115,6 +133,14 @@ class Storages {
 
     KeySegmentPair read_sync(const VariantKey& variant_key, ReadKeyOpts opts, bool primary_only = true) {
         ARCTICDB_RUNTIME_SAMPLE(StoragesRead, 0)
+        if (primary_only && use_disk_cache(variant_key))
+            return read_through_disk_cache(variant_key, std::move(opts));
+
+        if (primary_only && use_column_projected_read(primary(), variant_key, opts))
+            return read_segment_columns(
+                    primary(), variant_key, *opts.columns_, ColumnProjectedReadConfig::from_config()
+            );
+
         if (primary_only || variant_key_type(variant_key) != KeyType::TABLE_DATA)
             return primary().read(VariantKey{variant_key}, opts);
 
@@ -133,7 +159,13 @@ class Storages {
     }
 
     static folly::Future<KeySegmentPair> async_read(Storage& storage, VariantKey&& variant_key, ReadKeyOpts opts) {
-        if (storage.has_async_api()) {
+        if (use_column_projected_read(storage, variant_key, opts)) {
+            return folly::makeFutureWith([&storage, &variant_key, &opts] {
+                return read_segment_columns(
+                        storage, variant_key, *opts.columns_, ColumnProjectedReadConfig::from_config()
+                );
+            });
+        } else if (storage.has_async_api()) {
             return storage.async_api()->async_read(std::move(variant_key), opts);
         } else {
             auto key_seg = storage.read(std::move(variant_key), opts);
@@ -145,6 +177,13 @@ class Storages {
             VariantKey&& variant_key, const ReadVisitor& visitor, ReadKeyOpts opts, bool primary_only = true
     ) {
         ARCTICDB_RUNTIME_SAMPLE(StoragesRead, 0)
+        if (primary_only && use_disk_cache(variant_key)) {
+            return async_read_through_disk_cache(std::move(variant_key), std::move(opts))
+                    .thenValue([visitor](KeySegmentPair&& key_seg) {
+                        visitor(key_seg.variant_key(), std::move(*key_seg.segment_ptr()));
+                    });
+        }
+
         if (primary_only || variant_key_type(variant_key) != KeyType::TABLE_DATA)
             return async_read(primary(), std::move(variant_key), visitor, opts);
 
@@ -158,6 +197,9 @@ class Storages {
 
     folly::Future<KeySegmentPair> read(VariantKey&& variant_key, ReadKeyOpts opts, bool primary_only = true) {
         ARCTICDB_RUNTIME_SAMPLE(StoragesRead, 0)
+        if (primary_only && use_disk_cache(variant_key))
+            return async_read_through_disk_cache(std::move(variant_key), std::move(opts));
+
         if (primary_only || variant_key_type(variant_key) != KeyType::TABLE_DATA)
             return async_read(primary(), std::move(variant_key), opts);
 
@@ -209,9 +251,20 @@ class Storages {
     /** Calls Storage::do_key_path on the primary storage. Remember to check the open mode. */
     [[nodiscard]] std::string key_path(const VariantKey& key) const { return primary().key_path(key); }
 
-    void remove(VariantKey&& variant_key, storage::RemoveOpts opts) { primary().remove(std::move(variant_key), opts); }
+    void remove(VariantKey&& variant_key, storage::RemoveOpts opts) {
+        if (use_disk_cache(variant_key))
+            disk_cache_->remove(disk_cache_name(), variant_key);
 
-    void remove(std::span<VariantKey> variant_keys, storage::RemoveOpts opts) { primary().remove(variant_keys, opts); }
+        primary().remove(std::move(variant_key), opts);
+    }
+
+    void remove(std::span<VariantKey> variant_keys, storage::RemoveOpts opts) {
+        for (const auto& variant_key : variant_keys) {
+            if (use_disk_cache(variant_key))
+                disk_cache_->remove(disk_cache_name(), variant_key);
+        }
+        primary().remove(variant_keys, opts);
+    }
 
     [[nodiscard]] std::optional<size_t> max_delete_batch_size() const { return primary().max_delete_batch_size(); }
 
@@ -262,8 +315,49 @@ class Storages {
         return *storages_[0];
     }
 
+    [[nodiscard]] bool use_disk_cache(const VariantKey& variant_key) const {
+        return disk_cache_ && disk_cache_->caches(variant_key_type(variant_key));
+    }
+
+    // Keys are only unique within a library, so cache entries are scoped by the library as well as the storage
+    [[nodiscard]] std::string disk_cache_name() const {
+        return fmt::format("{}:{}", primary().name(), primary().library_path());
+    }
+
+    std::optional<KeySegmentPair> read_from_disk_cache(const VariantKey& variant_key) {
+        auto segment = disk_cache_->get(disk_cache_name(), variant_key);
+        if (!segment)
+            return std::nullopt;
+
+        return KeySegmentPair{VariantKey{variant_key}, std::move(*segment)};
+    }
+
+    KeySegmentPair read_through_disk_cache(const VariantKey& variant_key, ReadKeyOpts opts) {
+        if (auto cached = read_from_disk_cache(variant_key))
+            return std::move(*cached);
+
+        // Only whole segments can be cached, so read the key in full even if a column projected read was requested
+        opts.columns_.reset();
+        auto key_seg = primary().read(VariantKey{variant_key}, opts);
+        disk_cache_->put(disk_cache_name(), key_seg.variant_key(), *key_seg.segment_ptr());
+        return key_seg;
+    }
+
+    folly::Future<KeySegmentPair> async_read_through_disk_cache(VariantKey&& variant_key, ReadKeyOpts opts) {
+        if (auto cached = read_from_disk_cache(variant_key))
+            return folly::makeFuture(std::move(*cached));
+
+        opts.columns_.reset();
+        return async_read(primary(), std::move(variant_key), opts)
+                .thenValue([disk_cache = disk_cache_, name = disk_cache_name()](KeySegmentPair&& key_seg) {
+                    disk_cache->put(name, key_seg.variant_key(), *key_seg.segment_ptr());
+                    return std::move(key_seg);
+                });
+    }
+
     std::vector<std::shared_ptr<Storage>> storages_;
     OpenMode mode_;
+    std::shared_ptr<DiskCache> disk_cache_;
 };
 
 inline std::shared_ptr<Storages> create_storages(
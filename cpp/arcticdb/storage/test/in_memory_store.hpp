@@ -48,9 +48,10 @@ class InMemoryStore : public Store {
         return storage::OpenMode::DELETE;
     }
 
-    std::vector<folly::Future<pipelines::SegmentAndSlice>>
-    batch_read_uncompressed(std::vector<pipelines::RangesAndKey>&&, std::shared_ptr<std::unordered_set<std::string>>)
-            override {
+    std::vector<folly::Future<pipelines::SegmentAndSlice>> batch_read_uncompressed(
+            std::vector<pipelines::RangesAndKey>&&, std::shared_ptr<std::unordered_set<std::string>>,
+            std::shared_ptr<BlockFilter>
+    ) override {
         throw std::runtime_error("Not implemented for tests");
     }
 
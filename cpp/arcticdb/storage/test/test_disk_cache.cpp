@@ -0,0 +1,177 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+#include <arcticdb/storage/disk_cache.hpp>
+#include <arcticdb/storage/storages.hpp>
+#include <arcticdb/storage/memory/memory_storage.hpp>
+#include <arcticdb/storage/test/common.hpp>
+#include <arcticdb/util/clock.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace arcticdb;
+using namespace arcticdb::storage;
+
+namespace {
+constexpr auto storage_name = "test_storage";
+
+class DiskCacheTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        path_ = std::filesystem::temp_directory_path() /
+                fmt::format("arcticdb_disk_cache_test_{}", util::SysClock::nanos_since_epoch());
+    }
+
+    void TearDown() override { std::filesystem::remove_all(path_); }
+
+    [[nodiscard]] DiskCacheConfig config(uint64_t max_bytes) const {
+        return DiskCacheConfig{path_.string(), max_bytes, {KeyType::TABLE_DATA, KeyType::TABLE_INDEX}};
+    }
+
+    // The size of one cache entry for a test key and segment
+    [[nodiscard]] uint64_t entry_bytes() const {
+        DiskCache cache{config(1UL << 30)};
+        auto segment = get_test_segment();
+        cache.put(storage_name, get_test_key("x"), segment);
+        const auto bytes = cache.size_bytes();
+        cache.remove(storage_name, get_test_key("x"));
+        return bytes;
+    }
+
+    std::filesystem::path path_;
+};
+
+void put_test_segment(DiskCache& cache, const VariantKey& key) {
+    auto segment = get_test_segment();
+    cache.put(storage_name, key, segment);
+}
+} // namespace
+
+TEST(DiskCacheKeyTypes, Parse) {
+    ASSERT_EQ(
+            parse_cacheable_key_types("TABLE_DATA, TABLE_INDEX"),
+            (std::unordered_set<KeyType>{KeyType::TABLE_DATA, KeyType::TABLE_INDEX})
+    );
+    ASSERT_TRUE(parse_cacheable_key_types("").empty());
+    ASSERT_THROW(parse_cacheable_key_types("NOT_A_KEY_TYPE"), std::exception);
+    ASSERT_THROW(parse_cacheable_key_types("VERSION_REF"), std::exception);
+    ASSERT_THROW(parse_cacheable_key_types("TABLE_DATA,VERSION"), std::exception);
+}
+
+TEST_F(DiskCacheTest, Disabled) {
+    DiskCache cache{DiskCacheConfig{}};
+    ASSERT_FALSE(cache.enabled());
+    ASSERT_FALSE(cache.caches(KeyType::TABLE_DATA));
+    put_test_segment(cache, get_test_key("a"));
+    ASSERT_FALSE(cache.get(storage_name, get_test_key("a")).has_value());
+    ASSERT_FALSE(std::filesystem::exists(path_));
+}
+
+TEST_F(DiskCacheTest, RejectsPartialSegments) {
+    DiskCache cache{config(1UL << 30)};
+    auto segment = get_test_segment();
+    segment.set_contents(SegmentContents::SELECTED_COLUMNS);
+    cache.put(storage_name, get_test_key("a"), segment);
+    ASSERT_EQ(cache.num_entries(), 0);
+    ASSERT_FALSE(cache.get(storage_name, get_test_key("a")).has_value());
+}
+
+TEST_F(DiskCacheTest, RoundTrip) {
+    DiskCache cache{config(1UL << 30)};
+    const auto key = get_test_key("a");
+    ASSERT_FALSE(cache.get(storage_name, key).has_value());
+    put_test_segment(cache, key);
+    ASSERT_EQ(cache.num_entries(), 1UL);
+
+    auto segment = cache.get(storage_name, key);
+    ASSERT_TRUE(segment.has_value());
+    auto expected = get_test_segment();
+    ASSERT_EQ(segment->calculate_size(), expected.calculate_size());
+    ASSERT_EQ(decode_segment(*segment).row_count(), decode_segment(expected).row_count());
+
+    // Entries are scoped by storage and by key type
+    ASSERT_FALSE(cache.get("other_storage", key).has_value());
+    put_test_segment(cache, get_test_key("a", KeyType::VERSION));
+    ASSERT_EQ(cache.num_entries(), 1UL);
+
+    cache.remove(storage_name, key);
+    ASSERT_EQ(cache.num_entries(), 0UL);
+    ASSERT_EQ(cache.size_bytes(), 0UL);
+    ASSERT_FALSE(cache.get(storage_name, key).has_value());
+}
+
+TEST_F(DiskCacheTest, EvictsLeastRecentlyUsed) {
+    DiskCache cache{config(2 * entry_bytes())};
+    put_test_segment(cache, get_test_key("a"));
+    put_test_segment(cache, get_test_key("b"));
+    ASSERT_TRUE(cache.get(storage_name, get_test_key("a")).has_value());
+
+    put_test_segment(cache, get_test_key("c"));
+    ASSERT_EQ(cache.num_entries(), 2UL);
+    ASSERT_TRUE(cache.get(storage_name, get_test_key("a")).has_value());
+    ASSERT_FALSE(cache.get(storage_name, get_test_key("b")).has_value());
+    ASSERT_TRUE(cache.get(storage_name, get_test_key("c")).has_value());
+}
+
+TEST_F(DiskCacheTest, EntriesSurviveRestart) {
+    const auto max_bytes = 2 * entry_bytes();
+    {
+        DiskCache cache{config(max_bytes)};
+        put_test_segment(cache, get_test_key("a"));
+    }
+    std::ofstream{path_ / "leftover.tmp"} << "partial";
+
+    DiskCache cache{config(max_bytes)};
+    ASSERT_EQ(cache.num_entries(), 1UL);
+    ASSERT_FALSE(std::filesystem::exists(path_ / "leftover.tmp"));
+    ASSERT_TRUE(cache.get(storage_name, get_test_key("a")).has_value());
+}
+
+TEST_F(DiskCacheTest, RemovedFileIsAMiss) {
+    DiskCache cache{config(1UL << 30)};
+    put_test_segment(cache, get_test_key("a"));
+    for (const auto& file : std::filesystem::recursive_directory_iterator{path_}) {
+        if (file.is_regular_file())
+            std::filesystem::remove(file.path());
+    }
+    ASSERT_FALSE(cache.get(storage_name, get_test_key("a")).has_value());
+    ASSERT_EQ(cache.num_entries(), 0UL);
+}
+
+TEST_F(DiskCacheTest, StoragesReadThrough) {
+    auto disk_cache = std::make_shared<DiskCache>(config(1UL << 30));
+    auto library_path = LibraryPath::from_delim_path("disk_cache.test");
+    auto memory_storage = std::make_shared<MemoryStorage>(library_path, OpenMode::DELETE, MemoryStorage::Config{});
+    Storages storages{Storages::StorageVector{memory_storage}, OpenMode::DELETE, disk_cache};
+
+    const auto key = get_test_key("a");
+    KeySegmentPair key_seg{VariantKey{key}, get_test_segment()};
+    storages.write(key_seg);
+    ASSERT_EQ(disk_cache->num_entries(), 1UL);
+
+    // Served from the cache once the key has gone from the underlying storage
+    memory_storage->remove(VariantKey{key}, RemoveOpts{});
+    ASSERT_NO_THROW(storages.read_sync(key, ReadKeyOpts{}));
+    ASSERT_NO_THROW(storages.read(VariantKey{key}, ReadKeyOpts{}).get());
+
+    storages.remove(VariantKey{key}, RemoveOpts{true});
+    ASSERT_EQ(disk_cache->num_entries(), 0UL);
+    ASSERT_THROW(storages.read_sync(key, ReadKeyOpts{}), KeyNotFoundException);
+
+    // Reads of keys missing from the cache populate it
+    write_in_store(*memory_storage, "b");
+    storages.read_sync(get_test_key("b"), ReadKeyOpts{});
+    ASSERT_EQ(disk_cache->num_entries(), 1UL);
+
+    // Key types that are not configured are never cached
+    write_in_store(*memory_storage, "c", KeyType::VERSION);
+    storages.read_sync(get_test_key("c", KeyType::VERSION), ReadKeyOpts{});
+    ASSERT_EQ(disk_cache->num_entries(), 1UL);
+}
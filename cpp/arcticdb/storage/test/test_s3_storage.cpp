@@ -11,7 +11,12 @@
 #include <arcticdb/storage/s3/s3_api.hpp>
 #include <arcticdb/storage/s3/s3_storage.hpp>
 #include <arcticdb/storage/s3/s3_client_wrapper.hpp>
+#include <arcticdb/storage/s3/s3_ranged_get.hpp>
+#include <arcticdb/storage/mock/s3_mock_client.hpp>
 #include <arcticdb/storage/s3/nfs_backed_storage.hpp>
+#include <arcticdb/storage/partial_segment_read.hpp>
+#include <arcticdb/codec/default_codecs.hpp>
+#include <arcticdb/toolbox/query_stats.hpp>
 #include <arcticdb/entity/protobufs.hpp>
 #include <arcticdb/entity/variant_key.hpp>
 #include <arcticdb/storage/test/common.hpp>
@@ -458,6 +463,173 @@ TEST_F(S3StorageFixture, test_list_directory_bucket_failure) {
     ASSERT_FALSE(store.directory_bucket());
 }
 
+TEST_F(S3StorageFixture, test_read_in_parts) {
+    ScopedConfig ranged_get({{"S3Storage.RangedGetThresholdBytes", 64}, {"S3Storage.RangedGetPartBytes", 50}});
+    write_in_store(store, "symbol");
+
+    ASSERT_EQ(read_in_store(store, "symbol"), "symbol");
+    ASSERT_THROW(read_in_store(store, "symbol-not-present"), KeyNotFoundException);
+    ASSERT_THROW(
+            read_in_store(
+                    store,
+                    S3ClientTestWrapper::get_failure_trigger(
+                            "symbol", StorageOperation::READ, Aws::S3::S3Errors::THROTTLING, false
+                    )
+            ),
+            UnexpectedS3ErrorException
+    );
+}
+
+namespace {
+class RangeRecordingS3Client : public MockS3Client {
+  public:
+    folly::Future<S3Result<GetObjectRangeOutput>> get_object_range_async(
+            const std::string& s3_object_name, const std::string& bucket_name, uint64_t offset, uint64_t length,
+            uint8_t* dest
+    ) const override {
+        {
+            std::lock_guard lock{ranges_mutex_};
+            ranges_.emplace_back(offset, length);
+        }
+        return MockS3Client::get_object_range_async(s3_object_name, bucket_name, offset, length, dest);
+    }
+
+    mutable std::mutex ranges_mutex_;
+    mutable std::vector<std::pair<uint64_t, uint64_t>> ranges_;
+};
+
+std::vector<uint8_t> serialized_bytes(Segment& segment) {
+    std::vector<uint8_t> bytes(segment.calculate_size());
+    segment.write_to(bytes.data());
+    return bytes;
+}
+} // namespace
+
+TEST(S3RangedGet, ParseContentRange) {
+    ASSERT_EQ(parse_content_range_object_size("bytes 0-99/1234"), 1234u);
+    ASSERT_EQ(parse_content_range_object_size("bytes 100-199/200"), 200u);
+    ASSERT_EQ(parse_content_range_object_size("bytes 0-99/*"), std::nullopt);
+    ASSERT_EQ(parse_content_range_object_size(""), std::nullopt);
+}
+
+TEST(S3RangedGet, ReassemblesPartsIntoOneSegment) {
+    auto client = std::make_shared<RangeRecordingS3Client>();
+    auto segment = get_test_segment();
+    ASSERT_TRUE(client->put_object("object", segment, "bucket").is_success());
+    auto expected = client->get_object("object", "bucket");
+    const auto expected_bytes = serialized_bytes(expected.get_output());
+    const uint64_t object_size = expected_bytes.size();
+    ASSERT_GT(object_size, 200u);
+
+    auto result = get_object_ranged(client, "object", "bucket", RangedGetConfig{64, 50}).get();
+    ASSERT_TRUE(result.is_success());
+    ASSERT_EQ(serialized_bytes(result.get_output()), expected_bytes);
+
+    const auto& ranges = client->ranges_;
+    ASSERT_EQ(ranges.size(), (object_size + 49) / 50);
+    uint64_t next_offset = 0;
+    for (const auto& [offset, length] : ranges) {
+        ASSERT_EQ(offset, next_offset);
+        ASSERT_EQ(length, std::min(uint64_t{50}, object_size - next_offset));
+        next_offset += length;
+    }
+    ASSERT_EQ(next_offset, object_size);
+}
+
+TEST(S3RangedGet, SmallObjectReadInOneRequest) {
+    auto client = std::make_shared<RangeRecordingS3Client>();
+    auto segment = get_test_segment();
+    ASSERT_TRUE(client->put_object("object", segment, "bucket").is_success());
+    auto expected = client->get_object("object", "bucket");
+
+    auto result = get_object_ranged(client, "object", "bucket", RangedGetConfig{1 << 20, 50}).get();
+    ASSERT_TRUE(result.is_success());
+    ASSERT_EQ(serialized_bytes(result.get_output()), serialized_bytes(expected.get_output()));
+    // Read with a plain GetObject, without allocating a buffer of the threshold size
+    ASSERT_TRUE(client->ranges_.empty());
+}
+
+TEST(S3RangedGet, MissingObject) {
+    auto client = std::make_shared<RangeRecordingS3Client>();
+    auto result = get_object_ranged(client, "object", "bucket", RangedGetConfig{64, 50}).get();
+    ASSERT_FALSE(result.is_success());
+    ASSERT_EQ(result.get_error().GetErrorType(), Aws::S3::S3Errors::RESOURCE_NOT_FOUND);
+}
+
+TEST(S3RangedGet, OnlyDataKeys) {
+    const RangedGetConfig config{64, 50};
+    ASSERT_TRUE(config.applies_to(KeyType::TABLE_DATA));
+    ASSERT_FALSE(config.applies_to(KeyType::VERSION_REF));
+    ASSERT_FALSE(config.applies_to(KeyType::VERSION));
+    ASSERT_FALSE(RangedGetConfig{}.applies_to(KeyType::TABLE_DATA));
+}
+
+namespace {
+struct EnableQueryStats {
+    EnableQueryStats() { query_stats::QueryStats::instance()->enable(); }
+    ~EnableQueryStats() {
+        query_stats::QueryStats::instance()->disable();
+        query_stats::QueryStats::instance()->reset_stats();
+    }
+};
+
+uint64_t table_data_bytes_read() {
+    auto stats = query_stats::QueryStats::instance()->get_stats();
+    return stats["storage_operations"]["S3_GetObjectAsync"]["TABLE_DATA"]["size_bytes"];
+}
+} // namespace
+
+TEST_F(S3StorageFixture, test_read_segment_columns) {
+    EnableQueryStats enable_query_stats;
+    const auto key = get_test_key("symbol");
+    auto segment_in_memory = get_test_timeseries_frame("symbol", 1'000, 0).segment_;
+    store.write(KeySegmentPair(
+            VariantKey{key},
+            encode_dispatch(std::move(segment_in_memory), codec::default_passthrough_codec(), EncodingVersion::V2)
+    ));
+    auto full = store.read(VariantKey{key}, ReadKeyOpts{});
+    const uint64_t object_size = full.segment_ptr()->calculate_size();
+    auto expected = decode_segment(*full.segment_ptr());
+    const auto& expected_floats = expected.column(static_cast<position_t>(*expected.column_index("floats")));
+
+    const std::unordered_set<std::string> columns{"floats"};
+    for (uint64_t prefix_bytes : {uint64_t{FIXED_HEADER_SIZE}, uint64_t{256}, object_size}) {
+        query_stats::QueryStats::instance()->reset_stats();
+        auto partial = read_segment_columns(store, key, columns, ColumnProjectedReadConfig{prefix_bytes, 0});
+        if (prefix_bytes < object_size)
+            ASSERT_LT(table_data_bytes_read(), object_size / 2);
+        else
+            ASSERT_EQ(table_data_bytes_read(), object_size);
+
+        auto& seg = *partial.segment_ptr();
+        ASSERT_EQ(seg.is_partial(), prefix_bytes < object_size);
+        if (seg.is_partial()) {
+            std::vector<uint8_t> bytes(object_size);
+            ASSERT_THROW(seg.write_to(bytes.data()), ArcticException);
+        }
+        const auto desc = stream_descriptor(
+                StreamId{"symbol"},
+                stream::TimeseriesIndex::default_index(),
+                {scalar_field(DataType::FLOAT64, "floats")}
+        );
+        SegmentInMemory result{desc.clone()};
+        decode_into_memory_segment(seg, seg.header(), result, seg.descriptor());
+        ASSERT_EQ(result.row_count(), expected.row_count());
+        for (position_t row = 0; row < static_cast<position_t>(expected.row_count()); ++row) {
+            ASSERT_EQ(result.column(0).scalar_at<timestamp>(row), expected.column(0).scalar_at<timestamp>(row));
+            ASSERT_EQ(result.column(1).scalar_at<double>(row), expected_floats.scalar_at<double>(row));
+        }
+    }
+}
+
+TEST_F(S3StorageFixture, test_read_segment_columns_missing_key) {
+    const std::unordered_set<std::string> columns{"floats"};
+    ASSERT_THROW(
+            read_segment_columns(store, get_test_key("symbol"), columns, ColumnProjectedReadConfig{256, 0}),
+            KeyNotFoundException
+    );
+}
+
 TEST(S3LogSystem, RoutesToSpdlogWithLevelAndTag) {
     using namespace arcticdb::storage::s3;
     using Aws::Utils::Logging::LogLevel;
@@ -12,6 +12,7 @@
 #include <arcticdb/storage/storage_options.hpp>
 #include <arcticdb/storage/storage_exceptions.hpp>
 #include <arcticdb/async/batch_read_args.hpp>
+#include <arcticdb/codec/codec.hpp>
 #include <arcticdb/processing/clause.hpp>
 
 #include <folly/futures/Future.h>
@@ -68,9 +69,11 @@ struct StreamSource {
     [[nodiscard]] virtual std::vector<folly::Future<bool>> batch_key_exists(const std::vector<entity::VariantKey>& keys
     ) = 0;
 
+    // block_filter, if set, decides the blocks of each segment to leave undecoded, see BlockFilter
     virtual std::vector<folly::Future<pipelines::SegmentAndSlice>> batch_read_uncompressed(
             std::vector<pipelines::RangesAndKey>&& ranges_and_keys,
-            std::shared_ptr<std::unordered_set<std::string>> columns_to_decode
+            std::shared_ptr<std::unordered_set<std::string>> columns_to_decode,
+            std::shared_ptr<BlockFilter> block_filter = nullptr
     ) = 0;
 
     virtual folly::Future<std::pair<std::optional<VariantKey>, std::optional<google::protobuf::Any>>> read_metadata(
@@ -60,6 +60,12 @@ std::string task_type_to_string(TaskType task_type) {
         return "Memory_DeleteObject";
     case TaskType::Memory_HeadObject:
         return "Memory_HeadObject";
+    case TaskType::DiskCache_Hit:
+        return "DiskCache_Hit";
+    case TaskType::DiskCache_Miss:
+        return "DiskCache_Miss";
+    case TaskType::DiskCache_PutObject:
+        return "DiskCache_PutObject";
     default:
         log::version().warn("Unknown task type {}", static_cast<int>(task_type));
         return "Unknown";
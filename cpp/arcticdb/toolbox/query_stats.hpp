@@ -30,6 +30,9 @@ enum class TaskType : size_t {
     Memory_GetObject = 8,
     Memory_DeleteObject = 9,
     Memory_HeadObject = 10,
+    DiskCache_Hit = 11,
+    DiskCache_Miss = 12,
+    DiskCache_PutObject = 13,
     END
 };
 
@@ -8,6 +8,8 @@
 
 #include <arcticdb/util/bitset.hpp>
 
+#include <bit>
+
 namespace arcticdb {
 
 void bitset_to_packed_bits(const bm::bvector<>& bv, uint8_t* dest_ptr) {
@@ -103,4 +105,18 @@ void copy_packed_bits(const uint8_t* src, size_t src_bit_offset, size_t num_bits
     }
 }
 
+void packed_words_to_bitset(const uint64_t* words, size_t num_bits, bm::bvector<>& bv) {
+    bv.clear();
+    bv.resize(bv_size(num_bits));
+    bm::bvector<>::bulk_insert_iterator inserter(bv);
+    const auto num_words = (num_bits + 63) / 64;
+    for (size_t word_idx = 0; word_idx < num_words; ++word_idx) {
+        // Only the set bits are visited, so mostly empty words are cheap
+        for (auto word = words[word_idx]; word != 0; word &= word - 1) {
+            inserter = bv_size(word_idx * 64 + std::countr_zero(word));
+        }
+    }
+    inserter.flush();
+}
+
 } // namespace arcticdb
@@ -47,6 +47,9 @@ void set_bit_at(uint8_t* packed_bits, size_t bit_pos, bool value);
 
 void copy_packed_bits(const uint8_t* src, size_t src_bit_offset, size_t num_bits, uint8_t* dest);
 
+// Sets bv to the num_bits bits packed into words, with bit i in bit (i % 64) of words[i / 64]
+void packed_words_to_bitset(const uint64_t* words, size_t num_bits, bm::bvector<>& bv);
+
 template<typename functor>
 requires std::is_invocable_r_v<void, functor, size_t>
 void iterate_over_set_positions(const bm::bvector<>& bv, size_t from, size_t to, functor&& f) {
@@ -9,8 +9,8 @@
 #pragma once
 
 #include <arcticdb/entity/types.hpp>
+#include <folly/concurrency/ConcurrentHashMap.h>
 #include <mutex>
-#include <unordered_map>
 
 namespace arcticdb {
 struct Lock {
@@ -31,16 +31,14 @@ struct ScopedLock {
     ~ScopedLock() { lock_->unlock(); }
 };
 
+// Looking up the lock of a symbol that already has one takes no lock on the table itself
 class LockTable {
-    std::unordered_map<StreamId, std::shared_ptr<Lock>> locks_;
-    std::mutex mutex_;
+    folly::ConcurrentHashMap<StreamId, std::shared_ptr<Lock>> locks_;
 
   public:
     LockTable() = default;
     std::shared_ptr<Lock> get_lock_object(const StreamId& stream_id) {
-        std::lock_guard lock(mutex_);
-
-        if (auto it = locks_.find(stream_id); it != std::end(locks_))
+        if (auto it = locks_.find(stream_id); it != locks_.cend())
             return it->second;
 
         return locks_.try_emplace(stream_id, std::make_shared<Lock>()).first->second;
@@ -5,8 +5,12 @@
  * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
  * will be governed by the Apache License, version 2.0.
  */
-#include <shared_mutex>
+#pragma once
+
+#include <list>
 #include <memory>
+#include <mutex>
+#include <optional>
 
 #include <ankerl/unordered_dense.h>
 #include <arcticdb/util/constructors.hpp>
@@ -14,28 +18,63 @@
 
 namespace arcticdb {
 
-template<typename KeyType, typename ValueType>
+// Every entry counts as one towards the capacity of an LRUCache
+struct UnitWeigher {
+    template<typename ValueType>
+    size_t operator()(const ValueType&) const noexcept {
+        return 1;
+    }
+};
+
+/*
+ * Thread-safe least recently used cache. The capacity bounds the total weight of the entries, where Weigher gives the
+ * weight of each value, so the default bounds the number of entries and a weigher returning a size in bytes gives a
+ * byte budget. A value heavier than the whole capacity is not cached.
+ */
+template<typename KeyType, typename ValueType, typename Weigher = UnitWeigher>
 class LRUCache {
     struct Node {
         KeyType key;
         ValueType value;
-        Node(const KeyType& k, ValueType&& v) : key(k), value(std::move(v)) {}
+        size_t weight;
+        Node(const KeyType& k, ValueType&& v, size_t w) : key(k), value(std::move(v)), weight(w) {}
     };
 
     size_t capacity_;
+    size_t weight_ = 0;
+    Weigher weigher_;
+    // get() reorders the list, so all access is exclusive
     mutable std::list<Node> list_;
-    mutable std::shared_mutex mutex_;
+    mutable std::mutex mutex_;
     ankerl::unordered_dense::map<KeyType, typename std::list<Node>::iterator> cache_;
 
+    void erase(typename decltype(cache_)::iterator it) {
+        weight_ -= it->second->weight;
+        list_.erase(it->second);
+        cache_.erase(it);
+    }
+
   public:
-    explicit LRUCache(size_t capacity) noexcept : capacity_(capacity) {}
+    explicit LRUCache(size_t capacity, Weigher weigher = Weigher{}) noexcept :
+        capacity_(capacity),
+        weigher_(std::move(weigher)) {}
 
     ARCTICDB_NO_MOVE_OR_COPY(LRUCache)
 
     [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
 
+    [[nodiscard]] size_t size() const {
+        std::lock_guard lock(mutex_);
+        return cache_.size();
+    }
+
+    [[nodiscard]] size_t weight() const {
+        std::lock_guard lock(mutex_);
+        return weight_;
+    }
+
     [[nodiscard]] std::optional<ValueType> get(const KeyType& key) const {
-        std::shared_lock lock(mutex_);
+        std::lock_guard lock(mutex_);
         ARCTICDB_DEBUG(log::inmem(), "Looking for key {}", key);
         auto it = cache_.find(key);
         if (it == cache_.end()) {
@@ -49,33 +88,35 @@ class LRUCache {
     }
 
     void remove(const KeyType& key) {
-        std::unique_lock lock(mutex_);
+        std::lock_guard lock(mutex_);
         ARCTICDB_DEBUG(log::inmem(), "Removing key {}", key);
         auto it = cache_.find(key);
         if (it == cache_.end())
             return;
 
-        list_.erase(it->second);
-        cache_.erase(it);
+        erase(it);
     }
 
     void put(const KeyType& key, ValueType value) {
-        std::unique_lock lock(mutex_);
+        const auto weight = weigher_(value);
+        std::lock_guard lock(mutex_);
         ARCTICDB_DEBUG(log::inmem(), "Adding key {}", key);
-        auto it = cache_.find(key);
-        if (it != cache_.end()) {
-            it->second->value = std::move(value);
-            list_.splice(list_.begin(), list_, it->second);
-        } else {
-            if (cache_.size() >= capacity_) {
-                ARCTICDB_DEBUG(log::inmem(), "Evicting key {}", list_.back().key);
-                cache_.erase(list_.back().key);
-                list_.pop_back();
-            }
-            list_.emplace_front(key, std::move(value));
-            cache_[list_.front().key] = list_.begin();
+        if (auto it = cache_.find(key); it != cache_.end())
+            erase(it);
+
+        if (weight > capacity_) {
+            ARCTICDB_DEBUG(log::inmem(), "Not caching key {} of weight {} above capacity {}", key, weight, capacity_);
+            return;
+        }
+
+        while (weight_ + weight > capacity_) {
+            ARCTICDB_DEBUG(log::inmem(), "Evicting key {}", list_.back().key);
+            erase(cache_.find(list_.back().key));
         }
+        list_.emplace_front(key, std::move(value), weight);
+        cache_[list_.front().key] = list_.begin();
+        weight_ += weight;
     }
 };
 
-} // namespace arcticdb
\ No newline at end of file
+} // namespace arcticdb
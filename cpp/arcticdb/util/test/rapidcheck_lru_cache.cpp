@@ -57,4 +57,30 @@ RC_GTEST_PROP(LRUCacheTest, BehavesCorrectly, (const std::vector<int>& keys)) {
     }
 
     RC_ASSERT(cache.capacity() == capacity);
-}
\ No newline at end of file
+}
+TEST(LRUCacheTest, WeightedCapacity) {
+    using namespace arcticdb;
+    struct SizeWeigher {
+        size_t operator()(const std::string& value) const { return value.size(); }
+    };
+    LRUCache<int, std::string, SizeWeigher> cache(10);
+    cache.put(1, "aaaa");
+    cache.put(2, "bbbb");
+    ASSERT_EQ(cache.weight(), 8u);
+    ASSERT_TRUE(cache.get(1).has_value());
+
+    // Evicts the least recently used entries until the new value fits
+    cache.put(3, "cccc");
+    ASSERT_EQ(cache.size(), 2u);
+    ASSERT_TRUE(cache.get(1).has_value());
+    ASSERT_FALSE(cache.get(2).has_value());
+
+    // Replacing a value updates the weight
+    cache.put(1, "a");
+    ASSERT_EQ(cache.weight(), 5u);
+
+    // Values heavier than the whole capacity are not cached, and replace any existing value
+    cache.put(3, "ccccccccccc");
+    ASSERT_FALSE(cache.get(3).has_value());
+    ASSERT_EQ(cache.weight(), 1u);
+}
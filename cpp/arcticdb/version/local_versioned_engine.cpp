@@ -2383,6 +2383,12 @@ void LocalVersionedEngine::configure(const storage::LibraryDescriptor::VariantSt
                 if (cfg.write_options().has_sync_passive()) {
                     version_map->set_log_changes(cfg.write_options().sync_passive().enabled());
                 }
+                if (cfg.write_options().version_change_journal()) {
+                    const auto retention = cfg.write_options().version_change_journal_retention_ns();
+                    version_map->set_change_journal(std::make_shared<VersionChangeJournal>(
+                            retention > 0 ? static_cast<timestamp>(retention) : VersionChangeJournal::DEFAULT_RETENTION
+                    ));
+                }
             },
             [](const auto& conf) {
                 util::raise_rte(
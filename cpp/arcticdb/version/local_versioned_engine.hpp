@@ -90,27 +90,27 @@ R list_streams_internal_implementation(
     ARCTICDB_SAMPLE(ListStreamsInternal, 0)
     R res{};
 
+    // A regex takes precedence over a prefix
+    std::optional<std::string> filter = regex;
+    if (!filter && prefix)
+        filter = "^" + *prefix;
+
     if (snap_name) {
         res = list_streams_in_snapshot<R>(version_store_objects.store_, *snap_name);
     } else {
+        // The symbol list applies the filter while loading, rather than building the full set first
         if (use_symbol_list.value_or(version_store_objects.cfg_.symbol_list()))
-            res = version_store_objects.symbol_list_.get_symbol_set<R>(version_store_objects.store_);
-        else
-            res = list_streams<R>(
-                    version_store_objects.store_,
-                    version_store_objects.version_map_,
-                    prefix,
-                    all_symbols.value_or(false)
-            );
-    }
+            return version_store_objects.symbol_list_.get_symbol_set<R>(version_store_objects.store_, filter);
 
-    if (regex) {
-        return filter_by_regex(res, regex);
-    } else if (prefix) {
-        return filter_by_regex(res, std::optional("^" + *prefix));
-    } else {
-        return res;
+        res = list_streams<R>(
+                version_store_objects.store_, version_store_objects.version_map_, prefix, all_symbols.value_or(false)
+        );
     }
+
+    if (filter)
+        return filter_by_regex(res, filter);
+
+    return res;
 }
 
 } // namespace details
@@ -165,6 +165,7 @@ void register_bindings(py::module& version, py::exception<arcticdb::ArcticExcept
     constants.attr("FAILED_STORAGE_LOG_ID") = py::str(FailedStorageLogId);
     constants.attr("RECREATE_SYMBOL_ID") = py::str(RecreateSymbolId);
     constants.attr("REFRESH_SYMBOL_ID") = py::str(RefreshSymbolId);
+    constants.attr("VERSION_CHANGE_ID") = py::str(VersionChangeId);
 
     entity::apy::register_common_entity_bindings(version, arcticdb::BindingScope::GLOBAL);
 
@@ -470,16 +471,17 @@ void register_bindings(py::module& version, py::exception<arcticdb::ArcticExcept
 
     py::class_<GroupByClause, std::shared_ptr<GroupByClause>>(version, "GroupByClause")
             .def(py::init<std::string>())
-            .def_property_readonly("grouping_column", [](const GroupByClause& self) { return self.grouping_column_; })
+            .def(py::init<std::vector<std::string>>())
+            .def_property_readonly("grouping_columns", [](const GroupByClause& self) { return self.grouping_columns_; })
             .def("__str__", &GroupByClause::to_string);
 
     py::class_<AggregationClause, std::shared_ptr<AggregationClause>>(version, "AggregationClause")
             .def(py::init(
-                    [](const std::string& grouping_colum,
+                    [](const std::vector<std::string>& grouping_columns,
                        std::unordered_map<std::string, std::variant<std::string, std::pair<std::string, std::string>>>
                                aggregations) {
                         return AggregationClause(
-                                grouping_colum, python_util::named_aggregators_from_dict(std::move(aggregations))
+                                grouping_columns, python_util::named_aggregators_from_dict(std::move(aggregations))
                         );
                     }
             ))
@@ -7,6 +7,7 @@
  */
 
 #include <arcticdb/version/snapshot.hpp>
+#include <arcticdb/version/snapshot_membership.hpp>
 #include <arcticdb/version/version_log.hpp>
 #include <arcticdb/stream/index_aggregator.hpp>
 #include <arcticdb/python/python_utils.hpp>
@@ -166,6 +167,12 @@ std::unordered_set<entity::AtomKey> get_index_keys_in_snapshots(
     ARCTICDB_SAMPLE(GetIndexKeysInSnapshot, 0)
 
     std::unordered_set<entity::AtomKey> index_keys_in_snapshots{};
+    if (auto from_membership = get_master_snapshots_map_from_membership(store, {stream_id}); from_membership) {
+        for (auto& [index_key, _] : from_membership->map[stream_id])
+            index_keys_in_snapshots.insert(index_key);
+
+        return index_keys_in_snapshots;
+    }
 
     iterate_snapshots(store, [&index_keys_in_snapshots, &store, &stream_id](const VariantKey& vk) {
         ARCTICDB_DEBUG(log::snapshot(), "Reading snapshot {}", vk);
@@ -208,6 +215,14 @@ std::optional<AtomKey> index_key_for_stream_and_version_in_snapshot_segment(
 std::optional<AtomKey> find_index_key_in_snapshots(
         const std::shared_ptr<Store>& store, const StreamId& stream_id, VersionId version_id
 ) {
+    if (auto from_membership = get_master_snapshots_map_from_membership(store, {stream_id}); from_membership) {
+        for (const auto& [index_key, _] : from_membership->map[stream_id]) {
+            if (index_key.version_id() == version_id)
+                return index_key;
+        }
+        return std::nullopt;
+    }
+
     std::vector<VariantKey> snapshot_keys;
     iterate_snapshots(store, [&snapshot_keys](auto&& snapshot_key) {
         snapshot_keys.emplace_back(std::move(snapshot_key));
@@ -399,6 +414,11 @@ SnapshotMap get_versions_from_snapshots(const std::shared_ptr<Store>& store, con
 MasterSnapshotMapWithStats get_master_snapshots_map_with_stats(
         std::shared_ptr<Store> store, const std::optional<std::unordered_set<StreamId>>& stream_ids
 ) {
+    if (stream_ids) {
+        if (auto from_membership = get_master_snapshots_map_from_membership(store, *stream_ids); from_membership)
+            return std::move(*from_membership);
+    }
+
     MasterSnapshotMapWithStats out;
     iterate_snapshots(store, [&out, &store, &stream_ids](const VariantKey& sk) {
         ++out.total_snapshots;
@@ -424,6 +444,20 @@ MasterSnapshotMapAndKeys get_master_snapshots_map_and_keys_in_given_snapshot(
         std::shared_ptr<Store> store, const SnapshotVariantKey& given_snapshot
 ) {
     MasterSnapshotMapAndKeys out;
+    if (snapshot_membership_enabled()) {
+        // Only the symbols in the given snapshot are needed
+        out.index_keys_in_given_snapshot = get_versions_from_segment(store->read_sync(given_snapshot).second);
+        std::unordered_set<StreamId> stream_ids;
+        for (const auto& key : out.index_keys_in_given_snapshot)
+            stream_ids.insert(key.id());
+
+        if (auto from_membership = get_master_snapshots_map_from_membership(store, stream_ids); from_membership) {
+            out.map = std::move(from_membership->map);
+            return out;
+        }
+        out.index_keys_in_given_snapshot.clear();
+    }
+
     iterate_snapshots(store, [&given_snapshot, &out, &store](const VariantKey& sk) {
         auto snapshot_id = variant_key_id(sk);
         auto snapshot_segment = store->read_sync(sk).second;
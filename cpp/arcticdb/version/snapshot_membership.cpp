@@ -0,0 +1,456 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/version/snapshot_membership.hpp>
+#include <arcticdb/async/task_scheduler.hpp>
+#include <arcticdb/log/log.hpp>
+#include <arcticdb/stream/index_aggregator.hpp>
+#include <arcticdb/stream/stream_utils.hpp>
+#include <arcticdb/util/configs_map.hpp>
+
+#include <map>
+#include <set>
+
+namespace arcticdb {
+
+namespace {
+
+const StreamId coverage_id{StringId{"__snapshot_membership__"}};
+const StreamId lock_name{StringId{"__snapshot_membership_lock__"}};
+constexpr size_t LOCK_TIMEOUT_MS = 10'000;
+
+// Snapshot -> index keys in it
+using Membership = std::map<SnapshotId, std::vector<AtomKey>>;
+
+struct SnapshotContent {
+    SnapshotId snapshot_id_;
+    std::vector<AtomKey> keys_;
+};
+
+using SnapshotContents = std::vector<SnapshotContent>;
+
+// Stored as the content hash of the coverage key's first row
+enum class CoverageState : ContentHash { IN_PROGRESS = 0, COMPLETE = 1 };
+
+/*
+ * The coverage key. Its first row is a SNAPSHOT_MEMBERSHIP key whose version id is the generation, bumped by every
+ * change to the index, and whose content hash is the state. The other rows are SNAPSHOT keys naming the snapshots
+ * recorded in the symbol keys.
+ */
+struct Coverage {
+    VersionId generation_ = 0;
+    CoverageState state_ = CoverageState::IN_PROGRESS;
+    std::set<SnapshotId> snapshots_;
+
+    [[nodiscard]] bool is_complete() const { return state_ == CoverageState::COMPLETE; }
+};
+
+RefKey membership_key(const StreamId& id) { return RefKey{id, KeyType::SNAPSHOT_MEMBERSHIP}; }
+
+Membership membership_from_segment(const SegmentInMemory& segment) {
+    Membership membership;
+    auto current = membership.end();
+    for (ssize_t row = 0; row < ssize_t(segment.row_count()); ++row) {
+        auto key = stream::read_key_row(segment, row);
+        if (key.type() == KeyType::SNAPSHOT) {
+            current = membership.try_emplace(key.id()).first;
+        } else {
+            util::check(
+                    current != membership.end(), "Snapshot membership key {} has no snapshot for {}", key.id(), key
+            );
+            current->second.push_back(std::move(key));
+        }
+    }
+    return membership;
+}
+
+SegmentInMemory keys_segment(const StreamId& id, const std::vector<AtomKey>& keys) {
+    SegmentInMemory output{StreamDescriptor{id}};
+    IndexAggregator<RowCountIndex> aggregator(id, [&output](SegmentInMemory&& segment) {
+        output = std::move(segment);
+    });
+    for (const auto& key : keys)
+        aggregator.add_key(key);
+
+    aggregator.finalize();
+    return output;
+}
+
+AtomKey snapshot_row(const SnapshotId& snapshot_id) { return atom_key_builder().build(snapshot_id, KeyType::SNAPSHOT); }
+
+SegmentInMemory membership_segment(const StreamId& id, const Membership& membership) {
+    std::vector<AtomKey> rows;
+    for (const auto& [snapshot_id, keys] : membership) {
+        rows.push_back(snapshot_row(snapshot_id));
+        rows.insert(rows.end(), keys.begin(), keys.end());
+    }
+    return keys_segment(id, rows);
+}
+
+std::optional<Coverage> read_coverage(const std::shared_ptr<Store>& store) {
+    SegmentInMemory segment;
+    try {
+        segment = store->read_sync(membership_key(coverage_id), {.dont_warn_about_missing_key = true}).second;
+    } catch (const storage::KeyNotFoundException&) {
+        return std::nullopt;
+    }
+    util::check(segment.row_count() > 0, "Empty snapshot membership coverage key");
+    const auto header = stream::read_key_row(segment, 0);
+    // Anything else was written in an earlier layout, and is rebuilt
+    if (header.type() != KeyType::SNAPSHOT_MEMBERSHIP)
+        return Coverage{};
+
+    Coverage coverage{header.version_id(), static_cast<CoverageState>(header.content_hash()), {}};
+    for (ssize_t row = 1; row < ssize_t(segment.row_count()); ++row)
+        coverage.snapshots_.insert(stream::read_key_row(segment, row).id());
+
+    return coverage;
+}
+
+void write_coverage(const std::shared_ptr<Store>& store, const Coverage& coverage) {
+    std::vector<AtomKey> rows{atom_key_builder()
+                                      .version_id(coverage.generation_)
+                                      .content_hash(static_cast<ContentHash>(coverage.state_))
+                                      .build(coverage_id, KeyType::SNAPSHOT_MEMBERSHIP)};
+    for (const auto& snapshot_id : coverage.snapshots_)
+        rows.push_back(snapshot_row(snapshot_id));
+
+    store->write_sync(KeyType::SNAPSHOT_MEMBERSHIP, coverage_id, keys_segment(coverage_id, rows));
+}
+
+void remove_coverage(const std::shared_ptr<Store>& store) {
+    store->remove_key_sync(membership_key(coverage_id), storage::RemoveOpts{.ignores_missing_key_ = true});
+}
+
+// The symbols' keys, with an empty membership for symbols that have none
+std::vector<Membership> read_symbol_memberships(
+        const std::shared_ptr<Store>& store, const std::vector<StreamId>& stream_ids
+) {
+    const auto window_size = async::TaskScheduler::instance()->io_thread_count();
+    auto futures = folly::window(
+            stream_ids,
+            [store](const StreamId& stream_id) {
+                return store->read(membership_key(stream_id), {.dont_warn_about_missing_key = true})
+                        .thenValueInline([](auto&& key_seg) { return membership_from_segment(key_seg.second); })
+                        .thenError(folly::tag_t<storage::KeyNotFoundException>{}, [](auto&&) {
+                            return Membership{};
+                        });
+            },
+            window_size
+    );
+    return folly::collect(futures).get();
+}
+
+// Every snapshot in the library, decoded
+SnapshotContents read_every_snapshot(const std::shared_ptr<Store>& store) {
+    std::vector<VariantKey> snapshot_keys;
+    iterate_snapshots(store, [&snapshot_keys](const VariantKey& snapshot_key) {
+        snapshot_keys.push_back(snapshot_key);
+    });
+    const auto window_size = async::TaskScheduler::instance()->io_thread_count();
+    auto futures = folly::window(
+            std::move(snapshot_keys),
+            [store](const VariantKey& snapshot_key) {
+                return store->read(snapshot_key, {.dont_warn_about_missing_key = true})
+                        .thenValueInline([snapshot_key](auto&& key_seg) {
+                            return std::optional<SnapshotContent>{SnapshotContent{
+                                    variant_key_id(snapshot_key), get_versions_from_segment(key_seg.second)
+                            }};
+                        })
+                        .thenError(folly::tag_t<storage::KeyNotFoundException>{}, [](auto&&) {
+                            return std::optional<SnapshotContent>{};
+                        });
+            },
+            window_size
+    );
+    SnapshotContents contents;
+    // Snapshots deleted since they were listed are skipped
+    for (auto& content : folly::collect(futures).get()) {
+        if (content)
+            contents.push_back(std::move(*content));
+    }
+    return contents;
+}
+
+void write_symbol_memberships(
+        const std::shared_ptr<Store>& store, std::vector<std::pair<StreamId, Membership>>&& updates
+) {
+    const auto window_size = async::TaskScheduler::instance()->io_thread_count();
+    auto futures = folly::window(
+            std::move(updates),
+            [store](const std::pair<StreamId, Membership>& update) {
+                const auto& [stream_id, membership] = update;
+                if (membership.empty())
+                    return store->remove_key(
+                            membership_key(stream_id), storage::RemoveOpts{.ignores_missing_key_ = true}
+                    );
+
+                return store->write(KeyType::SNAPSHOT_MEMBERSHIP, stream_id, membership_segment(stream_id, membership))
+                        .thenValueInline([](auto&&) { return folly::Unit{}; });
+            },
+            window_size
+    );
+    folly::collect(futures).get();
+}
+
+// Symbol -> snapshot -> the symbol's index keys in it
+std::unordered_map<StreamId, Membership> memberships_of(const SnapshotContents& contents) {
+    std::unordered_map<StreamId, Membership> memberships;
+    for (const auto& snapshot : contents) {
+        for (const auto& key : snapshot.keys_)
+            memberships[key.id()][snapshot.snapshot_id_].push_back(key);
+    }
+    return memberships;
+}
+
+// Replaces what the symbols' keys record for one snapshot with its contents. Symbols that held keys in the snapshot
+// before but hold none now are passed in previous_symbols.
+void replace_snapshot_in_symbol_keys(
+        const std::shared_ptr<Store>& store, const SnapshotContent& content,
+        std::unordered_set<StreamId> previous_symbols
+) {
+    auto additions = memberships_of({content});
+    for (const auto& [stream_id, _] : additions)
+        previous_symbols.insert(stream_id);
+
+    std::vector<StreamId> stream_ids{previous_symbols.begin(), previous_symbols.end()};
+    auto memberships = read_symbol_memberships(store, stream_ids);
+    std::vector<std::pair<StreamId, Membership>> updates;
+    for (size_t i = 0; i < stream_ids.size(); ++i) {
+        auto& membership = memberships[i];
+        membership.erase(content.snapshot_id_);
+        if (auto it = additions.find(stream_ids[i]); it != additions.end())
+            membership.merge(it->second);
+
+        updates.emplace_back(std::move(stream_ids[i]), std::move(membership));
+    }
+    ARCTICDB_DEBUG(
+            log::snapshot(), "Recording snapshot {} in the keys of {} symbols", content.snapshot_id_, updates.size()
+    );
+    write_symbol_memberships(store, std::move(updates));
+}
+
+/*
+ * Builds the index from every snapshot if it is missing or incomplete, returning the snapshots read, or std::nullopt
+ * if another process holds the lock or has built it. The coverage key is marked in progress before the snapshots are
+ * listed, so that processes changing a snapshot concurrently without the lock invalidate it once they are done.
+ */
+std::optional<SnapshotContents> build_index(const std::shared_ptr<Store>& store) {
+    StorageLock<> lock{lock_name};
+    if (!lock.try_lock(store)) {
+        ARCTICDB_DEBUG(log::snapshot(), "Not building the snapshot membership index, as it is locked");
+        return std::nullopt;
+    }
+    OnExit x([&lock, &store] { lock.unlock(store); });
+
+    try {
+        auto coverage = read_coverage(store).value_or(Coverage{});
+        if (coverage.is_complete())
+            return std::nullopt;
+
+        coverage = Coverage{coverage.generation_ + 1, CoverageState::IN_PROGRESS, {}};
+        write_coverage(store, coverage);
+        auto contents = read_every_snapshot(store);
+        auto memberships = memberships_of(contents);
+
+        // Keys of symbols no longer in any snapshot are removed, along with any left by an earlier failed build
+        std::vector<std::pair<StreamId, Membership>> updates;
+        store->iterate_type(KeyType::SNAPSHOT_MEMBERSHIP, [&](VariantKey&& key) {
+            const auto& stream_id = variant_key_id(key);
+            if (stream_id != coverage_id && !memberships.contains(stream_id))
+                updates.emplace_back(stream_id, Membership{});
+        });
+        for (auto& [stream_id, membership] : memberships)
+            updates.emplace_back(stream_id, std::move(membership));
+
+        write_symbol_memberships(store, std::move(updates));
+        for (const auto& snapshot : contents)
+            coverage.snapshots_.insert(snapshot.snapshot_id_);
+
+        // A process that could not take the lock removes the coverage key, and the index must then stay unbuilt
+        if (auto current = read_coverage(store); current && current->generation_ == coverage.generation_) {
+            coverage.state_ = CoverageState::COMPLETE;
+            write_coverage(store, coverage);
+            log::snapshot().info("Built the snapshot membership index from {} snapshots", contents.size());
+        }
+        return contents;
+    } catch (const std::exception& e) {
+        log::snapshot().info("Failed to build the snapshot membership index: {}", e.what());
+        return std::nullopt;
+    }
+}
+
+void add_to_map(
+        MasterSnapshotMap& map, const std::unordered_set<StreamId>& stream_ids, const SnapshotContents& contents
+) {
+    for (const auto& snapshot : contents) {
+        for (const auto& key : snapshot.keys_) {
+            if (stream_ids.contains(key.id()))
+                map[key.id()][key].insert(snapshot.snapshot_id_);
+        }
+    }
+}
+
+} // namespace
+
+bool snapshot_membership_enabled() { return ConfigsMap::instance()->get_int("Snapshot.MembershipIndex", 0) != 0; }
+
+std::optional<MasterSnapshotMapWithStats> get_master_snapshots_map_from_membership(
+        const std::shared_ptr<Store>& store, const std::unordered_set<StreamId>& stream_ids
+) {
+    if (!snapshot_membership_enabled() || stream_ids.contains(coverage_id))
+        return std::nullopt;
+
+    ARCTICDB_SAMPLE(GetMasterSnapshotsMapFromMembership, 0)
+    MasterSnapshotMapWithStats out;
+    if (auto coverage = read_coverage(store); coverage && coverage->is_complete()) {
+        std::vector<StreamId> ids{stream_ids.begin(), stream_ids.end()};
+        auto memberships = read_symbol_memberships(store, ids);
+        // The symbol keys describe the snapshots only if no change to the index started while they were read
+        if (auto after = read_coverage(store);
+            after && after->is_complete() && after->generation_ == coverage->generation_) {
+            for (size_t i = 0; i < ids.size(); ++i) {
+                for (const auto& [snapshot_id, keys] : memberships[i]) {
+                    for (const auto& key : keys)
+                        out.map[ids[i]][key].insert(snapshot_id);
+                }
+            }
+            out.total_snapshots = coverage->snapshots_.size();
+            return out;
+        }
+        ARCTICDB_DEBUG(log::snapshot(), "Snapshot membership index changed while it was read");
+        return std::nullopt;
+    }
+
+    // Reading every snapshot is what building the index requires, so the lookup is answered from the build
+    auto contents = build_index(store);
+    if (!contents)
+        return std::nullopt;
+
+    add_to_map(out.map, stream_ids, *contents);
+    out.total_snapshots = contents->size();
+    return out;
+}
+
+SnapshotMembershipUpdate::SnapshotMembershipUpdate(std::shared_ptr<Store> store, SnapshotId snapshot_id) :
+    store_(std::move(store)),
+    snapshot_id_(std::move(snapshot_id)) {
+    // Libraries that use the index must enable it in every process that changes snapshots
+    if (!snapshot_membership_enabled())
+        return;
+
+    unmaintained_ = true;
+    if (!store_->key_exists_sync(membership_key(coverage_id)))
+        return;
+
+    lock_ = std::make_unique<StorageLock<>>(lock_name);
+    try {
+        lock_->lock_timeout(store_, LOCK_TIMEOUT_MS);
+    } catch (const StorageLockTimeout& e) {
+        // Without the lock the index cannot be kept in step with this snapshot, so lookups must not use it
+        log::snapshot().warn("Removing the snapshot membership index, as its lock was not released: {}", e.what());
+        lock_.reset();
+        remove_coverage(store_);
+        return;
+    }
+
+    try {
+        auto coverage = read_coverage(store_);
+        if (coverage && !coverage->is_complete()) {
+            // With the lock held, an index still in progress was left by a process that failed while changing it
+            remove_coverage(store_);
+            coverage.reset();
+        }
+        if (!coverage) {
+            release();
+            return;
+        }
+        coverage->generation_ += 1;
+        coverage->state_ = CoverageState::IN_PROGRESS;
+        write_coverage(store_, *coverage);
+        generation_ = coverage->generation_;
+        unmaintained_ = false;
+    } catch (...) {
+        release();
+        throw;
+    }
+}
+
+SnapshotMembershipUpdate::~SnapshotMembershipUpdate() {
+    try {
+        // The snapshot may have changed without being recorded
+        if (lock_ || unmaintained_)
+            invalidate();
+    } catch (const std::exception& e) {
+        log::snapshot().warn("Failed to invalidate the snapshot membership index: {}", e.what());
+    }
+    release();
+}
+
+void SnapshotMembershipUpdate::record(
+        const std::vector<AtomKey>& previous_keys, const std::vector<AtomKey>& current_keys
+) {
+    update(previous_keys, &current_keys);
+}
+
+void SnapshotMembershipUpdate::remove(const std::vector<AtomKey>& previous_keys) { update(previous_keys, nullptr); }
+
+void SnapshotMembershipUpdate::update(
+        const std::vector<AtomKey>& previous_keys, const std::vector<AtomKey>* current_keys
+) {
+    if (unmaintained_) {
+        // Invalidates an index built or started while this snapshot was being changed
+        invalidate();
+        return;
+    }
+    if (!lock_)
+        return;
+
+    std::unordered_set<StreamId> previous_symbols;
+    for (const auto& key : previous_keys)
+        previous_symbols.insert(key.id());
+
+    replace_snapshot_in_symbol_keys(
+            store_,
+            SnapshotContent{snapshot_id_, current_keys ? *current_keys : std::vector<AtomKey>{}},
+            std::move(previous_symbols)
+    );
+    // The coverage key may have been removed by a process that could not take the lock
+    if (auto coverage = read_coverage(store_); coverage && coverage->generation_ == generation_) {
+        if (current_keys)
+            coverage->snapshots_.insert(snapshot_id_);
+        else
+            coverage->snapshots_.erase(snapshot_id_);
+
+        coverage->state_ = CoverageState::COMPLETE;
+        write_coverage(store_, *coverage);
+    }
+    release();
+}
+
+void SnapshotMembershipUpdate::invalidate() {
+    unmaintained_ = false;
+    if (store_->key_exists_sync(membership_key(coverage_id))) {
+        log::snapshot().info("Removing the snapshot membership index, as snapshot {} changed outside it", snapshot_id_);
+        remove_coverage(store_);
+    }
+}
+
+void SnapshotMembershipUpdate::release() {
+    if (!lock_)
+        return;
+
+    try {
+        lock_->unlock(store_);
+    } catch (const std::exception& e) {
+        log::snapshot().warn("Failed to release the snapshot membership index lock: {}", e.what());
+    }
+    lock_.reset();
+}
+
+} // namespace arcticdb
@@ -0,0 +1,94 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/entity/atom_key.hpp>
+#include <arcticdb/entity/types.hpp>
+#include <arcticdb/storage/store.hpp>
+#include <arcticdb/util/storage_lock.hpp>
+#include <arcticdb/version/snapshot.hpp>
+
+#include <memory>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+namespace arcticdb {
+
+/*
+ * The snapshot membership index is a reverse index from symbols to the snapshots that hold their index keys, so that
+ * deciding whether the versions of a few symbols can be deleted does not read every snapshot in the library.
+ *
+ * Each symbol has a SNAPSHOT_MEMBERSHIP ref key listing, for every snapshot that contains the symbol, a SNAPSHOT key
+ * naming the snapshot followed by the symbol's index keys in it. The coverage key, a SNAPSHOT_MEMBERSHIP key with the
+ * reserved id __snapshot_membership__, holds the generation of the index, whether it is complete, and the snapshots
+ * it records. Every change to the index is made under the index lock and bumps the generation, marking the index in
+ * progress until the change is done.
+ *
+ * A lookup reads the coverage key, the keys of the symbols being checked, and the coverage key again. The symbol keys
+ * are used only if the index was complete at the same generation both times, so no snapshots are listed or read.
+ * Otherwise callers read every snapshot. With Snapshot.MembershipIndex enabled, a lookup that finds no complete index
+ * builds it from every snapshot under the lock.
+ *
+ * The index trusts that every process that creates, changes or deletes a snapshot maintains it, so it must be enabled
+ * in all of them. A process with it enabled that cannot take the lock, or that changes a snapshot while the index is
+ * missing or being built, removes the coverage key once the change is made, and the index is built again by the next
+ * lookup.
+ */
+
+// Whether lookups use, and build, the snapshot membership index
+bool snapshot_membership_enabled();
+
+/*
+ * The map from the given symbols' index keys to the snapshots holding them, with the number of snapshots indexed.
+ * Returns std::nullopt if the index is disabled, or is not complete and could not be built, in which case callers read
+ * every snapshot.
+ */
+std::optional<MasterSnapshotMapWithStats> get_master_snapshots_map_from_membership(
+        const std::shared_ptr<Store>& store, const std::unordered_set<StreamId>& stream_ids
+);
+
+/*
+ * Keeps the membership index in step with a change to one snapshot. Construct it before writing or removing the
+ * snapshot, then call record() or remove() once the change is made. If neither is called, the index is removed, which
+ * is always safe. Does nothing if the index is disabled in this process.
+ */
+class SnapshotMembershipUpdate {
+  public:
+    SnapshotMembershipUpdate(std::shared_ptr<Store> store, SnapshotId snapshot_id);
+
+    ~SnapshotMembershipUpdate();
+
+    ARCTICDB_NO_MOVE_OR_COPY(SnapshotMembershipUpdate)
+
+    // The snapshot now holds current_keys, where it held previous_keys before the change
+    void record(const std::vector<AtomKey>& previous_keys, const std::vector<AtomKey>& current_keys);
+
+    // The snapshot, which held previous_keys, has been removed
+    void remove(const std::vector<AtomKey>& previous_keys);
+
+  private:
+    void update(const std::vector<AtomKey>& previous_keys, const std::vector<AtomKey>* current_keys);
+
+    // Removes the coverage key if it exists, after a change that the index does not record
+    void invalidate();
+
+    void release();
+
+    std::shared_ptr<Store> store_;
+    SnapshotId snapshot_id_;
+    // Held while the index is being maintained
+    std::unique_ptr<StorageLock<>> lock_;
+    // The generation of the index this change makes, while it holds the lock
+    VersionId generation_ = 0;
+    // Set when the index is enabled but this change cannot be recorded in it
+    bool unmaintained_ = false;
+};
+
+} // namespace arcticdb
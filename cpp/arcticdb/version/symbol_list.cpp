@@ -28,6 +28,20 @@ static const StreamId compaction_id{StringId{CompactionId}};
 constexpr std::string_view version_string = "_v2_";
 constexpr NumericIndex version_identifier = std::numeric_limits<NumericIndex>::max();
 
+std::shared_ptr<const CollectionType> CompactedSymbolsCache::get(const AtomKey& compaction_key) const {
+    std::lock_guard lock(mutex_);
+    if (compaction_key_ == compaction_key)
+        return entries_;
+
+    return nullptr;
+}
+
+void CompactedSymbolsCache::set(const AtomKey& compaction_key, std::shared_ptr<const CollectionType> entries) {
+    std::lock_guard lock(mutex_);
+    compaction_key_ = compaction_key;
+    entries_ = std::move(entries);
+}
+
 SymbolListData::SymbolListData(std::shared_ptr<VersionMap> version_map, StreamId type_indicator, uint32_t seed) :
     type_holder_(std::move(type_indicator)),
     seed_(seed),
@@ -49,7 +63,7 @@ bool is_new_style_key(const AtomKey& key) {
     );
 }
 
-std::vector<SymbolListEntry> load_previous_from_version_keys(
+CollectionType load_previous_from_version_keys(
         const std::shared_ptr<Store>& store, SymbolListData& data, WillAttemptCompaction will_attempt_compaction
 ) {
     std::vector<StreamId> stream_ids;
@@ -77,7 +91,7 @@ std::vector<SymbolListEntry> load_previous_from_version_keys(
             folly::collect(batch_get_latest_undeleted_and_latest_versions_async(store, data.version_map_, stream_ids))
                     .get();
 
-    std::vector<SymbolListEntry> symbols;
+    CollectionType symbols;
     for (auto&& [idx, opt_key_pair] : folly::enumerate(res)) {
         const auto& [maybe_undeleted, _] = opt_key_pair;
         if (maybe_undeleted) {
@@ -186,8 +200,8 @@ DataType get_symbol_data_type(const SegmentInMemory& seg) {
     return data_type;
 }
 
-std::vector<SymbolListEntry> read_old_style_list_from_storage(const SegmentInMemory& seg) {
-    std::vector<SymbolListEntry> output;
+CollectionType read_old_style_list_from_storage(const SegmentInMemory& seg) {
+    CollectionType output;
     if (seg.empty())
         return output;
 
@@ -199,8 +213,8 @@ std::vector<SymbolListEntry> read_old_style_list_from_storage(const SegmentInMem
     return output;
 }
 
-std::vector<SymbolListEntry> read_new_style_list_from_storage(const SegmentInMemory& seg) {
-    std::vector<SymbolListEntry> output;
+CollectionType read_new_style_list_from_storage(const SegmentInMemory& seg) {
+    CollectionType output;
     if (seg.empty())
         return output;
 
@@ -253,7 +267,7 @@ std::vector<SymbolListEntry> read_new_style_list_from_storage(const SegmentInMem
     return output;
 }
 
-std::vector<SymbolListEntry> read_from_storage(const std::shared_ptr<StreamSource>& store, const AtomKey& key) {
+CollectionType read_from_storage(const std::shared_ptr<StreamSource>& store, const AtomKey& key) {
     ARCTICDB_DEBUG(log::symbol(), "Reading list from storage with key {}", key);
     auto [_, seg] = store->read_sync(key);
     if (seg.row_count() == 0)
@@ -395,21 +409,21 @@ ProblematicResult is_problematic(
 
 CollectionType merge_existing_with_journal_keys(
         const std::shared_ptr<VersionMap>& version_map, const std::shared_ptr<Store>& store,
-        const std::vector<AtomKey>& keys, std::vector<SymbolListEntry>&& existing
+        const std::vector<AtomKey>& keys, const CollectionType& existing_keys
 ) {
-    auto existing_keys = std::move(existing);
     auto update_map = load_journal_keys(keys);
 
     CollectionType symbols;
+    symbols.reserve(existing_keys.size() + update_map.size());
     std::map<StreamId, std::pair<VersionId, timestamp>> problematic_symbols;
     const auto min_allowed_interval = ConfigsMap::instance()->get_int("SymbolList.MinIntervalNs", 100'000'000LL);
 
-    for (auto& previous_entry : existing_keys) {
+    for (const auto& previous_entry : existing_keys) {
         const auto& stream_id = previous_entry.stream_id_;
         auto updated = update_map.find(stream_id);
         if (updated == std::end(update_map)) {
             if (previous_entry.action_ == ActionType::ADD)
-                symbols.emplace_back(std::move(previous_entry));
+                symbols.emplace_back(previous_entry);
             else
                 util::check(
                         previous_entry.action_ == ActionType::DELETE,
@@ -491,12 +505,20 @@ CollectionType merge_existing_with_journal_keys(
 
 CollectionType load_from_symbol_list_keys(
         const std::shared_ptr<VersionMap>& version_map, const std::shared_ptr<Store>& store,
-        const std::vector<AtomKey>& keys, const Compaction& compaction
+        const std::vector<AtomKey>& keys, const Compaction& compaction, SymbolListData& data
 ) {
     ARCTICDB_RUNTIME_DEBUG(log::symbol(), "Loading symbols from symbol list keys");
 
-    auto previous_compaction = read_from_storage(store, *compaction);
-    return merge_existing_with_journal_keys(version_map, store, keys, std::move(previous_compaction));
+    auto previous_compaction = data.compacted_symbols_.get(*compaction);
+    if (previous_compaction) {
+        ARCTICDB_RUNTIME_DEBUG(log::symbol(), "Reusing {} cached compacted symbols", previous_compaction->size());
+    } else {
+        previous_compaction = std::make_shared<const CollectionType>(read_from_storage(store, *compaction));
+        data.compacted_symbols_.set(*compaction, previous_compaction);
+    }
+    // The cached entries are shared with other loads, so they are merged in place and only the surviving entries are
+    // copied into the result
+    return merge_existing_with_journal_keys(version_map, store, keys, *previous_compaction);
 }
 
 CollectionType load_from_version_keys(
@@ -505,7 +527,7 @@ CollectionType load_from_version_keys(
 ) {
     ARCTICDB_RUNTIME_DEBUG(log::symbol(), "Loading symbols from version keys");
     auto previous_entries = load_previous_from_version_keys(store, data, will_attempt_compaction);
-    return merge_existing_with_journal_keys(version_map, store, keys, std::move(previous_entries));
+    return merge_existing_with_journal_keys(version_map, store, keys, previous_entries);
 }
 
 LoadResult attempt_load(
@@ -519,7 +541,7 @@ LoadResult attempt_load(
 
     if (load_result.maybe_previous_compaction)
         load_result.symbols_ = load_from_symbol_list_keys(
-                version_map, store, load_result.symbol_list_keys_, *load_result.maybe_previous_compaction
+                version_map, store, load_result.symbol_list_keys_, *load_result.maybe_previous_compaction, data
         );
     else {
         load_result.symbols_ = load_from_version_keys(
@@ -829,7 +851,7 @@ size_t SymbolList::compact(const std::shared_ptr<Store>& store) {
     return num_symbol_list_keys;
 }
 
-void SymbolList::compact_internal(const std::shared_ptr<Store>& store, LoadResult& load_result) const {
+void SymbolList::compact_internal(const std::shared_ptr<Store>& store, LoadResult& load_result) {
     if (has_recent_compaction(store, load_result.maybe_previous_compaction)) {
         // legacy arcticc symbol list entries don't get correctly listed when doing `iterate_type`, so can mess
         // up racing symbol list compaction detection.
@@ -841,6 +863,18 @@ void SymbolList::compact_internal(const std::shared_ptr<Store>& store, LoadResul
     } else {
         auto written = write_symbols(store, load_result.symbols_, compaction_id, data_.type_holder_);
         delete_keys(store, load_result.detach_symbol_list_keys(), std::get<AtomKey>(written));
+        // The next load finds the compaction just written, so cache what reading it back would return: the additions
+        // followed by the deletions, or nothing if there are no additions
+        auto compacted = std::make_shared<CollectionType>();
+        if (std::any_of(std::begin(load_result.symbols_), std::end(load_result.symbols_), [](const auto& entry) {
+                return entry.action_ == ActionType::ADD;
+            })) {
+            *compacted = load_result.symbols_;
+            std::stable_partition(std::begin(*compacted), std::end(*compacted), [](const auto& entry) {
+                return entry.action_ == ActionType::ADD;
+            });
+        }
+        data_.compacted_symbols_.set(std::get<AtomKey>(written), std::move(compacted));
     }
 }
 
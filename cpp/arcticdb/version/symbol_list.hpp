@@ -12,7 +12,9 @@
 #include <arcticdb/async/base_task.hpp>
 #include <arcticdb/version/version_map.hpp>
 #include <arcticdb/storage/open_mode.hpp>
+#include <arcticdb/util/regex_filter.hpp>
 #include <folly/futures/Future.h>
+#include <mutex>
 #include <set>
 #include <util/storage_lock.hpp>
 
@@ -40,11 +42,27 @@ struct LoadResult {
     std::vector<AtomKey>&& detach_symbol_list_keys() { return std::move(symbol_list_keys_); }
 };
 
+// The entries of the last compacted symbol list segment that this process read or wrote. Compaction keys are never
+// rewritten, so while a load finds the same compaction it merges the new journal keys into these entries instead of
+// reading and decoding the compacted segment again, which dominates list_symbols on libraries with many symbols.
+class CompactedSymbolsCache {
+  public:
+    std::shared_ptr<const CollectionType> get(const AtomKey& compaction_key) const;
+
+    void set(const AtomKey& compaction_key, std::shared_ptr<const CollectionType> entries);
+
+  private:
+    mutable std::mutex mutex_;
+    std::optional<AtomKey> compaction_key_;
+    std::shared_ptr<const CollectionType> entries_;
+};
+
 struct SymbolListData {
     StreamId type_holder_;
     uint32_t seed_;
     std::shared_ptr<VersionMap> version_map_;
     std::atomic<bool> warned_expected_slowdown_ = false;
+    CompactedSymbolsCache compacted_symbols_;
 
     explicit SymbolListData(
             std::shared_ptr<VersionMap> version_map, StreamId type_indicator = StringId(), uint32_t seed = 0
@@ -145,8 +163,15 @@ class SymbolList {
     ) :
         data_(std::move(version_map), std::move(type_indicator), seed) {}
 
+    /**
+     * @param regex If set, only symbols that match it are returned. Matching while loading avoids building the full
+     * set of symbols only to filter it.
+     */
     template<StreamIdSet R>
-    R load(const std::shared_ptr<VersionMap>& version_map, const std::shared_ptr<Store>& store, bool no_compaction) {
+    R load(
+            const std::shared_ptr<VersionMap>& version_map, const std::shared_ptr<Store>& store, bool no_compaction,
+            const std::optional<std::string>& regex = std::nullopt
+    ) {
         const WillAttemptCompaction will_attempt_compaction = [&]() {
             if (no_compaction)
                 return WillAttemptCompaction::NO_DISABLED;
@@ -181,9 +206,23 @@ class SymbolList {
         }
 
         R output;
+        std::optional<util::RegexPatternUTF8> pattern;
+        std::optional<util::RegexUTF8> matcher;
+        if (regex) {
+            pattern.emplace(*regex);
+            matcher.emplace(*pattern);
+        }
+
         for (const auto& entry : load_result.symbols_) {
-            if (entry.action_ == ActionType::ADD)
-                output.insert(entry.stream_id_);
+            if (entry.action_ != ActionType::ADD)
+                continue;
+
+            if (matcher) {
+                const auto* string_id = std::get_if<StringId>(&entry.stream_id_);
+                if (!matcher->match(string_id ? *string_id : std::string()))
+                    continue;
+            }
+            output.insert(entry.stream_id_);
         }
 
         return output;
@@ -195,8 +234,8 @@ class SymbolList {
     }
 
     template<typename R = std::set<StreamId>>
-    R get_symbol_set(const std::shared_ptr<Store>& store) {
-        return load<R>(data_.version_map_, store, false);
+    R get_symbol_set(const std::shared_ptr<Store>& store, const std::optional<std::string>& regex = std::nullopt) {
+        return load<R>(data_.version_map_, store, false, regex);
     }
 
     size_t compact(const std::shared_ptr<Store>& store);
@@ -210,7 +249,7 @@ class SymbolList {
     static void clear(const std::shared_ptr<Store>& store);
 
   private:
-    void compact_internal(const std::shared_ptr<Store>& store, LoadResult& load_result) const;
+    void compact_internal(const std::shared_ptr<Store>& store, LoadResult& load_result);
 
     [[nodiscard]] bool needs_compaction(const LoadResult& load_result) const;
 };
@@ -0,0 +1,68 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <arcticdb/storage/test/in_memory_store.hpp>
+#include <arcticdb/version/symbol_list.hpp>
+
+using namespace arcticdb;
+
+// run like: --benchmark_time_unit=ms --benchmark_filter=.* --benchmark_counters_tabular=true
+
+namespace {
+
+// A store whose symbol list is compacted, with a few journal entries written after the compaction as a busy library
+// would have between compactions
+std::shared_ptr<InMemoryStore> compacted_symbol_list_store(size_t num_symbols, const std::shared_ptr<VersionMap>& map) {
+    auto store = std::make_shared<InMemoryStore>();
+    SymbolList writer{map};
+    writer.load<std::set<StreamId>>(map, store, false);
+    for (size_t i = 0; i < num_symbols; ++i)
+        SymbolList::add_symbol(store, StreamId{fmt::format("symbol_{:07}", i)}, 0);
+
+    writer.compact(store);
+    for (size_t i = 0; i < 10; ++i)
+        SymbolList::add_symbol(store, StreamId{fmt::format("new_symbol_{}", i)}, 0);
+
+    return store;
+}
+
+} // namespace
+
+// Repeated listing by the same instance, which reuses the compacted symbols it has already decoded
+static void BM_list_symbols_same_instance(benchmark::State& state) {
+    auto version_map = std::make_shared<VersionMap>();
+    auto store = compacted_symbol_list_store(static_cast<size_t>(state.range(0)), version_map);
+    SymbolList symbol_list{version_map};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(symbol_list.get_symbol_set(store));
+}
+
+// Listing by a new instance each time, which reads and decodes the compacted segment
+static void BM_list_symbols_new_instance(benchmark::State& state) {
+    auto version_map = std::make_shared<VersionMap>();
+    auto store = compacted_symbol_list_store(static_cast<size_t>(state.range(0)), version_map);
+    for (auto _ : state) {
+        SymbolList symbol_list{version_map};
+        benchmark::DoNotOptimize(symbol_list.get_symbol_set(store));
+    }
+}
+
+// Listing symbols with a prefix that matches about one in a thousand of them
+static void BM_list_symbols_prefix(benchmark::State& state) {
+    auto version_map = std::make_shared<VersionMap>();
+    auto store = compacted_symbol_list_store(static_cast<size_t>(state.range(0)), version_map);
+    SymbolList symbol_list{version_map};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(symbol_list.get_symbol_set(store, "^symbol_0001"));
+}
+
+BENCHMARK(BM_list_symbols_same_instance)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_list_symbols_new_instance)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_list_symbols_prefix)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,89 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <arcticdb/async/task_scheduler.hpp>
+#include <arcticdb/storage/test/in_memory_store.hpp>
+#include <arcticdb/version/version_map.hpp>
+#include <arcticdb/version/version_map_batch_methods.hpp>
+
+#include <map>
+#include <mutex>
+
+using namespace arcticdb;
+
+// run like: --benchmark_time_unit=ms --benchmark_filter=.* --benchmark_counters_tabular=true
+
+namespace {
+
+// A version map with every symbol's latest version cached, so that lookups measure the cache rather than the store
+struct CachedVersionMap {
+    std::shared_ptr<InMemoryStore> store_ = std::make_shared<InMemoryStore>();
+    std::shared_ptr<VersionMap> version_map_ = std::make_shared<VersionMap>();
+    std::vector<StreamId> stream_ids_;
+
+    explicit CachedVersionMap(size_t num_symbols) {
+        version_map_->set_reload_interval(std::numeric_limits<timestamp>::max());
+        for (size_t i = 0; i < num_symbols; ++i) {
+            StreamId stream_id{fmt::format("symbol_{}", i)};
+            auto key = atom_key_builder().version_id(0).creation_ts(1).content_hash(i).build(
+                    stream_id, KeyType::TABLE_INDEX
+            );
+            version_map_->write_version(store_, key, std::nullopt);
+            stream_ids_.push_back(std::move(stream_id));
+        }
+    }
+};
+
+const CachedVersionMap& cached_version_map(size_t num_symbols) {
+    static std::map<size_t, std::unique_ptr<CachedVersionMap>> maps;
+    static std::mutex mutex;
+    std::lock_guard lock(mutex);
+    auto& map = maps[num_symbols];
+    if (!map)
+        map = std::make_unique<CachedVersionMap>(num_symbols);
+    return *map;
+}
+
+} // namespace
+
+// Lookups of cached entries from the benchmark's own threads, each thread walking all of the symbols
+static void BM_version_map_cached_lookup(benchmark::State& state) {
+    const auto& cached = cached_version_map(static_cast<size_t>(state.range(0)));
+    const LoadStrategy load_strategy{LoadType::LATEST, LoadObjective::UNDELETED_ONLY};
+    const auto offset = static_cast<size_t>(state.thread_index()) * 997;
+    for (auto _ : state) {
+        for (size_t i = 0; i < cached.stream_ids_.size(); ++i) {
+            const auto& stream_id = cached.stream_ids_[(i + offset) % cached.stream_ids_.size()];
+            benchmark::DoNotOptimize(
+                    cached.version_map_->check_reload(cached.store_, stream_id, load_strategy, __FUNCTION__)
+            );
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * cached.stream_ids_.size()));
+}
+
+// batch_get_latest_version as called by batch_read, with the IO pool sized to the thread count under test
+static void BM_batch_get_latest_version(benchmark::State& state) {
+    const auto num_threads = static_cast<size_t>(state.range(0));
+    const auto& cached = cached_version_map(static_cast<size_t>(state.range(1)));
+    async::TaskScheduler::instance()->set_max_threads(num_threads);
+    async::TaskScheduler::instance()->set_active_threads(num_threads);
+    for (auto _ : state) {
+        auto latest = batch_get_latest_version(cached.store_, cached.version_map_, cached.stream_ids_, false);
+        benchmark::DoNotOptimize(latest);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * cached.stream_ids_.size()));
+}
+
+BENCHMARK(BM_version_map_cached_lookup)->Arg(20'000)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_batch_get_latest_version)
+        ->ArgsProduct({{1, 2, 4, 8, 16, 32}, {20'000}})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
@@ -0,0 +1,139 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arcticdb/storage/test/in_memory_store.hpp>
+#include <arcticdb/util/configs_map.hpp>
+#include <arcticdb/version/snapshot.hpp>
+#include <arcticdb/version/snapshot_membership.hpp>
+
+using namespace arcticdb;
+
+namespace {
+
+AtomKey index_key(const StreamId& stream_id, VersionId version_id) {
+    return atom_key_builder().version_id(version_id).creation_ts(version_id).content_hash(version_id).build(
+            stream_id, KeyType::TABLE_INDEX
+    );
+}
+
+// Writes a snapshot as a client that does not maintain the membership index would
+void write_unrecorded_snapshot(
+        const std::shared_ptr<Store>& store, const SnapshotId& snapshot_id, std::vector<AtomKey> keys
+) {
+    write_snapshot_entry(store, keys, snapshot_id, py::none(), false);
+}
+
+void write_snapshot(const std::shared_ptr<Store>& store, const SnapshotId& snapshot_id, std::vector<AtomKey> keys) {
+    SnapshotMembershipUpdate update{store, snapshot_id};
+    write_snapshot_entry(store, keys, snapshot_id, py::none(), false);
+    update.record({}, keys);
+}
+
+void delete_snapshot(const std::shared_ptr<Store>& store, const SnapshotId& snapshot_id) {
+    const RefKey snapshot_key{snapshot_id, KeyType::SNAPSHOT_REF};
+    auto previous_keys = get_versions_from_segment(store->read_sync(snapshot_key).second);
+    SnapshotMembershipUpdate update{store, snapshot_id};
+    store->remove_key_sync(snapshot_key);
+    update.remove(previous_keys);
+}
+
+MasterSnapshotMap read_every_snapshot(
+        const std::shared_ptr<Store>& store, const std::unordered_set<StreamId>& stream_ids
+) {
+    ScopedConfig disabled("Snapshot.MembershipIndex", 0);
+    return get_master_snapshots_map(store, stream_ids);
+}
+
+bool index_exists(const std::shared_ptr<Store>& store) {
+    return store->key_exists_sync(RefKey{StreamId{"__snapshot_membership__"}, KeyType::SNAPSHOT_MEMBERSHIP});
+}
+
+} // namespace
+
+TEST(SnapshotMembership, MatchesSnapshots) {
+    ScopedConfig enabled("Snapshot.MembershipIndex", 1);
+    ScopedConfig lock_wait("StorageLock.WaitMs", 1);
+    auto store = std::make_shared<InMemoryStore>();
+    const StreamId sym_a{"a"};
+    const StreamId sym_b{"b"};
+    const std::unordered_set<StreamId> stream_ids{sym_a, sym_b};
+
+    // Snapshots that predate the index are read in full by the lookup that builds it
+    write_unrecorded_snapshot(store, "s1", {index_key(sym_a, 0), index_key(sym_b, 0)});
+    write_unrecorded_snapshot(store, "s2", {index_key(sym_a, 1)});
+    ASSERT_EQ(get_master_snapshots_map(store, stream_ids), read_every_snapshot(store, stream_ids));
+    ASSERT_TRUE(store->key_exists_sync(RefKey{sym_a, KeyType::SNAPSHOT_MEMBERSHIP}));
+    ASSERT_TRUE(store->key_exists_sync(RefKey{sym_b, KeyType::SNAPSHOT_MEMBERSHIP}));
+
+    write_snapshot(store, "s3", {index_key(sym_a, 2), index_key(sym_b, 0)});
+    auto from_membership = get_master_snapshots_map_with_stats(store, stream_ids);
+    ASSERT_EQ(from_membership.map, read_every_snapshot(store, stream_ids));
+    ASSERT_EQ(from_membership.total_snapshots, size_t{3});
+    ASSERT_EQ(from_membership.map[sym_b][index_key(sym_b, 0)], (std::unordered_set<SnapshotId>{"s1", "s3"}));
+
+    delete_snapshot(store, "s2");
+    auto after_delete = get_master_snapshots_map(store, stream_ids);
+    ASSERT_EQ(after_delete, read_every_snapshot(store, stream_ids));
+    ASSERT_FALSE(after_delete[sym_a].contains(index_key(sym_a, 1)));
+    ASSERT_EQ(
+            get_index_keys_in_snapshots(store, sym_a),
+            (std::unordered_set<AtomKey>{index_key(sym_a, 0), index_key(sym_a, 2)})
+    );
+    ASSERT_EQ(find_index_key_in_snapshots(store, sym_a, 2), index_key(sym_a, 2));
+    ASSERT_EQ(find_index_key_in_snapshots(store, sym_a, 1), std::nullopt);
+}
+
+TEST(SnapshotMembership, LookupsReadOnlyTheIndex) {
+    ScopedConfig enabled("Snapshot.MembershipIndex", 1);
+    ScopedConfig lock_wait("StorageLock.WaitMs", 1);
+    auto store = std::make_shared<InMemoryStore>();
+    const StreamId sym_a{"a"};
+    write_snapshot(store, "s1", {index_key(sym_a, 0)});
+    ASSERT_FALSE(index_exists(store));
+    ASSERT_EQ(get_index_keys_in_snapshots(store, sym_a), std::unordered_set<AtomKey>{index_key(sym_a, 0)});
+    ASSERT_TRUE(index_exists(store));
+
+    // A snapshot removed without the index is still reported, which shows that the snapshots were not read
+    store->remove_key_sync(RefKey{"s1", KeyType::SNAPSHOT_REF});
+    ASSERT_EQ(get_index_keys_in_snapshots(store, sym_a), std::unordered_set<AtomKey>{index_key(sym_a, 0)});
+}
+
+TEST(SnapshotMembership, UnrecordedChangeRemovesIndex) {
+    ScopedConfig enabled("Snapshot.MembershipIndex", 1);
+    ScopedConfig lock_wait("StorageLock.WaitMs", 1);
+    auto store = std::make_shared<InMemoryStore>();
+    const StreamId sym_a{"a"};
+    write_unrecorded_snapshot(store, "s1", {index_key(sym_a, 0)});
+    get_index_keys_in_snapshots(store, sym_a);
+    ASSERT_TRUE(index_exists(store));
+
+    // A change that fails before it is recorded leaves the index removed, and the next lookup builds it again
+    {
+        SnapshotMembershipUpdate update{store, "s2"};
+        write_unrecorded_snapshot(store, "s2", {index_key(sym_a, 1)});
+    }
+    ASSERT_FALSE(index_exists(store));
+    ASSERT_EQ(
+            get_index_keys_in_snapshots(store, sym_a),
+            (std::unordered_set<AtomKey>{index_key(sym_a, 0), index_key(sym_a, 1)})
+    );
+    ASSERT_TRUE(index_exists(store));
+}
+
+TEST(SnapshotMembership, NotMaintainedUntilBuilt) {
+    ScopedConfig lock_wait("StorageLock.WaitMs", 1);
+    auto store = std::make_shared<InMemoryStore>();
+    write_snapshot(store, "s1", {index_key(StreamId{"a"}, 0)});
+    ASSERT_FALSE(store->key_exists_sync(RefKey{StreamId{"a"}, KeyType::SNAPSHOT_MEMBERSHIP}));
+
+    ScopedConfig enabled("Snapshot.MembershipIndex", 1);
+    write_snapshot(store, "s2", {index_key(StreamId{"a"}, 1)});
+    ASSERT_FALSE(store->key_exists_sync(RefKey{StreamId{"a"}, KeyType::SNAPSHOT_MEMBERSHIP}));
+}
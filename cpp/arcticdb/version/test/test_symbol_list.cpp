@@ -908,6 +908,39 @@ TEST_F(SymbolListSuite, KeyHashIsDifferent) {
     ASSERT_EQ(hashes.size(), 3);
 }
 
+TEST_F(SymbolListSuite, ReusesCompactedSymbols) {
+    write_initial_compaction_key();
+    SymbolList::add_symbol(store_, symbol_1, 0);
+    SymbolList::add_symbol(store_, symbol_2, 0);
+    symbol_list_->compact(store_);
+    SymbolList::add_symbol(store_, symbol_3, 0);
+
+    // The compaction this instance wrote is not read back while it is the latest one
+    StorageFailureSimulator::instance()->configure({{FailureType::READ, {fault()}}});
+    ASSERT_THAT(symbol_list_->get_symbols(store_, true), ElementsAre(symbol_1, symbol_2, symbol_3));
+    StorageFailureSimulator::reset();
+
+    // A compaction by another instance is read from storage
+    SymbolList other{version_map_};
+    SymbolList::add_symbol(store_, StreamId{"ddd"}, 0);
+    other.compact(store_);
+    ASSERT_THAT(
+            symbol_list_->get_symbols(store_, true), ElementsAre(symbol_1, symbol_2, symbol_3, StreamId{"ddd"})
+    );
+}
+
+TEST_F(SymbolListSuite, FiltersWhileLoading) {
+    write_initial_compaction_key();
+    SymbolList::add_symbol(store_, symbol_1, 0);
+    SymbolList::add_symbol(store_, symbol_2, 0);
+    SymbolList::add_symbol(store_, symbol_3, 0);
+
+    ASSERT_THAT(symbol_list_->get_symbol_set(store_, "^b"), ElementsAre(symbol_2));
+    ASSERT_THAT(symbol_list_->get_symbol_set(store_, "a|c"), ElementsAre(symbol_1, symbol_3));
+    ASSERT_THAT(symbol_list_->get_symbol_set(store_, "^z"), IsEmpty());
+    ASSERT_THAT(symbol_list_->get_symbol_set(store_), ElementsAre(symbol_1, symbol_2, symbol_3));
+}
+
 struct ReferenceVersionMap {
     std::unordered_map<StreamId, VersionId> versions_;
     std::mutex mutex_;
@@ -17,6 +17,9 @@
 #include <arcticdb/version/version_map_batch_methods.hpp>
 #include <arcticdb/stream/test/stream_test_common.hpp>
 
+#include <atomic>
+#include <thread>
+
 namespace arcticdb {
 
 using ::testing::UnorderedElementsAre;
@@ -959,6 +962,86 @@ TEST(VersionMap, FollowingVersionChainWithWriteAndPrunePrevious) {
     }
 }
 
+TEST(VersionMap, VersionCatalogue) {
+    auto store = std::make_shared<InMemoryStore>();
+    auto version_map = std::make_shared<VersionMap>();
+    version_map->set_use_catalogue(true);
+    StreamId id{"test"};
+    using Type = VersionChainOperation::Type;
+    std::vector<VersionChainOperation> version_chain;
+    for (VersionId version_id = 0; version_id < 20; ++version_id)
+        version_chain.push_back({Type::WRITE, version_id});
+    version_chain.push_back({Type::TOMBSTONE, 5});
+    write_versions(store, version_map, id, version_chain);
+
+    // A full load that follows the chain one VERSION key at a time rebuilds the catalogue
+    const RefKey catalogue_key{id, KeyType::VERSION_CATALOGUE};
+    ASSERT_FALSE(store->key_exists(catalogue_key).get());
+    const LoadStrategy load_all{LoadType::ALL, LoadObjective::INCLUDE_DELETED};
+    version_map->load_via_ref_key(store, id, load_all, std::make_shared<VersionMapEntry>(id));
+    ASSERT_TRUE(store->key_exists(catalogue_key).get());
+
+    write_versions(store, version_map, id, {{Type::WRITE, 20}, {Type::WRITE, 21}});
+    auto ref_entry = VersionMapEntry{id};
+    read_symbol_ref(store, id, ref_entry);
+
+    auto expected = std::make_shared<VersionMapEntry>(id);
+    std::make_shared<VersionMap>()->follow_version_chain(store, ref_entry, expected, load_all);
+
+    // The VERSION keys written since the catalogue was built are read one at a time, and so are the first two that the
+    // catalogue holds, as compaction may have rewritten them
+    auto entry = std::make_shared<VersionMapEntry>(id);
+    ASSERT_EQ(version_map->follow_version_chain(store, ref_entry, entry, load_all), 4u);
+    ASSERT_EQ(entry->head_, expected->head_);
+    ASSERT_EQ(entry->keys_, expected->keys_);
+    ASSERT_TRUE(entry->load_progress_.is_earliest_version_loaded);
+    ASSERT_EQ(entry->load_progress_.oldest_loaded_index_version_, VersionId{0});
+    ASSERT_TRUE(entry->is_tombstoned(atom_key_with_version(id, 5, 5)));
+
+    // Compaction rewrites VERSION keys that the catalogue holds
+    version_map->compact(store, id);
+    ASSERT_FALSE(store->key_exists(catalogue_key).get());
+
+    // Deleting the symbol removes its catalogue
+    write_version_catalogue(store, *version_map->check_reload(store, id, load_all, __FUNCTION__));
+    ASSERT_TRUE(store->key_exists(catalogue_key).get());
+    version_map->delete_all_versions(store, id);
+    ASSERT_FALSE(store->key_exists(catalogue_key).get());
+}
+
+TEST(VersionMap, OutOfDateVersionCatalogue) {
+    auto store = std::make_shared<InMemoryStore>();
+    auto version_map = std::make_shared<VersionMap>();
+    version_map->set_use_catalogue(true);
+    StreamId id{"test"};
+    using Type = VersionChainOperation::Type;
+    std::vector<VersionChainOperation> version_chain;
+    for (VersionId version_id = 0; version_id < 8; ++version_id)
+        version_chain.push_back({Type::WRITE, version_id});
+    write_versions(store, version_map, id, version_chain);
+
+    const LoadStrategy load_all{LoadType::ALL, LoadObjective::INCLUDE_DELETED};
+    auto ref_entry = VersionMapEntry{id};
+    read_symbol_ref(store, id, ref_entry);
+    auto loaded = std::make_shared<VersionMapEntry>(id);
+    std::make_shared<VersionMap>()->follow_version_chain(store, ref_entry, loaded, load_all);
+
+    // A load that read the chain before a compaction writes its catalogue after the compaction removed the old one
+    version_map->compact(store, id);
+    write_version_catalogue(store, *loaded);
+
+    read_symbol_ref(store, id, ref_entry);
+    auto expected = std::make_shared<VersionMapEntry>(id);
+    std::make_shared<VersionMap>()->follow_version_chain(store, ref_entry, expected, load_all);
+
+    // The catalogue holds the compacted VERSION key with its old contents, so it must not be read from below that key
+    auto entry = std::make_shared<VersionMapEntry>(id);
+    version_map->follow_version_chain(store, ref_entry, entry, load_all);
+    ASSERT_EQ(entry->head_, expected->head_);
+    ASSERT_EQ(entry->keys_, expected->keys_);
+    ASSERT_TRUE(entry->load_progress_.is_earliest_version_loaded);
+}
+
 TEST(VersionMap, HasCachedEntry) {
     ScopedConfig sc("VersionMap.ReloadInterval", std::numeric_limits<int64_t>::max());
     // Set up the version chain v0 <- v1(tombstone_all) <- v2 <- v3(tombstoned)
@@ -1575,6 +1658,84 @@ TEST(VersionMap, DowntoCacheHitAfterFromTimeWithTombstoneAll) {
     ));
 }
 
+TEST(VersionMap, ConcurrentCachedLookups) {
+    auto store = std::make_shared<InMemoryStore>();
+    auto version_map = std::make_shared<VersionMap>();
+    version_map->set_reload_interval(std::numeric_limits<timestamp>::max());
+    const size_t num_symbols = 200;
+    for (size_t i = 0; i < num_symbols; ++i) {
+        auto key = atom_key_builder().version_id(i).creation_ts(i).content_hash(i).build(
+                StreamId{fmt::format("symbol_{}", i)}, KeyType::TABLE_INDEX
+        );
+        version_map->write_version(store, key, std::nullopt);
+    }
+
+    // Lookups from many threads race with each other and with flushes, which force reloads from the store
+    const LoadStrategy load_strategy{LoadType::LATEST, LoadObjective::UNDELETED_ONLY};
+    std::vector<std::thread> threads;
+    std::atomic<size_t> mismatches{0};
+    for (size_t t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            for (size_t i = 0; i < num_symbols * 10; ++i) {
+                const auto symbol = (i + t * 31) % num_symbols;
+                auto entry = version_map->check_reload(
+                        store, StreamId{fmt::format("symbol_{}", symbol)}, load_strategy, __FUNCTION__
+                );
+                if (entry->get_first_index(false).first->version_id() != symbol)
+                    ++mismatches;
+                if (t == 0 && i % 100 == 0)
+                    version_map->flush();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    ASSERT_EQ(mismatches, 0);
+}
+
+TEST(VersionMap, ChangeJournalInvalidatesCachedEntries) {
+    // The store and the version maps share the piloted clock, so journal entries and reload times are comparable
+    PilotedClock::time_ = ONE_MINUTE;
+    auto store = std::make_shared<InMemoryStore>();
+    auto writer = std::make_shared<VersionMapImpl<PilotedClock>>();
+    auto reader = std::make_shared<VersionMapImpl<PilotedClock>>();
+    for (const auto& version_map : {writer, reader}) {
+        version_map->set_reload_interval(ONE_SECOND);
+        version_map->set_change_journal(std::make_shared<VersionChangeJournal>());
+    }
+
+    StreamId changed{"changed"};
+    StreamId unchanged{"unchanged"};
+    auto index_key = [](const StreamId& id, VersionId version_id) {
+        return atom_key_builder()
+                .version_id(version_id)
+                .creation_ts(PilotedClock::nanos_since_epoch())
+                .content_hash(version_id)
+                .build(id, KeyType::TABLE_INDEX);
+    };
+    writer->write_version(store, index_key(changed, 0), std::nullopt);
+    writer->write_version(store, index_key(unchanged, 0), std::nullopt);
+
+    // Load both symbols into the reader's cache beyond the clock unsync tolerance of the writes
+    PilotedClock::time_ += ONE_SECOND;
+    const LoadStrategy load_strategy{LoadType::LATEST, LoadObjective::UNDELETED_ONLY};
+    reader->check_reload(store, changed, load_strategy, __FUNCTION__);
+    reader->check_reload(store, unchanged, load_strategy, __FUNCTION__);
+
+    // Past the reload interval the journal has to be polled again before cached entries can be used
+    PilotedClock::time_ += 2 * ONE_SECOND;
+    writer->write_version(store, index_key(changed, 1), std::nullopt);
+    ASSERT_FALSE(reader->has_cached_entry(unchanged, load_strategy));
+
+    auto entry = reader->check_reload(store, changed, load_strategy, __FUNCTION__);
+    ASSERT_EQ(entry->get_first_index(false).first->version_id(), 1);
+
+    // The poll showed no change to the other symbol, so its entry is still used well past the reload interval
+    ASSERT_TRUE(reader->has_cached_entry(unchanged, load_strategy));
+    entry = reader->check_reload(nullptr, unchanged, load_strategy, __FUNCTION__);
+    ASSERT_EQ(entry->get_first_index(false).first->version_id(), 0);
+}
+
 #define GTEST_COUT std::cerr << "[          ] [ INFO ]"
 
 TEST_F(VersionMapStore, StressTestWrite) {
@@ -294,3 +294,43 @@ TEST_F(VersionMapBatchStore, SpecificVersionsShouldCopyInput) {
         sym_versions.insert({symbol_2, {50}});
     }
 }
+
+TEST_F(VersionMapBatchStore, AsyncLoadsMatchSynchronousLoads) {
+    SKIP_WIN("Exceeds LMDB map size");
+    auto store = test_store_->_test_get_store();
+    auto writer_map = std::make_shared<VersionMap>();
+    const StreamId live{"live"};
+    const StreamId with_deletes{"with_deletes"};
+    add_versions_for_stream(writer_map, store, live, 5);
+    add_versions_for_stream(writer_map, store, with_deletes, 6);
+    auto entry = writer_map->check_reload(
+            store, with_deletes, LoadStrategy{LoadType::ALL, LoadObjective::INCLUDE_DELETED}, __FUNCTION__
+    );
+    writer_map->write_tombstones(store, {test_index_key(with_deletes, 5)}, with_deletes, entry);
+    writer_map->write_tombstones(store, {test_index_key(with_deletes, 4)}, with_deletes, entry);
+
+    const std::vector<LoadStrategy> load_strategies{
+            LoadStrategy{LoadType::LATEST, LoadObjective::UNDELETED_ONLY},
+            LoadStrategy{LoadType::LATEST, LoadObjective::INCLUDE_DELETED},
+            LoadStrategy{LoadType::DOWNTO, LoadObjective::UNDELETED_ONLY, static_cast<SignedVersionId>(1)},
+            LoadStrategy{LoadType::DOWNTO, LoadObjective::INCLUDE_DELETED, static_cast<SignedVersionId>(-2)},
+            LoadStrategy{LoadType::ALL, LoadObjective::INCLUDE_DELETED}
+    };
+    for (const auto& load_strategy : load_strategies) {
+        for (const auto& stream_id : {live, with_deletes, StreamId{"missing"}}) {
+            auto sync_map = std::make_shared<VersionMap>();
+            auto expected = sync_map->check_reload(store, stream_id, load_strategy, __FUNCTION__);
+            auto async_map = std::make_shared<VersionMap>();
+            auto loaded = batch_load_entry(store, async_map, stream_id, load_strategy).get();
+            ASSERT_EQ(loaded->head_, expected->head_);
+            ASSERT_EQ(loaded->get_indexes(true), expected->get_indexes(true));
+            ASSERT_EQ(loaded->get_indexes(false), expected->get_indexes(false));
+            ASSERT_EQ(
+                    loaded->load_progress_.is_earliest_version_loaded,
+                    expected->load_progress_.is_earliest_version_loaded
+            );
+            if (!expected->empty())
+                ASSERT_TRUE(async_map->has_cached_entry(stream_id, load_strategy));
+        }
+    }
+}
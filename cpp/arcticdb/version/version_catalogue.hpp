@@ -0,0 +1,138 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/entity/key.hpp>
+#include <arcticdb/entity/types.hpp>
+#include <arcticdb/storage/store.hpp>
+#include <arcticdb/stream/index_aggregator.hpp>
+#include <arcticdb/stream/stream_utils.hpp>
+#include <arcticdb/version/version_map_entry.hpp>
+#include <arcticdb/version/version_utils.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace arcticdb {
+
+/*
+ * The version catalogue of a symbol is a VERSION_CATALOGUE ref key whose segment holds every key of the version chain
+ * from one VERSION key downwards, in chain order and in the same columnar layout as a VERSION key's segment:
+ *
+ * Version catalogue: ['sym'| [v2|i2|v1|i1|t0|v0|i0]]
+ *
+ * The chain below a VERSION key never changes other than through compaction, which rewrites the VERSION key it compacts
+ * into in place and removes the catalogue. Writes since the catalogue was built add VERSION keys above it, so a load
+ * follows the chain down to a VERSION key that the catalogue holds, checks that the catalogue agrees with that key's
+ * contents (see read_chain_from_catalogue), and reads the rest from the catalogue. Catalogues are rebuilt from fully
+ * loaded entries, and removed along with the chain when the symbol is deleted or its chain is rewritten.
+ */
+struct VersionCatalogue {
+    SegmentInMemory segment_;
+    // The rows holding VERSION keys, starting with the VERSION key the catalogue was built from in row 0
+    std::vector<std::pair<ssize_t, AtomKey>> version_rows_;
+};
+
+inline std::optional<VersionCatalogue> read_version_catalogue(
+        const std::shared_ptr<StreamSource>& store, const StreamId& stream_id
+) {
+    storage::ReadKeyOpts read_opts;
+    read_opts.dont_warn_about_missing_key = true;
+    VersionCatalogue catalogue;
+    try {
+        catalogue.segment_ = store->read_sync(RefKey{stream_id, KeyType::VERSION_CATALOGUE}, read_opts).second;
+    } catch (const storage::KeyNotFoundException&) {
+        return std::nullopt;
+    }
+
+    const auto& segment = catalogue.segment_;
+    for (ssize_t row = 0; row < ssize_t(segment.row_count()); ++row) {
+        if (stream::key_type_from_segment<pipelines::index::Fields>(segment, row) == KeyType::VERSION)
+            catalogue.version_rows_.emplace_back(row, read_key_row(segment, row));
+    }
+    util::check(
+            !catalogue.version_rows_.empty() && catalogue.version_rows_.front().first == 0,
+            "Version catalogue for {} does not start with a version key",
+            stream_id
+    );
+    return catalogue;
+}
+
+inline void write_version_catalogue(const std::shared_ptr<StreamSink>& store, const VersionMapEntry& entry) {
+    util::check(
+            entry.head_ && entry.head_->type() == KeyType::VERSION && entry.load_progress_.is_earliest_version_loaded,
+            "Version catalogue for {} requires a fully loaded entry",
+            entry.stream_id_
+    );
+    ARCTICDB_DEBUG(log::version(), "Writing version catalogue for {} from {}", entry.stream_id_, *entry.head_);
+
+    IndexAggregator<RowCountIndex> catalogue_agg(entry.stream_id_, [&store, &entry](auto&& s) {
+        auto segment = std::forward<decltype(s)>(s);
+        store->write_sync(KeyType::VERSION_CATALOGUE, entry.stream_id_, std::move(segment));
+    });
+    catalogue_agg.add_key(*entry.head_);
+    for (const auto& key : entry.keys_)
+        catalogue_agg.add_key(key.to_atom_key(entry.stream_id_));
+
+    catalogue_agg.finalize();
+}
+
+inline void remove_version_catalogue(const std::shared_ptr<StreamSink>& store, const StreamId& stream_id) {
+    store->remove_key_sync(
+            RefKey{stream_id, KeyType::VERSION_CATALOGUE}, storage::RemoveOpts{.ignores_missing_key_ = true}
+    );
+}
+
+// Whether the rows after the catalogue row holding a VERSION key are the keys of that VERSION key's segment in storage
+inline bool catalogue_matches(const VersionCatalogue& catalogue, ssize_t row, const SegmentInMemory& version_segment) {
+    const auto& segment = catalogue.segment_;
+    if (row + 1 + ssize_t(version_segment.row_count()) > ssize_t(segment.row_count()))
+        return false;
+
+    for (ssize_t i = 0; i < ssize_t(version_segment.row_count()); ++i) {
+        if (read_key_row(version_segment, i) != read_key_row(segment, row + 1 + i))
+            return false;
+    }
+    return true;
+}
+
+enum class CatalogueRead { NOT_HELD, OUT_OF_DATE, READ };
+
+// Compaction rewrites the second VERSION key of the chain in place, so of the VERSION keys that a catalogue holds only
+// its first two can have been rewritten since it was built, e.g. by a compaction that removed the catalogue before a
+// concurrent load wrote it again. The catalogue is therefore only read from below its second VERSION key or a later
+// one, once that key has been read from storage and found to match the catalogue. Given the VERSION key just read, this
+// reads the rest of the chain below it from the catalogue into the entry if it can.
+inline CatalogueRead read_chain_from_catalogue(
+        const VersionCatalogue& catalogue, const AtomKey& version_key, const SegmentInMemory& version_segment,
+        VersionMapEntry& entry, LoadProgress& load_progress
+) {
+    for (size_t i = 1; i < catalogue.version_rows_.size(); ++i) {
+        const auto& [row, catalogue_key] = catalogue.version_rows_[i];
+        if (catalogue_key != version_key)
+            continue;
+
+        if (!catalogue_matches(catalogue, row, version_segment)) {
+            ARCTICDB_DEBUG(
+                    log::version(), "Version catalogue of {} is out of date at {}", entry.stream_id_, version_key
+            );
+            return CatalogueRead::OUT_OF_DATE;
+        }
+        ARCTICDB_DEBUG(
+                log::version(), "Reading version chain of {} below {} from catalogue", entry.stream_id_, version_key
+        );
+        (void)read_chain_keys(
+                catalogue.segment_, row + 1 + ssize_t(version_segment.row_count()), true, entry, load_progress
+        );
+        return CatalogueRead::READ;
+    }
+    return CatalogueRead::NOT_HELD;
+}
+
+} // namespace arcticdb
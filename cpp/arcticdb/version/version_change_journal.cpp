@@ -0,0 +1,110 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#include <arcticdb/version/version_change_journal.hpp>
+#include <arcticdb/async/task_scheduler.hpp>
+#include <arcticdb/log/log.hpp>
+#include <arcticdb/storage/store.hpp>
+#include <arcticdb/version/version_constants.hpp>
+#include <arcticdb/version/version_log.hpp>
+
+namespace arcticdb {
+
+VersionChangeJournal::VersionChangeJournal(timestamp retention) : retention_(retention) {
+    util::check(retention_ > 0, "Version change journal retention must be positive, got {}", retention_);
+}
+
+void VersionChangeJournal::append(
+        const std::shared_ptr<Store>& store, const StreamId& stream_id, VersionId version_id, timestamp now
+) {
+    log_event(store, stream_id, VersionChangeId, version_id);
+    if (now - last_prune_ <= retention_ / 2 || pruning_.exchange(true))
+        return;
+
+    last_prune_ = now;
+    // Pruning lists the whole journal, which the write should not wait for
+    std::ignore = folly::via(&async::io_executor(), [journal = shared_from_this(), store, now] {
+        try {
+            journal->prune(store, now);
+        } catch (const std::exception& e) {
+            // The entries are left for the next prune
+            log::version().warn("Failed to prune the version change journal: {}", e.what());
+        }
+        journal->pruning_ = false;
+    });
+}
+
+void VersionChangeJournal::prune(const std::shared_ptr<Store>& store, timestamp now) {
+    std::vector<VariantKey> expired;
+    store->iterate_type(
+            KeyType::LOG,
+            [&expired, cutoff = now - retention_](VariantKey&& key) {
+                if (to_atom(key).creation_ts() < cutoff)
+                    expired.emplace_back(std::move(key));
+            },
+            VersionChangeId
+    );
+    if (expired.empty())
+        return;
+
+    ARCTICDB_DEBUG(log::version(), "Pruning {} expired version change journal entries", expired.size());
+    // Another writer pruning concurrently may have removed some of them already
+    store->remove_keys_sync(std::move(expired), storage::RemoveOpts{.ignores_missing_key_ = true});
+}
+
+void VersionChangeJournal::maybe_poll(const std::shared_ptr<Store>& store, timestamp now, timestamp poll_interval) {
+    auto polled_recently = [&] {
+        std::shared_lock lock(mutex_);
+        return last_poll_.has_value() && now - *last_poll_ <= poll_interval;
+    };
+    if (polled_recently())
+        return;
+
+    std::unique_lock poll_lock(poll_mutex_, std::try_to_lock);
+    if (!poll_lock.owns_lock() || polled_recently())
+        return;
+
+    std::unordered_map<StreamId, timestamp> latest_change;
+    try {
+        store->iterate_type(
+                KeyType::LOG,
+                [&latest_change](VariantKey&& key) {
+                    const auto& atom_key = to_atom(key);
+                    auto [it, inserted] = latest_change.try_emplace(atom_key.start_index(), atom_key.creation_ts());
+                    if (!inserted)
+                        it->second = std::max(it->second, atom_key.creation_ts());
+                },
+                VersionChangeId
+        );
+    } catch (const std::exception& e) {
+        // Cached entries are reloaded from their ref keys until a poll succeeds
+        log::version().warn("Failed to poll the version change journal: {}", e.what());
+        return;
+    }
+
+    std::unique_lock lock(mutex_);
+    last_poll_ = now;
+    latest_change_ = std::move(latest_change);
+}
+
+bool VersionChangeJournal::is_fresh(
+        const StreamId& stream_id, timestamp last_reload_time, timestamp now, timestamp poll_interval
+) const {
+    std::shared_lock lock(mutex_);
+    if (!last_poll_.has_value() || now - *last_poll_ > poll_interval)
+        return false;
+
+    // Changes before the retention period may have been pruned from the journal
+    if (last_reload_time < *last_poll_ - retention_)
+        return false;
+
+    const auto it = latest_change_.find(stream_id);
+    return it == latest_change_.end() || it->second < last_reload_time;
+}
+
+} // namespace arcticdb
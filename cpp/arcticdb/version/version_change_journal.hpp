@@ -0,0 +1,75 @@
+/* Copyright 2026 Man Group Operations Limited
+ *
+ * Use of this software is governed by the Business Source License 1.1 included in the file licenses/BSL.txt.
+ *
+ * As of the Change Date specified in that file, in accordance with the Business Source License, use of this software
+ * will be governed by the Apache License, version 2.0.
+ */
+
+#pragma once
+
+#include <arcticdb/entity/types.hpp>
+#include <arcticdb/util/constants.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace arcticdb {
+
+class Store;
+
+/*
+ * An alternative to expiring cached version map entries after VersionMap.ReloadInterval, enabled per library by the
+ * version_change_journal write option so that every writer to the library journals its changes.
+ *
+ * Every time a writer updates a symbol's VERSION_REF key it appends an entry to the change journal, which is a LOG key
+ * with id VersionChangeId whose index value is the symbol, in the same way that passive sync logs its events. Readers
+ * list the journal once per reload interval for all symbols, and a cached entry stays valid for as long as the journal
+ * shows no change to its symbol after it was loaded. A hot reader therefore makes one listing per interval instead of
+ * one VERSION_REF read per symbol per interval.
+ *
+ * Writers delete journal entries older than the retention period in the background, so the listing stays small. An
+ * entry loaded before the oldest retained change may have missed a pruned change, so it is reloaded as it would be
+ * without the journal. Likewise if the journal has not been polled successfully within the reload interval.
+ *
+ * Writers from versions of ArcticDB that predate the journal do not append to it, so libraries that they write to must
+ * not enable it.
+ */
+class VersionChangeJournal : public std::enable_shared_from_this<VersionChangeJournal> {
+  public:
+    static constexpr timestamp DEFAULT_RETENTION = 10 * ONE_MINUTE;
+
+    explicit VersionChangeJournal(timestamp retention = DEFAULT_RETENTION);
+
+    // Appends a change to the symbol. At most once per half retention period this also starts a prune of the expired
+    // entries on an IO thread, which the write does not wait for.
+    void append(const std::shared_ptr<Store>& store, const StreamId& stream_id, VersionId version_id, timestamp now);
+
+    // Lists the journal unless it was listed less than poll_interval ago. Only one thread lists at a time, others
+    // carry on with the previous listing.
+    void maybe_poll(const std::shared_ptr<Store>& store, timestamp now, timestamp poll_interval);
+
+    // Whether a cached entry for the symbol, loaded at last_reload_time, has seen every change to the symbol up to the
+    // last poll of the journal
+    [[nodiscard]] bool is_fresh(
+            const StreamId& stream_id, timestamp last_reload_time, timestamp now, timestamp poll_interval
+    ) const;
+
+  private:
+    void prune(const std::shared_ptr<Store>& store, timestamp now);
+
+    const timestamp retention_;
+    mutable std::shared_mutex mutex_;
+    std::mutex poll_mutex_;
+    std::atomic<bool> pruning_ = false;
+    // The time of the last successful listing, and the latest change to each symbol that it found
+    std::optional<timestamp> last_poll_;
+    std::unordered_map<StreamId, timestamp> latest_change_;
+    std::atomic<timestamp> last_prune_ = 0;
+};
+
+} // namespace arcticdb
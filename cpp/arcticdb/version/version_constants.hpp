@@ -26,4 +26,6 @@ static const char* const FailedStorageLogId = "__failed_storage_log__";
 static const char* const RecreateSymbolId = "__recreate__";
 // Used by v2 replication in the enterprise repo to manually refresh a symbol
 static const char* const RefreshSymbolId = "__refresh__";
+// Entries of the change journal that readers poll to invalidate their cached version map entries
+static const char* const VersionChangeId = "__version_change__";
 } // namespace arcticdb
\ No newline at end of file
@@ -21,7 +21,10 @@
 #include <arcticdb/stream/index.hpp>
 #include <arcticdb/pipeline/query.hpp>
 #include <arcticdb/pipeline/read_pipeline.hpp>
+#include <arcticdb/pipeline/bloom_filter.hpp>
 #include <arcticdb/pipeline/column_stats_filter.hpp>
+#include <arcticdb/pipeline/index_column_stats.hpp>
+#include <arcticdb/pipeline/zone_maps.hpp>
 #include <arcticdb/async/task_scheduler.hpp>
 #include <arcticdb/async/tasks.hpp>
 #include <arcticdb/util/name_validation.hpp>
@@ -611,6 +614,9 @@ folly::Future<AtomKey> async_update_impl(
                                     get_keys_affected_by_update(index_segment_reader, *frame, query, dynamic_schema);
                             auto unaffected_keys =
                                     get_keys_not_affected_by_update(index_segment_reader, *affected_keys);
+                            if (embed_column_stats_in_index()) {
+                                set_embedded_column_stats(index_segment_reader.seg(), unaffected_keys);
+                            }
                             util::check(
                                     affected_keys->size() + unaffected_keys.size() == index_segment_reader.size(),
                                     "The sum of affected keys and unaffected keys must be "
@@ -945,7 +951,7 @@ void set_output_descriptors(
         const ProcessingUnit& proc, const std::vector<std::shared_ptr<Clause>>& clauses,
         const std::shared_ptr<PipelineContext>& pipeline_context
 ) {
-    std::optional<std::string> index_column;
+    std::vector<std::string> index_columns;
     for (auto clause = clauses.rbegin(); clause != clauses.rend(); ++clause) {
         bool should_break = util::variant_match(
                 (*clause)->clause_info().index_,
@@ -973,11 +979,8 @@ void set_output_descriptors(
                     return true;
                 },
                 [&](const NewIndex& new_index) {
-                    index_column = new_index;
-                    auto mutable_index = pipeline_context->norm_meta_->mutable_df()->mutable_common()->mutable_index();
-                    mutable_index->set_name(new_index);
-                    mutable_index->clear_fake_name();
-                    mutable_index->set_is_physically_stored(true);
+                    index_columns = new_index;
+                    set_new_index_norm_meta(new_index, *pipeline_context->norm_meta_);
                     return true;
                 }
         );
@@ -1016,8 +1019,8 @@ void set_output_descriptors(
         // Erase field from new_fields as we add them to final_stream_descriptor, as all fields left in new_fields
         // after these operations were created by the processing pipeline, and so should be appended
         // Index columns should always appear first
-        if (index_column.has_value()) {
-            const auto nh = new_fields.extract(*index_column);
+        for (const auto& index_column : index_columns) {
+            const auto nh = new_fields.extract(index_column);
             internal::check<ErrorCode::E_ASSERTION_FAILURE>(
                     !nh.empty(), "New index column not found in processing pipeline"
             );
@@ -1118,13 +1121,29 @@ std::vector<folly::Future<pipelines::SegmentAndSlice>> add_schema_check(
     return res;
 }
 
+/*
+ * When the first clause is a filter, a BlockFilter that skips decoding the zones of data segments it cannot match, see
+ * zone_map_block_filter. nullptr otherwise.
+ */
+static std::shared_ptr<BlockFilter> first_filter_block_filter(const std::vector<std::shared_ptr<Clause>>& clauses) {
+    if (clauses.empty() || folly::poly_type(*clauses.front()) != typeid(FilterClause)) {
+        return nullptr;
+    }
+    const auto& filter_clause = folly::poly_cast<FilterClause>(*clauses.front());
+    return std::make_shared<BlockFilter>(
+            zone_map_block_filter(filter_clause.expression_context_, filter_clause.root_node_name_)
+    );
+}
+
 std::vector<folly::Future<pipelines::SegmentAndSlice>> generate_segment_and_slice_futures(
         const std::shared_ptr<Store>& store, const std::shared_ptr<PipelineContext>& pipeline_context,
-        const ProcessingConfig& processing_config, std::vector<RangesAndKey>&& all_ranges
+        const ProcessingConfig& processing_config, std::vector<RangesAndKey>&& all_ranges,
+        std::shared_ptr<BlockFilter> block_filter = nullptr
 ) {
     auto incomplete_bitset = get_incompletes_bitset(all_ranges);
-    auto segment_and_slice_futures =
-            store->batch_read_uncompressed(std::move(all_ranges), columns_to_decode(pipeline_context));
+    auto segment_and_slice_futures = store->batch_read_uncompressed(
+            std::move(all_ranges), columns_to_decode(pipeline_context), std::move(block_filter)
+    );
     return add_schema_check(
             pipeline_context, std::move(segment_and_slice_futures), std::move(incomplete_bitset), processing_config
     );
@@ -1199,6 +1218,317 @@ static void generate_output_schema_and_save_to_pipeline(
     pipeline_context.default_values_ = std::forward<decltype(default_values)>(default_values);
 }
 
+static bool late_materialisation_enabled() {
+    return ConfigsMap::instance()->get_int("LateMaterialisation.Enabled", 0) == 1;
+}
+
+/*
+ * The columns to decode first, to decide which row slices to read in full, when the first clause is a filter and the
+ * read needs columns besides the filter's inputs. nullptr if late materialisation does not apply.
+ */
+static std::shared_ptr<std::unordered_set<std::string>> late_materialisation_columns(
+        const std::shared_ptr<PipelineContext>& pipeline_context, const std::vector<std::shared_ptr<Clause>>& clauses,
+        const std::vector<RangesAndKey>& ranges_and_keys
+) {
+    if (!late_materialisation_enabled() || clauses.empty() ||
+        folly::poly_type(*clauses.front()) != typeid(FilterClause) ||
+        std::ranges::any_of(ranges_and_keys, [](const auto& ranges_and_key) {
+            return ranges_and_key.is_incomplete();
+        })) {
+        return nullptr;
+    }
+    const auto& input_columns = folly::poly_cast<FilterClause>(*clauses.front()).clause_info().input_columns_;
+    if (!input_columns.has_value()) {
+        return nullptr;
+    }
+    auto predicate_columns = std::make_shared<std::unordered_set<std::string>>();
+    // DecodeSliceTask expects the index columns, and columns of multi-indexes are stored under mangled names
+    const auto& desc = pipeline_context->descriptor();
+    for (size_t idx = 0; idx < desc.index().field_count(); ++idx) {
+        predicate_columns->emplace(desc.field(idx).name());
+    }
+    for (const auto& column : *input_columns) {
+        predicate_columns->emplace(column);
+        predicate_columns->emplace(stream::mangled_name(column));
+    }
+
+    // columns_to_decode gives nullptr when every column is decoded
+    auto all_columns = columns_to_decode(pipeline_context);
+    for (const auto& field : desc.fields()) {
+        std::string column{field.name()};
+        if ((!all_columns || all_columns->contains(column)) && !predicate_columns->contains(column)) {
+            return predicate_columns;
+        }
+    }
+    return nullptr;
+}
+
+/*
+ * The row slices with rows matching the filter that is the first clause, grouped into processing units, along with the
+ * segments already decoded with just the predicate columns for the column slices read to evaluate it
+ */
+struct FilterMatches {
+    std::vector<RangesAndKey> ranges_and_keys_;
+    std::vector<std::optional<SegmentInMemory>> predicate_segments_;
+    std::vector<std::vector<size_t>> processing_unit_indexes_;
+};
+
+/*
+ * Decodes just predicate_columns of each row slice and evaluates the filter that is the first clause on them, keeping
+ * the row slices with any matching rows and their decoded predicate columns. With static schema, only the column
+ * slices holding predicate columns are read.
+ */
+static folly::Future<FilterMatches> filter_matches(
+        const std::shared_ptr<Store>& store, const std::shared_ptr<PipelineContext>& pipeline_context,
+        const ProcessingConfig& processing_config, const std::shared_ptr<Clause>& filter_clause,
+        std::vector<RangesAndKey>&& ranges_and_keys,
+        const std::shared_ptr<std::unordered_set<std::string>>& predicate_columns
+) {
+    const auto& desc = pipeline_context->descriptor();
+    std::vector<size_t> predicate_positions;
+    for (const auto& column : *predicate_columns) {
+        if (auto position = desc.find_field(column); position && *position >= desc.index().field_count()) {
+            predicate_positions.emplace_back(*position);
+        }
+    }
+    auto holds_predicate_column = [&](const RangesAndKey& ranges_and_key) {
+        return processing_config.dynamic_schema_ ||
+               std::ranges::any_of(predicate_positions, [&ranges_and_key](size_t position) {
+                   return ranges_and_key.col_range().contains(position);
+               });
+    };
+
+    auto processing_unit_indexes = filter_clause->structure_for_processing(ranges_and_keys);
+    // The indexes in ranges_and_keys of the column slices read for each processing unit, in the order they are read
+    std::vector<std::vector<size_t>> unit_read_indexes;
+    std::vector<RangesAndKey> predicate_ranges_and_keys;
+    for (const auto& indexes : processing_unit_indexes) {
+        auto& read_indexes = unit_read_indexes.emplace_back();
+        for (auto index : indexes) {
+            if (holds_predicate_column(ranges_and_keys[index])) {
+                read_indexes.emplace_back(index);
+            }
+        }
+        if (read_indexes.empty()) {
+            // Nothing to decide with, so read the whole row slice
+            read_indexes = indexes;
+        }
+        for (auto index : read_indexes) {
+            predicate_ranges_and_keys.emplace_back(ranges_and_keys[index]);
+        }
+    }
+
+    auto segment_and_slice_futures = store->batch_read_uncompressed(
+            std::move(predicate_ranges_and_keys), predicate_columns, first_filter_block_filter({filter_clause})
+    );
+    std::vector<folly::Future<std::optional<std::vector<SegmentInMemory>>>> unit_matches;
+    unit_matches.reserve(unit_read_indexes.size());
+    auto next_future = segment_and_slice_futures.begin();
+    for (const auto& read_indexes : unit_read_indexes) {
+        std::vector<folly::Future<pipelines::SegmentAndSlice>> unit_futures;
+        unit_futures.reserve(read_indexes.size());
+        for (size_t idx = 0; idx < read_indexes.size(); ++idx) {
+            unit_futures.emplace_back(std::move(*next_future++));
+        }
+        unit_matches.emplace_back(
+                folly::collect(std::move(unit_futures))
+                        .via(&async::cpu_executor())
+                        .thenValue([filter_clause](std::vector<pipelines::SegmentAndSlice>&& segment_and_slices
+                                   ) -> std::optional<std::vector<SegmentInMemory>> {
+                            std::vector<std::shared_ptr<SegmentInMemory>> segments;
+                            std::vector<std::shared_ptr<RowRange>> row_ranges;
+                            std::vector<std::shared_ptr<ColRange>> col_ranges;
+                            for (auto& [ranges_and_key, segment_in_memory] : segment_and_slices) {
+                                segments.emplace_back(std::make_shared<SegmentInMemory>(std::move(segment_in_memory)));
+                                row_ranges.emplace_back(std::make_shared<RowRange>(ranges_and_key.row_range()));
+                                col_ranges.emplace_back(std::make_shared<ColRange>(ranges_and_key.col_range()));
+                            }
+                            ProcessingUnit proc;
+                            proc.set_segments(segments);
+                            proc.set_row_ranges(std::move(row_ranges));
+                            proc.set_col_ranges(std::move(col_ranges));
+                            const bool matches = util::variant_match(
+                                    folly::poly_cast<FilterClause>(*filter_clause).evaluate(proc),
+                                    [](const util::BitSet& bitset) { return bitset.count() > 0; },
+                                    [](EmptyResult) { return false; },
+                                    [](FullResult) { return true; },
+                                    [](const auto&) -> bool { util::raise_rte("Expected bitset from filter clause"); }
+                            );
+                            if (!matches) {
+                                return std::nullopt;
+                            }
+                            std::vector<SegmentInMemory> unit_segments;
+                            unit_segments.reserve(segments.size());
+                            for (auto& segment : segments) {
+                                unit_segments.emplace_back(std::move(*segment));
+                            }
+                            return unit_segments;
+                        })
+        );
+    }
+
+    return folly::collect(std::move(unit_matches))
+            .via(&async::cpu_executor())
+            .thenValue([ranges_and_keys = std::move(ranges_and_keys),
+                        processing_unit_indexes = std::move(processing_unit_indexes),
+                        unit_read_indexes = std::move(unit_read_indexes
+                        )](std::vector<std::optional<std::vector<SegmentInMemory>>>&& unit_segments) mutable {
+                FilterMatches matches;
+                for (const auto& [unit, indexes] : folly::enumerate(processing_unit_indexes)) {
+                    if (!unit_segments[unit]) {
+                        continue;
+                    }
+                    auto& unit_indexes = matches.processing_unit_indexes_.emplace_back();
+                    const auto& read_indexes = unit_read_indexes[unit];
+                    auto read_index = read_indexes.begin();
+                    auto segment = unit_segments[unit]->begin();
+                    for (auto index : indexes) {
+                        unit_indexes.emplace_back(matches.ranges_and_keys_.size());
+                        matches.ranges_and_keys_.emplace_back(std::move(ranges_and_keys[index]));
+                        if (read_index != read_indexes.end() && *read_index == index) {
+                            matches.predicate_segments_.emplace_back(std::move(*segment++));
+                            ++read_index;
+                        } else {
+                            matches.predicate_segments_.emplace_back(std::nullopt);
+                        }
+                    }
+                }
+                ARCTICDB_DEBUG(
+                        log::version(),
+                        "Late materialisation kept {} of {} row slices",
+                        matches.processing_unit_indexes_.size(),
+                        processing_unit_indexes.size()
+                );
+                return matches;
+            });
+}
+
+/*
+ * Combines the predicate columns decoded to evaluate the filter with the remaining columns decoded from the same
+ * column slice. The index columns come first and the others follow in stream descriptor order, as a full decode gives.
+ * Both decodes read the same string pool, so the offsets of either segment's string columns are valid in it.
+ */
+static SegmentInMemory combine_decoded_columns(
+        const StreamDescriptor& desc, SegmentInMemory&& predicate_segment, SegmentInMemory&& remaining_segment
+) {
+    const auto& predicate_desc = predicate_segment.descriptor();
+    const auto index_field_count = predicate_desc.index().field_count();
+    StreamDescriptor combined_desc{predicate_desc.id(), predicate_desc.index()};
+    combined_desc.set_sorted(predicate_desc.sorted());
+    SegmentInMemory combined{std::move(combined_desc)};
+    for (size_t idx = 0; idx < index_field_count; ++idx) {
+        combined.add_column(predicate_segment.field(idx).ref(), predicate_segment.column_ptr(position_t(idx)));
+    }
+
+    std::vector<std::tuple<size_t, FieldRef, std::shared_ptr<Column>>> columns;
+    for (const auto* segment : {&predicate_segment, &remaining_segment}) {
+        for (size_t idx = index_field_count; idx < segment->descriptor().field_count(); ++idx) {
+            const auto& field = segment->field(idx);
+            columns.emplace_back(
+                    desc.find_field(field.name()).value_or(desc.field_count()),
+                    field.ref(),
+                    segment->column_ptr(position_t(idx))
+            );
+        }
+    }
+    std::ranges::stable_sort(columns, {}, [](const auto& column) { return std::get<0>(column); });
+    for (const auto& [position, field, column] : columns) {
+        combined.add_column(field, column);
+    }
+
+    combined.set_string_pool(
+            remaining_segment.has_string_pool() ? remaining_segment.string_pool_ptr()
+                                                : predicate_segment.string_pool_ptr()
+    );
+    // Keeps the zone maps for the filter clause
+    if (const auto* metadata = predicate_segment.metadata()) {
+        google::protobuf::Any meta = *metadata;
+        combined.set_metadata(std::move(meta));
+    }
+    combined.set_row_data(ssize_t(std::max(predicate_segment.row_count(), remaining_segment.row_count())) - 1);
+    return combined;
+}
+
+/*
+ * Reads the columns of the matching row slices that were not decoded to evaluate the filter and combines them with the
+ * decoded predicate columns. Column slices without decoded predicate columns are read in full, and with static schema
+ * those holding only predicate columns are not read again at all.
+ */
+static std::vector<folly::Future<pipelines::SegmentAndSlice>> read_remaining_columns(
+        const std::shared_ptr<Store>& store, const std::shared_ptr<PipelineContext>& pipeline_context,
+        const ProcessingConfig& processing_config, const std::unordered_set<std::string>& predicate_columns,
+        const std::shared_ptr<BlockFilter>& block_filter, FilterMatches&& matches
+) {
+    const auto& desc = pipeline_context->descriptor();
+    auto all_columns = columns_to_decode(pipeline_context);
+    // DecodeSliceTask expects the index columns
+    auto remaining_columns = std::make_shared<std::unordered_set<std::string>>();
+    std::vector<size_t> remaining_positions;
+    for (size_t position = 0; position < desc.field_count(); ++position) {
+        std::string column{desc.field(position).name()};
+        if (position < desc.index().field_count()) {
+            remaining_columns->emplace(std::move(column));
+        } else if ((!all_columns || all_columns->contains(column)) && !predicate_columns.contains(column)) {
+            remaining_positions.emplace_back(position);
+            remaining_columns->emplace(std::move(column));
+        }
+    }
+    auto holds_remaining_column = [&](const RangesAndKey& ranges_and_key) {
+        return processing_config.dynamic_schema_ ||
+               std::ranges::any_of(remaining_positions, [&ranges_and_key](size_t position) {
+                   return ranges_and_key.col_range().contains(position);
+               });
+    };
+
+    std::vector<RangesAndKey> full_ranges_and_keys;
+    std::vector<RangesAndKey> remaining_ranges_and_keys;
+    for (size_t idx = 0; idx < matches.ranges_and_keys_.size(); ++idx) {
+        const auto& ranges_and_key = matches.ranges_and_keys_[idx];
+        if (!matches.predicate_segments_[idx]) {
+            full_ranges_and_keys.emplace_back(ranges_and_key);
+        } else if (holds_remaining_column(ranges_and_key)) {
+            remaining_ranges_and_keys.emplace_back(ranges_and_key);
+        }
+    }
+    auto full_futures =
+            store->batch_read_uncompressed(std::move(full_ranges_and_keys), std::move(all_columns), block_filter);
+    auto remaining_futures = store->batch_read_uncompressed(
+            std::move(remaining_ranges_and_keys), std::move(remaining_columns), block_filter
+    );
+
+    std::vector<folly::Future<pipelines::SegmentAndSlice>> res;
+    res.reserve(matches.ranges_and_keys_.size());
+    auto next_full = full_futures.begin();
+    auto next_remaining = remaining_futures.begin();
+    for (size_t idx = 0; idx < matches.ranges_and_keys_.size(); ++idx) {
+        auto& ranges_and_key = matches.ranges_and_keys_[idx];
+        auto& predicate_segment = matches.predicate_segments_[idx];
+        if (!predicate_segment) {
+            res.emplace_back(std::move(*next_full++));
+        } else if (holds_remaining_column(ranges_and_key)) {
+            res.emplace_back(std::move(*next_remaining++)
+                                     .thenValue([pipeline_context,
+                                                 ranges_and_key = std::move(ranges_and_key),
+                                                 predicate_segment = std::move(*predicate_segment
+                                                 )](pipelines::SegmentAndSlice&& remaining) mutable {
+                                         return async::make_decoded_slice(
+                                                 std::move(ranges_and_key),
+                                                 combine_decoded_columns(
+                                                         pipeline_context->descriptor(),
+                                                         std::move(predicate_segment),
+                                                         std::move(remaining.segment_in_memory_)
+                                                 )
+                                         );
+                                     }));
+        } else {
+            res.emplace_back(folly::makeFuture(
+                    async::make_decoded_slice(std::move(ranges_and_key), std::move(*predicate_segment))
+            ));
+        }
+    }
+    return res;
+}
+
 folly::Future<std::vector<EntityId>> read_and_schedule_processing(
         const std::shared_ptr<Store>& store, const std::shared_ptr<PipelineContext>& pipeline_context,
         const std::shared_ptr<ReadQuery>& read_query, const ReadOptions& read_options,
@@ -1216,6 +1546,42 @@ folly::Future<std::vector<EntityId>> read_and_schedule_processing(
 
     auto ranges_and_keys = generate_ranges_and_keys(*pipeline_context);
 
+    if (auto predicate_columns =
+                late_materialisation_columns(pipeline_context, read_query->clauses_, ranges_and_keys)) {
+        // Decode the columns the filter needs first, and the rest only for the row slices with rows that match it
+        return filter_matches(
+                       store,
+                       pipeline_context,
+                       processing_config,
+                       read_query->clauses_.front(),
+                       std::move(ranges_and_keys),
+                       predicate_columns
+        )
+                .thenValue([store,
+                            pipeline_context,
+                            processing_config,
+                            read_query,
+                            component_manager,
+                            predicate_columns](FilterMatches&& matches) {
+                    auto processing_unit_indexes = std::move(matches.processing_unit_indexes_);
+                    auto segment_and_slice_futures = read_remaining_columns(
+                            store,
+                            pipeline_context,
+                            processing_config,
+                            *predicate_columns,
+                            first_filter_block_filter(read_query->clauses_),
+                            std::move(matches)
+                    );
+                    return schedule_clause_processing(
+                            component_manager,
+                            std::move(segment_and_slice_futures),
+                            std::move(processing_unit_indexes),
+                            std::make_shared<std::vector<std::shared_ptr<Clause>>>(read_query->clauses_)
+                    );
+                })
+                .via(&async::cpu_executor());
+    }
+
     // Each element of the vector corresponds to one processing unit containing the list of indexes in ranges_and_keys
     // required for that processing unit i.e. if the first processing unit needs ranges_and_keys[0] and
     // ranges_and_keys[1], and the second needs ranges_and_keys[2] and ranges_and_keys[3] then the structure will be
@@ -1228,8 +1594,13 @@ folly::Future<std::vector<EntityId>> read_and_schedule_processing(
     }
 
     // Start reading as early as possible
-    auto segment_and_slice_futures =
-            generate_segment_and_slice_futures(store, pipeline_context, processing_config, std::move(ranges_and_keys));
+    auto segment_and_slice_futures = generate_segment_and_slice_futures(
+            store,
+            pipeline_context,
+            processing_config,
+            std::move(ranges_and_keys),
+            first_filter_block_filter(read_query->clauses_)
+    );
 
     return schedule_clause_processing(
                    component_manager,
@@ -1289,7 +1660,10 @@ FrameAndDescriptor read_segment_impl(const std::shared_ptr<Store>& store, const
 }
 
 FrameAndDescriptor read_index_impl(const std::shared_ptr<Store>& store, const VersionedItem& version) {
-    return read_segment_impl(store, version.key_);
+    auto seg = store->read_compressed_sync(version.key_).segment_ptr();
+    auto index_segment = decode_segment(*seg, AllocationType::DETACHABLE);
+    drop_embedded_column_stats(index_segment);
+    return frame_and_descriptor_from_segment(std::move(index_segment));
 }
 
 std::optional<index::IndexSegmentReader> get_index_segment_reader(
@@ -1401,7 +1775,18 @@ static void read_indexed_keys_to_pipeline(
             read_query, pipeline_context, dynamic_schema, bucketize_dynamic
     );
 
-    if (index_information.column_stats_.has_value()) {
+    // Stats embedded in the index are preferred to the COLUMN_STATS key, which is only read if they might be missing
+    std::optional<FilterQuery<index::IndexSegmentReader>> embedded_column_stats_filter;
+    if (index_segment_reader.has_timestamp_index() && has_embedded_column_stats(index_segment_reader.seg())) {
+        ColumnStatsQueryMetadata query_metadata(read_query.clauses_);
+        if (query_metadata.should_try_column_stats_read()) {
+            embedded_column_stats_filter =
+                    create_embedded_column_stats_filter(index_segment_reader, std::move(query_metadata));
+        }
+    }
+    if (embedded_column_stats_filter.has_value()) {
+        queries.push_back(std::move(*embedded_column_stats_filter));
+    } else if (index_information.column_stats_.has_value()) {
         auto& [data, query_metadata] = *index_information.column_stats_;
         queries.push_back(create_column_stats_filter(std::move(data), tsd, std::move(query_metadata)));
     }
@@ -2115,6 +2500,7 @@ void create_column_stats_impl(
             }
         }
         // Add new stat columns to the old segment
+        move_column_stats_strings(new_segment, old_segment->string_pool_ptr());
         old_segment->concatenate(std::move(new_segment));
         google::protobuf::Any any;
         any.PackFrom(old_header);
@@ -2212,6 +2598,16 @@ FrameAndDescriptor read_column_stats_impl(const std::shared_ptr<Store>& store, c
     try {
         auto segment = store->read_compressed(column_stats_key).get().segment_ptr();
         auto segment_in_memory = decode_segment(*segment, AllocationType::DETACHABLE);
+        // Bloom filters are binary, so are not returned
+        std::vector<std::string> bloom_filter_columns;
+        for (const auto& field : segment_in_memory.descriptor().fields()) {
+            if (field.type().data_type() == bloom_filter_data_type) {
+                bloom_filter_columns.emplace_back(field.name());
+            }
+        }
+        for (const auto& name : bloom_filter_columns) {
+            segment_in_memory.drop_column(name);
+        }
         const auto num_rows = segment_in_memory.row_count();
         for (auto i = 0u; i < segment_in_memory.num_columns(); ++i) {
             auto& column = segment_in_memory.column(static_cast<position_t>(i));
@@ -2828,6 +3224,43 @@ VersionedItem defragment_symbol_data_impl(
     );
 }
 
+static folly::Future<std::optional<ColumnStatsSource>> read_column_stats_source(
+        const std::shared_ptr<Store>& store, const AtomKey& index_key, ColumnStatsQueryMetadata&& query_metadata
+) {
+    auto column_stats_key = index_key_to_column_stats_key(index_key);
+    storage::ReadKeyOpts stats_read_opts{.dont_warn_about_missing_key = true};
+    return store->read_compressed(column_stats_key, stats_read_opts)
+            .thenValueInline(
+                    [qm = std::move(query_metadata)](storage::KeySegmentPair&& key_seg
+                    ) -> std::optional<ColumnStatsSource> { return ColumnStatsSource{key_seg.segment_ptr(), qm}; }
+            );
+}
+
+static VersionIdentifier to_index_information(
+        const VersionedItem& vi, folly::Try<std::pair<VariantKey, SegmentInMemory>>&& index_try,
+        folly::Try<std::optional<ColumnStatsSource>>&& column_stats_try
+) {
+    if (index_try.hasException()) {
+        ARCTICDB_DEBUG(
+                log::version(), "Key not found from versioned item {}: {}", vi.key_, index_try.exception().what()
+        );
+        throw storage::NoDataFoundException(fmt::format(
+                "When trying to read version {} of symbol `{}`, failed to read key {}: {}",
+                vi.version(),
+                vi.symbol(),
+                vi.key_,
+                index_try.exception().what()
+        ));
+    }
+
+    if (column_stats_try.hasException()) {
+        log::version().debug("Column stats key not found");
+        return std::make_shared<IndexInformation>(std::move(index_try).value(), std::nullopt);
+    }
+
+    return std::make_shared<IndexInformation>(std::move(index_try).value(), std::move(column_stats_try).value());
+}
+
 static folly::Future<VersionIdentifier> fetch_index_and_column_stats(
         const std::shared_ptr<Store>& store, const VersionedItem& versioned_item, const ReadQuery& read_query
 ) {
@@ -2835,48 +3268,35 @@ static folly::Future<VersionIdentifier> fetch_index_and_column_stats(
 
     using OptionalColumnStatsSource = std::optional<ColumnStatsSource>;
     ColumnStatsQueryMetadata query_metadata(read_query.clauses_);
+    if (query_metadata.should_try_column_stats_read() && embed_column_stats_in_index()) {
+        // Indexes written with stats embedded do not need the COLUMN_STATS key, so only read it for those without
+        return std::move(index_future)
+                .via(&async::io_executor())
+                .thenTry([store, vi = versioned_item, qm = std::move(query_metadata)](auto&& index_try) mutable
+                         -> folly::Future<VersionIdentifier> {
+                    if (index_try.hasValue() && has_embedded_column_stats(index_try.value().second)) {
+                        return folly::makeFuture(to_index_information(
+                                vi, std::move(index_try), folly::Try<OptionalColumnStatsSource>(std::nullopt)
+                        ));
+                    }
+                    return read_column_stats_source(store, vi.key_, std::move(qm))
+                            .thenTry([vi, index_try = std::move(index_try)](auto&& column_stats_try) mutable {
+                                return to_index_information(vi, std::move(index_try), std::move(column_stats_try));
+                            });
+                });
+    }
+
     folly::Future<OptionalColumnStatsSource> column_stats_future =
             folly::makeFuture<OptionalColumnStatsSource>(std::nullopt);
     if (query_metadata.should_try_column_stats_read()) {
-        auto column_stats_key = index_key_to_column_stats_key(versioned_item.key_);
-        storage::ReadKeyOpts stats_read_opts{.dont_warn_about_missing_key = true};
-        column_stats_future =
-                store->read_compressed(column_stats_key, stats_read_opts)
-                        .thenValueInline(
-                                [qm = std::move(query_metadata)](storage::KeySegmentPair&& key_seg
-                                ) -> OptionalColumnStatsSource { return ColumnStatsSource{key_seg.segment_ptr(), qm}; }
-                        );
+        column_stats_future = read_column_stats_source(store, versioned_item.key_, std::move(query_metadata));
     }
 
     return folly::collectAll(std::move(index_future), std::move(column_stats_future))
             .via(&async::io_executor())
             .thenValue([vi = versioned_item](auto&& results) -> VersionIdentifier {
                 auto& [index_try, column_stats_try] = results;
-
-                if (index_try.hasException()) {
-                    ARCTICDB_DEBUG(
-                            log::version(),
-                            "Key not found from versioned item {}: {}",
-                            vi.key_,
-                            index_try.exception().what()
-                    );
-                    throw storage::NoDataFoundException(fmt::format(
-                            "When trying to read version {} of symbol `{}`, failed to read key {}: {}",
-                            vi.version(),
-                            vi.symbol(),
-                            vi.key_,
-                            index_try.exception().what()
-                    ));
-                }
-
-                if (column_stats_try.hasException()) {
-                    log::version().debug("Column stats key not found");
-                    return std::make_shared<IndexInformation>(std::move(index_try).value(), std::nullopt);
-                }
-
-                return std::make_shared<IndexInformation>(
-                        std::move(index_try).value(), std::move(column_stats_try).value()
-                );
+                return to_index_information(vi, std::move(index_try), std::move(column_stats_try));
             });
 }
 
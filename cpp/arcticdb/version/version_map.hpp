@@ -18,6 +18,7 @@
 #include <map>
 #include <deque>
 #include <gtest/gtest_prod.h>
+#include <folly/concurrency/ConcurrentHashMap.h>
 
 #include <arcticdb/entity/types.hpp>
 #include <arcticdb/entity/atom_key.hpp>
@@ -34,7 +35,10 @@
 #include <arcticdb/util/constants.hpp>
 #include <arcticdb/util/key_utils.hpp>
 #include <arcticdb/version/version_map_entry.hpp>
+#include <arcticdb/version/version_catalogue.hpp>
+#include <arcticdb/version/version_change_journal.hpp>
 #include <arcticdb/async/batch_read_args.hpp>
+#include <arcticdb/async/task_scheduler.hpp>
 #include <arcticdb/version/version_log.hpp>
 #include <arcticdb/version/version_utils.hpp>
 #include <arcticdb/util/lock_table.hpp>
@@ -105,8 +109,12 @@ class VersionMapImpl {
      * If we one day replace the String in StreamId with something cheap to copy again, we can easily drop the & here.
      *
      * Methods already declared with const& were not touched during this change.
+     *
+     * The map is a folly::ConcurrentHashMap rather than a map behind a single mutex, as batch operations look up many
+     * symbols from many IO threads at once. Lookups take no lock, and insertions only lock one of the map's shards.
+     * Entries are handed out as shared_ptr copies, so replacing an entry in the map never invalidates one in use.
      */
-    using MapType = std::map<StreamId, std::shared_ptr<VersionMapEntry>>;
+    using MapType = folly::ConcurrentHashMap<StreamId, std::shared_ptr<VersionMapEntry>>;
 
     static constexpr uint64_t DEFAULT_CLOCK_UNSYNC_TOLERANCE = ONE_MILLISECOND * 200;
     static constexpr uint64_t DEFAULT_RELOAD_INTERVAL = ONE_SECOND * 2;
@@ -114,7 +122,10 @@ class VersionMapImpl {
     bool validate_ = false;
     bool log_changes_ = false;
     std::optional<timestamp> reload_interval_;
-    mutable std::mutex map_mutex_;
+    std::shared_ptr<VersionChangeJournal> change_journal_;
+    bool use_catalogue_ = ConfigsMap::instance()->get_int("VersionMap.VersionCatalogue", 0) != 0;
+    // Symbols found to have no version catalogue, which this map does not look for again until it writes one itself
+    mutable folly::ConcurrentHashMap<StreamId, bool> symbols_without_catalogue_;
     std::shared_ptr<LockTable> lock_table_ = std::make_shared<LockTable>();
 
   public:
@@ -130,9 +141,18 @@ class VersionMapImpl {
 
     void set_reload_interval(timestamp interval) { reload_interval_ = std::make_optional<timestamp>(interval); }
 
+    void set_change_journal(std::shared_ptr<VersionChangeJournal> change_journal) {
+        change_journal_ = std::move(change_journal);
+    }
+
+    void set_use_catalogue(bool value) { use_catalogue_ = value; }
+
     bool validate() const { return validate_; }
 
-    void follow_version_chain(
+    /**
+     * @return The number of VERSION keys read from storage one at a time, rather than from the version catalogue
+     */
+    size_t follow_version_chain(
             const std::shared_ptr<Store>& store, const VersionMapEntry& ref_entry,
             const std::shared_ptr<VersionMapEntry>& entry, const LoadStrategy& load_strategy
     ) const {
@@ -144,36 +164,106 @@ class VersionMapImpl {
         );
         auto next_key = ref_entry.head_;
         entry->head_ = ref_entry.head_;
+        if (load_from_ref_entry(ref_entry, *entry, load_strategy))
+            return 0;
 
         std::optional<VersionId> latest_version;
         LoadProgress load_progress;
-        util::check(ref_entry.keys_.size() >= 2, "Invalid empty ref entry");
-        std::optional<AtomKey> cached_penultimate_index;
-        if (ref_entry.keys_.size() == 3) {
-            util::check(
-                    is_index_or_tombstone(ref_entry.keys_[1].type()),
-                    "Expected index key in as second item in 3-item ref key"
-            );
-            cached_penultimate_index = ref_entry.keys_[1].to_atom_key(ref_entry.stream_id_);
-        }
+        size_t version_keys_read = 0;
+        std::optional<VersionCatalogue> catalogue;
+        while (true) {
+            ARCTICDB_DEBUG(log::version(), "Loading version key {}", next_key.value());
+            const auto version_key = next_key.value();
+            auto [key, seg] = store->read_sync(version_key);
+            next_key = read_segment_with_keys(seg, entry, load_progress);
+            set_latest_version(entry, latest_version);
+            ++version_keys_read;
+            if (!next_key || !continue_following_chain(load_strategy, load_progress, latest_version, entry))
+                break;
 
-        if (key_exists_in_ref_entry(load_strategy, ref_entry, cached_penultimate_index)) {
-            load_progress = ref_entry.load_progress_;
-            entry->keys_.push_back(ref_entry.keys_[0]);
-            if (cached_penultimate_index)
-                entry->keys_.push_back(*cached_penultimate_index);
-        } else {
-            do {
-                ARCTICDB_DEBUG(log::version(), "Loading version key {}", next_key.value());
-                auto [key, seg] = store->read_sync(next_key.value());
-                next_key = read_segment_with_keys(seg, entry, load_progress);
+            // Loads that stop at the head's VERSION key never need the catalogue, deeper ones fetch it once
+            if (version_keys_read == 1)
+                catalogue = maybe_read_version_catalogue(store, entry->stream_id_);
+
+            if (!catalogue)
+                continue;
+
+            const auto catalogue_read = read_chain_from_catalogue(*catalogue, version_key, seg, *entry, load_progress);
+            if (catalogue_read == CatalogueRead::READ) {
                 set_latest_version(entry, latest_version);
-            } while (next_key && continue_when_loading_version(load_strategy, load_progress, latest_version) &&
-                     continue_when_loading_from_time(load_strategy, load_progress) &&
-                     continue_when_loading_latest(load_strategy, entry) &&
-                     continue_when_loading_undeleted(load_strategy, entry, load_progress));
+                break;
+            } else if (catalogue_read == CatalogueRead::OUT_OF_DATE) {
+                // Following the rest of the chain one key at a time rebuilds the catalogue if the chain is long
+                catalogue.reset();
+            }
         }
+
         entry->load_progress_ = load_progress;
+        return version_keys_read;
+    }
+
+    /**
+     * check_reload for batch methods that load many symbols at once. The ref key and each VERSION key after it are
+     * read by separate asynchronous reads chained by continuations, rather than by one IO task that blocks on each read
+     * in turn. A symbol waiting on storage therefore holds no IO thread, and the reads of as many symbols as the caller
+     * keeps in flight overlap, each symbol's next read being issued as soon as its previous one completes.
+     *
+     * A missing ref key is resolved asynchronously too, through the legacy ref key and otherwise as an empty entry.
+     * Loads that would use the version catalogue, and any load that fails part way, are finished by the synchronous
+     * storage_reload on an IO thread, with its usual retries. The caller must keep the map alive until the returned
+     * future completes.
+     */
+    folly::Future<std::shared_ptr<VersionMapEntry>> check_reload_async(
+            std::shared_ptr<Store> store, const StreamId& stream_id, const LoadStrategy& load_strategy
+    ) {
+        if (change_journal_)
+            change_journal_->maybe_poll(store, now(), get_reload_interval());
+
+        if (has_cached_entry(stream_id, load_strategy))
+            return folly::makeFuture(get_entry(stream_id));
+
+        load_strategy.validate();
+        auto entry = make_reloaded_entry(stream_id);
+        storage::ReadKeyOpts read_opts;
+        read_opts.dont_warn_about_missing_key = true;
+        using OptionalKeySegment = std::optional<std::pair<VariantKey, SegmentInMemory>>;
+        return store->read(RefKey{stream_id, KeyType::VERSION_REF}, read_opts)
+                .thenValue([](std::pair<VariantKey, SegmentInMemory>&& key_seg) {
+                    return OptionalKeySegment{std::move(key_seg)};
+                })
+                .thenError(
+                        folly::tag_t<storage::KeyNotFoundException>{},
+                        [store, stream_id, read_opts](const storage::KeyNotFoundException&) {
+                            // As in read_symbol_ref, fall back to the legacy ref key, and treat a symbol with
+                            // neither as having no versions
+                            return store->read(RefKey{stream_id, KeyType::VERSION, true}, read_opts)
+                                    .thenValue([](std::pair<VariantKey, SegmentInMemory>&& key_seg) {
+                                        return OptionalKeySegment{std::move(key_seg)};
+                                    })
+                                    .thenError(
+                                            folly::tag_t<storage::KeyNotFoundException>{},
+                                            [](const storage::KeyNotFoundException&) { return OptionalKeySegment{}; }
+                                    );
+                        }
+                )
+                .thenValue([this, store, entry, load_strategy](OptionalKeySegment&& key_seg) {
+                    VersionMapEntry ref_entry(entry->stream_id_);
+                    if (key_seg) {
+                        LoadProgress load_progress;
+                        ref_entry.head_ = read_segment_with_keys(key_seg->second, ref_entry, load_progress);
+                        ref_entry.load_progress_ = load_progress;
+                    }
+                    return follow_version_chain_async(store, ref_entry, entry, load_strategy);
+                })
+                .thenError(
+                        folly::tag_t<std::exception>{},
+                        [this, store, stream_id, load_strategy](const std::exception& e) {
+                            ARCTICDB_DEBUG(log::version(), "Reloading {} synchronously after: {}", stream_id, e.what());
+                            return folly::via(&async::io_executor(), [this, store, stream_id, load_strategy] {
+                                return storage_reload(store, stream_id, load_strategy);
+                            });
+                        }
+                );
     }
 
     void load_via_ref_key(
@@ -190,7 +280,8 @@ class VersionMapImpl {
                 if (ref_entry.empty())
                     return;
 
-                follow_version_chain(store, ref_entry, entry, load_strategy);
+                const auto version_keys_read = follow_version_chain(store, ref_entry, entry, load_strategy);
+                maybe_rebuild_catalogue(store, *entry, version_keys_read);
                 break;
             } catch (const std::exception& err) {
                 if (--max_trials <= 0) {
@@ -212,8 +303,8 @@ class VersionMapImpl {
     }
 
     void flush() {
-        std::lock_guard lock(map_mutex_);
         map_.clear();
+        symbols_without_catalogue_.clear();
     }
 
     void load_via_iteration(
@@ -246,7 +337,7 @@ class VersionMapImpl {
         auto entry = check_reload(store, key.id(), load_param, __FUNCTION__);
 
         do_write(store, key, entry, prevent_non_increasing_version_id);
-        write_symbol_ref(store, key, previous_key, entry->head_.value());
+        update_symbol_ref(store, key, previous_key, entry->head_.value());
         if (validate_)
             entry->validate();
         if (log_changes_)
@@ -277,7 +368,7 @@ class VersionMapImpl {
             entry->validate();
 
         if (entry->head_)
-            write_symbol_ref(
+            update_symbol_ref(
                     store, entry->keys_.cbegin()->to_atom_key(entry->stream_id_), std::nullopt, entry->head_.value()
             );
 
@@ -310,7 +401,7 @@ class VersionMapImpl {
         }
 
         auto previous_index = do_write(store, key.version_id(), key.id(), std::span{keys_to_write}, entry);
-        write_symbol_ref(
+        update_symbol_ref(
                 store, entry->keys_.cbegin()->to_atom_key(entry->stream_id_), previous_index, entry->head_.value()
         );
 
@@ -331,6 +422,8 @@ class VersionMapImpl {
         std::deque<AtomKey> output;
         auto [version_id, index_keys] = tombstone_from_key_or_all(store, stream_id);
         output.assign(std::begin(index_keys), std::end(index_keys));
+        if (use_catalogue_)
+            remove_version_catalogue(store, stream_id);
         return {version_id, std::move(output)};
     }
 
@@ -556,6 +649,9 @@ class VersionMapImpl {
     ) {
         ARCTICDB_DEBUG(log::version(), "Check reload in function {} for id {}", function, stream_id);
 
+        if (change_journal_)
+            change_journal_->maybe_poll(store, now(), get_reload_interval());
+
         if (has_cached_entry(stream_id, load_strategy)) {
             return get_entry(stream_id);
         }
@@ -642,7 +738,7 @@ class VersionMapImpl {
         static const bool should_log_individual_tombstones =
                 ConfigsMap::instance()->get_int("VersionMap.LogIndividualTombstones", 1);
         auto tombstone_keys = write_tombstones_internal(store, keys, stream_id, entry, creation_ts);
-        write_symbol_ref(store, tombstone_keys.front(), std::nullopt, entry->head_.value());
+        update_symbol_ref(store, tombstone_keys.front(), std::nullopt, entry->head_.value());
         if (log_changes_) {
             if (should_log_individual_tombstones) {
                 for (const auto& key : tombstone_keys) {
@@ -709,6 +805,9 @@ class VersionMapImpl {
             );
             store->remove_key_sync(*entry.head_);
         }
+        // The catalogue lists the VERSION keys removed here
+        if (use_catalogue_)
+            remove_version_catalogue(store, stream_id);
         std::vector<folly::Future<folly::Unit>> key_futs;
         for (const auto& key : entry.keys_) {
             if (key.type() == KeyType::VERSION)
@@ -729,17 +828,22 @@ class VersionMapImpl {
         util::check(requested_load_type < LoadType::UNKNOWN, "Unexpected load type requested {}", requested_load_type);
 
         requested_load_strategy.validate();
-        MapType::const_iterator entry_it;
-        if (!find_entry(entry_it, stream_id)) {
+        const auto entry = find_entry(stream_id);
+        if (!entry) {
             return false;
         }
 
-        const timestamp reload_interval = reload_interval_.value_or(
-                ConfigsMap::instance()->get_int("VersionMap.ReloadInterval", DEFAULT_RELOAD_INTERVAL)
-        );
-
-        const auto& entry = entry_it->second;
-        if (const timestamp cache_timing = now() - entry->last_reload_time_; cache_timing > reload_interval) {
+        const timestamp reload_interval = get_reload_interval();
+        if (change_journal_) {
+            if (!change_journal_->is_fresh(stream_id, entry->last_reload_time_, now(), reload_interval)) {
+                ARCTICDB_DEBUG(
+                        log::version(),
+                        "Version change journal shows a change to symbol {} since it was loaded",
+                        stream_id
+                );
+                return false;
+            }
+        } else if (const timestamp cache_timing = now() - entry->last_reload_time_; cache_timing > reload_interval) {
             ARCTICDB_DEBUG(
                     log::version(),
                     "Latest read time {} too long ago for last acceptable cached timing {} (cache period {}) for "
@@ -820,6 +924,8 @@ class VersionMapImpl {
         }
 
         update_version_key(store, parent->to_atom_key(stream_id), index_keys_compacted, stream_id);
+        // The parent VERSION key is rewritten in place, so a catalogue that holds it would list removed VERSION keys
+        remove_version_catalogue(store, stream_id);
         store->remove_keys(version_keys_compacted).get();
 
         new_entry->keys_.erase(
@@ -845,14 +951,12 @@ class VersionMapImpl {
             entry->validate();
     }
 
-    bool find_entry(MapType::const_iterator& entry, const StreamId& stream_id) const {
-        std::lock_guard lock(map_mutex_);
-        entry = map_.find(stream_id);
-        if (entry == map_.cend()) {
-            ARCTICDB_DEBUG(log::version(), "Did not find cached entry for stream id {}", stream_id);
-            return false;
-        }
-        return true;
+    std::shared_ptr<VersionMapEntry> find_entry(const StreamId& stream_id) const {
+        if (auto result = map_.find(stream_id); result != map_.cend())
+            return result->second;
+
+        ARCTICDB_DEBUG(log::version(), "Did not find cached entry for stream id {}", stream_id);
+        return nullptr;
     }
 
     bool inline has_loaded_earliest_version(const VersionMapEntry& entry, const LoadStrategy& requested_load_strategy)
@@ -897,11 +1001,11 @@ class VersionMapImpl {
         return false;
     }
 
-    std::shared_ptr<VersionMapEntry>& get_entry(const StreamId& stream_id) {
-        std::lock_guard lock(map_mutex_);
-        if (auto result = map_.find(stream_id); result != std::end(map_))
+    std::shared_ptr<VersionMapEntry> get_entry(const StreamId& stream_id) {
+        if (auto result = map_.find(stream_id); result != map_.cend())
             return result->second;
 
+        // If another thread inserts first then its entry is kept and returned
         return map_.try_emplace(stream_id, std::make_shared<VersionMapEntry>(stream_id)).first->second;
     }
 
@@ -933,7 +1037,7 @@ class VersionMapImpl {
 
         version_agg.commit();
         auto previous_index = entry->get_second_undeleted_index();
-        write_symbol_ref(store, entry->keys_.cbegin()->to_atom_key(entry->stream_id_), previous_index, journal_key);
+        update_symbol_ref(store, entry->keys_.cbegin()->to_atom_key(entry->stream_id_), previous_index, journal_key);
         return journal_key;
     }
 
@@ -944,27 +1048,165 @@ class VersionMapImpl {
          * Goes to the storage for a given symbol, and recreates the VersionMapEntry from preferably the ref key
          * structure, and if that fails it then goes and builds that from iterating all keys from storage which can
          * be much slower, though always consistent.
+         *
+         * The entry is built aside and then published in place of the cached one, so that threads still reading the
+         * previous entry are never exposed to a partially loaded one.
          */
+        auto entry = make_reloaded_entry(stream_id);
+        load_via_ref_key(store, stream_id, load_strategy, entry);
+        return publish_reloaded_entry(entry);
+    }
 
-        auto entry = get_entry(stream_id);
-        entry->clear();
+    std::shared_ptr<VersionMapEntry> make_reloaded_entry(const StreamId& stream_id) const {
+        auto entry = std::make_shared<VersionMapEntry>(stream_id);
         const auto clock_unsync_tolerance =
                 ConfigsMap::instance()->get_int("VersionMap.UnsyncTolerance", DEFAULT_CLOCK_UNSYNC_TOLERANCE);
         entry->last_reload_time_ = Clock::nanos_since_epoch() - clock_unsync_tolerance;
+        return entry;
+    }
 
-        auto temp = std::make_shared<VersionMapEntry>(*entry);
-        load_via_ref_key(store, stream_id, load_strategy, temp);
-        std::swap(*entry, *temp);
-
+    std::shared_ptr<VersionMapEntry> publish_reloaded_entry(const std::shared_ptr<VersionMapEntry>& entry) {
         util::check(entry->keys_.empty() || entry->head_, "Non-empty VersionMapEntry should set head");
         if (validate_)
             entry->validate();
 
+        map_.insert_or_assign(entry->stream_id_, entry);
         return entry;
     }
 
+    // Fills the entry from the ref key alone if it holds every key the load needs
+    static bool load_from_ref_entry(
+            const VersionMapEntry& ref_entry, VersionMapEntry& entry, const LoadStrategy& load_strategy
+    ) {
+        util::check(ref_entry.keys_.size() >= 2, "Invalid empty ref entry");
+        std::optional<AtomKey> cached_penultimate_index;
+        if (ref_entry.keys_.size() == 3) {
+            util::check(
+                    is_index_or_tombstone(ref_entry.keys_[1].type()),
+                    "Expected index key in as second item in 3-item ref key"
+            );
+            cached_penultimate_index = ref_entry.keys_[1].to_atom_key(ref_entry.stream_id_);
+        }
+
+        if (!key_exists_in_ref_entry(load_strategy, ref_entry, cached_penultimate_index))
+            return false;
+
+        entry.load_progress_ = ref_entry.load_progress_;
+        entry.keys_.push_back(ref_entry.keys_[0]);
+        if (cached_penultimate_index)
+            entry.keys_.push_back(*cached_penultimate_index);
+
+        return true;
+    }
+
+    static bool continue_following_chain(
+            const LoadStrategy& load_strategy, const LoadProgress& load_progress,
+            const std::optional<VersionId>& latest_version, const std::shared_ptr<VersionMapEntry>& entry
+    ) {
+        return continue_when_loading_version(load_strategy, load_progress, latest_version) &&
+               continue_when_loading_from_time(load_strategy, load_progress) &&
+               continue_when_loading_latest(load_strategy, entry) &&
+               continue_when_loading_undeleted(load_strategy, entry, load_progress);
+    }
+
+    // The state of an asynchronous load carried from one VERSION key read to the next
+    struct ChainProgress {
+        std::optional<VersionId> latest_version;
+        LoadProgress load_progress;
+    };
+
+    folly::Future<std::shared_ptr<VersionMapEntry>> follow_version_chain_async(
+            const std::shared_ptr<Store>& store, const VersionMapEntry& ref_entry,
+            const std::shared_ptr<VersionMapEntry>& entry, const LoadStrategy& load_strategy
+    ) {
+        if (ref_entry.empty())
+            return folly::makeFuture(publish_reloaded_entry(entry));
+
+        entry->head_ = ref_entry.head_;
+        if (load_from_ref_entry(ref_entry, *entry, load_strategy))
+            return folly::makeFuture(publish_reloaded_entry(entry));
+
+        return read_version_chain_async(store, ref_entry.head_.value(), entry, load_strategy, ChainProgress{});
+    }
+
+    folly::Future<std::shared_ptr<VersionMapEntry>> read_version_chain_async(
+            const std::shared_ptr<Store>& store, const AtomKey& version_key,
+            const std::shared_ptr<VersionMapEntry>& entry, const LoadStrategy& load_strategy, ChainProgress progress
+    ) {
+        ARCTICDB_DEBUG(log::version(), "Loading version key {}", version_key);
+        return store->read(version_key)
+                .thenValue([this, store, entry, load_strategy, progress = std::move(progress)](
+                                   std::pair<VariantKey, SegmentInMemory>&& key_seg
+                           ) mutable -> folly::Future<std::shared_ptr<VersionMapEntry>> {
+                    auto next_key = read_segment_with_keys(key_seg.second, entry, progress.load_progress);
+                    set_latest_version(entry, progress.latest_version);
+                    if (!next_key || !continue_following_chain(
+                                             load_strategy, progress.load_progress, progress.latest_version, entry
+                                     )) {
+                        entry->load_progress_ = progress.load_progress;
+                        return folly::makeFuture(publish_reloaded_entry(entry));
+                    }
+
+                    // Deeper loads read the version catalogue, which the synchronous load handles
+                    if (use_catalogue_) {
+                        return folly::via(&async::io_executor(), [this, store, entry, load_strategy] {
+                            return storage_reload(store, entry->stream_id_, load_strategy);
+                        });
+                    }
+
+                    return read_version_chain_async(store, *next_key, entry, load_strategy, std::move(progress));
+                });
+    }
+
     timestamp now() const { return Clock::nanos_since_epoch(); }
 
+    timestamp get_reload_interval() const {
+        return reload_interval_.value_or(
+                ConfigsMap::instance()->get_int("VersionMap.ReloadInterval", DEFAULT_RELOAD_INTERVAL)
+        );
+    }
+
+    std::optional<VersionCatalogue> maybe_read_version_catalogue(
+            const std::shared_ptr<Store>& store, const StreamId& stream_id
+    ) const {
+        if (!use_catalogue_ || symbols_without_catalogue_.find(stream_id) != symbols_without_catalogue_.cend())
+            return std::nullopt;
+
+        auto catalogue = read_version_catalogue(store, stream_id);
+        if (!catalogue)
+            symbols_without_catalogue_.insert_or_assign(stream_id, true);
+
+        return catalogue;
+    }
+
+    void maybe_rebuild_catalogue(
+            const std::shared_ptr<Store>& store, const VersionMapEntry& entry, size_t version_keys_read
+    ) const {
+        static const auto rebuild_blocks =
+                ConfigsMap::instance()->get_int("VersionMap.VersionCatalogueRebuildBlocks", 10);
+        if (!use_catalogue_ || !entry.load_progress_.is_earliest_version_loaded ||
+            static_cast<int64_t>(version_keys_read) < rebuild_blocks)
+            return;
+
+        try {
+            write_version_catalogue(store, entry);
+            symbols_without_catalogue_.erase(entry.stream_id_);
+        } catch (const std::exception& e) {
+            // Loads still succeed without the catalogue, e.g. for readers without write access to the library
+            log::version().info("Failed to rebuild the version catalogue for {}: {}", entry.stream_id_, e.what());
+        }
+    }
+
+    // Every write of a VERSION_REF key goes through here, so that the change journal sees all of them
+    void update_symbol_ref(
+            const std::shared_ptr<Store>& store, const AtomKey& latest_index,
+            const std::optional<AtomKey>& previous_key, const AtomKey& journal_key
+    ) {
+        write_symbol_ref(store, latest_index, previous_key, journal_key);
+        if (change_journal_)
+            change_journal_->append(store, latest_index.id(), latest_index.version_id(), now());
+    }
+
     std::shared_ptr<VersionMapEntry> rewrite_entry(
             std::shared_ptr<Store> store, const StreamId& stream_id, const std::shared_ptr<VersionMapEntry>& entry
     ) {
@@ -1112,9 +1354,10 @@ class VersionMapImpl {
     }
 
     void recover_deleted(std::shared_ptr<Store> store, const StreamId& stream_id) {
-        auto& entry = get_entry(stream_id);
+        auto entry = get_entry(stream_id);
         entry->clear();
         load_via_iteration(store, stream_id, entry);
+        map_.insert_or_assign(stream_id, entry);
 
         auto missing_versions = find_deleted_version_keys_for_entry(store, stream_id, entry);
 
@@ -170,36 +170,35 @@ folly::Future<VersionEntryOrSnapshot> set_up_snapshot_future(
     }
 }
 
-folly::Future<VersionEntryOrSnapshot> set_up_version_future(
-        const StreamId& symbol, const StreamVersionData& version_data,
-        ankerl::unordered_dense::map<StreamId, SplitterType>& version_futures, const std::shared_ptr<Store>& store,
-        const std::shared_ptr<VersionMap>& version_map
+// Loads every symbol with a version query once, with at most batch_load_window() loads in flight
+ankerl::unordered_dense::map<StreamId, SplitterType> set_up_version_futures(
+        const ankerl::unordered_dense::map<StreamId, StreamVersionData>& version_data,
+        const std::shared_ptr<Store>& store, const std::shared_ptr<VersionMap>& version_map
 ) {
-    if (version_data.count_ == 1) {
-        return async::submit_io_task(CheckReloadTask{store, version_map, symbol, version_data.load_strategy_})
-                .thenValue([](std::shared_ptr<VersionMapEntry> version_map_entry) {
-                    return VersionEntryOrSnapshot{std::move(version_map_entry)};
-                });
-    } else {
-        auto maybe_fut = version_futures.find(symbol);
-        if (maybe_fut == version_futures.end()) {
-            auto [splitter, inserted] = version_futures.emplace(
-                    symbol,
-                    folly::FutureSplitter{
-                            async::submit_io_task(
-                                    CheckReloadTask{store, version_map, symbol, version_data.load_strategy_}
-                            )
-                                    .thenValue([](std::shared_ptr<VersionMapEntry> version_map_entry) {
-                                        return VersionEntryOrSnapshot{std::move(version_map_entry)};
-                                    })
-                    }
-            );
-
-            return splitter->second.getFuture();
-        } else {
-            return maybe_fut->second.getFuture();
-        }
+    std::vector<std::pair<StreamId, LoadStrategy>> loads;
+    loads.reserve(version_data.size());
+    for (const auto& [symbol, data] : version_data) {
+        if (data.count_ > 0)
+            loads.emplace_back(symbol, data.load_strategy_);
     }
+
+    auto futures = folly::window(
+            loads,
+            [store, version_map](const std::pair<StreamId, LoadStrategy>& load) {
+                return batch_load_entry(store, version_map, load.first, load.second)
+                        .thenValue([](std::shared_ptr<VersionMapEntry> version_map_entry) {
+                            return VersionEntryOrSnapshot{std::move(version_map_entry)};
+                        });
+            },
+            batch_load_window()
+    );
+
+    ankerl::unordered_dense::map<StreamId, SplitterType> version_futures;
+    version_futures.reserve(loads.size());
+    for (size_t i = 0; i < loads.size(); ++i)
+        version_futures.emplace(loads[i].first, folly::FutureSplitter{std::move(futures[i])});
+
+    return version_futures;
 }
 
 std::vector<folly::Future<std::optional<AtomKey>>> batch_get_versions_async(
@@ -232,7 +231,7 @@ std::vector<folly::Future<std::optional<AtomKey>>> batch_get_versions_async(
             std::make_shared<SnapshotKeyMap>(get_keys_for_snapshots(store, snapshot_count_map->snapshots()));
 
     ankerl::unordered_dense::map<StreamId, SplitterType> snapshot_futures;
-    ankerl::unordered_dense::map<StreamId, SplitterType> version_futures;
+    auto version_futures = set_up_version_futures(version_data, store, version_map);
 
     std::vector<folly::Future<std::optional<AtomKey>>> output;
     output.reserve(symbols.size());
@@ -248,11 +247,10 @@ std::vector<folly::Future<std::optional<AtomKey>>> batch_get_versions_async(
                             snapshot_futures, snapshot_count_map, snapshot_key_map, snapshot_query, store
                     );
                 },
-                [&version_entry_fut, &version_data, &symbol, &version_futures, &store, &version_map](const auto&) {
-                    const auto it = version_data.find(*symbol);
-                    util::check(it != version_data.end(), "Missing version data for symbol {}", *symbol);
-
-                    version_entry_fut = set_up_version_future(*symbol, it->second, version_futures, store, version_map);
+                [&version_entry_fut, &symbol, &version_futures](const auto&) {
+                    const auto it = version_futures.find(*symbol);
+                    util::check(it != version_futures.end(), "Missing version load for symbol {}", *symbol);
+                    version_entry_fut = it->second.getFuture();
                 }
         );
 
@@ -40,9 +40,26 @@ inline std::optional<std::string> collect_futures_exceptions(auto&& futures) {
     return all_exceptions;
 }
 
+/*
+ * How many symbols the batch methods load at once. A load holds no IO thread while it waits on storage (see
+ * VersionMap::check_reload_async), so this can be well above the number of IO threads, which lets backends with
+ * asynchronous reads have a request in flight for every symbol in the window.
+ */
+inline size_t batch_load_window() {
+    return static_cast<size_t>(ConfigsMap::instance()->get_int("VersionMap.BatchLoadWindow", 1000));
+}
+
+inline folly::Future<std::shared_ptr<VersionMapEntry>> batch_load_entry(
+        const std::shared_ptr<Store>& store, const std::shared_ptr<VersionMap>& version_map, const StreamId& stream_id,
+        const LoadStrategy& load_strategy
+) {
+    // The map must outlive the load's continuations
+    return version_map->check_reload_async(store, stream_id, load_strategy).ensure([version_map] {});
+}
+
 template<typename Inputs, typename TaskSubmitter, typename ResultHandler>
 inline void submit_tasks_for_range(Inputs inputs, TaskSubmitter submitter, ResultHandler result_handler) {
-    const auto window_size = async::TaskScheduler::instance()->io_thread_count() * 2;
+    const auto window_size = batch_load_window();
 
     auto futures = folly::window(
             std::move(inputs),
@@ -73,7 +90,7 @@ inline std::shared_ptr<std::unordered_map<StreamId, SymbolStatus>> batch_check_l
     submit_tasks_for_range(
             *symbols,
             [store, version_map, &load_strategy](auto& symbol) {
-                return async::submit_io_task(CheckReloadTask{store, version_map, symbol, load_strategy});
+                return batch_load_entry(store, version_map, symbol, load_strategy);
             },
             [output, mutex](const auto& id, const std::shared_ptr<VersionMapEntry>& entry) {
                 auto index_key = entry->get_first_index(false).first;
@@ -119,7 +136,7 @@ inline std::shared_ptr<std::unordered_map<StreamId, MaybeDeletedAtomKey>> batch_
     submit_tasks_for_range(
             stream_ids,
             [store, version_map, &load_strategy](auto& stream_id) {
-                return async::submit_io_task(CheckReloadTask{store, version_map, stream_id, load_strategy});
+                return batch_load_entry(store, version_map, stream_id, load_strategy);
             },
             [output, include_deleted, mutex](auto id, auto entry) {
                 auto [index_key, deleted] = entry->get_first_index(include_deleted);
@@ -147,7 +164,7 @@ inline std::shared_ptr<std::unordered_map<StreamId, AtomKey>> batch_get_latest_v
     submit_tasks_for_range(
             stream_ids,
             [store, version_map, &load_strategy](auto& stream_id) {
-                return async::submit_io_task(CheckReloadTask{store, version_map, stream_id, load_strategy});
+                return batch_load_entry(store, version_map, stream_id, load_strategy);
             },
             [output, include_deleted, mutex](auto id, auto entry) {
                 auto [index_key, deleted] = entry->get_first_index(include_deleted);
@@ -167,19 +184,23 @@ batch_get_latest_undeleted_and_latest_versions_async(
         const std::vector<StreamId>& stream_ids
 ) {
     ARCTICDB_SAMPLE(BatchGetLatestUndeletedVersionAndNextVersionId, 0)
-    std::vector<folly::Future<std::pair<std::optional<AtomKey>, std::optional<AtomKey>>>> vector_fut;
-    for (auto& stream_id : stream_ids) {
-        vector_fut.push_back(async::submit_io_task(CheckReloadTask{
-                                                           store,
-                                                           version_map,
-                                                           stream_id,
-                                                           LoadStrategy{LoadType::LATEST, LoadObjective::UNDELETED_ONLY}
-                                                   }
-        ).thenValue([](const std::shared_ptr<VersionMapEntry>& entry) {
-            return std::make_pair(entry->get_first_index(false).first, entry->get_first_index(true).first);
-        }));
-    }
-    return vector_fut;
+    return folly::window(
+            stream_ids,
+            [store, version_map](const StreamId& stream_id) {
+                return batch_load_entry(
+                               store,
+                               version_map,
+                               stream_id,
+                               LoadStrategy{LoadType::LATEST, LoadObjective::UNDELETED_ONLY}
+                )
+                        .thenValue([](const std::shared_ptr<VersionMapEntry>& entry) {
+                            return std::make_pair(
+                                    entry->get_first_index(false).first, entry->get_first_index(true).first
+                            );
+                        });
+            },
+            batch_load_window()
+    );
 }
 
 inline std::vector<folly::Future<version_store::UpdateInfo>>
@@ -188,22 +209,25 @@ batch_get_latest_undeleted_version_and_next_version_id_async(
         const std::vector<StreamId>& stream_ids
 ) {
     ARCTICDB_SAMPLE(BatchGetLatestUndeletedVersionAndNextVersionId, 0)
-    std::vector<folly::Future<version_store::UpdateInfo>> vector_fut;
-    for (auto& stream_id : stream_ids) {
-        vector_fut.push_back(async::submit_io_task(CheckReloadTask{
-                                                           store,
-                                                           version_map,
-                                                           stream_id,
-                                                           LoadStrategy{LoadType::LATEST, LoadObjective::UNDELETED_ONLY}
-                                                   }
-        ).thenValue([](auto entry) {
-            auto latest_version = entry->get_first_index(true).first;
-            auto latest_undeleted_version = entry->get_first_index(false).first;
-            VersionId next_version_id = latest_version.has_value() ? latest_version->version_id() + 1 : 0;
-            return version_store::UpdateInfo{latest_undeleted_version, next_version_id};
-        }));
-    }
-    return vector_fut;
+    return folly::window(
+            stream_ids,
+            [store, version_map](const StreamId& stream_id) {
+                return batch_load_entry(
+                               store,
+                               version_map,
+                               stream_id,
+                               LoadStrategy{LoadType::LATEST, LoadObjective::UNDELETED_ONLY}
+                )
+                        .thenValue([](auto entry) {
+                            auto latest_version = entry->get_first_index(true).first;
+                            auto latest_undeleted_version = entry->get_first_index(false).first;
+                            VersionId next_version_id =
+                                    latest_version.has_value() ? latest_version->version_id() + 1 : 0;
+                            return version_store::UpdateInfo{latest_undeleted_version, next_version_id};
+                        });
+            },
+            batch_load_window()
+    );
 }
 
 using VersionVectorType = std::vector<VersionId>;
@@ -246,7 +270,7 @@ inline BatchGetVersionResult<SymbolVersion> batch_get_specific_versions(
             [store, version_map, objective](auto sym_version) {
                 auto first_version = *std::min_element(std::begin(sym_version.second), std::end(sym_version.second));
                 LoadStrategy load_strategy{LoadType::DOWNTO, objective, static_cast<SignedVersionId>(first_version)};
-                return async::submit_io_task(CheckReloadTask{store, version_map, sym_version.first, load_strategy});
+                return batch_load_entry(store, version_map, sym_version.first, load_strategy);
             },
 
             [found, option, &sym_versions, found_mutex, tombstoned_vers, tombstoned_mutex](
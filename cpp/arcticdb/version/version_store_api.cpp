@@ -21,8 +21,10 @@
 #include <arcticdb/version/version_utils.hpp>
 #include <arcticdb/pipeline/pipeline_utils.hpp>
 #include <arcticdb/version/snapshot.hpp>
+#include <arcticdb/version/snapshot_membership.hpp>
 #include <arcticdb/storage/file/file_store.hpp>
 #include <arcticdb/version/version_functions.hpp>
+#include <arcticdb/async/operation_context.hpp>
 
 namespace arcticdb::version_store {
 
@@ -367,6 +369,7 @@ VersionResultVector PythonVersionStore::list_versions(
         const std::optional<StreamId>& stream_id, const std::optional<SnapshotId>& snap_name, bool latest_only,
         bool skip_snapshots
 ) {
+    async::ScopedOperation operation{async::TaskPriority::HIGH};
     ARCTICDB_SAMPLE(ListVersions, 0)
     ARCTICDB_RUNTIME_DEBUG(log::version(), "Command: list_versions");
 
@@ -484,6 +487,7 @@ void PythonVersionStore::add_to_snapshot(
     }
     auto [snap_key, snap_segment] = std::move(*opt_snapshot);
     auto [snapshot_contents, user_meta] = get_versions_and_metadata_from_snapshot(store(), snap_key);
+    const auto previous_contents = snapshot_contents;
     auto [specific_versions_index_map, latest_versions_index_map] = get_stream_index_map(stream_ids, version_queries);
     for (const auto& [stream_id, key] : *latest_versions_index_map) {
         specific_versions_index_map->try_emplace(stream_id, key);
@@ -513,7 +517,9 @@ void PythonVersionStore::add_to_snapshot(
         retained_keys.emplace_back(std::move(key));
 
     std::sort(std::begin(retained_keys), std::end(retained_keys));
+    SnapshotMembershipUpdate membership_update{store(), snap_name};
     write_snapshot_entry(store(), retained_keys, snap_name, user_meta, version_map()->log_changes());
+    membership_update.record(previous_contents, retained_keys);
     if (is_delete_keys_immediately) {
         std::unordered_set<StreamId> deleted_stream_ids;
         deleted_stream_ids.reserve(deleted_keys.size());
@@ -546,6 +552,7 @@ void PythonVersionStore::remove_from_snapshot(
     }
     auto [snap_key, snap_segment] = std::move(*opt_snapshot);
     auto [snapshot_contents, user_meta] = get_versions_and_metadata_from_snapshot(store(), snap_key);
+    const auto previous_contents = snapshot_contents;
 
     using SymbolVersion = std::pair<StreamId, VersionId>;
     std::unordered_set<SymbolVersion> symbol_versions;
@@ -567,7 +574,9 @@ void PythonVersionStore::remove_from_snapshot(
         }
     }
 
+    SnapshotMembershipUpdate membership_update{store(), snap_name};
     write_snapshot_entry(store(), retained_keys, snap_name, user_meta, version_map()->log_changes());
+    membership_update.record(previous_contents, retained_keys);
     if (is_delete_keys_immediately) {
         std::unordered_set<StreamId> deleted_stream_ids;
         deleted_stream_ids.reserve(deleted_keys.size());
@@ -664,7 +673,9 @@ void PythonVersionStore::snapshot(
     }
 
     ARCTICDB_DEBUG(log::version(), "Total Index keys in snapshot={}", index_keys.size());
+    SnapshotMembershipUpdate membership_update{store(), snap_name};
     write_snapshot_entry(store(), index_keys, snap_name, user_meta, version_map()->log_changes());
+    membership_update.record({}, index_keys);
 }
 
 std::set<StreamId> PythonVersionStore::list_streams(
@@ -1027,6 +1038,7 @@ std::vector<std::variant<ReadResult, DataError>> PythonVersionStore::batch_read(
         std::vector<std::shared_ptr<ReadQuery>>& read_queries, const BatchReadOptions& batch_read_options,
         std::shared_ptr<std::any> handler_data
 ) {
+    async::ScopedOperation operation{async::TaskPriority::NORMAL};
 
     auto read_versions_or_errors =
             batch_read_internal(stream_ids, version_queries, read_queries, batch_read_options, handler_data);
@@ -1097,7 +1109,10 @@ void PythonVersionStore::delete_snapshot(const SnapshotId& snap_name) {
 
     if (variant_key_type(snap_key) == KeyType::SNAPSHOT_REF && cfg().write_options().delayed_deletes()) {
         ARCTICDB_DEBUG(log::version(), "Delaying deletion of Snapshot {}", snap_name);
+        SnapshotMembershipUpdate membership_update{store(), snap_name};
+        const auto previous_contents = get_versions_from_segment(snap_segment);
         tombstone_snapshot(store(), to_ref(snap_key), std::move(snap_segment), version_map()->log_changes());
+        membership_update.remove(previous_contents);
     } else {
         delete_snapshot_sync(snap_name, snap_key);
         if (version_map()->log_changes()) {
@@ -1112,7 +1127,11 @@ void PythonVersionStore::delete_snapshot_sync(const SnapshotId& snap_name, const
     auto snap_map_and_keys = get_master_snapshots_map_and_keys_in_given_snapshot(store(), snap_key);
 
     ARCTICDB_DEBUG(log::version(), "Deleting Snapshot {}", snap_name);
-    store()->remove_key(snap_key).get();
+    {
+        SnapshotMembershipUpdate membership_update{store(), snap_name};
+        store()->remove_key(snap_key).get();
+        membership_update.remove(snap_map_and_keys.index_keys_in_given_snapshot);
+    }
 
     try {
         delete_trees_responsibly(
@@ -1129,6 +1148,7 @@ ReadResult PythonVersionStore::read_dataframe_version(
         const StreamId& stream_id, const VersionQuery& version_query, const std::shared_ptr<ReadQuery>& read_query,
         const ReadOptions& read_options, std::shared_ptr<std::any> handler_data
 ) {
+    async::ScopedOperation operation{async::TaskPriority::NORMAL};
 
     auto opt_version_and_frame =
             read_dataframe_version_internal(stream_id, version_query, read_query, read_options, handler_data);
@@ -1401,6 +1421,7 @@ py::object metadata_protobuf_to_pyobject(const std::optional<google::protobuf::A
 std::pair<VersionedItem, py::object> PythonVersionStore::read_metadata(
         const StreamId& stream_id, const VersionQuery& version_query
 ) {
+    async::ScopedOperation operation{async::TaskPriority::HIGH};
     ARCTICDB_RUNTIME_DEBUG(log::version(), "Command: read_metadata");
     ARCTICDB_SAMPLE(ReadMetadata, 0)
 
@@ -1440,6 +1461,7 @@ std::vector<std::variant<std::pair<VersionedItem, py::object>, DataError>> Pytho
         const std::vector<StreamId>& stream_ids, const std::vector<VersionQuery>& version_queries,
         const BatchReadOptions& batch_read_options
 ) {
+    async::ScopedOperation operation{async::TaskPriority::HIGH};
     ARCTICDB_SAMPLE(BatchReadMetadata, 0)
     auto metadatas_or_errors = batch_read_metadata_internal(stream_ids, version_queries, batch_read_options);
 
@@ -1464,6 +1486,7 @@ std::vector<std::variant<std::pair<VersionedItem, py::object>, DataError>> Pytho
 DescriptorItem PythonVersionStore::read_descriptor(
         const StreamId& stream_id, const VersionQuery& version_query, bool include_index_segment
 ) {
+    async::ScopedOperation operation{async::TaskPriority::HIGH};
     return read_descriptor_internal(stream_id, version_query, include_index_segment);
 }
 
@@ -1471,6 +1494,7 @@ std::vector<std::variant<DescriptorItem, DataError>> PythonVersionStore::batch_r
         const std::vector<StreamId>& stream_ids, const std::vector<VersionQuery>& version_queries,
         const BatchReadOptions& batch_read_options
 ) {
+    async::ScopedOperation operation{async::TaskPriority::HIGH};
 
     return batch_read_descriptor_internal(stream_ids, version_queries, batch_read_options);
 }
@@ -26,10 +26,14 @@ VariantKey write_multi_index_entry(
         const py::object& metastruct, const py::object& user_meta, VersionId version_id
 );
 
-inline std::optional<AtomKey> read_segment_with_keys(
-        const SegmentInMemory& seg, VersionMapEntry& entry, LoadProgress& load_progress
+// Reads the keys of a version chain segment from first_row onwards into the entry. A version key segment ends with the
+// version key that it links to, which is returned. A version catalogue holds the rest of the chain in one segment, so
+// with whole_chain its version keys are read like any other and nothing is returned.
+inline std::optional<AtomKey> read_chain_keys(
+        const SegmentInMemory& seg, ssize_t first_row, bool whole_chain, VersionMapEntry& entry,
+        LoadProgress& load_progress
 ) {
-    ssize_t row = 0;
+    ssize_t row = first_row;
     std::optional<AtomKey> next;
     VersionId oldest_loaded_index = std::numeric_limits<VersionId>::max();
     VersionId oldest_loaded_undeleted_index = std::numeric_limits<VersionId>::max();
@@ -63,9 +67,11 @@ inline std::optional<AtomKey> read_segment_with_keys(
             entry.keys_.push_back(key);
         } else if (key.type() == KeyType::VERSION) {
             entry.keys_.push_back(key);
-            next = key;
-            ++row;
-            break;
+            if (!whole_chain) {
+                next = key;
+                ++row;
+                break;
+            }
         } else {
             util::raise_rte("Unexpected type in journal segment");
         }
@@ -83,6 +89,12 @@ inline std::optional<AtomKey> read_segment_with_keys(
     return next;
 }
 
+inline std::optional<AtomKey> read_segment_with_keys(
+        const SegmentInMemory& seg, VersionMapEntry& entry, LoadProgress& load_progress
+) {
+    return read_chain_keys(seg, 0, false, entry, load_progress);
+}
+
 inline std::optional<AtomKey> read_segment_with_keys(
         const SegmentInMemory& seg, const std::shared_ptr<VersionMapEntry>& entry, LoadProgress& load_progress
 ) {
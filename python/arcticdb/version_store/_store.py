@@ -1284,6 +1284,7 @@ class NativeVersionStore:
         self,
         symbol: str,
         as_of: Optional[VersionQueryInput] = None,
+        bloom_filter_columns: Optional[List[str]] = None,
     ) -> None:
         """
         Calculates MINMAX column statistics for each row-slice for the given symbol. In the future, these
@@ -1295,18 +1296,26 @@ class NativeVersionStore:
         pruned by the index mechanism. Any pre-existing stats are merged with the newly computed ones
         (read-modify-write).
 
+        BLOOM stats, a Bloom filter of the values in each row-slice, are additionally built for the columns in
+        bloom_filter_columns. They let `==` and `isin` filters skip row-slices of high-cardinality columns, such as
+        identifiers, where MINMAX stats do not help. They can be built for numeric, timestamp and string columns.
+
         Parameters
         ----------
         symbol: `str`
             Symbol name.
         as_of : `Optional[VersionQueryInput]`, default=None
             See documentation of `read` method for more details.
+        bloom_filter_columns: `Optional[List[str]]`, default=None
+            Columns to build BLOOM stats for.
 
         Returns
         -------
         None
         """
         column_stats = self._get_eligible_column_stats_spec(symbol, as_of)
+        for column in bloom_filter_columns or []:
+            column_stats.setdefault(column, set()).add("BLOOM")
         if not column_stats:
             return
 
@@ -1397,7 +1406,8 @@ class NativeVersionStore:
         Returns
         -------
         `pyarrow.Table`
-            Table representing the stored column statistics for each row-slice in a human-readable format.
+            Table representing the stored column statistics for each row-slice in a human-readable format. BLOOM
+            stats are binary, and are not included.
         """
         version_query = self._get_version_query(as_of, **kwargs)
         read_result = ReadResult(*self.version_store.read_column_stats_version(symbol, version_query))
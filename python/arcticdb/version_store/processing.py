@@ -17,7 +17,7 @@ import numpy as np
 import pandas as pd
 from pandas.tseries.frequencies import to_offset
 
-from typing import Any, Dict, NamedTuple, Optional, Tuple, Union
+from typing import Any, Dict, List, NamedTuple, Optional, Tuple, Union
 
 from arcticdb.exceptions import ArcticDbNotYetImplemented, ArcticNativeException, UserInputException
 from arcticdb.version_store._normalization import normalize_dt_range_to_ts
@@ -576,10 +576,10 @@ class QueryBuilder:
         self._python_clauses = self._python_clauses + [PythonProjectionClause(name, expr)]
         return self
 
-    def groupby(self, name: str):
+    def groupby(self, name: Union[str, List[str]]):
         """
-        Group symbol by column name. GroupBy operations must be followed by an aggregation operator. Currently the following five aggregation
-        operators are supported:
+        Group symbol by column name, or by several column names. GroupBy operations must be followed by an aggregation
+        operator. Currently the following five aggregation operators are supported:
 
         * "mean" - compute the mean of the group
         * "sum" - compute the sum of the group
@@ -591,8 +591,10 @@ class QueryBuilder:
 
         Parameters
         ----------
-        name: `str`
-            Name of the column to group on. Note that currently GroupBy only supports single-column groupings.
+        name: `Union[str, List[str]]`
+            Name of the column to group on, or a list of the names of several columns to group on. With several
+            columns, rows are grouped by the tuple of their values in these columns, and the result has a MultiIndex
+            with a level per column. As in Pandas, rows with a missing value in any grouping column are dropped.
 
         Examples
         --------
@@ -669,11 +671,37 @@ class QueryBuilder:
             group_1          1          3  1.666667
             group_2          4          5       2.2
 
+        Sum over two grouping columns:
+
+        >>> df = pd.DataFrame(
+            {
+                "symbol": ["A", "A", "B", "A"],
+                "side": ["BUY", "SELL", "BUY", "BUY"],
+                "quantity": [10, 20, 30, 40],
+            },
+            index=np.arange(4),
+        )
+        >>> q = adb.QueryBuilder()
+        >>> q = q.groupby(["symbol", "side"]).agg({"quantity": "sum"})
+        >>> lib.write("symbol", df)
+        >>> lib.read("symbol", query_builder=q).data
+
+                         quantity
+            symbol side
+            A      BUY         50
+                   SELL        20
+            B      BUY         30
+
         Returns
         -------
         QueryBuilder
             Modified QueryBuilder object.
         """
+        if not isinstance(name, str):
+            check(
+                isinstance(name, list) and len(name) > 0 and all(isinstance(column, str) for column in name),
+                f"GroupBy expects a column name or a non-empty list of column names, received {name}",
+            )
         self.clauses = self.clauses + [_GroupByClause(name)]
         self._python_clauses = self._python_clauses + [PythonGroupByClause(name)]
         return self
@@ -700,7 +728,7 @@ class QueryBuilder:
                 aggregations[k] = (v[0], v[1].lower())
 
         if isinstance(self.clauses[-1], _GroupByClause):
-            self.clauses = self.clauses + [_AggregationClause(self.clauses[-1].grouping_column, aggregations)]
+            self.clauses = self.clauses + [_AggregationClause(self.clauses[-1].grouping_columns, aggregations)]
             self._python_clauses = self._python_clauses + [PythonAggregationClause(aggregations)]
         else:
             self.clauses[-1].set_aggregations(aggregations)
@@ -1165,7 +1193,7 @@ class QueryBuilder:
                 self.clauses = self.clauses + [_GroupByClause(python_clause.name)]
             elif isinstance(python_clause, PythonAggregationClause):
                 self.clauses = self.clauses + [
-                    _AggregationClause(self.clauses[-1].grouping_column, python_clause.aggregations)
+                    _AggregationClause(self.clauses[-1].grouping_columns, python_clause.aggregations)
                 ]
             elif isinstance(python_clause, PythonResampleClause):
                 if python_clause.closed == _ResampleBoundary.LEFT:
@@ -1,3 +1,4 @@
+import time
 import uuid
 from enum import Enum
 from typing import NamedTuple
@@ -449,3 +450,27 @@ def test_read_version_chain(
         # Write the new version and check that it can be loaded despite the cache doesn't have it with as_of
         vinfo = lib_chain_setup.write(sym, make_df())
         assert lib_read.read(sym, as_of=vinfo.version).version == vinfo.version
+
+
+def test_version_change_journal_keeps_unchanged_symbols_cached(in_memory_store_factory, clear_query_stats):
+    reload_interval = 100_000_000
+    lib_write = in_memory_store_factory(version_change_journal=True)
+    lib_read = in_memory_store_factory(reuse_name=True, version_change_journal=True)
+    sym = f"sym_{uuid.uuid4().hex[:8]}"
+
+    with config_context("VersionMap.ReloadInterval", reload_interval):
+        lib_write.write(sym, make_df())
+        # Stay clear of the clock unsync tolerance between the write and the first load
+        time.sleep(0.3)
+        assert lib_read.read(sym).version == 0
+
+        qs.enable()
+        qs.reset_stats()
+        # Past the reload interval, the journal shows no change so the cached version is used
+        time.sleep(0.3)
+        assert lib_read.read(sym).version == 0
+        assert get_version_ref_reads(qs.get_query_stats()) == 0
+
+        lib_write.write(sym, make_df())
+        time.sleep(0.3)
+        assert lib_read.read(sym).version == 1
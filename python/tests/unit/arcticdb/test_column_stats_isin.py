@@ -504,3 +504,43 @@ def test_column_stats_isin_int64_min_not_treated_as_nat(
     expected = full_df[pandas_expr(full_df)]
     assert_frame_equal(expected, result)
     assert table_data_reads == expected_reads, f"Expected {expected_reads} TABLE_DATA read(s), got {table_data_reads}"
+
+
+@pytest.mark.parametrize(
+    "query_expr,pandas_expr,expected_reads",
+    [
+        pytest.param(lambda q: q["id"] == "m", lambda df: df["id"] == "m", 1, id="string_equals"),
+        pytest.param(lambda q: q["id"] == "x", lambda df: df["id"] == "x", 0, id="string_equals_absent"),
+        pytest.param(lambda q: q["id"].isin(["m", "y"]), lambda df: df["id"].isin(["m", "y"]), 2, id="string_isin"),
+        pytest.param(lambda q: q["id"] != "m", lambda df: df["id"] != "m", 2, id="string_not_equals"),
+        pytest.param(lambda q: q["num"].isin([7, 50]), lambda df: df["num"].isin([7, 50]), 1, id="numeric_isin"),
+        pytest.param(lambda q: q["num"] == 50, lambda df: df["num"] == 50, 0, id="numeric_equals_within_minmax"),
+    ],
+)
+def test_column_stats_bloom_filter_columns(
+    in_memory_version_store, clear_query_stats, column_stats_filtering_enabled, query_expr, pandas_expr, expected_reads
+):
+    lib = in_memory_version_store
+
+    # Unsorted values, so the min and max of each row slice span nearly every value of the other
+    df0 = pd.DataFrame({"id": ["a", "z", "m"], "num": [1, 100, 7]}, index=pd.date_range("2000-01-01", periods=3))
+    df1 = pd.DataFrame({"id": ["b", "y", "n"], "num": [2, 99, 8]}, index=pd.date_range("2000-01-04", periods=3))
+    lib.write(sym, df0)
+    lib.append(sym, df1)
+
+    # Bloom filters added to existing MINMAX stats are merged in to the same key
+    lib.create_column_stats_experimental(sym)
+    assert lib.get_column_stats_info_experimental(sym) == {"num": {"MINMAX"}}
+    lib.create_column_stats_experimental(sym, bloom_filter_columns=["id", "num"])
+    assert lib.get_column_stats_info_experimental(sym) == {"id": {"BLOOM"}, "num": {"MINMAX", "BLOOM"}}
+
+    qs.enable()
+    q = QueryBuilder()
+    q = q[query_expr(q)]
+    qs.reset_stats()
+    result = lib.read(sym, query_builder=q).data
+    table_data_reads = get_table_data_read_count()
+
+    full_df = pd.concat([df0, df1])
+    assert_frame_equal(full_df[pandas_expr(full_df)], result)
+    assert table_data_reads == expected_reads, f"Expected {expected_reads} TABLE_DATA read(s), got {table_data_reads}"
@@ -12,7 +12,8 @@ import pandas as pd
 from pandas import DataFrame
 
 from arcticdb.version_store.processing import QueryBuilder
-from arcticdb_ext.exceptions import InternalException, SchemaException
+from arcticdb.exceptions import ArcticNativeException
+from arcticdb_ext.exceptions import InternalException, SchemaException, UserInputException
 from arcticdb.util.test import (
     assert_frame_equal,
     generic_aggregation_test,
@@ -374,6 +375,32 @@ def test_aggregation_with_nones_and_nans_in_string_grouping_column(version_store
     generic_aggregation_test(lib, symbol, df, "grouping_column", {"to_sum": "sum"})
 
 
+def test_group_multiple_columns(lmdb_version_store_tiny_segment, any_output_format):
+    lib = lmdb_version_store_tiny_segment
+    lib._set_output_format_for_pipeline_tests(any_output_format)
+    symbol = "test_group_multiple_columns"
+    # Rows with a None or NaN in any grouping column are dropped, as in Pandas
+    df = DataFrame(
+        {
+            "symbol": ["A", "B", "A", "C", "B", "A", None, "C", "A", "B"],
+            "venue": [1.0, 2.0, 1.0, 1.0, 2.0, 2.0, 1.0, np.nan, 1.0, 2.0],
+            "side": ["BUY", "SELL", "SELL", "BUY", "SELL", "BUY", "BUY", "SELL", "BUY", "BUY"],
+            "quantity": np.arange(10),
+            "price": np.arange(10, dtype=np.float64) / 2,
+        }
+    )
+    lib.write(symbol, df, dynamic_strings=True)
+    generic_aggregation_test(lib, symbol, df, ["symbol", "venue", "side"], {"quantity": "sum", "price": "mean"})
+    generic_aggregation_test(lib, symbol, df, ["side", "symbol"], {"quantity": "count"})
+
+
+def test_group_multiple_columns_invalid():
+    with pytest.raises(ArcticNativeException):
+        QueryBuilder().groupby([])
+    with pytest.raises(UserInputException):
+        QueryBuilder().groupby(["symbol", "symbol"])
+
+
 def test_doctring_example_query_builder_groupby_max(lmdb_version_store_v1, any_output_format):
     lib = lmdb_version_store_v1
     lib._set_output_format_for_pipeline_tests(any_output_format)
@@ -24,6 +24,7 @@ EXPECTED = {
     "FAILED_STORAGE_LOG_ID": "__failed_storage_log__",
     "RECREATE_SYMBOL_ID": "__recreate__",
     "REFRESH_SYMBOL_ID": "__refresh__",
+    "VERSION_CHANGE_ID": "__version_change__",
 }
 
 
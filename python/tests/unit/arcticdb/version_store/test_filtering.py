@@ -907,6 +907,31 @@ def test_filter_column_slicing_different_segments(
     assert np.array_equal(expected, received)
 
 
+@pytest.mark.parametrize("store", ["lmdb_version_store_tiny_segment", "lmdb_version_store_tiny_segment_dynamic"])
+def test_filter_late_materialisation(request, store, any_output_format):
+    lib = request.getfixturevalue(store)
+    lib._set_output_format_for_pipeline_tests(any_output_format)
+    df = pd.DataFrame(
+        {"a": np.arange(0, 10), "b": np.arange(10, 20), "c": np.arange(20, 30), "d": np.arange(30, 40)},
+        index=np.arange(10),
+    )
+    symbol = "test_filter_late_materialisation"
+    lib.write(symbol, df)
+    with config_context("LateMaterialisation.Enabled", 1):
+        # Only the row slice holding c == 22 is read with its other columns
+        q = QueryBuilder()
+        q = q[q["c"] == 22]
+        assert_frame_equal(df.query("c == 22"), lib.read(symbol, query_builder=q).data)
+        q = QueryBuilder()
+        q = q[(q["c"] < 23) & (q["a"] > 0)]
+        expected = df.query("c < 23 & a > 0").loc[:, ["b", "d"]]
+        received = lib.read(symbol, columns=["b", "d"], query_builder=q).data
+        assert_frame_equal(expected, received)
+        q = QueryBuilder()
+        q = q[q["c"] > 100]
+        assert lib.read(symbol, query_builder=q).data.empty
+
+
 def test_filter_with_multi_index(lmdb_version_store_v1, any_output_format, column_stats_filtering_enabled_and_disabled):
     lib = lmdb_version_store_v1
     lib._set_output_format_for_pipeline_tests(any_output_format)